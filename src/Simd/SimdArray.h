@@ -37,13 +37,14 @@ namespace Simd
         SIMD_INLINE Array(size_t size_ = 0, bool clear = false, size_t align = SIMD_ALIGN)
             : data(0)
             , size(0)
+            , _shared(false)
         {
             Resize(size_, clear);
         }
 
         SIMD_INLINE ~Array()
         {
-            if (data)
+            if (data && !_shared)
                 Simd::Free(data);
         }
 
@@ -53,8 +54,10 @@ namespace Simd
             {
                 if (data)
                 {
-                    Simd::Free(data);
+                    if (!_shared)
+                        Simd::Free(data);
                     *(T**)&data = 0;
+                    _shared = false;
                 }
                 *(size_t*)&size = size_;
                 if (size_)
@@ -73,6 +76,23 @@ namespace Simd
         {
             Simd::Swap((T*&)data, (T*&)(array.data));
             Simd::Swap((size_t&)size, (size_t&)(array.size));
+            Simd::Swap((bool&)_shared, (bool&)(array._shared));
+        }
+
+        SIMD_INLINE bool Shared() const
+        {
+            return _shared;
+        }
+
+        SIMD_INLINE void Share(T * data_, size_t size_)
+        {
+            Resize(0);
+            if (data_ && size_)
+            {
+                *(T**)&data = data_;
+                *(size_t*)&size = size_;
+                _shared = true;
+            }
         }
 
         SIMD_INLINE T & operator[] (size_t i)
@@ -84,6 +104,9 @@ namespace Simd
         {
             return data[i];
         }
+
+    private:
+        bool _shared;
     };
 
     typedef Array<int8_t> Array8i;
@@ -27,6 +27,7 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdAvx1.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -2018,18 +2019,24 @@ namespace Simd
         {
             for (size_t b = 0; b < _batch; ++b)
             {
-                if (_bias)
+                Simd::Parallel(0, _count, [&](size_t thread, size_t begin, size_t end)
                 {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
-                }
-                else
-                {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
-                }
-                if (_param.activation)
-                    ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);
+                    if (_bias)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                            dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
+                    }
+                    else
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                            dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
+                    }
+                    if (_param.activation)
+                    {
+                        const float * params = _param.activation == ::SimdConvolutionActivationPrelu ? _params + begin : _params;
+                        ConvolutionBiasAndActivation(NULL, end - begin, 1, _param.activation, params, ::SimdFalse, dst + begin);
+                    }
+                }, _threadNumber);
                 src += _sizeS;
                 dst += _sizeD;
             }
@@ -2084,20 +2091,15 @@ namespace Simd
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
-            else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
-                return new SynetConvolution32fDepthwiseDotProduct(param);
-            else if (SynetConvolution32fWinograd::Preferable(param))
-                return new SynetConvolution32fWinograd(param);
-            else if (SynetConvolution32fGemmNT::Preferable(param))
-                return new SynetConvolution32fGemmNT(param);
-            else if (SynetConvolution32fDirectNchw::Preferable(param))
-                return new Avx::SynetConvolution32fDirectNchw(param);
-            else if (SynetConvolution32fNhwcDirect::Preferable(param))
-                return new SynetConvolution32fNhwcDirect(param);
-            else if (SynetConvolution32fDirectNhwc::Preferable(param))
-                return new SynetConvolution32fDirectNhwc(param);
-            else
-                return new SynetConvolution32fGemmNN(param);
+            Base::SynetConvolution32fAutotune autotune(param, "Avx");
+            autotune.Add<SynetConvolution32fDepthwiseDotProduct>("DepthwiseDotProduct", SynetConvolution32fDepthwiseDotProduct::Supported(param), SynetConvolution32fDepthwiseDotProduct::Preferable(param));
+            autotune.Add<SynetConvolution32fWinograd>("Winograd", SynetConvolution32fWinograd::Supported(param), SynetConvolution32fWinograd::Preferable(param));
+            autotune.Add<SynetConvolution32fGemmNT>("GemmNT", SynetConvolution32fGemmNT::Supported(param), SynetConvolution32fGemmNT::Preferable(param));
+            autotune.Add<Avx::SynetConvolution32fDirectNchw>("DirectNchw", SynetConvolution32fDirectNchw::Supported(param), SynetConvolution32fDirectNchw::Preferable(param));
+            autotune.Add<SynetConvolution32fNhwcDirect>("NhwcDirect", SynetConvolution32fNhwcDirect::Supported(param), SynetConvolution32fNhwcDirect::Preferable(param));
+            autotune.Add<SynetConvolution32fDirectNhwc>("DirectNhwc", SynetConvolution32fDirectNhwc::Supported(param), SynetConvolution32fDirectNhwc::Preferable(param));
+            autotune.Add<SynetConvolution32fGemmNN>("GemmNN", true, true);
+            return autotune.Select();
         }
     }
 #endif//SIMD_AVX_ENABLE
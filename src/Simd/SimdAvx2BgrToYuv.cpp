@@ -237,6 +237,66 @@ namespace Simd
             else
                 BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
+
+        template <bool align, bool uyvy> SIMD_INLINE void BgrToYuyv422(const uint8_t * bgr, uint8_t * yuyv)
+        {
+            __m256i blue[2], green[2], red[2], y[2];
+
+            LoadBgr<align>((__m256i*)bgr + 0, blue[0], green[0], red[0]);
+            y[0] = BgrToY8(blue[0], green[0], red[0]);
+
+            LoadBgr<align>((__m256i*)bgr + 3, blue[1], green[1], red[1]);
+            y[1] = BgrToY8(blue[1], green[1], red[1]);
+
+            Average16(blue[0]);
+            Average16(blue[1]);
+            Average16(green[0]);
+            Average16(green[1]);
+            Average16(red[0]);
+            Average16(red[1]);
+
+            __m256i u = PackI16ToU8(BgrToU16(blue[0], green[0], red[0]), BgrToU16(blue[1], green[1], red[1]));
+            __m256i v = PackI16ToU8(BgrToV16(blue[0], green[0], red[0]), BgrToV16(blue[1], green[1], red[1]));
+            StoreYuyv<align, uyvy>(yuyv, y, u, v);
+        }
+
+        template <bool align, bool uyvy> void BgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            assert((width % 2 == 0) && (width >= DA));
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(yuyv) && Aligned(yuyvStride));
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                    BgrToYuyv422<align, uyvy>(bgr + 3 * col, yuyv + 2 * col);
+                if (tail)
+                {
+                    size_t col = width - DA;
+                    BgrToYuyv422<false, uyvy>(bgr + 3 * col, yuyv + 2 * col);
+                }
+                bgr += bgrStride;
+                yuyv += yuyvStride;
+            }
+        }
+
+        void BgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(yuyv) && Aligned(yuyvStride))
+                BgrToYuyv422<true, false>(bgr, bgrStride, width, height, yuyv, yuyvStride);
+            else
+                BgrToYuyv422<false, false>(bgr, bgrStride, width, height, yuyv, yuyvStride);
+        }
+
+        void BgrToUyvy422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(uyvy) && Aligned(uyvyStride))
+                BgrToYuyv422<true, true>(bgr, bgrStride, width, height, uyvy, uyvyStride);
+            else
+                BgrToYuyv422<false, true>(bgr, bgrStride, width, height, uyvy, uyvyStride);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -336,6 +336,58 @@ namespace Simd
             else
                 BgraToYuva420p<false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
         }
+
+        template <bool align, bool uyvy> SIMD_INLINE void BgraToYuyv422(const uint8_t * bgra, uint8_t * yuyv)
+        {
+            __m256i _b16_r16[2][2], _g16_1[2][2], y[2];
+            y[0] = LoadAndConvertY8<align>((__m256i*)bgra + 0, _b16_r16[0], _g16_1[0]);
+            y[1] = LoadAndConvertY8<align>((__m256i*)bgra + 4, _b16_r16[1], _g16_1[1]);
+
+            Average16(_b16_r16);
+            Average16(_g16_1);
+
+            __m256i u = PackI16ToU8(ConvertU16(_b16_r16[0], _g16_1[0]), ConvertU16(_b16_r16[1], _g16_1[1]));
+            __m256i v = PackI16ToU8(ConvertV16(_b16_r16[0], _g16_1[0]), ConvertV16(_b16_r16[1], _g16_1[1]));
+            StoreYuyv<align, uyvy>(yuyv, y, u, v);
+        }
+
+        template <bool align, bool uyvy> void BgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            assert((width % 2 == 0) && (width >= DA));
+            if (align)
+                assert(Aligned(bgra) && Aligned(bgraStride) && Aligned(yuyv) && Aligned(yuyvStride));
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                    BgraToYuyv422<align, uyvy>(bgra + 4 * col, yuyv + 2 * col);
+                if (tail)
+                {
+                    size_t col = width - DA;
+                    BgraToYuyv422<false, uyvy>(bgra + 4 * col, yuyv + 2 * col);
+                }
+                bgra += bgraStride;
+                yuyv += yuyvStride;
+            }
+        }
+
+        void BgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            if (Aligned(bgra) && Aligned(bgraStride) && Aligned(yuyv) && Aligned(yuyvStride))
+                BgraToYuyv422<true, false>(bgra, bgraStride, width, height, yuyv, yuyvStride);
+            else
+                BgraToYuyv422<false, false>(bgra, bgraStride, width, height, yuyv, yuyvStride);
+        }
+
+        void BgraToUyvy422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+        {
+            if (Aligned(bgra) && Aligned(bgraStride) && Aligned(uyvy) && Aligned(uyvyStride))
+                BgraToYuyv422<true, true>(bgra, bgraStride, width, height, uyvy, uyvyStride);
+            else
+                BgraToYuyv422<false, true>(bgra, bgraStride, width, height, uyvy, uyvyStride);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
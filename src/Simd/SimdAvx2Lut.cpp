@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i Lut8u(const uint8_t * src, const int32_t * table, __m256i offset)
+        {
+            __m256i index = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src)), offset);
+            return _mm256_i32gather_epi32(table, index, 4);
+        }
+
+        template<size_t channels> SIMD_INLINE void Lut8u(const uint8_t * src, const int32_t * table, const __m256i * offset, uint8_t * dst)
+        {
+            for (size_t i = 0; i < channels; ++i, src += A, dst += A, offset += 4)
+            {
+                __m256i lo = PackU32ToI16(Lut8u(src + 0 * F, table, offset[0]), Lut8u(src + 1 * F, table, offset[1]));
+                __m256i hi = PackU32ToI16(Lut8u(src + 2 * F, table, offset[2]), Lut8u(src + 3 * F, table, offset[3]));
+                _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(lo, hi));
+            }
+        }
+
+        template<size_t channels> void Lut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A);
+
+            int32_t _table[channels * LUT8U_SIZE], _offset[channels * A];
+            for (size_t i = 0; i < channels * LUT8U_SIZE; ++i)
+                _table[i] = table[i];
+            for (size_t i = 0; i < channels * A; ++i)
+                _offset[i] = int32_t(i % channels * LUT8U_SIZE);
+            __m256i offset[channels * 4];
+            for (size_t i = 0; i < channels * 4; ++i)
+                offset[i] = _mm256_loadu_si256((__m256i*)(_offset + i * F));
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Lut8u<channels>(src + col * channels, _table, offset, dst + col * channels);
+                if (widthA < width)
+                    Base::Lut8u(src + widthA * channels, srcStride, width - widthA, 1, channels, table, dst + widthA * channels, dstStride);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Lut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, const uint8_t * table, uint8_t * dst, size_t dstStride)
+        {
+            switch (channels)
+            {
+            case 1: Lut8u<1>(src, srcStride, width, height, table, dst, dstStride); break;
+            case 3: Lut8u<3>(src, srcStride, width, height, table, dst, dstStride); break;
+            case 4: Lut8u<4>(src, srcStride, width, height, table, dst, dstStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256i Lut16uTo8u(const uint8_t * src, const uint8_t * table, __m256i last, __m256i edge)
+        {
+            __m256i value = _mm256_min_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)src)), last);
+            __m256i index = _mm256_min_epi32(value, edge);
+            __m256i shift = _mm256_slli_epi32(_mm256_sub_epi32(value, index), 3);
+            __m256i gather = _mm256_i32gather_epi32((const int*)table, index, 1);
+            return _mm256_and_si256(_mm256_srlv_epi32(gather, shift), K32_000000FF);
+        }
+
+        void Lut16uTo8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, size_t bits, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A && bits >= 2 && bits <= 16);
+
+            __m256i last = _mm256_set1_epi32((1 << bits) - 1);
+            __m256i edge = _mm256_set1_epi32((1 << bits) - 4);
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                {
+                    const uint8_t * s = src + col * 2;
+                    __m256i lo = PackU32ToI16(Lut16uTo8u(s + 0 * HA, table, last, edge), Lut16uTo8u(s + 1 * HA, table, last, edge));
+                    __m256i hi = PackU32ToI16(Lut16uTo8u(s + 2 * HA, table, last, edge), Lut16uTo8u(s + 3 * HA, table, last, edge));
+                    _mm256_storeu_si256((__m256i*)(dst + col), PackI16ToU8(lo, hi));
+                }
+                if (widthA < width)
+                    Base::Lut16uTo8u(src + widthA * 2, srcStride, width - widthA, 1, table, bits, dst + widthA, dstStride);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
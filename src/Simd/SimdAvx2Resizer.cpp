@@ -41,7 +41,7 @@ namespace Simd
         {
             if (_ax.data)
                 return;
-            if (_param.channels == 1 && _param.srcW < 4 * _param.dstW)
+            if (_param.channels == 1 && _param.srcW < 4 * _param.dstW && _param.srcW >= A)
                 _blocks = BlockCountMax(A);
             float scale = (float)_param.srcW / _param.dstW;
             _ax.Resize(AlignHi(_param.dstW, A) * _param.channels * 2, false, _param.align);
@@ -241,7 +241,7 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -290,7 +290,7 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -465,7 +465,11 @@ namespace Simd
                 src += N, sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(zero)));
             sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(-next)));
             __m128i res = _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(Base::AREA_ROUND)), Base::AREA_SHIFT);
-            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(res, Sse2::K_ZERO), Sse2::K_ZERO));
+            int32_t val = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(res, Sse2::K_ZERO), Sse2::K_ZERO));
+            if (N == 4)
+                *(int32_t*)dst = val;
+            else
+                *(int16_t*)dst = int16_t(val), dst[2] = uint8_t(val >> 16);
         }
 
         template<> SIMD_INLINE void ResizerByteAreaResult<4>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint8_t * dst)
@@ -483,7 +487,8 @@ namespace Simd
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[_yBeg] * srcStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += rowRest)
             {
                 int32_t * buf = _by.data;
                 size_t yn = iy[dy + 1] - iy[dy];
@@ -524,7 +529,7 @@ namespace Simd
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, Avx::F);
             size_t rsh = AlignLo(rs, Sse::F);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -638,6 +643,368 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        //---------------------------------------------------------------------
+
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Base::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowV(const uint8_t * src, size_t stride, const int16_t * ay, size_t ky, int16_t * dst)
+        {
+            static const __m256i ROUND = SIMD_MM256_SET1_EPI32(Base::FILTER_ROW_ROUND);
+            __m256i sum0 = _mm256_setzero_si256(), sum1 = _mm256_setzero_si256();
+            size_t k = 0;
+            for (; k + 1 < ky; k += 2, src += 2 * stride)
+            {
+                __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+                __m256i s1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(src + stride)));
+                __m256i alpha = SetInt16(ay[k + 0], ay[k + 1]);
+                sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), alpha));
+                sum1 = _mm256_add_epi32(sum1, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), alpha));
+            }
+            if (k < ky)
+            {
+                __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+                __m256i alpha = SetInt16(ay[k], 0);
+                sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, K_ZERO), alpha));
+                sum1 = _mm256_add_epi32(sum1, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, K_ZERO), alpha));
+            }
+            sum0 = _mm256_srai_epi32(_mm256_add_epi32(sum0, ROUND), Base::FILTER_ROW_SHIFT);
+            sum1 = _mm256_srai_epi32(_mm256_add_epi32(sum1, ROUND), Base::FILTER_ROW_SHIFT);
+            _mm256_storeu_si256((__m256i*)dst, _mm256_packs_epi32(sum0, sum1));
+        }
+
+        SIMD_INLINE __m256i LoadHalves(const int16_t * p0, const int16_t * p1)
+        {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i*)p0)), _mm_loadu_si128((__m128i*)p1), 1);
+        }
+
+        SIMD_INLINE __m256i ResizerByteFilterSumH(const int16_t * src0, const int16_t * src1, const int16_t * ax0, const int16_t * ax1, size_t kx)
+        {
+            __m256i sum = _mm256_setzero_si256();
+            for (size_t k = 0; k < kx; k += Sse2::HA)
+                sum = _mm256_add_epi32(sum, _mm256_madd_epi16(LoadHalves(src0 + k, src1 + k), LoadHalves(ax0 + k, ax1 + k)));
+            return sum;
+        }
+
+        void ResizerByteFilter::RunH(const int16_t * src, uint8_t * dst)
+        {
+            static const __m256i ROUND = SIMD_MM256_SET1_EPI32(Base::FILTER_ROUND);
+            size_t rd = _param.dstW * _param.channels, rd8 = AlignLo(rd, 8), kx = _kx;
+            size_t dx = 0;
+            for (; dx < rd8; dx += 8)
+            {
+                const int16_t * ax = _ax.data + dx * kx;
+                const int32_t * ix = _ix.data + dx;
+                __m256i s0 = ResizerByteFilterSumH(src + ix[0], src + ix[4], ax + 0 * kx, ax + 4 * kx, kx);
+                __m256i s1 = ResizerByteFilterSumH(src + ix[1], src + ix[5], ax + 1 * kx, ax + 5 * kx, kx);
+                __m256i s2 = ResizerByteFilterSumH(src + ix[2], src + ix[6], ax + 2 * kx, ax + 6 * kx, kx);
+                __m256i s3 = ResizerByteFilterSumH(src + ix[3], src + ix[7], ax + 3 * kx, ax + 7 * kx, kx);
+                __m256i sum = _mm256_hadd_epi32(_mm256_hadd_epi32(s0, s1), _mm256_hadd_epi32(s2, s3));
+                sum = _mm256_srai_epi32(_mm256_add_epi32(sum, ROUND), Base::FILTER_SHIFT);
+                sum = _mm256_packus_epi16(_mm256_packs_epi32(sum, K_ZERO), K_ZERO);
+                _mm_storel_epi64((__m128i*)(dst + dx), _mm_unpacklo_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)));
+            }
+            for (; dx < rd; ++dx)
+            {
+                const int16_t * pb = src + _ix[dx];
+                const int16_t * ax = _ax.data + dx * kx;
+                int32_t sum = 0;
+                for (size_t k = 0; k < kx; ++k)
+                    sum += pb[k] * ax[k];
+                dst[dx] = Base::RestrictRange((sum + Base::FILTER_ROUND) >> Base::FILTER_SHIFT, 0, 255);
+            }
+        }
+
+        void ResizerByteFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t rs = _param.srcW * _param.channels;
+            if (rs < HA)
+            {
+                Base::ResizerByteFilter::Run(src, srcStride, dst, dstStride);
+                return;
+            }
+            size_t rsHA = AlignLo(rs, HA);
+            int16_t * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const uint8_t * ps = src + _iy[dy] * srcStride;
+                const int16_t * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rsHA; sx += HA)
+                    ResizerByteFilterRowV(ps + sx, srcStride, ay, _ky, bx + sx);
+                if (rsHA < rs)
+                    ResizerByteFilterRowV(ps + rs - HA, srcStride, ay, _ky, bx + rs - HA);
+                RunH(bx, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Base::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowV(const float * src, size_t stride, const float * ay, size_t ky, float * dst)
+        {
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t k = 0; k < ky; ++k, src += stride)
+                sum = _mm256_fmadd_ps(_mm256_loadu_ps(src), _mm256_set1_ps(ay[k]), sum);
+            _mm256_storeu_ps(dst, sum);
+        }
+
+        SIMD_INLINE __m256 ResizerFloatFilterSumH(const float * src0, const float * src1, const float * ax0, const float * ax1, size_t kx)
+        {
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t k = 0; k < kx; k += Sse::F)
+                sum = _mm256_fmadd_ps(Avx::Load<false>(src0 + k, src1 + k), Avx::Load<false>(ax0 + k, ax1 + k), sum);
+            return sum;
+        }
+
+        void ResizerFloatFilter::RunH(const float * src, float * dst)
+        {
+            size_t rd = _param.dstW * _param.channels, rdF = AlignLo(rd, F), kx = _kx;
+            size_t dx = 0;
+            for (; dx < rdF; dx += F)
+            {
+                const float * ax = _ax.data + dx * kx;
+                const int32_t * ix = _ix.data + dx;
+                __m256 s0 = ResizerFloatFilterSumH(src + ix[0], src + ix[4], ax + 0 * kx, ax + 4 * kx, kx);
+                __m256 s1 = ResizerFloatFilterSumH(src + ix[1], src + ix[5], ax + 1 * kx, ax + 5 * kx, kx);
+                __m256 s2 = ResizerFloatFilterSumH(src + ix[2], src + ix[6], ax + 2 * kx, ax + 6 * kx, kx);
+                __m256 s3 = ResizerFloatFilterSumH(src + ix[3], src + ix[7], ax + 3 * kx, ax + 7 * kx, kx);
+                _mm256_storeu_ps(dst + dx, _mm256_hadd_ps(_mm256_hadd_ps(s0, s1), _mm256_hadd_ps(s2, s3)));
+            }
+            for (; dx < rd; ++dx)
+            {
+                const float * pb = src + _ix[dx];
+                const float * ax = _ax.data + dx * kx;
+                float sum = 0.0f;
+                for (size_t k = 0; k < kx; ++k)
+                    sum += pb[k] * ax[k];
+                dst[dx] = sum;
+            }
+        }
+
+        void ResizerFloatFilter::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            size_t rs = _param.srcW * _param.channels;
+            if (rs < F)
+            {
+                Base::ResizerFloatFilter::Run(src, srcStride, dst, dstStride);
+                return;
+            }
+            size_t rsF = AlignLo(rs, F);
+            float * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const float * ps = src + _iy[dy] * srcStride;
+                const float * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rsF; sx += F)
+                    ResizerFloatFilterRowV(ps + sx, srcStride, ay, _ky, bx + sx);
+                if (rsF < rs)
+                    ResizerFloatFilterRowV(ps + rs - F, srcStride, ay, _ky, bx + rs - F);
+                RunH(bx, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Base::ResizerShortBilinear(param)
+        {
+        }
+
+        SIMD_INLINE __m256i ResizerShortBilinearRow(__m256i s0, __m256i s1, __m256i a)
+        {
+            __m256i d = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s1, s0), a), _mm256_set1_epi32(Base::SHORT_LINEAR_ROW_ROUND)), Base::SHORT_LINEAR_ROW_SHIFT);
+            return _mm256_add_epi32(_mm256_slli_epi32(s0, Base::SHORT_LINEAR_BITS), d);
+        }
+
+        SIMD_INLINE __m256i ResizerShortBilinearCol(const int32_t * r0, const int32_t * r1, __m256i a)
+        {
+            __m256i s0 = _mm256_loadu_si256((__m256i*)r0);
+            __m256i d = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(_mm256_loadu_si256((__m256i*)r1), s0), a), _mm256_set1_epi32(Base::SHORT_LINEAR_COL_ROUND)), Base::SHORT_LINEAR_SHIFT);
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_add_epi32(s0, d), _mm256_set1_epi32(Base::SHORT_LINEAR_ROUND)), Base::SHORT_LINEAR_BITS);
+        }
+
+        void ResizerShortBilinear::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            size_t rs8 = AlignLo(rs, 8), rs16 = AlignLo(rs, 16);
+            int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    int32_t * pb = pbx[k];
+                    const uint16_t * ps = src + (sy + k) * srcStride;
+                    const int32_t * ix = _ix.data;
+                    size_t dx = 0;
+                    if (cn == 1)
+                    {
+                        for (; dx < rs8; dx += 8)
+                        {
+                            __m256i s01 = _mm256_i32gather_epi32((int32_t*)ps, _mm256_loadu_si256((__m256i*)(ix + dx)), 2);
+                            __m256i s0 = _mm256_and_si256(s01, K32_0000FFFF);
+                            __m256i s1 = _mm256_srli_epi32(s01, 16);
+                            _mm256_storeu_si256((__m256i*)(pb + dx), ResizerShortBilinearRow(s0, s1, _mm256_loadu_si256((__m256i*)(_ax.data + dx))));
+                        }
+                    }
+                    else
+                    {
+                        __m256i _cn = _mm256_set1_epi32((int32_t)cn);
+                        for (; dx < rs8; dx += 8)
+                        {
+                            __m256i i0 = _mm256_loadu_si256((__m256i*)(ix + dx));
+                            __m256i s0 = _mm256_and_si256(_mm256_i32gather_epi32((int32_t*)ps, i0, 2), K32_0000FFFF);
+                            __m256i s1 = _mm256_srli_epi32(_mm256_i32gather_epi32((int32_t*)(ps - 1), _mm256_add_epi32(i0, _cn), 2), 16);
+                            _mm256_storeu_si256((__m256i*)(pb + dx), ResizerShortBilinearRow(s0, s1, _mm256_loadu_si256((__m256i*)(_ax.data + dx))));
+                        }
+                    }
+                    for (; dx < rs; dx++)
+                        pb[dx] = Base::ResizerShortBilinearRow(ps[ix[dx]], ps[ix[dx] + cn], _ax[dx]);
+                }
+
+                __m256i fy = _mm256_set1_epi32(_ay[dy]);
+                size_t dx = 0;
+                for (; dx < rs16; dx += 16)
+                {
+                    __m256i d0 = ResizerShortBilinearCol(pbx[0] + dx + 0, pbx[1] + dx + 0, fy);
+                    __m256i d1 = ResizerShortBilinearCol(pbx[0] + dx + 8, pbx[1] + dx + 8, fy);
+                    _mm256_storeu_si256((__m256i*)(dst + dx), PackU32ToI16(d0, d1));
+                }
+                for (; dx < rs8; dx += 8)
+                    _mm_storeu_si128((__m128i*)(dst + dx), _mm256_castsi256_si128(PackU32ToI16(ResizerShortBilinearCol(pbx[0] + dx, pbx[1] + dx, fy), K_ZERO)));
+                for (; dx < rs; dx++)
+                    dst[dx] = (uint16_t)Base::ResizerShortBilinearCol(pbx[0][dx], pbx[1][dx], _ay[dy]);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Base::ResizerShortArea(param)
+        {
+        }
+
+        template<UpdateType update> SIMD_INLINE void ResizerShortAreaRowUpdate(const uint16_t * src, size_t size, size_t size16, int32_t a, int32_t * dst)
+        {
+            __m256i _a = _mm256_set1_epi32(a);
+            size_t i = 0;
+            for (; i < size16; i += 16)
+            {
+                __m128i s0 = _mm_loadu_si128((__m128i*)(src + i) + 0);
+                __m128i s1 = _mm_loadu_si128((__m128i*)(src + i) + 1);
+                Update<update, false>(dst + i + 0, _mm256_mullo_epi32(_mm256_cvtepu16_epi32(s0), _a));
+                Update<update, false>(dst + i + 8, _mm256_mullo_epi32(_mm256_cvtepu16_epi32(s1), _a));
+            }
+            for (; i < size; ++i)
+                dst[i] = (update == UpdateAdd ? dst[i] : 0) + src[i] * a;
+        }
+
+        SIMD_INLINE void ResizerShortAreaRowSum(const uint16_t * src, size_t stride, size_t count, size_t size, int32_t curr, int32_t zero, int32_t next, int32_t * dst)
+        {
+            size_t size16 = AlignLo(size, 16);
+            ResizerShortAreaRowUpdate<UpdateSet>(src, size, size16, curr, dst);
+            for (size_t i = 0; i < count; ++i)
+                src += stride, ResizerShortAreaRowUpdate<UpdateAdd>(src, size, size16, zero, dst);
+            ResizerShortAreaRowUpdate<UpdateAdd>(src, size, size16, -next, dst);
+            __m256i round = _mm256_set1_epi32(Base::SHORT_AREA_ROW_ROUND);
+            size_t size8 = AlignLo(size, 8), i = 0;
+            for (; i < size8; i += 8)
+                _mm256_storeu_si256((__m256i*)(dst + i), _mm256_srai_epi32(_mm256_add_epi32(_mm256_loadu_si256((__m256i*)(dst + i)), round), Base::SHORT_AREA_ROW_SHIFT));
+            for (; i < size; ++i)
+                dst[i] = (dst[i] + Base::SHORT_AREA_ROW_ROUND) >> Base::SHORT_AREA_ROW_SHIFT;
+        }
+
+        template<size_t N> SIMD_INLINE void ResizerShortAreaResult(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            int32_t sum[N];
+            for (size_t c = 0; c < N; ++c)
+                sum[c] = src[c] * curr;
+            for (size_t i = 0; i < count; ++i)
+            {
+                src += N;
+                for (size_t c = 0; c < N; ++c)
+                    sum[c] += src[c] * zero;
+            }
+            for (size_t c = 0; c < N; ++c)
+                dst[c] = (uint16_t)RestrictRange((sum[c] - src[c] * next + Base::SHORT_AREA_ROUND) >> Base::SHORT_AREA_SHIFT, 0, 0xFFFF);
+        }
+
+        template<size_t N> SIMD_INLINE void ResizerShortAreaResult34(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            __m128i sum = _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(curr));
+            for (size_t i = 0; i < count; ++i)
+                src += N, sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(zero)));
+            sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(-next)));
+            __m128i res = _mm_packus_epi32(_mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(Base::SHORT_AREA_ROUND)), Base::SHORT_AREA_SHIFT), Sse2::K_ZERO);
+            if (N == 4)
+                _mm_storel_epi64((__m128i*)dst, res);
+            else
+                *(int32_t*)dst = _mm_cvtsi128_si32(res), dst[2] = (uint16_t)_mm_extract_epi16(res, 2);
+        }
+
+        template<> SIMD_INLINE void ResizerShortAreaResult<4>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            ResizerShortAreaResult34<4>(src, count, curr, zero, next, dst);
+        }
+
+        template<> SIMD_INLINE void ResizerShortAreaResult<3>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            ResizerShortAreaResult34<3>(src, count, curr, zero, next, dst);
+        }
+
+        template<size_t N> void ResizerShortArea::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            size_t dstW = _param.dstW, rowSize = _param.srcW * N;
+            const int32_t * iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data, * ty = _ty.data, * tx = _tx.data;
+            int32_t ay0 = ay[0], ax0 = ax[0];
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const int32_t * buf = _by.data;
+                size_t yn = iy[dy + 1] - iy[dy];
+                ResizerShortAreaRowSum(src + iy[dy] * srcStride, srcStride, yn, rowSize, ay[dy], ay0, ty[dy], _by.data);
+                for (size_t dx = 0; dx < dstW; dx++)
+                {
+                    size_t xn = ix[dx + 1] - ix[dx];
+                    ResizerShortAreaResult<N>(buf, xn, ax[dx], ax0, tx[dx], dst + dx * N), buf += xn * N;
+                }
+            }
+        }
+
+        void ResizerShortArea::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            switch (_param.channels)
+            {
+            case 1: Run<1>(src, srcStride, dst, dstStride); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m256i));
@@ -647,6 +1014,14 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
+            else if (param.IsShortBilinear())
+                return new ResizerShortBilinear(param);
+            else if (param.IsShortArea())
+                return new ResizerShortArea(param);
             else
                 return Avx::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
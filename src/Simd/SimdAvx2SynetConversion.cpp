@@ -25,8 +25,10 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdConversion.h"
 #include "Simd/SimdSse41.h"
+#include "Simd/SimdAvx2.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetSetInput.h"
 #include "Simd/SimdExtract.h"
 
 namespace Simd
@@ -536,6 +538,317 @@ namespace Simd
             default: assert(0);
             }
         }
+
+        //---------------------------------------------------------------------
+
+        const __m256i K32_YUV10_MAX = SIMD_MM256_SET1_EPI32(0x3FF);
+
+        template<int part> SIMD_INLINE __m256 Yuv10ToFloat(__m256i lo, __m256i hi, __m256 scale, __m256 shift)
+        {
+            __m256i value = _mm256_permute2x128_si256(lo, hi, part ? 0x31 : 0x20);
+            value = _mm256_min_epi32(_mm256_max_epi32(value, K_ZERO), K32_YUV10_MAX);
+            return _mm256_fmadd_ps(_mm256_cvtepi32_ps(value), scale, shift);
+        }
+
+        template <class T> SIMD_INLINE void Yuv10ToGray(__m256i y16, __m256 scale, __m256 shift, float * dst)
+        {
+            __m256i y = AdjustY16<T>(y16);
+            __m256i g0 = AdjustedYuvToBlue32<T>(_mm256_unpacklo_epi16(y, K16_0001), K_ZERO);
+            __m256i g1 = AdjustedYuvToBlue32<T>(_mm256_unpackhi_epi16(y, K16_0001), K_ZERO);
+            Avx::Store<false>(dst + 0, Yuv10ToFloat<0>(g0, g1, scale, shift));
+            Avx::Store<false>(dst + F, Yuv10ToFloat<1>(g0, g1, scale, shift));
+        }
+
+        template <class T> SIMD_INLINE void Yuv10ToBgr(__m256i y16, __m256i u16, __m256i v16, const __m256 * scale, const __m256 * shift, __m256 * blue, __m256 * green, __m256 * red)
+        {
+            __m256i y = AdjustY16<T>(y16), u = AdjustUV16<T>(u16), v = AdjustUV16<T>(v16);
+            __m256i y0 = _mm256_unpacklo_epi16(y, K16_0001), y1 = _mm256_unpackhi_epi16(y, K16_0001);
+            __m256i b0 = AdjustedYuvToBlue32<T>(y0, _mm256_unpacklo_epi16(u, K_ZERO));
+            __m256i b1 = AdjustedYuvToBlue32<T>(y1, _mm256_unpackhi_epi16(u, K_ZERO));
+            blue[0] = Yuv10ToFloat<0>(b0, b1, scale[0], shift[0]);
+            blue[1] = Yuv10ToFloat<1>(b0, b1, scale[0], shift[0]);
+            __m256i g0 = AdjustedYuvToGreen32<T>(y0, _mm256_unpacklo_epi16(u, v));
+            __m256i g1 = AdjustedYuvToGreen32<T>(y1, _mm256_unpackhi_epi16(u, v));
+            green[0] = Yuv10ToFloat<0>(g0, g1, scale[1], shift[1]);
+            green[1] = Yuv10ToFloat<1>(g0, g1, scale[1], shift[1]);
+            __m256i r0 = AdjustedYuvToRed32<T>(y0, _mm256_unpacklo_epi16(v, K_ZERO));
+            __m256i r1 = AdjustedYuvToRed32<T>(y1, _mm256_unpackhi_epi16(v, K_ZERO));
+            red[0] = Yuv10ToFloat<0>(r0, r1, scale[2], shift[2]);
+            red[1] = Yuv10ToFloat<1>(r0, r1, scale[2], shift[2]);
+        }
+
+        const __m256i K32_NHWC3_0 = SIMD_MM256_SETR_EPI32(0, 0, 0, 1, 1, 1, 2, 2);
+        const __m256i K32_NHWC3_1 = SIMD_MM256_SETR_EPI32(2, 3, 3, 3, 4, 4, 4, 5);
+        const __m256i K32_NHWC3_2 = SIMD_MM256_SETR_EPI32(5, 5, 6, 6, 6, 7, 7, 7);
+
+        SIMD_INLINE void StoreNhwc3(float * dst, __m256 blue, __m256 green, __m256 red)
+        {
+            Avx::Store<false>(dst + 0 * F, _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(blue, K32_NHWC3_0),
+                _mm256_permutevar8x32_ps(green, K32_NHWC3_0), 0x92), _mm256_permutevar8x32_ps(red, K32_NHWC3_0), 0x24));
+            Avx::Store<false>(dst + 1 * F, _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(blue, K32_NHWC3_1),
+                _mm256_permutevar8x32_ps(green, K32_NHWC3_1), 0x24), _mm256_permutevar8x32_ps(red, K32_NHWC3_1), 0x49));
+            Avx::Store<false>(dst + 2 * F, _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(blue, K32_NHWC3_2),
+                _mm256_permutevar8x32_ps(green, K32_NHWC3_2), 0x49), _mm256_permutevar8x32_ps(red, K32_NHWC3_2), 0x92));
+        }
+
+        template <class T, SimdTensorFormatType format> SIMD_INLINE void SynetSetInputP010Bgr(const uint8_t * y, const __m256i * u16, const __m256i * v16,
+            const __m256 * scale, const __m256 * shift, float * dst, size_t size)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m256 b[2], g[2], r[2];
+                Yuv10ToBgr<T>(LoadY10<false, true>(y + i * A), u16[i], v16[i], scale, shift, b, g, r);
+                if (format == SimdTensorFormatNchw)
+                {
+                    float * dst0 = dst + i * HA;
+                    Avx::Store<false>(dst0 + 0 * size + 0, b[0]);
+                    Avx::Store<false>(dst0 + 0 * size + F, b[1]);
+                    Avx::Store<false>(dst0 + 1 * size + 0, g[0]);
+                    Avx::Store<false>(dst0 + 1 * size + F, g[1]);
+                    Avx::Store<false>(dst0 + 2 * size + 0, r[0]);
+                    Avx::Store<false>(dst0 + 2 * size + F, r[1]);
+                }
+                else
+                {
+                    StoreNhwc3(dst + 3 * i * HA + 0 * F, b[0], g[0], r[0]);
+                    StoreNhwc3(dst + 3 * i * HA + 3 * F, b[1], g[1], r[1]);
+                }
+            }
+        }
+
+        template <class T, SimdTensorFormatType format> void SynetSetInputP010Bgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, const __m256 * scale, const __m256 * shift, float * dst)
+        {
+            size_t size = width * height, aligned = AlignLo(width, A), step = format == SimdTensorFormatNchw ? 1 : 3;
+            __m256i u16[2], v16[2];
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < aligned; col += A)
+                {
+                    LoadP010Uv<false>(uv + 2 * col, u16, v16);
+                    SynetSetInputP010Bgr<T, format>(y + 2 * col, u16, v16, scale, shift, dst + step * col, size);
+                }
+                if (aligned < width)
+                {
+                    size_t col = width - A;
+                    LoadP010Uv<false>(uv + 2 * col, u16, v16);
+                    SynetSetInputP010Bgr<T, format>(y + 2 * col, u16, v16, scale, shift, dst + step * col, size);
+                }
+                y += yStride;
+                if (row & 1)
+                    uv += uvStride;
+                dst += step * width;
+            }
+        }
+
+        template <class T> void SynetSetInputP010Gray(const uint8_t * y, size_t yStride, size_t width, size_t height, __m256 scale, __m256 shift, float * dst)
+        {
+            size_t aligned = AlignLo(width, HA);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < aligned; col += HA)
+                    Yuv10ToGray<T>(LoadY10<false, true>(y + 2 * col), scale, shift, dst + col);
+                if (aligned < width)
+                    Yuv10ToGray<T>(LoadY10<false, true>(y + 2 * (width - HA)), scale, shift, dst + width - HA);
+                y += yStride;
+                dst += width;
+            }
+        }
+
+        template <class T> void SynetSetInputP010(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            const float * scale, const float * shift, float * dst, size_t channels, SimdTensorFormatType format)
+        {
+            typedef Base::Yuv10<T, 10> Y10;
+            __m256 _scale[3], _shift[3];
+            for (size_t i = 0; i < channels; ++i)
+            {
+                _scale[i] = _mm256_set1_ps(scale[i]);
+                _shift[i] = _mm256_set1_ps(shift[i]);
+            }
+            if (channels == 1)
+                SynetSetInputP010Gray<Y10>(y, yStride, width, height, _scale[0], _shift[0], dst);
+            else if (format == SimdTensorFormatNchw)
+                SynetSetInputP010Bgr<Y10, SimdTensorFormatNchw>(y, yStride, uv, uvStride, width, height, _scale, _shift, dst);
+            else
+                SynetSetInputP010Bgr<Y10, SimdTensorFormatNhwc>(y, yStride, uv, uvStride, width, height, _scale, _shift, dst);
+        }
+
+        void SynetSetInputP010(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType,
+            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (channels == 1 || channels == 3));
+
+            float scale[3];
+            for (size_t i = 0; i < channels; ++i)
+                scale[i] = (upper[i] - lower[i]) / 1023.0f;
+            switch (yuvType)
+            {
+            case SimdYuvBt601: SynetSetInputP010<Base::Bt601>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt709: SynetSetInputP010<Base::Bt709>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt2020: SynetSetInputP010<Base::Bt2020>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvTrect871: SynetSetInputP010<Base::Trect871>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt709Full: SynetSetInputP010<Base::Bt709Full>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt2020Full: SynetSetInputP010<Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetSetInputYuv::SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+            size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format)
+            : Base::SynetSetInputYuv(srcW, srcH, yuvType, method, lower, upper, dstW, dstH, channels, format)
+        {
+        }
+
+        void SynetSetInputYuv::DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v)
+        {
+            if (_srcW >= DA)
+                Avx2::DeinterleaveUv(uv, 0, _srcW / 2, 1, u, 0, v, 0);
+            else
+                Base::SynetSetInputYuv::DeinterleaveUv(uv, u, v);
+        }
+
+        void SynetSetInputYuv::YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        {
+            if (_srcW >= DA)
+                Avx2::Yuv422pToBgrV2(y, 0, u, 0, v, 0, _srcW, 1, bgr, 0, _yuvType);
+            else
+                Base::SynetSetInputYuv::YuvToBgr(y, u, v, bgr);
+        }
+
+        template<int shift> SIMD_INLINE __m256 ByteToFloat(__m256i value)
+        {
+            return _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(value, shift), K32_000000FF));
+        }
+
+        template<int channel> SIMD_INLINE void ResizeRow3(__m256i src0, __m256i src1, __m256 alpha, float * dst)
+        {
+            __m256 s0 = ByteToFloat<channel * 8>(src0);
+            __m256 s1 = ByteToFloat<channel * 8>(src1);
+            _mm256_storeu_ps(dst, _mm256_fmadd_ps(_mm256_sub_ps(s1, s0), alpha, s0));
+        }
+
+        void SynetSetInputYuv::ResizeRow(const uint8_t * src, float * dst)
+        {
+            size_t cn = _channels, aligned = AlignLo(_dstW, F), dx = 0;
+            if (cn == 1)
+            {
+                for (; dx < aligned; dx += F)
+                {
+                    __m256i s = _mm256_i32gather_epi32((int32_t*)src, _mm256_loadu_si256((__m256i*)(_ix.data + dx)), 1);
+                    __m256 s0 = ByteToFloat<0>(s), s1 = ByteToFloat<8>(s);
+                    _mm256_storeu_ps(dst + dx, _mm256_fmadd_ps(_mm256_sub_ps(s1, s0), _mm256_loadu_ps(_ax.data + dx), s0));
+                }
+            }
+            else
+            {
+                for (; dx < aligned; dx += F)
+                {
+                    __m256i idx = _mm256_loadu_si256((__m256i*)(_ix.data + dx));
+                    __m256 fx = _mm256_loadu_ps(_ax.data + dx);
+                    __m256i s0 = _mm256_i32gather_epi32((int32_t*)src, idx, 1);
+                    __m256i s1 = _mm256_i32gather_epi32((int32_t*)(src + 3), idx, 1);
+                    ResizeRow3<0>(s0, s1, fx, dst + 0 * _dstW + dx);
+                    ResizeRow3<1>(s0, s1, fx, dst + 1 * _dstW + dx);
+                    ResizeRow3<2>(s0, s1, fx, dst + 2 * _dstW + dx);
+                }
+            }
+            for (; dx < _dstW; ++dx)
+            {
+                const uint8_t * ps = src + _ix[dx];
+                float fx = _ax[dx];
+                for (size_t c = 0; c < cn; ++c)
+                    dst[c * _dstW + dx] = float(ps[c]) + float(ps[c + cn] - ps[c]) * fx;
+            }
+        }
+
+        SIMD_INLINE void StoreNchwXc(float * dst, const __m256 * val, size_t channels, size_t step)
+        {
+            __m256 zero = _mm256_setzero_ps();
+            __m256 b = val[0], g = channels > 1 ? val[1] : zero, r = channels > 1 ? val[2] : zero;
+            __m128 z = _mm_setzero_ps();
+            for (size_t h = 0; h < 2; ++h, dst += 4 * step)
+            {
+                __m128 p0 = h ? _mm256_extractf128_ps(b, 1) : _mm256_castps256_ps128(b);
+                __m128 p1 = h ? _mm256_extractf128_ps(g, 1) : _mm256_castps256_ps128(g);
+                __m128 p2 = h ? _mm256_extractf128_ps(r, 1) : _mm256_castps256_ps128(r);
+                __m128 p3 = z;
+                _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+                _mm_storeu_ps(dst + 0 * step, p0);
+                _mm_storeu_ps(dst + 1 * step, p1);
+                _mm_storeu_ps(dst + 2 * step, p2);
+                _mm_storeu_ps(dst + 3 * step, p3);
+                for (size_t i = 4; i < step; i += 4)
+                {
+                    _mm_storeu_ps(dst + 0 * step + i, z);
+                    _mm_storeu_ps(dst + 1 * step + i, z);
+                    _mm_storeu_ps(dst + 2 * step + i, z);
+                    _mm_storeu_ps(dst + 3 * step + i, z);
+                }
+            }
+        }
+
+        void SynetSetInputYuv::StoreRow(const float * src0, const float * src1, float alpha, float * dst)
+        {
+            size_t cn = _channels, aligned = AlignLo(_dstW, F), dx = 0;
+            __m256 fy = _mm256_set1_ps(alpha), scale[3], shift[3];
+            for (size_t c = 0; c < cn; ++c)
+            {
+                scale[c] = _mm256_set1_ps(_scale[c]);
+                shift[c] = _mm256_set1_ps(_shift[c]);
+            }
+            for (; dx < aligned; dx += F)
+            {
+                __m256 val[3];
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    __m256 s0 = _mm256_loadu_ps(src0 + c * _dstW + dx);
+                    __m256 s1 = _mm256_loadu_ps(src1 + c * _dstW + dx);
+                    val[c] = _mm256_fmadd_ps(_mm256_fmadd_ps(_mm256_sub_ps(s1, s0), fy, s0), scale[c], shift[c]);
+                }
+                if (_format == SimdTensorFormatNchw)
+                {
+                    for (size_t c = 0; c < cn; ++c)
+                        _mm256_storeu_ps(dst + c * _stepC + dx, val[c]);
+                }
+                else if (_format == SimdTensorFormatNhwc)
+                {
+                    if (cn == 1)
+                        _mm256_storeu_ps(dst + dx, val[0]);
+                    else
+                        StoreNhwc3(dst + 3 * dx, val[0], val[1], val[2]);
+                }
+                else
+                    StoreNchwXc(dst + dx * _stepX, val, cn, _stepX);
+            }
+            for (; dx < _dstW; ++dx)
+            {
+                float * pd = dst + dx * _stepX;
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    float s0 = src0[c * _dstW + dx], s1 = src1[c * _dstW + dx];
+                    pd[c * _stepC] = (s0 + (s1 - s0) * alpha) * _scale[c] + _shift[c];
+                }
+                for (size_t c = cn; c < _stepX; ++c)
+                    pd[c] = 0;
+            }
+        }
+
+        void SynetSetInputYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, u, uStride, v, vStride, dst);
+        }
+
+        void SynetSetInputNv12(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, uv, uvStride, NULL, 0, dst);
+        }
     }
 #endif//SIMD_AVX2_ENABLE
 }
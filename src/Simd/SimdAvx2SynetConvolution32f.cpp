@@ -1642,20 +1642,15 @@ namespace Simd
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
-            else if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
-                return new Avx::SynetConvolution32fDepthwiseDotProduct(param);
-            else if (SynetConvolution32fWinograd::Preferable(param))
-                return new SynetConvolution32fWinograd(param);
-            else if (SynetConvolution32fGemmNT::Preferable(param))
-                return new SynetConvolution32fGemmNT(param);
-            else if (SynetConvolution32fDirectNchw::Preferable(param))
-                return new Avx2::SynetConvolution32fDirectNchw(param);
-            else if (SynetConvolution32fNhwcDirect::Preferable(param))
-                return new SynetConvolution32fNhwcDirect(param);
-            else if (SynetConvolution32fDirectNhwc::Preferable(param))
-                return new SynetConvolution32fDirectNhwc(param);
-            else
-                return new SynetConvolution32fGemmNN(param);
+            Base::SynetConvolution32fAutotune autotune(param, "Avx2");
+            autotune.Add<Avx::SynetConvolution32fDepthwiseDotProduct>("DepthwiseDotProduct", Avx::SynetConvolution32fDepthwiseDotProduct::Supported(param), Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param));
+            autotune.Add<SynetConvolution32fWinograd>("Winograd", SynetConvolution32fWinograd::Supported(param), SynetConvolution32fWinograd::Preferable(param));
+            autotune.Add<SynetConvolution32fGemmNT>("GemmNT", SynetConvolution32fGemmNT::Supported(param), SynetConvolution32fGemmNT::Preferable(param));
+            autotune.Add<Avx2::SynetConvolution32fDirectNchw>("DirectNchw", SynetConvolution32fDirectNchw::Supported(param), SynetConvolution32fDirectNchw::Preferable(param));
+            autotune.Add<SynetConvolution32fNhwcDirect>("NhwcDirect", SynetConvolution32fNhwcDirect::Supported(param), SynetConvolution32fNhwcDirect::Preferable(param));
+            autotune.Add<SynetConvolution32fDirectNhwc>("DirectNhwc", SynetConvolution32fDirectNhwc::Supported(param), SynetConvolution32fDirectNhwc::Preferable(param));
+            autotune.Add<SynetConvolution32fGemmNN>("GemmNN", true, true);
+            return autotune.Select();
         }
     }
 #endif//SIMD_AVX2_ENABLE
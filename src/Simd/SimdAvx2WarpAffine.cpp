@@ -0,0 +1,256 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdWarpAffine.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        WarpAffineNearest::WarpAffineNearest(const WarpAffParam & param)
+            : Base::WarpAffineNearest(param)
+        {
+        }
+
+        void WarpAffineNearest::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t pixelSize = _param.PixelSize(), x = beg, end8 = beg + AlignLoAny(end - beg, 8);
+            __m256 rx = _mm256_set1_ps(_rx[y]), ry = _mm256_set1_ps(_ry[y]);
+            __m256i _pixelSize = _mm256_set1_epi32((int)pixelSize), _srcStride = _mm256_set1_epi32((int)srcStride);
+            SIMD_ALIGNED(32) int32_t offs[8];
+            for (; x < end8; x += 8)
+            {
+                __m256i ix = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_loadu_ps(_cx.data + x), rx));
+                __m256i iy = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_loadu_ps(_cy.data + x), ry));
+                __m256i _offs = _mm256_add_epi32(_mm256_mullo_epi32(ix, _pixelSize), _mm256_mullo_epi32(iy, _srcStride));
+                if (pixelSize == 4)
+                    _mm256_storeu_si256((__m256i*)(dst + x * 4), _mm256_i32gather_epi32((int32_t*)src, _offs, 1));
+                else
+                {
+                    _mm256_store_si256((__m256i*)offs, _offs);
+                    for (size_t i = 0; i < 8; ++i)
+                        Base::WarpCopyPixel(src + offs[i], pixelSize, dst + (x + i) * pixelSize);
+                }
+            }
+            Base::WarpAffineNearest::RunInterior(src, srcStride, y, x, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam & param)
+            : Base::WarpAffineByteBilinear(param)
+        {
+        }
+
+        SIMD_INLINE void ByteBilinearCoords(const float * cx, const float * cy, __m256 rx, __m256 ry, __m256i pixelSize, __m256i srcStride,
+            __m256i & offs, __m256i & wA, __m256i & wB)
+        {
+            static const __m256 k_range = _mm256_set1_ps((float)WARP_RANGE);
+            static const __m256 k_half = _mm256_set1_ps(0.5f);
+            static const __m256i k_irange = _mm256_set1_epi32(WARP_RANGE);
+            __m256 sx = _mm256_add_ps(_mm256_loadu_ps(cx), rx);
+            __m256 sy = _mm256_add_ps(_mm256_loadu_ps(cy), ry);
+            __m256i ix = _mm256_cvttps_epi32(sx), iy = _mm256_cvttps_epi32(sy);
+            __m256i fx = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(sx, _mm256_cvtepi32_ps(ix)), k_range), k_half));
+            __m256i fy = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(sy, _mm256_cvtepi32_ps(iy)), k_range), k_half));
+            __m256i gx = _mm256_sub_epi32(k_irange, fx), gy = _mm256_sub_epi32(k_irange, fy);
+            offs = _mm256_add_epi32(_mm256_mullo_epi32(ix, pixelSize), _mm256_mullo_epi32(iy, srcStride));
+            wA = _mm256_or_si256(_mm256_mullo_epi32(gx, gy), _mm256_slli_epi32(_mm256_mullo_epi32(fx, gy), 16));
+            wB = _mm256_or_si256(_mm256_mullo_epi32(gx, fy), _mm256_slli_epi32(_mm256_mullo_epi32(fx, fy), 16));
+        }
+
+        SIMD_INLINE __m256i ByteBilinearSum(__m256i s0, __m256i s1, __m256i wA, __m256i wB)
+        {
+            static const __m256i k_round = _mm256_set1_epi32(WARP_ROUND);
+            __m256i sum = _mm256_add_epi32(_mm256_madd_epi16(s0, wA), _mm256_madd_epi16(s1, wB));
+            return _mm256_srli_epi32(_mm256_add_epi32(sum, k_round), 2 * WARP_SHIFT);
+        }
+
+        template<int N> SIMD_INLINE __m128i LoadPixel(const uint8_t * src)
+        {
+            switch (N)
+            {
+            case 2: return _mm_cvtsi32_si128(*(uint16_t*)src);
+            case 3: return _mm_cvtsi32_si128(*(uint16_t*)src | (src[2] << 16));
+            case 4: return _mm_cvtsi32_si128(*(int32_t*)src);
+            }
+            return _mm_setzero_si128();
+        }
+
+        template<int N> SIMD_INLINE void StorePixel(__m128i value, uint8_t * dst)
+        {
+            int32_t pixel = _mm_cvtsi128_si32(value);
+            switch (N)
+            {
+            case 2: *(uint16_t*)dst = (uint16_t)pixel; break;
+            case 3: *(uint16_t*)dst = (uint16_t)pixel; dst[2] = (uint8_t)(pixel >> 16); break;
+            case 4: *(int32_t*)dst = pixel; break;
+            }
+        }
+
+        template<int N> SIMD_INLINE void ByteBilinearPixel(const uint8_t * p0, size_t srcStride, int32_t wA, int32_t wB, uint8_t * dst)
+        {
+            static const __m128i k_round = _mm_set1_epi32(WARP_ROUND);
+            const uint8_t * p1 = p0 + srcStride;
+            __m128i s0 = _mm_cvtepu8_epi16(_mm_unpacklo_epi8(LoadPixel<N>(p0), LoadPixel<N>(p0 + N)));
+            __m128i s1 = _mm_cvtepu8_epi16(_mm_unpacklo_epi8(LoadPixel<N>(p1), LoadPixel<N>(p1 + N)));
+            __m128i sum = _mm_add_epi32(_mm_madd_epi16(s0, _mm_set1_epi32(wA)), _mm_madd_epi16(s1, _mm_set1_epi32(wB)));
+            sum = _mm_srli_epi32(_mm_add_epi32(sum, k_round), 2 * WARP_SHIFT);
+            StorePixel<N>(_mm_packus_epi16(_mm_packs_epi32(sum, Sse2::K_ZERO), Sse2::K_ZERO), dst);
+        }
+
+        template<int N> void ByteBilinearInterior(const uint8_t * src, size_t srcStride, const float * cx, const float * cy, float rx, float ry, size_t & x, size_t end, uint8_t * dst)
+        {
+            static const __m256i k_shuffle0 = SIMD_MM256_SETR_EPI8(
+                0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1,
+                0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1);
+            static const __m256i k_shuffle1 = SIMD_MM256_SETR_EPI8(
+                0x2, -1, 0x3, -1, 0x6, -1, 0x7, -1, 0xA, -1, 0xB, -1, 0xE, -1, 0xF, -1,
+                0x2, -1, 0x3, -1, 0x6, -1, 0x7, -1, 0xA, -1, 0xB, -1, 0xE, -1, 0xF, -1);
+            size_t end8 = x + AlignLoAny(end - x, 8);
+            __m256 _rx = _mm256_set1_ps(rx), _ry = _mm256_set1_ps(ry);
+            __m256i _pixelSize = _mm256_set1_epi32(N), _srcStride = _mm256_set1_epi32((int)srcStride);
+            SIMD_ALIGNED(32) int32_t offs[8], wA[8], wB[8];
+            for (; x < end8; x += 8)
+            {
+                __m256i _offs, _wA, _wB;
+                ByteBilinearCoords(cx + x, cy + x, _rx, _ry, _pixelSize, _srcStride, _offs, _wA, _wB);
+                if (N == 1)
+                {
+                    __m256i s0 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int32_t*)src, _offs, 1), k_shuffle0);
+                    __m256i s1 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int32_t*)(src + srcStride - 2), _offs, 1), k_shuffle1);
+                    __m256i sum = ByteBilinearSum(s0, s1, _wA, _wB);
+                    __m128i sum16 = _mm_packs_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+                    _mm_storel_epi64((__m128i*)(dst + x), _mm_packus_epi16(sum16, Sse2::K_ZERO));
+                }
+                else
+                {
+                    _mm256_store_si256((__m256i*)offs, _offs);
+                    _mm256_store_si256((__m256i*)wA, _wA);
+                    _mm256_store_si256((__m256i*)wB, _wB);
+                    for (size_t i = 0; i < 8; ++i)
+                        ByteBilinearPixel<N>(src + offs[i], srcStride, wA[i], wB[i], dst + (x + i) * N);
+                }
+            }
+        }
+
+        void WarpAffineByteBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t x = beg;
+            switch (_param.channels)
+            {
+            case 1: ByteBilinearInterior<1>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], x, end, dst); break;
+            case 2: ByteBilinearInterior<2>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], x, end, dst); break;
+            case 3: ByteBilinearInterior<3>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], x, end, dst); break;
+            case 4: ByteBilinearInterior<4>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], x, end, dst); break;
+            }
+            Base::WarpAffineByteBilinear::RunInterior(src, srcStride, y, x, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineFloatBilinear::WarpAffineFloatBilinear(const WarpAffParam & param)
+            : Base::WarpAffineFloatBilinear(param)
+        {
+        }
+
+        SIMD_INLINE __m256 FloatBilinearInterp(__m256 p00, __m256 p01, __m256 p10, __m256 p11, __m256 fx, __m256 fy)
+        {
+            __m256 gx = _mm256_sub_ps(_mm256_set1_ps(1.0f), fx), gy = _mm256_sub_ps(_mm256_set1_ps(1.0f), fy);
+            __m256 r0 = _mm256_add_ps(_mm256_mul_ps(p00, gx), _mm256_mul_ps(p01, fx));
+            __m256 r1 = _mm256_add_ps(_mm256_mul_ps(p10, gx), _mm256_mul_ps(p11, fx));
+            return _mm256_add_ps(_mm256_mul_ps(r0, gy), _mm256_mul_ps(r1, fy));
+        }
+
+        void WarpAffineFloatBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels, stride = srcStride / sizeof(float), x = beg;
+            if (cn == 1 || cn == 4)
+            {
+                size_t end8 = beg + AlignLoAny(end - beg, 8);
+                const float * ps = (float*)src;
+                float * pd = (float*)dst;
+                __m256 rx = _mm256_set1_ps(_rx[y]), ry = _mm256_set1_ps(_ry[y]);
+                __m256i _cn = _mm256_set1_epi32((int)cn), _stride = _mm256_set1_epi32((int)stride);
+                SIMD_ALIGNED(32) int32_t offs[8];
+                SIMD_ALIGNED(32) float fx[8], fy[8];
+                for (; x < end8; x += 8)
+                {
+                    __m256 sx = _mm256_add_ps(_mm256_loadu_ps(_cx.data + x), rx);
+                    __m256 sy = _mm256_add_ps(_mm256_loadu_ps(_cy.data + x), ry);
+                    __m256i ix = _mm256_cvttps_epi32(sx), iy = _mm256_cvttps_epi32(sy);
+                    __m256 _fx = _mm256_sub_ps(sx, _mm256_cvtepi32_ps(ix));
+                    __m256 _fy = _mm256_sub_ps(sy, _mm256_cvtepi32_ps(iy));
+                    __m256i _offs = _mm256_add_epi32(_mm256_mullo_epi32(ix, _cn), _mm256_mullo_epi32(iy, _stride));
+                    if (cn == 1)
+                    {
+                        const float * p0 = ps, * p1 = ps + stride;
+                        __m256 p00 = _mm256_i32gather_ps(p0 + 0, _offs, 4);
+                        __m256 p01 = _mm256_i32gather_ps(p0 + 1, _offs, 4);
+                        __m256 p10 = _mm256_i32gather_ps(p1 + 0, _offs, 4);
+                        __m256 p11 = _mm256_i32gather_ps(p1 + 1, _offs, 4);
+                        _mm256_storeu_ps(pd + x, FloatBilinearInterp(p00, p01, p10, p11, _fx, _fy));
+                    }
+                    else
+                    {
+                        _mm256_store_si256((__m256i*)offs, _offs);
+                        _mm256_store_ps(fx, _fx);
+                        _mm256_store_ps(fy, _fy);
+                        for (size_t i = 0; i < 8; i += 2)
+                        {
+                            const float * p0 = ps + offs[i + 0], * p1 = p0 + stride;
+                            const float * q0 = ps + offs[i + 1], * q1 = q0 + stride;
+                            __m256 p00 = Avx::Load<false>(p0 + 0, q0 + 0);
+                            __m256 p01 = Avx::Load<false>(p0 + 4, q0 + 4);
+                            __m256 p10 = Avx::Load<false>(p1 + 0, q1 + 0);
+                            __m256 p11 = Avx::Load<false>(p1 + 4, q1 + 4);
+                            __m256 wx = _mm256_insertf128_ps(_mm256_set1_ps(fx[i + 0]), _mm_set1_ps(fx[i + 1]), 1);
+                            __m256 wy = _mm256_insertf128_ps(_mm256_set1_ps(fy[i + 0]), _mm_set1_ps(fy[i + 1]), 1);
+                            _mm256_storeu_ps(pd + (x + i) * 4, FloatBilinearInterp(p00, p01, p10, p11, wx, wy));
+                        }
+                    }
+                }
+            }
+            Base::WarpAffineFloatBilinear::RunInterior(src, srcStride, y, x, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+        {
+            WarpAffParam param(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpAffineNearest(param);
+            else if (param.IsByte())
+                return new WarpAffineByteBilinear(param);
+            else
+                return new WarpAffineFloatBilinear(param);
+        }
+    }
+#endif //SIMD_AVX2_ENABLE
+}
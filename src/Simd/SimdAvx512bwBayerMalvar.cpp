@@ -0,0 +1,249 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<int part> SIMD_INLINE __m512i BayerPart(__m512i value)
+        {
+            return part ? _mm512_srli_epi16(value, 8) : _mm512_and_si512(value, K16_00FF);
+        }
+
+        SIMD_INLINE __m512i BayerMalvar(__m512i sum)
+        {
+            return _mm512_srai_epi16(_mm512_add_epi16(sum, K16_0008), 4);
+        }
+
+        template<int part, bool green> SIMD_INLINE void BayerMalvar(const __m512i src[13], __m512i & x, __m512i & g, __m512i & y)
+        {
+            __m512i c = BayerPart<part>(src[2]);
+            __m512i h1 = _mm512_add_epi16(BayerPart<part>(src[1]), BayerPart<part>(src[3]));
+            __m512i h2 = _mm512_add_epi16(BayerPart<part>(src[0]), BayerPart<part>(src[4]));
+            __m512i v1 = _mm512_add_epi16(BayerPart<part>(src[6]), BayerPart<part>(src[9]));
+            __m512i v2 = _mm512_add_epi16(BayerPart<part>(src[11]), BayerPart<part>(src[12]));
+            __m512i d = _mm512_add_epi16(_mm512_add_epi16(BayerPart<part>(src[5]), BayerPart<part>(src[7])),
+                _mm512_add_epi16(BayerPart<part>(src[8]), BayerPart<part>(src[10])));
+            if (green)
+            {
+                __m512i c5 = _mm512_add_epi16(_mm512_slli_epi16(c, 2), c);
+                __m512i hd = _mm512_sub_epi16(_mm512_add_epi16(c5, _mm512_slli_epi16(h1, 2)), _mm512_add_epi16(h2, d));
+                __m512i vd = _mm512_sub_epi16(_mm512_add_epi16(c5, _mm512_slli_epi16(v1, 2)), _mm512_add_epi16(v2, d));
+                x = BayerMalvar(_mm512_add_epi16(_mm512_slli_epi16(hd, 1), v2));
+                g = c;
+                y = BayerMalvar(_mm512_add_epi16(_mm512_slli_epi16(vd, 1), h2));
+            }
+            else
+            {
+                __m512i a2 = _mm512_add_epi16(h2, v2);
+                __m512i c3d = _mm512_add_epi16(_mm512_add_epi16(_mm512_slli_epi16(c, 1), c), d);
+                x = c;
+                g = BayerMalvar(_mm512_slli_epi16(_mm512_sub_epi16(_mm512_add_epi16(_mm512_slli_epi16(c, 2), _mm512_slli_epi16(_mm512_add_epi16(h1, v1), 1)), a2), 1));
+                y = BayerMalvar(_mm512_sub_epi16(_mm512_slli_epi16(c3d, 2), _mm512_add_epi16(_mm512_slli_epi16(a2, 1), a2)));
+            }
+        }
+
+        SIMD_INLINE __m512i BayerMerge(__m512i even, __m512i odd)
+        {
+            __m512i packed = _mm512_packus_epi16(even, odd);
+            return _mm512_unpacklo_epi8(packed, _mm512_bsrli_epi128(packed, 8));
+        }
+
+        template<bool greenEven, bool redRow> SIMD_INLINE void BayerToBgrMalvar(const uint8_t * src[5], size_t col, __m512i bgr[3])
+        {
+            __m512i s[13], x[2], g[2], y[2];
+            s[0] = _mm512_loadu_si512(src[2] + col - 2);
+            s[1] = _mm512_loadu_si512(src[2] + col - 1);
+            s[2] = _mm512_loadu_si512(src[2] + col);
+            s[3] = _mm512_loadu_si512(src[2] + col + 1);
+            s[4] = _mm512_loadu_si512(src[2] + col + 2);
+            s[5] = _mm512_loadu_si512(src[1] + col - 1);
+            s[6] = _mm512_loadu_si512(src[1] + col);
+            s[7] = _mm512_loadu_si512(src[1] + col + 1);
+            s[8] = _mm512_loadu_si512(src[3] + col - 1);
+            s[9] = _mm512_loadu_si512(src[3] + col);
+            s[10] = _mm512_loadu_si512(src[3] + col + 1);
+            s[11] = _mm512_loadu_si512(src[0] + col);
+            s[12] = _mm512_loadu_si512(src[4] + col);
+            BayerMalvar<0, greenEven>(s, x[0], g[0], y[0]);
+            BayerMalvar<1, !greenEven>(s, x[1], g[1], y[1]);
+            bgr[redRow ? 2 : 0] = BayerMerge(x[0], x[1]);
+            bgr[1] = BayerMerge(g[0], g[1]);
+            bgr[redRow ? 0 : 2] = BayerMerge(y[0], y[1]);
+        }
+
+        template<bool greenEven, bool redRow> void BayerToBgrMalvar(const uint8_t * src[5], size_t width, uint8_t * bgr)
+        {
+            __m512i _bgr[3];
+            size_t body = width - 2 - A;
+            for (size_t col = 2; col < body; col += A)
+            {
+                BayerToBgrMalvar<greenEven, redRow>(src, col, _bgr);
+                _mm512_storeu_si512((__m512i*)(bgr + 3 * col) + 0, InterleaveBgr<0>(_bgr[0], _bgr[1], _bgr[2]));
+                _mm512_storeu_si512((__m512i*)(bgr + 3 * col) + 1, InterleaveBgr<1>(_bgr[0], _bgr[1], _bgr[2]));
+                _mm512_storeu_si512((__m512i*)(bgr + 3 * col) + 2, InterleaveBgr<2>(_bgr[0], _bgr[1], _bgr[2]));
+            }
+            BayerToBgrMalvar<greenEven, redRow>(src, body, _bgr);
+            _mm512_storeu_si512((__m512i*)(bgr + 3 * body) + 0, InterleaveBgr<0>(_bgr[0], _bgr[1], _bgr[2]));
+            _mm512_storeu_si512((__m512i*)(bgr + 3 * body) + 1, InterleaveBgr<1>(_bgr[0], _bgr[1], _bgr[2]));
+            _mm512_storeu_si512((__m512i*)(bgr + 3 * body) + 2, InterleaveBgr<2>(_bgr[0], _bgr[1], _bgr[2]));
+        }
+
+        SIMD_INLINE void BayerSaveBgra(const __m512i bgr[3], const __m512i & alpha, uint8_t * bgra)
+        {
+            __m512i b = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, bgr[0]);
+            __m512i g = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, bgr[1]);
+            __m512i r = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, bgr[2]);
+            __m512i bgLo = UnpackU8<0>(b, g);
+            __m512i bgHi = UnpackU8<1>(b, g);
+            __m512i raLo = UnpackU8<0>(r, alpha);
+            __m512i raHi = UnpackU8<1>(r, alpha);
+            _mm512_storeu_si512(bgra + 0 * A, UnpackU16<0>(bgLo, raLo));
+            _mm512_storeu_si512(bgra + 1 * A, UnpackU16<1>(bgLo, raLo));
+            _mm512_storeu_si512(bgra + 2 * A, UnpackU16<0>(bgHi, raHi));
+            _mm512_storeu_si512(bgra + 3 * A, UnpackU16<1>(bgHi, raHi));
+        }
+
+        template<bool greenEven, bool redRow> void BayerToBgraMalvar(const uint8_t * src[5], size_t width, const __m512i & alpha, uint8_t * bgra)
+        {
+            __m512i bgr[3];
+            size_t body = width - 2 - A;
+            for (size_t col = 2; col < body; col += A)
+            {
+                BayerToBgrMalvar<greenEven, redRow>(src, col, bgr);
+                BayerSaveBgra(bgr, alpha, bgra + 4 * col);
+            }
+            BayerToBgrMalvar<greenEven, redRow>(src, body, bgr);
+            BayerSaveBgra(bgr, alpha, bgra + 4 * body);
+        }
+
+        template<size_t channels> SIMD_INLINE void BayerMalvarBorder(const uint8_t * src[5], size_t width, bool greenEven, bool redRow, uint8_t * dst, uint8_t alpha)
+        {
+            const size_t cols[4] = { 0, 1, width - 2, width - 1 };
+            for (size_t i = 0; i < 4; ++i)
+            {
+                Base::BayerToBgrMalvar(src, cols[i], width, ((cols[i] & 1) == 0) == greenEven, redRow, dst + cols[i] * channels);
+                if (channels == 4)
+                    dst[cols[i] * channels + 3] = alpha;
+            }
+        }
+
+        void BayerToBgrMalvar(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            const uint8_t * src[5];
+            bool greenEven, redRow;
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BayerMalvarRows(bayer, bayerStride, row, height, src);
+                Base::BayerMalvarPattern(bayerFormat, row, greenEven, redRow);
+                if (greenEven)
+                {
+                    if (redRow)
+                        BayerToBgrMalvar<true, true>(src, width, bgr);
+                    else
+                        BayerToBgrMalvar<true, false>(src, width, bgr);
+                }
+                else
+                {
+                    if (redRow)
+                        BayerToBgrMalvar<false, true>(src, width, bgr);
+                    else
+                        BayerToBgrMalvar<false, false>(src, width, bgr);
+                }
+                BayerMalvarBorder<3>(src, width, greenEven, redRow, bgr, 0);
+                bgr += bgrStride;
+            }
+        }
+
+        void BayerToBgraMalvar(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            const uint8_t * src[5];
+            bool greenEven, redRow;
+            __m512i _alpha = _mm512_set1_epi8((char)alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BayerMalvarRows(bayer, bayerStride, row, height, src);
+                Base::BayerMalvarPattern(bayerFormat, row, greenEven, redRow);
+                if (greenEven)
+                {
+                    if (redRow)
+                        BayerToBgraMalvar<true, true>(src, width, _alpha, bgra);
+                    else
+                        BayerToBgraMalvar<true, false>(src, width, _alpha, bgra);
+                }
+                else
+                {
+                    if (redRow)
+                        BayerToBgraMalvar<false, true>(src, width, _alpha, bgra);
+                    else
+                        BayerToBgraMalvar<false, false>(src, width, _alpha, bgra);
+                }
+                BayerMalvarBorder<4>(src, width, greenEven, redRow, bgra, alpha);
+                bgra += bgraStride;
+            }
+        }
+
+        void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+            uint8_t * bgr, size_t bgrStride, SimdBayerDemosaicType demosaic)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A + 4);
+
+            switch (demosaic)
+            {
+            case SimdBayerDemosaicBilinear:
+                BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+                break;
+            case SimdBayerDemosaicMalvar:
+                BayerToBgrMalvar(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void BayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBayerDemosaicType demosaic)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A + 4);
+
+            switch (demosaic)
+            {
+            case SimdBayerDemosaicBilinear:
+                BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+                break;
+            case SimdBayerDemosaicMalvar:
+                BayerToBgraMalvar(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
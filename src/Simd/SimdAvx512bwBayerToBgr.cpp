@@ -50,7 +50,7 @@ namespace Simd
         {
             const uint8_t * src[3];
             __m512i _src[12];
-            size_t body = AlignHi(width - 2, A) - A;
+            size_t body = AlignHi(width - A, A);
             for (size_t row = 0; row < height; row += 2)
             {
                 src[0] = (row == 0 ? bayer : bayer - 2 * bayerStride);
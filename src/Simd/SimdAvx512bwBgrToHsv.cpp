@@ -0,0 +1,67 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask64 body = TailMask64(F * 3), tail = TailMask64((width - widthF) * 3);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < widthF; col += F)
+                    ConvertColor32<BgrToHsv32>(bgr + col * 3, hsv + col * 3, body);
+                if (col < width)
+                    ConvertColor32<BgrToHsv32>(bgr + col * 3, hsv + col * 3, tail);
+                bgr += bgrStride;
+                hsv += hsvStride;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask64 body = TailMask64(F * 3), tail = TailMask64((width - widthF) * 3);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < widthF; col += F)
+                    ConvertColor32<HsvToBgr32>(hsv + col * 3, bgr + col * 3, body);
+                if (col < width)
+                    ConvertColor32<HsvToBgr32>(hsv + col * 3, bgr + col * 3, tail);
+                hsv += hsvStride;
+                bgr += bgrStride;
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
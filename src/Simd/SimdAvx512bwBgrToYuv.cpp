@@ -258,6 +258,62 @@ namespace Simd
             else
                 BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
+
+        template <bool align, bool mask, bool uyvy> SIMD_INLINE void BgrToYuyv422(const uint8_t * bgr, uint8_t * yuyv, const __mmask64 * ms)
+        {
+            __m512i _b16_r16[2][2], _g16_1[2][2], y[2];
+            y[0] = LoadAndConvertBgrToY8<align, mask>(bgr + 0 * A, _b16_r16[0], _g16_1[0], ms + 0);
+            y[1] = LoadAndConvertBgrToY8<align, mask>(bgr + 3 * A, _b16_r16[1], _g16_1[1], ms + 4);
+
+            Average16(_b16_r16);
+            Average16(_g16_1);
+
+            __m512i u = Permuted2Pack16iTo8u(ConvertU16(_b16_r16[0], _g16_1[0]), ConvertU16(_b16_r16[1], _g16_1[1]));
+            __m512i v = Permuted2Pack16iTo8u(ConvertV16(_b16_r16[0], _g16_1[0]), ConvertV16(_b16_r16[1], _g16_1[1]));
+            StoreYuyv<align, mask, uyvy>(yuyv, y, u, v, ms + 8);
+        }
+
+        template <bool align, bool uyvy> void BgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            assert(width % 2 == 0);
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(yuyv) && Aligned(yuyvStride));
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width - 1, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[12];
+            for (size_t i = 0; i < 8; ++i)
+                tailMasks[i] = TailMask64(tail * 6 - 48 * i) & 0x0000FFFFFFFFFFFF;
+            for (size_t i = 0; i < 4; ++i)
+                tailMasks[8 + i] = TailMask64(tail * 4 - A * i);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BgrToYuyv422<align, false, uyvy>(bgr + col * 6, yuyv + col * 4, tailMasks);
+                if (col < width)
+                    BgrToYuyv422<align, true, uyvy>(bgr + col * 6, yuyv + col * 4, tailMasks);
+                bgr += bgrStride;
+                yuyv += yuyvStride;
+            }
+        }
+
+        void BgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(yuyv) && Aligned(yuyvStride))
+                BgrToYuyv422<true, false>(bgr, bgrStride, width, height, yuyv, yuyvStride);
+            else
+                BgrToYuyv422<false, false>(bgr, bgrStride, width, height, yuyv, yuyvStride);
+        }
+
+        void BgrToUyvy422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(uyvy) && Aligned(uyvyStride))
+                BgrToYuyv422<true, true>(bgr, bgrStride, width, height, uyvy, uyvyStride);
+            else
+                BgrToYuyv422<false, true>(bgr, bgrStride, width, height, uyvy, uyvyStride);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
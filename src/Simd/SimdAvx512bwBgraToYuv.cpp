@@ -359,6 +359,62 @@ namespace Simd
             else
                 BgraToYuva420p<false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
         }
+
+        template <bool align, bool mask, bool uyvy> SIMD_INLINE void BgraToYuyv422(const uint8_t * bgra, uint8_t * yuyv, const __mmask64 * ms)
+        {
+            __m512i _b16_r16[2][2], _g16_1[2][2], y[2];
+            y[0] = LoadAndConvertBgraToY8<align, mask>(bgra + 0 * A, _b16_r16[0], _g16_1[0], ms + 0);
+            y[1] = LoadAndConvertBgraToY8<align, mask>(bgra + 4 * A, _b16_r16[1], _g16_1[1], ms + 4);
+
+            Average16(_b16_r16);
+            Average16(_g16_1);
+
+            __m512i u = Permuted2Pack16iTo8u(ConvertU16(_b16_r16[0], _g16_1[0]), ConvertU16(_b16_r16[1], _g16_1[1]));
+            __m512i v = Permuted2Pack16iTo8u(ConvertV16(_b16_r16[0], _g16_1[0]), ConvertV16(_b16_r16[1], _g16_1[1]));
+            StoreYuyv<align, mask, uyvy>(yuyv, y, u, v, ms + 8);
+        }
+
+        template <bool align, bool uyvy> void BgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            assert(width % 2 == 0);
+            if (align)
+                assert(Aligned(bgra) && Aligned(bgraStride) && Aligned(yuyv) && Aligned(yuyvStride));
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[12];
+            for (size_t i = 0; i < 8; ++i)
+                tailMasks[i] = TailMask64(tail * 8 - A * i);
+            for (size_t i = 0; i < 4; ++i)
+                tailMasks[8 + i] = TailMask64(tail * 4 - A * i);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BgraToYuyv422<align, false, uyvy>(bgra + col * 8, yuyv + col * 4, tailMasks);
+                if (col < width)
+                    BgraToYuyv422<align, true, uyvy>(bgra + col * 8, yuyv + col * 4, tailMasks);
+                bgra += bgraStride;
+                yuyv += yuyvStride;
+            }
+        }
+
+        void BgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            if (Aligned(bgra) && Aligned(bgraStride) && Aligned(yuyv) && Aligned(yuyvStride))
+                BgraToYuyv422<true, false>(bgra, bgraStride, width, height, yuyv, yuyvStride);
+            else
+                BgraToYuyv422<false, false>(bgra, bgraStride, width, height, yuyv, yuyvStride);
+        }
+
+        void BgraToUyvy422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+        {
+            if (Aligned(bgra) && Aligned(bgraStride) && Aligned(uyvy) && Aligned(uyvyStride))
+                BgraToYuyv422<true, true>(bgra, bgraStride, width, height, uyvy, uyvyStride);
+            else
+                BgraToYuyv422<false, true>(bgra, bgraStride, width, height, uyvy, uyvyStride);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
@@ -224,6 +224,102 @@ namespace Simd
             else
                 DeinterleaveBgra<false>(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
         }
+
+        template <bool align, bool mask> SIMD_INLINE void Yuyv422ToGray(const uint8_t * yuyv, uint8_t * gray, const __mmask64 * tails)
+        {
+            __m512i yuyv0 = Load<align, mask>(yuyv + 0, tails[0]);
+            __m512i yuyv1 = Load<align, mask>(yuyv + A, tails[1]);
+            __m512i _gray = _mm512_packus_epi16(_mm512_and_si512(yuyv0, K16_00FF), _mm512_and_si512(yuyv1, K16_00FF));
+            Store<align, mask>(gray, _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _gray), tails[2]);
+        }
+
+        template <bool align> void Yuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            if (align)
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(gray) && Aligned(grayStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[3];
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[i] = TailMask64(tail * 2 - A * i);
+            tailMasks[2] = TailMask64(tail);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    Yuyv422ToGray<align, false>(yuyv + col * 2, gray + col, tailMasks);
+                if (col < width)
+                    Yuyv422ToGray<align, true>(yuyv + col * 2, gray + col, tailMasks);
+                yuyv += yuyvStride;
+                gray += grayStride;
+            }
+        }
+
+        void Yuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(gray) && Aligned(grayStride))
+                Yuyv422ToGray<true>(yuyv, yuyvStride, width, height, gray, grayStride);
+            else
+                Yuyv422ToGray<false>(yuyv, yuyvStride, width, height, gray, grayStride);
+        }
+
+        template <bool align, bool mask> SIMD_INLINE void Yuyv422ToYuv420p(const uint8_t * yuyv0, const uint8_t * yuyv1,
+            uint8_t * y0, uint8_t * y1, uint8_t * u, uint8_t * v, const __mmask64 * tails)
+        {
+            __m512i _y0[2], u0, v0, _y1[2], u1, v1;
+            LoadYuyv<align, mask, false>(yuyv0, _y0, u0, v0, tails);
+            LoadYuyv<align, mask, false>(yuyv1, _y1, u1, v1, tails);
+            Store<align, mask>(y0 + 0, _y0[0], tails[4]);
+            Store<align, mask>(y0 + A, _y0[1], tails[5]);
+            Store<align, mask>(y1 + 0, _y1[0], tails[4]);
+            Store<align, mask>(y1 + A, _y1[1], tails[5]);
+            Store<align, mask>(u, _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_avg_epu8(u0, u1)), tails[6]);
+            Store<align, mask>(v, _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_avg_epu8(v0, v1)), tails[6]);
+        }
+
+        template <bool align> void Yuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+            {
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(y) && Aligned(yStride));
+                assert(Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride));
+            }
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[7];
+            for (size_t i = 0; i < 4; ++i)
+                tailMasks[i] = TailMask64(tail * 4 - A * i);
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[4 + i] = TailMask64(tail * 2 - A * i);
+            tailMasks[6] = TailMask64(tail);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    Yuyv422ToYuv420p<align, false>(yuyv + col * 4, yuyv + yuyvStride + col * 4, y + col * 2, y + yStride + col * 2, u + col, v + col, tailMasks);
+                if (col < width)
+                    Yuyv422ToYuv420p<align, true>(yuyv + col * 4, yuyv + yuyvStride + col * 4, y + col * 2, y + yStride + col * 2, u + col, v + col, tailMasks);
+                yuyv += 2 * yuyvStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void Yuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(y) && Aligned(yStride)
+                && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride))
+                Yuyv422ToYuv420p<true>(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+            else
+                Yuyv422ToYuv420p<false>(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
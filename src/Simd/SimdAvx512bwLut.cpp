@@ -0,0 +1,135 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<size_t channels> SIMD_INLINE __m512i Lut8u(const __m512i & src, const __m512i * table, const __mmask32 * mask)
+        {
+            __mmask32 hi = _mm512_cmpge_epi16_mask(src, K16_0080);
+            __m512i index = _mm512_srli_epi16(src, 1);
+            __m512i shift = _mm512_slli_epi16(_mm512_and_si512(src, K16_0001), 3);
+            __m512i dst = _mm512_mask_blend_epi16(hi, _mm512_permutex2var_epi16(table[0], index, table[1]), 
+                _mm512_permutex2var_epi16(table[2], index, table[3]));
+            for (size_t c = 1; c < channels; ++c)
+            {
+                dst = _mm512_mask_blend_epi16(mask[c] & ~hi, dst, _mm512_permutex2var_epi16(table[4 * c + 0], index, table[4 * c + 1]));
+                dst = _mm512_mask_blend_epi16(mask[c] & hi, dst, _mm512_permutex2var_epi16(table[4 * c + 2], index, table[4 * c + 3]));
+            }
+            return _mm512_and_si512(_mm512_srlv_epi16(dst, shift), K16_00FF);
+        }
+
+        template<size_t channels> SIMD_INLINE void Lut8u(const uint8_t * src, const __m512i * table, const __mmask32 * mask, uint8_t * dst)
+        {
+            __m512i _src = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)src));
+            _mm256_storeu_si256((__m256i*)dst, _mm512_cvtepi16_epi8(Lut8u<channels>(_src, table, mask)));
+        }
+
+        template<size_t channels> SIMD_INLINE void Lut8u(const uint8_t * src, const __m512i * table, const __mmask32 * mask, uint8_t * dst, __mmask64 tail)
+        {
+            __m512i _src = _mm512_cvtepu8_epi16(_mm512_castsi512_si256(_mm512_maskz_loadu_epi8(tail, src)));
+            _mm512_mask_storeu_epi8(dst, tail, _mm512_castsi256_si512(_mm512_cvtepi16_epi8(Lut8u<channels>(_src, table, mask))));
+        }
+
+        template<size_t channels> void Lut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, uint8_t * dst, size_t dstStride)
+        {
+            __m512i _table[channels * 4];
+            for (size_t i = 0; i < channels * 4; ++i)
+                _table[i] = _mm512_loadu_si512(table + i * A);
+            __mmask32 mask[channels * channels];
+            for (size_t p = 0; p < channels; ++p)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    mask[p * channels + c] = 0;
+                    for (size_t j = 0; j < HA; ++j)
+                        if ((p * HA + j) % channels == c)
+                            mask[p * channels + c] |= __mmask32(1) << j;
+                }
+            }
+
+            size_t size = width * channels, sizeHA = AlignLo(size, HA);
+            __mmask64 tail = TailMask64(size - sizeHA);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t i = 0, p = 0;
+                for (; i < sizeHA; i += HA, p = (p + 1 == channels ? 0 : p + 1))
+                    Lut8u<channels>(src + i, _table, mask + p * channels, dst + i);
+                if (i < size)
+                    Lut8u<channels>(src + i, _table, mask + p * channels, dst + i, tail);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Lut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, const uint8_t * table, uint8_t * dst, size_t dstStride)
+        {
+            switch (channels)
+            {
+            case 1: Lut8u<1>(src, srcStride, width, height, table, dst, dstStride); break;
+            case 3: Lut8u<3>(src, srcStride, width, height, table, dst, dstStride); break;
+            case 4: Lut8u<4>(src, srcStride, width, height, table, dst, dstStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void Lut16uTo8u(const uint8_t * src, const uint8_t * table, __m512i last, __m512i edge, uint8_t * dst, __mmask16 tail = -1)
+        {
+            __m512i value = _mm512_min_epi32(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(_mm512_maskz_loadu_epi16(tail, src))), last);
+            __m512i index = _mm512_min_epi32(value, edge);
+            __m512i shift = _mm512_slli_epi32(_mm512_sub_epi32(value, index), 3);
+            __m512i gather = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail, index, table, 1);
+            _mm512_mask_cvtepi32_storeu_epi8(dst, tail, _mm512_srlv_epi32(gather, shift));
+        }
+
+        void Lut16uTo8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, size_t bits, uint8_t * dst, size_t dstStride)
+        {
+            assert(bits >= 2 && bits <= 16);
+
+            __m512i last = _mm512_set1_epi32((1 << bits) - 1);
+            __m512i edge = _mm512_set1_epi32((1 << bits) - 4);
+            size_t widthF = AlignLo(width, F);
+            __mmask16 tail = TailMask16(width - widthF);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < widthF; col += F)
+                    Lut16uTo8u(src + col * 2, table, last, edge, dst + col);
+                if (col < width)
+                    Lut16uTo8u(src + col * 2, table, last, edge, dst + col, tail);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -218,7 +218,7 @@ namespace Simd
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
@@ -264,7 +264,7 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
@@ -451,7 +451,11 @@ namespace Simd
                 src += N, sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(zero)));
             sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(-next)));
             __m128i res = _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(Base::AREA_ROUND)), Base::AREA_SHIFT);
-            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(res, Sse2::K_ZERO), Sse2::K_ZERO));
+            int32_t val = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(res, Sse2::K_ZERO), Sse2::K_ZERO));
+            if (N == 4)
+                *(int32_t*)dst = val;
+            else
+                *(int16_t*)dst = int16_t(val), dst[2] = uint8_t(val >> 16);
         }
 
         template<> SIMD_INLINE void ResizerByteAreaResult<4>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint8_t * dst)
@@ -469,9 +473,10 @@ namespace Simd
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
+            src += iy[_yBeg] * srcStride;
             size_t rowSizeA = AlignLo(rowSize, A);
             __mmask64 tail = TailMask64(rowSize - rowSizeA);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += rowRest)
             {
                 int32_t * buf = _by.data;
                 size_t yn = iy[dy + 1] - iy[dy];
@@ -499,6 +504,62 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        //---------------------------------------------------------------------
+
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Avx2::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowV(const uint8_t * src, size_t stride, const int16_t * ay, size_t ky, int16_t * dst)
+        {
+            static const __m512i ROUND = SIMD_MM512_SET1_EPI32(Base::FILTER_ROW_ROUND);
+            __m512i sum0 = _mm512_setzero_si512(), sum1 = _mm512_setzero_si512();
+            size_t k = 0;
+            for (; k + 1 < ky; k += 2, src += 2 * stride)
+            {
+                __m512i s0 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)src));
+                __m512i s1 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(src + stride)));
+                __m512i alpha = SetInt16(ay[k + 0], ay[k + 1]);
+                sum0 = _mm512_add_epi32(sum0, _mm512_madd_epi16(_mm512_unpacklo_epi16(s0, s1), alpha));
+                sum1 = _mm512_add_epi32(sum1, _mm512_madd_epi16(_mm512_unpackhi_epi16(s0, s1), alpha));
+            }
+            if (k < ky)
+            {
+                __m512i s0 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)src));
+                __m512i alpha = SetInt16(ay[k], 0);
+                sum0 = _mm512_add_epi32(sum0, _mm512_madd_epi16(_mm512_unpacklo_epi16(s0, K_ZERO), alpha));
+                sum1 = _mm512_add_epi32(sum1, _mm512_madd_epi16(_mm512_unpackhi_epi16(s0, K_ZERO), alpha));
+            }
+            sum0 = _mm512_srai_epi32(_mm512_add_epi32(sum0, ROUND), Base::FILTER_ROW_SHIFT);
+            sum1 = _mm512_srai_epi32(_mm512_add_epi32(sum1, ROUND), Base::FILTER_ROW_SHIFT);
+            _mm512_storeu_si512((__m512i*)dst, _mm512_packs_epi32(sum0, sum1));
+        }
+
+        void ResizerByteFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t rs = _param.srcW * _param.channels;
+            if (rs < HA)
+            {
+                Avx2::ResizerByteFilter::Run(src, srcStride, dst, dstStride);
+                return;
+            }
+            size_t rsHA = AlignLo(rs, HA);
+            int16_t * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const uint8_t * ps = src + _iy[dy] * srcStride;
+                const int16_t * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rsHA; sx += HA)
+                    ResizerByteFilterRowV(ps + sx, srcStride, ay, _ky, bx + sx);
+                if (rsHA < rs)
+                    ResizerByteFilterRowV(ps + rs - HA, srcStride, ay, _ky, bx + rs - HA);
+                RunH(bx, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m512i));
@@ -506,6 +567,8 @@ namespace Simd
                 return new ResizerByteBilinear(param);
             else if (param.IsByteArea())
                 return new ResizerByteArea(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
             else
                 return Avx512f::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
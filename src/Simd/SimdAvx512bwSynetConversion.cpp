@@ -25,8 +25,10 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdConversion.h"
 #include "Simd/SimdAvx2.h"
+#include "Simd/SimdAvx512bw.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetSetInput.h"
 
 namespace Simd
 {
@@ -668,6 +670,37 @@ namespace Simd
             default: assert(0);
             }
         }
+        //---------------------------------------------------------------------
+
+        SynetSetInputYuv::SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+            size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format)
+            : Avx2::SynetSetInputYuv(srcW, srcH, yuvType, method, lower, upper, dstW, dstH, channels, format)
+        {
+        }
+
+        void SynetSetInputYuv::DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v)
+        {
+            Avx512bw::DeinterleaveUv(uv, 0, _srcW / 2, 1, u, 0, v, 0);
+        }
+
+        void SynetSetInputYuv::YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        {
+            Avx512bw::Yuv422pToBgrV2(y, 0, u, 0, v, 0, _srcW, 1, bgr, 0, _yuvType);
+        }
+
+        void SynetSetInputYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, u, uStride, v, vStride, dst);
+        }
+
+        void SynetSetInputNv12(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, uv, uvStride, NULL, 0, dst);
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE
 }
@@ -0,0 +1,254 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarpAffine.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        WarpAffineNearest::WarpAffineNearest(const WarpAffParam & param)
+            : Base::WarpAffineNearest(param)
+        {
+        }
+
+        void WarpAffineNearest::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t pixelSize = _param.PixelSize();
+            __m512 rx = _mm512_set1_ps(_rx[y]), ry = _mm512_set1_ps(_ry[y]);
+            __m512i _pixelSize = _mm512_set1_epi32((int)pixelSize), _srcStride = _mm512_set1_epi32((int)srcStride);
+            SIMD_ALIGNED(64) int32_t offs[16];
+            for (size_t x = beg; x < end; x += 16)
+            {
+                __mmask16 tail = TailMask16(end - x);
+                __m512i ix = _mm512_cvttps_epi32(_mm512_add_ps(_mm512_maskz_loadu_ps(tail, _cx.data + x), rx));
+                __m512i iy = _mm512_cvttps_epi32(_mm512_add_ps(_mm512_maskz_loadu_ps(tail, _cy.data + x), ry));
+                __m512i _offs = _mm512_add_epi32(_mm512_mullo_epi32(ix, _pixelSize), _mm512_mullo_epi32(iy, _srcStride));
+                if (pixelSize == 4)
+                    _mm512_mask_storeu_epi32(dst + x * 4, tail, _mm512_mask_i32gather_epi32(K_ZERO, tail, _offs, src, 1));
+                else
+                {
+                    _mm512_store_si512(offs, _offs);
+                    for (size_t i = 0, n = Simd::Min<size_t>(16, end - x); i < n; ++i)
+                        Base::WarpCopyPixel(src + offs[i], pixelSize, dst + (x + i) * pixelSize);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam & param)
+            : Base::WarpAffineByteBilinear(param)
+        {
+        }
+
+        SIMD_INLINE void ByteBilinearCoords(const float * cx, const float * cy, __mmask16 tail, __m512 rx, __m512 ry, __m512i pixelSize, __m512i srcStride,
+            __m512i & offs, __m512i & wA, __m512i & wB)
+        {
+            static const __m512 k_range = _mm512_set1_ps((float)WARP_RANGE);
+            static const __m512 k_half = _mm512_set1_ps(0.5f);
+            static const __m512i k_irange = _mm512_set1_epi32(WARP_RANGE);
+            __m512 sx = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, cx), rx);
+            __m512 sy = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, cy), ry);
+            __m512i ix = _mm512_cvttps_epi32(sx), iy = _mm512_cvttps_epi32(sy);
+            __m512i fx = _mm512_cvttps_epi32(_mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(sx, _mm512_cvtepi32_ps(ix)), k_range), k_half));
+            __m512i fy = _mm512_cvttps_epi32(_mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(sy, _mm512_cvtepi32_ps(iy)), k_range), k_half));
+            __m512i gx = _mm512_sub_epi32(k_irange, fx), gy = _mm512_sub_epi32(k_irange, fy);
+            offs = _mm512_add_epi32(_mm512_mullo_epi32(ix, pixelSize), _mm512_mullo_epi32(iy, srcStride));
+            wA = _mm512_or_si512(_mm512_mullo_epi32(gx, gy), _mm512_slli_epi32(_mm512_mullo_epi32(fx, gy), 16));
+            wB = _mm512_or_si512(_mm512_mullo_epi32(gx, fy), _mm512_slli_epi32(_mm512_mullo_epi32(fx, fy), 16));
+        }
+
+        template<int N> SIMD_INLINE __m128i LoadPixel(const uint8_t * src)
+        {
+            switch (N)
+            {
+            case 2: return _mm_cvtsi32_si128(*(uint16_t*)src);
+            case 3: return _mm_cvtsi32_si128(*(uint16_t*)src | (src[2] << 16));
+            case 4: return _mm_cvtsi32_si128(*(int32_t*)src);
+            }
+            return _mm_setzero_si128();
+        }
+
+        template<int N> SIMD_INLINE void StorePixel(__m128i value, uint8_t * dst)
+        {
+            int32_t pixel = _mm_cvtsi128_si32(value);
+            switch (N)
+            {
+            case 2: *(uint16_t*)dst = (uint16_t)pixel; break;
+            case 3: *(uint16_t*)dst = (uint16_t)pixel; dst[2] = (uint8_t)(pixel >> 16); break;
+            case 4: *(int32_t*)dst = pixel; break;
+            }
+        }
+
+        template<int N> SIMD_INLINE void ByteBilinearPixel(const uint8_t * p0, size_t srcStride, int32_t wA, int32_t wB, uint8_t * dst)
+        {
+            static const __m128i k_round = _mm_set1_epi32(WARP_ROUND);
+            const uint8_t * p1 = p0 + srcStride;
+            __m128i s0 = _mm_cvtepu8_epi16(_mm_unpacklo_epi8(LoadPixel<N>(p0), LoadPixel<N>(p0 + N)));
+            __m128i s1 = _mm_cvtepu8_epi16(_mm_unpacklo_epi8(LoadPixel<N>(p1), LoadPixel<N>(p1 + N)));
+            __m128i sum = _mm_add_epi32(_mm_madd_epi16(s0, _mm_set1_epi32(wA)), _mm_madd_epi16(s1, _mm_set1_epi32(wB)));
+            sum = _mm_srli_epi32(_mm_add_epi32(sum, k_round), 2 * WARP_SHIFT);
+            StorePixel<N>(_mm_packus_epi16(_mm_packs_epi32(sum, Sse2::K_ZERO), Sse2::K_ZERO), dst);
+        }
+
+        template<int N> void ByteBilinearInterior(const uint8_t * src, size_t srcStride, const float * cx, const float * cy, float rx, float ry, size_t beg, size_t end, uint8_t * dst)
+        {
+            static const __m512i k_shuffle0 = SIMD_MM512_SETR_EPI8(
+                0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1,
+                0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1,
+                0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1,
+                0x0, -1, 0x1, -1, 0x4, -1, 0x5, -1, 0x8, -1, 0x9, -1, 0xC, -1, 0xD, -1);
+            static const __m512i k_shuffle1 = SIMD_MM512_SETR_EPI8(
+                0x2, -1, 0x3, -1, 0x6, -1, 0x7, -1, 0xA, -1, 0xB, -1, 0xE, -1, 0xF, -1,
+                0x2, -1, 0x3, -1, 0x6, -1, 0x7, -1, 0xA, -1, 0xB, -1, 0xE, -1, 0xF, -1,
+                0x2, -1, 0x3, -1, 0x6, -1, 0x7, -1, 0xA, -1, 0xB, -1, 0xE, -1, 0xF, -1,
+                0x2, -1, 0x3, -1, 0x6, -1, 0x7, -1, 0xA, -1, 0xB, -1, 0xE, -1, 0xF, -1);
+            static const __m512i k_round = _mm512_set1_epi32(WARP_ROUND);
+            __m512 _rx = _mm512_set1_ps(rx), _ry = _mm512_set1_ps(ry);
+            __m512i _pixelSize = _mm512_set1_epi32(N), _srcStride = _mm512_set1_epi32((int)srcStride);
+            SIMD_ALIGNED(64) int32_t offs[16], wA[16], wB[16];
+            for (size_t x = beg; x < end; x += 16)
+            {
+                __mmask16 tail = TailMask16(end - x);
+                __m512i _offs, _wA, _wB;
+                ByteBilinearCoords(cx + x, cy + x, tail, _rx, _ry, _pixelSize, _srcStride, _offs, _wA, _wB);
+                if (N == 1)
+                {
+                    __m512i s0 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(K_ZERO, tail, _offs, src, 1), k_shuffle0);
+                    __m512i s1 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(K_ZERO, tail, _offs, src + srcStride - 2, 1), k_shuffle1);
+                    __m512i sum = _mm512_add_epi32(_mm512_madd_epi16(s0, _wA), _mm512_madd_epi16(s1, _wB));
+                    sum = _mm512_srli_epi32(_mm512_add_epi32(sum, k_round), 2 * WARP_SHIFT);
+                    _mm_mask_storeu_epi8(dst + x, tail, _mm512_cvtepi32_epi8(sum));
+                }
+                else
+                {
+                    _mm512_store_si512(offs, _offs);
+                    _mm512_store_si512(wA, _wA);
+                    _mm512_store_si512(wB, _wB);
+                    for (size_t i = 0, n = Simd::Min<size_t>(16, end - x); i < n; ++i)
+                        ByteBilinearPixel<N>(src + offs[i], srcStride, wA[i], wB[i], dst + (x + i) * N);
+                }
+            }
+        }
+
+        void WarpAffineByteBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            switch (_param.channels)
+            {
+            case 1: ByteBilinearInterior<1>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], beg, end, dst); break;
+            case 2: ByteBilinearInterior<2>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], beg, end, dst); break;
+            case 3: ByteBilinearInterior<3>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], beg, end, dst); break;
+            case 4: ByteBilinearInterior<4>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], beg, end, dst); break;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineFloatBilinear::WarpAffineFloatBilinear(const WarpAffParam & param)
+            : Base::WarpAffineFloatBilinear(param)
+        {
+        }
+
+        SIMD_INLINE __m512 FloatBilinearInterp(__m512 p00, __m512 p01, __m512 p10, __m512 p11, __m512 fx, __m512 fy)
+        {
+            __m512 gx = _mm512_sub_ps(_mm512_set1_ps(1.0f), fx), gy = _mm512_sub_ps(_mm512_set1_ps(1.0f), fy);
+            __m512 r0 = _mm512_add_ps(_mm512_mul_ps(p00, gx), _mm512_mul_ps(p01, fx));
+            __m512 r1 = _mm512_add_ps(_mm512_mul_ps(p10, gx), _mm512_mul_ps(p11, fx));
+            return _mm512_add_ps(_mm512_mul_ps(r0, gy), _mm512_mul_ps(r1, fy));
+        }
+
+        SIMD_INLINE __m128 FloatBilinearInterp(__m128 p00, __m128 p01, __m128 p10, __m128 p11, __m128 fx, __m128 fy)
+        {
+            __m128 gx = _mm_sub_ps(_mm_set1_ps(1.0f), fx), gy = _mm_sub_ps(_mm_set1_ps(1.0f), fy);
+            __m128 r0 = _mm_add_ps(_mm_mul_ps(p00, gx), _mm_mul_ps(p01, fx));
+            __m128 r1 = _mm_add_ps(_mm_mul_ps(p10, gx), _mm_mul_ps(p11, fx));
+            return _mm_add_ps(_mm_mul_ps(r0, gy), _mm_mul_ps(r1, fy));
+        }
+
+        void WarpAffineFloatBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels, stride = srcStride / sizeof(float);
+            if (cn == 1 || cn == 4)
+            {
+                const float * ps = (float*)src;
+                float * pd = (float*)dst;
+                __m512 rx = _mm512_set1_ps(_rx[y]), ry = _mm512_set1_ps(_ry[y]);
+                __m512i _cn = _mm512_set1_epi32((int)cn), _stride = _mm512_set1_epi32((int)stride);
+                SIMD_ALIGNED(64) int32_t offs[16];
+                SIMD_ALIGNED(64) float fx[16], fy[16];
+                for (size_t x = beg; x < end; x += 16)
+                {
+                    __mmask16 tail = TailMask16(end - x);
+                    __m512 sx = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, _cx.data + x), rx);
+                    __m512 sy = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, _cy.data + x), ry);
+                    __m512i ix = _mm512_cvttps_epi32(sx), iy = _mm512_cvttps_epi32(sy);
+                    __m512 _fx = _mm512_sub_ps(sx, _mm512_cvtepi32_ps(ix));
+                    __m512 _fy = _mm512_sub_ps(sy, _mm512_cvtepi32_ps(iy));
+                    __m512i _offs = _mm512_add_epi32(_mm512_mullo_epi32(ix, _cn), _mm512_mullo_epi32(iy, _stride));
+                    if (cn == 1)
+                    {
+                        const float * p0 = ps, * p1 = ps + stride;
+                        __m512 p00 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _offs, p0 + 0, 4);
+                        __m512 p01 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _offs, p0 + 1, 4);
+                        __m512 p10 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _offs, p1 + 0, 4);
+                        __m512 p11 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _offs, p1 + 1, 4);
+                        _mm512_mask_storeu_ps(pd + x, tail, FloatBilinearInterp(p00, p01, p10, p11, _fx, _fy));
+                    }
+                    else
+                    {
+                        _mm512_store_si512(offs, _offs);
+                        _mm512_store_ps(fx, _fx);
+                        _mm512_store_ps(fy, _fy);
+                        for (size_t i = 0, n = Simd::Min<size_t>(16, end - x); i < n; ++i)
+                        {
+                            const float * p0 = ps + offs[i], * p1 = p0 + stride;
+                            _mm_storeu_ps(pd + (x + i) * 4, FloatBilinearInterp(_mm_loadu_ps(p0), _mm_loadu_ps(p0 + 4),
+                                _mm_loadu_ps(p1), _mm_loadu_ps(p1 + 4), _mm_set1_ps(fx[i]), _mm_set1_ps(fy[i])));
+                        }
+                    }
+                }
+            }
+            else
+                Base::WarpAffineFloatBilinear::RunInterior(src, srcStride, y, beg, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+        {
+            WarpAffParam param(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpAffineNearest(param);
+            else if (param.IsByte())
+                return new WarpAffineByteBilinear(param);
+            else
+                return new WarpAffineFloatBilinear(param);
+        }
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
@@ -0,0 +1,83 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template <bool align, bool mask> SIMD_INLINE void Yuv444pToHsl(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * hsl, const __mmask64 * tails)
+        {
+            __m512i _y = Load<align, mask>(y, tails[0]);
+            __m512i _u = Load<align, mask>(u, tails[0]);
+            __m512i _v = Load<align, mask>(v, tails[0]);
+            __m512i blue = YuvToBlue(_y, _u), green = YuvToGreen(_y, _u, _v), red = YuvToRed(_y, _v);
+            ConvertColor32<BgrToHsl32>(_mm512_extracti32x4_epi32(blue, 0), _mm512_extracti32x4_epi32(green, 0), _mm512_extracti32x4_epi32(red, 0), hsl + 0 * F * 3, tails[1]);
+            ConvertColor32<BgrToHsl32>(_mm512_extracti32x4_epi32(blue, 1), _mm512_extracti32x4_epi32(green, 1), _mm512_extracti32x4_epi32(red, 1), hsl + 1 * F * 3, tails[2]);
+            ConvertColor32<BgrToHsl32>(_mm512_extracti32x4_epi32(blue, 2), _mm512_extracti32x4_epi32(green, 2), _mm512_extracti32x4_epi32(red, 2), hsl + 2 * F * 3, tails[3]);
+            ConvertColor32<BgrToHsl32>(_mm512_extracti32x4_epi32(blue, 3), _mm512_extracti32x4_epi32(green, 3), _mm512_extracti32x4_epi32(red, 3), hsl + 3 * F * 3, tails[4]);
+        }
+
+        template <bool align> void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride)
+        {
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 bodyMasks[5], tailMasks[5];
+            bodyMasks[0] = TailMask64(A);
+            tailMasks[0] = TailMask64(width - alignedWidth);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                bodyMasks[1 + i] = TailMask64(F * 3);
+                tailMasks[1 + i] = TailMask64(Simd::Min<ptrdiff_t>(width - alignedWidth - F * i, F) * 3);
+            }
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    Yuv444pToHsl<align, false>(y + col, u + col, v + col, hsl + col * 3, bodyMasks);
+                if (col < width)
+                    Yuv444pToHsl<align, true>(y + col, u + col, v + col, hsl + col * 3, tailMasks);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                hsl += hslStride;
+            }
+        }
+
+        void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride))
+                Yuv444pToHsl<true>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+            else
+                Yuv444pToHsl<false>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -45,7 +45,7 @@ namespace Simd
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, Avx512f::F);
             __mmask16 tail = TailMask16(rs - rsa);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -167,11 +167,52 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        //---------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Avx2::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowV(const float * src, size_t stride, const float * ay, size_t ky, float * dst)
+        {
+            __m512 sum = _mm512_setzero_ps();
+            for (size_t k = 0; k < ky; ++k, src += stride)
+                sum = _mm512_fmadd_ps(_mm512_loadu_ps(src), _mm512_set1_ps(ay[k]), sum);
+            _mm512_storeu_ps(dst, sum);
+        }
+
+        void ResizerFloatFilter::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            size_t rs = _param.srcW * _param.channels;
+            if (rs < F)
+            {
+                Avx2::ResizerFloatFilter::Run(src, srcStride, dst, dstStride);
+                return;
+            }
+            size_t rsF = AlignLo(rs, F);
+            float * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const float * ps = src + _iy[dy] * srcStride;
+                const float * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rsF; sx += F)
+                    ResizerFloatFilterRowV(ps + sx, srcStride, ay, _ky, bx + sx);
+                if (rsF < rs)
+                    ResizerFloatFilterRowV(ps + rs - F, srcStride, ay, _ky, bx + rs - F);
+                RunH(bx, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m512));
             if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
             else
                 return Avx2::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
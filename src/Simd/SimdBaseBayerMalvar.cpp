@@ -0,0 +1,86 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<size_t channels> void BayerToBgrMalvar(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, 
+            SimdPixelFormatType bayerFormat, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            const uint8_t * src[5];
+            bool greenEven, redRow;
+            for (size_t row = 0; row < height; ++row)
+            {
+                BayerMalvarRows(bayer, bayerStride, row, height, src);
+                BayerMalvarPattern(bayerFormat, row, greenEven, redRow);
+                for (size_t col = 0; col < width; ++col)
+                {
+                    BayerToBgrMalvar(src, col, width, ((col & 1) == 0) == greenEven, redRow, dst + col * channels);
+                    if (channels == 4)
+                        dst[col * channels + 3] = alpha;
+                }
+                dst += dstStride;
+            }
+        }
+
+        void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, 
+            uint8_t * bgr, size_t bgrStride, SimdBayerDemosaicType demosaic)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            switch (demosaic)
+            {
+            case SimdBayerDemosaicBilinear:
+                BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+                break;
+            case SimdBayerDemosaicMalvar:
+                BayerToBgrMalvar<3>(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride, 0);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void BayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, 
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBayerDemosaicType demosaic)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            switch (demosaic)
+            {
+            case SimdBayerDemosaicBilinear:
+                BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+                break;
+            case SimdBayerDemosaicMalvar:
+                BayerToBgrMalvar<4>(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+}
@@ -39,5 +39,18 @@ namespace Simd
                 }
             }
         }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pHsl = hsl + row*hslStride;
+                uint8_t * pBgr = bgr + row*bgrStride;
+                for (const uint8_t * pHslEnd = pHsl + width * 3; pHsl < pHslEnd; pHsl += 3, pBgr += 3)
+                {
+                    HslToBgr(pHsl[0], pHsl[1], pHsl[2], pBgr);
+                }
+            }
+        }
     }
 }
@@ -39,5 +39,18 @@ namespace Simd
                 }
             }
         }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pHsv = hsv + row*hsvStride;
+                uint8_t * pBgr = bgr + row*bgrStride;
+                for (const uint8_t * pHsvEnd = pHsv + width * 3; pHsv < pHsvEnd; pHsv += 3, pBgr += 3)
+                {
+                    HsvToBgr(pHsv[0], pHsv[1], pHsv[2], pBgr);
+                }
+            }
+        }
     }
 }
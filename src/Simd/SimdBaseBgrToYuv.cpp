@@ -114,5 +114,42 @@ namespace Simd
                 bgr += bgrStride;
             }
         }
+
+        template <bool uyvy> SIMD_INLINE void BgrToYuyv422(const uint8_t * bgr, uint8_t * yuyv)
+        {
+            const size_t Y = uyvy ? 1 : 0, U = uyvy ? 0 : 1;
+            yuyv[Y + 0] = BgrToY(bgr[0], bgr[1], bgr[2]);
+            yuyv[Y + 2] = BgrToY(bgr[3], bgr[4], bgr[5]);
+
+            int blue = Average(bgr[0], bgr[3]);
+            int green = Average(bgr[1], bgr[4]);
+            int red = Average(bgr[2], bgr[5]);
+
+            yuyv[U + 0] = BgrToU(blue, green, red);
+            yuyv[U + 2] = BgrToV(blue, green, red);
+        }
+
+        template <bool uyvy> void BgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            assert((width % 2 == 0) && (width >= 2));
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t colYuyv = 0, colBgr = 0, size = width * 2; colYuyv < size; colYuyv += 4, colBgr += 6)
+                    BgrToYuyv422<uyvy>(bgr + colBgr, yuyv + colYuyv);
+                bgr += bgrStride;
+                yuyv += yuyvStride;
+            }
+        }
+
+        void BgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            BgrToYuyv422<false>(bgr, bgrStride, width, height, yuyv, yuyvStride);
+        }
+
+        void BgrToUyvy422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+        {
+            BgrToYuyv422<true>(bgr, bgrStride, width, height, uyvy, uyvyStride);
+        }
     }
 }
@@ -153,5 +153,42 @@ namespace Simd
                 bgra += 2 * bgraStride;
             }
         }
+
+        template <bool uyvy> SIMD_INLINE void BgraToYuyv422(const uint8_t * bgra, uint8_t * yuyv)
+        {
+            const size_t Y = uyvy ? 1 : 0, U = uyvy ? 0 : 1;
+            yuyv[Y + 0] = BgrToY(bgra[0], bgra[1], bgra[2]);
+            yuyv[Y + 2] = BgrToY(bgra[4], bgra[5], bgra[6]);
+
+            int blue = Average(bgra[0], bgra[4]);
+            int green = Average(bgra[1], bgra[5]);
+            int red = Average(bgra[2], bgra[6]);
+
+            yuyv[U + 0] = BgrToU(blue, green, red);
+            yuyv[U + 2] = BgrToV(blue, green, red);
+        }
+
+        template <bool uyvy> void BgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            assert((width % 2 == 0) && (width >= 2));
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t colYuyv = 0, colBgra = 0, size = width * 2; colYuyv < size; colYuyv += 4, colBgra += 8)
+                    BgraToYuyv422<uyvy>(bgra + colBgra, yuyv + colYuyv);
+                bgra += bgraStride;
+                yuyv += yuyvStride;
+            }
+        }
+
+        void BgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            BgraToYuyv422<false>(bgra, bgraStride, width, height, yuyv, yuyvStride);
+        }
+
+        void BgraToUyvy422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+        {
+            BgraToYuyv422<true>(bgra, bgraStride, width, height, uyvy, uyvyStride);
+        }
     }
 }
@@ -28,6 +28,10 @@
 #include <thread>
 #include <sstream>
 #include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <mutex>
+#include <map>
 
 #ifdef __GNUC__
 #include <unistd.h>
@@ -35,6 +39,13 @@
 #include <stdlib.h>
 #endif
 
+#if defined(__linux__)
+#include <sched.h>
+#include <string.h>
+#include <pthread.h>
+#include <dirent.h>
+#endif
+
 namespace Simd
 {
     namespace Base
@@ -44,6 +55,27 @@ namespace Simd
             return std::thread::hardware_concurrency();
         }
 
+        struct CpuLogical
+        {
+            size_t id, core, socket, node;
+
+            CpuLogical(size_t i = 0, size_t c = 0, size_t s = 0, size_t n = 0)
+                : id(i), core(c), socket(s), node(n)
+            {
+            }
+
+            bool operator < (const CpuLogical & other) const
+            {
+                if (node != other.node)
+                    return node < other.node;
+                if (socket != other.socket)
+                    return socket < other.socket;
+                if (core != other.core)
+                    return core < other.core;
+                return id < other.id;
+            }
+        };
+
 #if defined(_MSC_VER)
         typedef SYSTEM_LOGICAL_PROCESSOR_INFORMATION Info;
 
@@ -86,6 +118,57 @@ namespace Simd
                     return info[i].Cache.Size;
             return 0;
         }
+
+        static void CpuTopology(std::vector<CpuLogical> & cpus, size_t & current)
+        {
+            std::vector<Info> info;
+            GetLogicalProcessorInformation(info);
+            const size_t bits = sizeof(ULONG_PTR) * 8;
+            std::vector<size_t> core(bits, 0), node(bits, 0);
+            for (size_t i = 0, c = 0; i < info.size(); ++i)
+            {
+                for (size_t b = 0; b < bits; ++b)
+                {
+                    if ((info[i].ProcessorMask & (ULONG_PTR(1) << b)) == 0)
+                        continue;
+                    if (info[i].Relationship == ::RelationProcessorCore)
+                        core[b] = c;
+                    if (info[i].Relationship == ::RelationNumaNode)
+                        node[b] = info[i].NumaNode.NodeNumber;
+                }
+                if (info[i].Relationship == ::RelationProcessorCore)
+                    c++;
+            }
+            DWORD_PTR process, system;
+            if (!::GetProcessAffinityMask(::GetCurrentProcess(), &process, &system))
+                return;
+            for (size_t b = 0; b < bits; ++b)
+                if (process & (DWORD_PTR(1) << b))
+                    cpus.push_back(CpuLogical(b, core[b], node[b], node[b]));
+            current = ::GetCurrentProcessorNumber();
+        }
+
+        bool GetThreadAffinity(std::vector<size_t> & cpus)
+        {
+            DWORD_PTR mask = ::SetThreadAffinityMask(::GetCurrentThread(), ~DWORD_PTR(0));
+            if (mask == 0)
+                return false;
+            ::SetThreadAffinityMask(::GetCurrentThread(), mask);
+            cpus.clear();
+            for (size_t b = 0; b < sizeof(mask) * 8; ++b)
+                if (mask & (DWORD_PTR(1) << b))
+                    cpus.push_back(b);
+            return true;
+        }
+
+        bool SetThreadAffinity(const std::vector<size_t> & cpus)
+        {
+            DWORD_PTR mask = 0;
+            for (size_t i = 0; i < cpus.size(); ++i)
+                if (cpus[i] < sizeof(mask) * 8)
+                    mask |= DWORD_PTR(1) << cpus[i];
+            return mask && ::SetThreadAffinityMask(::GetCurrentThread(), mask) != 0;
+        }
 #elif defined(__GNUC__)
         size_t CpuSocketNumber()
         {
@@ -146,8 +229,159 @@ namespace Simd
         }
 #endif
 
+#if defined(__linux__)
+        static size_t CpuProperty(size_t cpu, const char * name, size_t otherwise)
+        {
+            std::stringstream path;
+            path << "/sys/devices/system/cpu/cpu" << cpu << "/topology/" << name;
+            std::ifstream ifs(path.str());
+            size_t value;
+            return ifs >> value ? value : otherwise;
+        }
+
+        static size_t CpuNode(size_t cpu, size_t otherwise)
+        {
+            std::stringstream path;
+            path << "/sys/devices/system/cpu/cpu" << cpu;
+            ::DIR * dir = ::opendir(path.str().c_str());
+            if (dir == NULL)
+                return otherwise;
+            size_t node = otherwise;
+            while (::dirent * entry = ::readdir(dir))
+            {
+                if (strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9')
+                {
+                    node = ::atoi(entry->d_name + 4);
+                    break;
+                }
+            }
+            ::closedir(dir);
+            return node;
+        }
+
+        static void CpuTopology(std::vector<CpuLogical> & cpus, size_t & current)
+        {
+            ::cpu_set_t set;
+            CPU_ZERO(&set);
+            if (::sched_getaffinity(0, sizeof(set), &set))
+                return;
+            for (size_t i = 0; i < CPU_SETSIZE; ++i)
+            {
+                if (CPU_ISSET(i, &set))
+                {
+                    size_t socket = CpuProperty(i, "physical_package_id", 0);
+                    cpus.push_back(CpuLogical(i, CpuProperty(i, "core_id", i), socket, CpuNode(i, socket)));
+                }
+            }
+            int cpu = ::sched_getcpu();
+            current = cpu < 0 ? cpus.size() ? cpus[0].id : 0 : cpu;
+        }
+
+        bool GetThreadAffinity(std::vector<size_t> & cpus)
+        {
+            ::cpu_set_t set;
+            CPU_ZERO(&set);
+            if (::pthread_getaffinity_np(::pthread_self(), sizeof(set), &set))
+                return false;
+            cpus.clear();
+            for (size_t i = 0; i < CPU_SETSIZE; ++i)
+                if (CPU_ISSET(i, &set))
+                    cpus.push_back(i);
+            return true;
+        }
+
+        bool SetThreadAffinity(const std::vector<size_t> & cpus)
+        {
+            ::cpu_set_t set;
+            CPU_ZERO(&set);
+            for (size_t i = 0; i < cpus.size(); ++i)
+                if (cpus[i] < CPU_SETSIZE)
+                    CPU_SET(cpus[i], &set);
+            return cpus.size() && ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+        }
+#else
+        static void CpuTopology(std::vector<CpuLogical> & cpus, size_t & current)
+        {
+        }
+
+        bool GetThreadAffinity(std::vector<size_t> & cpus)
+        {
+            return false;
+        }
+
+        bool SetThreadAffinity(const std::vector<size_t> & cpus)
+        {
+            return false;
+        }
+#endif
+
 #else
 #error This platform is unsupported!
 #endif
+
+        void CpuAffinity(SimdAffinityFlags affinity, std::vector<size_t> & cpus)
+        {
+            cpus.clear();
+            if (affinity == SimdAffinityNone)
+                return;
+            std::vector<CpuLogical> topology;
+            size_t current = 0;
+            CpuTopology(topology, current);
+            std::sort(topology.begin(), topology.end());
+            size_t node = topology.size() ? topology[0].node : 0;
+            for (size_t i = 0; i < topology.size(); ++i)
+                if (topology[i].id == current)
+                    node = topology[i].node;
+            std::vector<size_t> siblings;
+            for (size_t i = 0; i < topology.size(); ++i)
+            {
+                if ((affinity & SimdAffinityNode) && topology[i].node != node)
+                    continue;
+                bool first = i == 0 || topology[i].core != topology[i - 1].core || topology[i].socket != topology[i - 1].socket;
+                if (first)
+                    cpus.push_back(topology[i].id);
+                else if ((affinity & SimdAffinityCore) == 0)
+                    siblings.push_back(topology[i].id);
+            }
+            cpus.insert(cpus.end(), siblings.begin(), siblings.end());
+        }
+
+        static std::mutex & CpuMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        static std::map<size_t, size_t> & CpuUsage()
+        {
+            static std::map<size_t, size_t> usage;
+            return usage;
+        }
+
+        void CpuAllocate(const std::vector<size_t> & candidates, size_t count, std::vector<size_t> & cpus)
+        {
+            std::lock_guard<std::mutex> lock(CpuMutex());
+            std::map<size_t, size_t> & usage = CpuUsage();
+            cpus.clear();
+            count = std::min(count, candidates.size());
+            for (size_t level = 0; cpus.size() < count; ++level)
+                for (size_t i = 0; i < candidates.size() && cpus.size() < count; ++i)
+                    if (usage[candidates[i]] == level)
+                        cpus.push_back(candidates[i]);
+            for (size_t i = 0; i < cpus.size(); ++i)
+                usage[cpus[i]]++;
+        }
+
+        void CpuRelease(const std::vector<size_t> & cpus)
+        {
+            std::lock_guard<std::mutex> lock(CpuMutex());
+            std::map<size_t, size_t> & usage = CpuUsage();
+            for (size_t i = 0; i < cpus.size(); ++i)
+            {
+                std::map<size_t, size_t>::iterator it = usage.find(cpus[i]);
+                if (it != usage.end() && --it->second == 0)
+                    usage.erase(it);
+            }
+        }
     }
 }
@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdMath.h"
 
 namespace Simd
 {
@@ -80,5 +81,40 @@ namespace Simd
                 a += aStride;
             }
         }
+
+        void Yuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += 2)
+                    gray[col] = yuyv[offset];
+                yuyv += yuyvStride;
+                gray += grayStride;
+            }
+        }
+
+        void Yuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint8_t * yuyv0 = yuyv, * yuyv1 = yuyv + yuyvStride;
+                for (size_t colY = 0, colUV = 0, offset = 0; colY < width; colY += 2, colUV += 1, offset += 4)
+                {
+                    y[colY + 0] = yuyv0[offset + 0];
+                    y[colY + 1] = yuyv0[offset + 2];
+                    y[colY + yStride + 0] = yuyv1[offset + 0];
+                    y[colY + yStride + 1] = yuyv1[offset + 2];
+                    u[colUV] = Average(yuyv0[offset + 1], yuyv1[offset + 1]);
+                    v[colUV] = Average(yuyv0[offset + 3], yuyv1[offset + 3]);
+                }
+                yuyv += 2 * yuyvStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
     }
 }
@@ -0,0 +1,108 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void Lut8u1(const uint8_t * src, size_t width, const uint8_t * table, uint8_t * dst)
+        {
+            size_t width4 = AlignLo(width, 4), col = 0;
+            for (; col < width4; col += 4)
+            {
+                dst[col + 0] = table[src[col + 0]];
+                dst[col + 1] = table[src[col + 1]];
+                dst[col + 2] = table[src[col + 2]];
+                dst[col + 3] = table[src[col + 3]];
+            }
+            for (; col < width; ++col)
+                dst[col] = table[src[col]];
+        }
+
+        SIMD_INLINE void Lut8u3(const uint8_t * src, size_t width, const uint8_t * table, uint8_t * dst)
+        {
+            const uint8_t * table0 = table + 0 * LUT8U_SIZE;
+            const uint8_t * table1 = table + 1 * LUT8U_SIZE;
+            const uint8_t * table2 = table + 2 * LUT8U_SIZE;
+            for (size_t col = 0, end = width * 3; col < end; col += 3)
+            {
+                dst[col + 0] = table0[src[col + 0]];
+                dst[col + 1] = table1[src[col + 1]];
+                dst[col + 2] = table2[src[col + 2]];
+            }
+        }
+
+        SIMD_INLINE void Lut8u4(const uint8_t * src, size_t width, const uint8_t * table, uint8_t * dst)
+        {
+            const uint8_t * table0 = table + 0 * LUT8U_SIZE;
+            const uint8_t * table1 = table + 1 * LUT8U_SIZE;
+            const uint8_t * table2 = table + 2 * LUT8U_SIZE;
+            const uint8_t * table3 = table + 3 * LUT8U_SIZE;
+            for (size_t col = 0, end = width * 4; col < end; col += 4)
+            {
+                dst[col + 0] = table0[src[col + 0]];
+                dst[col + 1] = table1[src[col + 1]];
+                dst[col + 2] = table2[src[col + 2]];
+                dst[col + 3] = table3[src[col + 3]];
+            }
+        }
+
+        void Lut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, const uint8_t * table, uint8_t * dst, size_t dstStride)
+        {
+            assert(channels == 1 || channels == 3 || channels == 4);
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                switch (channels)
+                {
+                case 1: Lut8u1(src, width, table, dst); break;
+                case 3: Lut8u3(src, width, table, dst); break;
+                case 4: Lut8u4(src, width, table, dst); break;
+                default:
+                    assert(0);
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Lut16uTo8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, size_t bits, uint8_t * dst, size_t dstStride)
+        {
+            assert(bits >= 1 && bits <= 16);
+
+            const size_t last = (size_t(1) << bits) - 1;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t * s = (const uint16_t *)src;
+                for (size_t col = 0; col < width; ++col)
+                    dst[col] = table[Simd::Min<size_t>(s[col], last)];
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+    }
+}
@@ -28,37 +28,38 @@ namespace Simd
 {
     namespace Base
     {
-
         SIMD_INLINE double Miliseconds(int64_t count)
         {
             return double(count) / double(TimeFrequency()) * 1000.0;
         }
 
-        PerformanceMeasurer::PerformanceMeasurer(const String& name, int64_t flop)
-            : _name(name)
-            , _flop(flop)
-            , _count(0)
+        SIMD_INLINE size_t HistogramBin(int64_t count)
+        {
+            int64_t us = count * 1000000 / TimeFrequency();
+            size_t bin = 0;
+            while (us > 0 && bin < PERFORMANCE_HISTOGRAM_SIZE - 1)
+                us >>= 1, bin++;
+            return bin;
+        }
+
+        PerformanceMeasurer::PerformanceMeasurer()
+            : _start(0)
             , _current(0)
-            , _total(0)
-            , _min(std::numeric_limits<int64_t>::max())
-            , _max(std::numeric_limits<int64_t>::min())
             , _entered(false)
             , _paused(false)
         {
+            Clear(0);
         }
 
-        PerformanceMeasurer::PerformanceMeasurer(const PerformanceMeasurer & pm)
-            : _name(pm._name)
-            , _flop(pm._flop)
-            , _count(pm._count)
-            , _start(pm._start)
-            , _current(pm._current)
-            , _total(pm._total)
-            , _min(pm._min)
-            , _max(pm._max)
-            , _entered(pm._entered)
-            , _paused(pm._paused)
+        void PerformanceMeasurer::Clear(size_t generation)
         {
+            _count.store(0, std::memory_order_relaxed);
+            _total.store(0, std::memory_order_relaxed);
+            _min.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+            _max.store(std::numeric_limits<int64_t>::min(), std::memory_order_relaxed);
+            for (size_t i = 0; i < PERFORMANCE_HISTOGRAM_SIZE; ++i)
+                _histogram[i].store(0, std::memory_order_relaxed);
+            _generation.store(generation, std::memory_order_release);
         }
 
         void PerformanceMeasurer::Enter()
@@ -82,74 +83,193 @@ namespace Simd
                 }
                 if (!pause)
                 {
-                    _total += _current;
-                    _min = std::min(_min, _current);
-                    _max = std::max(_max, _current);
-                    ++_count;
+                    size_t generation = PerformanceMeasurerStorage::s_storage.Generation();
+                    if (_generation.load(std::memory_order_relaxed) != generation)
+                        Clear(generation);
+                    _total.store(_total.load(std::memory_order_relaxed) + _current, std::memory_order_relaxed);
+                    if (_current < _min.load(std::memory_order_relaxed))
+                        _min.store(_current, std::memory_order_relaxed);
+                    if (_current > _max.load(std::memory_order_relaxed))
+                        _max.store(_current, std::memory_order_relaxed);
+                    std::atomic<int64_t> & bin = _histogram[HistogramBin(_current)];
+                    bin.store(bin.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                    _count.store(_count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
                     _current = 0;
                 }
                 _paused = pause;
             }
         }
 
-        String PerformanceMeasurer::Statistic() const
+        void PerformanceMeasurer::Combine(size_t generation, SimdPerformanceCounter & counter) const
         {
-            std::stringstream ss;
-            ss << _name << ": ";
-            ss << std::setprecision(0) << std::fixed << Miliseconds(_total) << " ms";
-            ss << " / " << _count << " = ";
-            ss << std::setprecision(3) << std::fixed << Average() << " ms";
-            ss << std::setprecision(3) << " {min=" << Miliseconds(_min) << "; max=" << Miliseconds(_max) << "}";
-            if (_flop)
-                ss << " " << std::setprecision(1) << GFlops() << " GFlops";
-            return ss.str();
+            if (_generation.load(std::memory_order_acquire) != generation)
+                return;
+            int64_t count = _count.load(std::memory_order_acquire);
+            if (count == 0)
+                return;
+            counter.count += count;
+            counter.total += Miliseconds(_total.load(std::memory_order_relaxed));
+            counter.min = std::min(counter.min, Miliseconds(_min.load(std::memory_order_relaxed)));
+            counter.max = std::max(counter.max, Miliseconds(_max.load(std::memory_order_relaxed)));
+            for (size_t i = 0; i < PERFORMANCE_HISTOGRAM_SIZE; ++i)
+                counter.histogram[i] += _histogram[i].load(std::memory_order_relaxed);
         }
 
-        void PerformanceMeasurer::Combine(const PerformanceMeasurer& other)
-        {
-            _count += other._count;
-            _total += other._total;
-            _min = std::min(_min, other._min);
-            _max = std::max(_max, other._max);
-        }
+        //---------------------------------------------------------------------
 
-        double PerformanceMeasurer::Average() const
+        PerformanceMeasurerStorage::Thread::Thread()
         {
-            return _count ? (Miliseconds(_total) / _count) : 0;
+            for (size_t i = 0; i < CHUNK_MAX; ++i)
+                chunks[i].store(NULL, std::memory_order_relaxed);
         }
 
-        double PerformanceMeasurer::GFlops() const
+        PerformanceMeasurerStorage::Thread::~Thread()
         {
-            return _count && _flop && _total > 0 ? (double(_flop) * _count / Miliseconds(_total) / 1000000.0) : 0;
+            for (size_t i = 0; i < CHUNK_MAX; ++i)
+                delete[] chunks[i].load(std::memory_order_relaxed);
         }
 
         //---------------------------------------------------------------------
 
         PerformanceMeasurerStorage PerformanceMeasurerStorage::s_storage;
 
-        const char * PerformanceMeasurerStorage::PerformanceStatistic()
+        PerformanceMeasurerStorage::PerformanceMeasurerStorage()
+            : _generation(1)
+        {
+            _names.push_back(String());
+            _flops.push_back(0);
+        }
+
+        size_t PerformanceMeasurerStorage::Register(const String & name, int64_t flop)
         {
-            if (_map.empty())
-                return "";
-            FunctionMap combined;
             std::lock_guard<std::mutex> lock(_mutex);
-            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
+            IdMap::const_iterator it = _ids.find(name);
+            if (it != _ids.end())
+                return it->second;
+            size_t id = _names.size();
+            if (id >= CHUNK_SIZE * CHUNK_MAX)
+                return 0;
+            _ids[name] = id;
+            _names.push_back(name);
+            _flops.push_back(flop);
+            return id;
+        }
+
+        void PerformanceMeasurerStorage::Combine(CounterVector & counters)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            size_t generation = Generation();
+            CounterVector all(_names.size());
+            for (size_t id = 1; id < all.size(); ++id)
+            {
+                SimdPerformanceCounter & counter = all[id];
+                memset(&counter, 0, sizeof(counter));
+                counter.name = _names[id].c_str();
+                counter.min = std::numeric_limits<double>::max();
+            }
+            for (size_t t = 0; t < _threads.size(); ++t)
             {
-                for (FunctionMap::const_iterator function = thread->second.begin(); function != thread->second.end(); ++function)
+                for (size_t c = 0; c < CHUNK_MAX; ++c)
                 {
-                    if (combined.find(function->first) == combined.end())
-                        combined[function->first].reset(new PerformanceMeasurer(*function->second));
-                    else
-                        combined[function->first]->Combine(*function->second);
+                    const PerformanceMeasurer * measurers = _threads[t]->chunks[c].load(std::memory_order_acquire);
+                    if (measurers == NULL)
+                        continue;
+                    for (size_t i = 0, id = c * CHUNK_SIZE; i < CHUNK_SIZE && id < all.size(); ++i, ++id)
+                        if (id)
+                            measurers[i].Combine(generation, all[id]);
                 }
             }
+            counters.clear();
+            for (IdMap::const_iterator it = _ids.begin(); it != _ids.end(); ++it)
+            {
+                SimdPerformanceCounter & counter = all[it->second];
+                if (counter.count == 0)
+                    continue;
+                counter.average = counter.total / counter.count;
+                int64_t flop = _flops[it->second];
+                counter.gflops = flop && counter.total > 0 ? double(flop) * counter.count / counter.total / 1000000.0 : 0;
+                counters.push_back(counter);
+            }
+        }
+
+        size_t PerformanceMeasurerStorage::Counters(SimdPerformanceCounter * counters, size_t size)
+        {
+            CounterVector combined;
+            Combine(combined);
+            for (size_t i = 0; i < combined.size() && i < size && counters; ++i)
+                counters[i] = combined[i];
+            return combined.size();
+        }
+
+        const char * PerformanceMeasurerStorage::PerformanceStatistic()
+        {
+            CounterVector combined;
+            Combine(combined);
+            if (combined.empty())
+                return "";
             std::stringstream report;
             report << std::endl << "Simd Library Internal Performance Statistics:" << std::endl;
-            for (FunctionMap::const_iterator it = combined.begin(); it != combined.end(); ++it)
-                report << it->second->Statistic() << std::endl;
+            for (size_t i = 0; i < combined.size(); ++i)
+            {
+                const SimdPerformanceCounter & c = combined[i];
+                report << c.name << ": ";
+                report << std::setprecision(0) << std::fixed << c.total << " ms";
+                report << " / " << c.count << " = ";
+                report << std::setprecision(3) << std::fixed << c.average << " ms";
+                report << std::setprecision(3) << " {min=" << c.min << "; max=" << c.max << "}";
+                if (c.gflops > 0)
+                    report << " " << std::setprecision(1) << c.gflops << " GFlops";
+                report << std::endl;
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
             _report = report.str();
             return _report.c_str();
         }
+
+        SIMD_INLINE void JsonString(std::ostream & os, const char * str)
+        {
+            os << "\"";
+            for (; *str; ++str)
+            {
+                if (*str == '"' || *str == '\\')
+                    os << '\\' << *str;
+                else if ((unsigned char)*str < 0x20)
+                    os << ' ';
+                else
+                    os << *str;
+            }
+            os << "\"";
+        }
+
+        const char * PerformanceMeasurerStorage::PerformanceJson()
+        {
+            CounterVector combined;
+            Combine(combined);
+            std::stringstream json;
+            json << std::setprecision(6) << std::fixed;
+            json << "[";
+            for (size_t i = 0; i < combined.size(); ++i)
+            {
+                const SimdPerformanceCounter & c = combined[i];
+                json << (i ? ",\n" : "\n") << "{\"name\":";
+                JsonString(json, c.name);
+                json << ",\"count\":" << c.count << ",\"total\":" << c.total;
+                json << ",\"min\":" << c.min << ",\"average\":" << c.average << ",\"max\":" << c.max;
+                json << ",\"gflops\":" << c.gflops << ",\"histogram\":[";
+                for (size_t j = 0; j < PERFORMANCE_HISTOGRAM_SIZE; ++j)
+                    json << (j ? "," : "") << c.histogram[j];
+                json << "]}";
+            }
+            json << (combined.empty() ? "]" : "\n]");
+            std::lock_guard<std::mutex> lock(_mutex);
+            _json = json.str();
+            return _json.c_str();
+        }
+
+        void PerformanceMeasurerStorage::Reset()
+        {
+            _generation.fetch_add(1);
+        }
     }
 }
 #endif//SIMD_PERFORMANCE_STATISTIC
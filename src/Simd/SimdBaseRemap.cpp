@@ -0,0 +1,278 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+
+namespace Simd
+{
+    Remap::Remap(const WarpParam & param)
+        : _param(param)
+    {
+        _mapX.Resize(_param.dstW * _param.dstH);
+        _mapY.Resize(_param.dstW * _param.dstH);
+    }
+
+    void Remap::SetCoord(size_t x, size_t y, double sx, double sy)
+    {
+        size_t offset = y * _param.dstW + x;
+        sx = Simd::RestrictRange(sx, -2.0, double(_param.srcW + 1));
+        sy = Simd::RestrictRange(sy, -2.0, double(_param.srcH + 1));
+        if (_param.IsNearest())
+        {
+            _mapX[offset] = (int32_t)::floor(sx + 0.5) * WARP_RANGE;
+            _mapY[offset] = (int32_t)::floor(sy + 0.5) * WARP_RANGE;
+        }
+        else
+        {
+            _mapX[offset] = (int32_t)::floor(sx * WARP_RANGE + 0.5);
+            _mapY[offset] = (int32_t)::floor(sy * WARP_RANGE + 0.5);
+        }
+    }
+
+    void Remap::SetMap(const float * map, size_t mapStride)
+    {
+        for (size_t y = 0; y < _param.dstH; ++y)
+        {
+            const float * row = (const float*)((const uint8_t*)map + y * mapStride);
+            for (size_t x = 0; x < _param.dstW; ++x)
+                SetCoord(x, y, row[2 * x + 0], row[2 * x + 1]);
+        }
+        SetSegments();
+    }
+
+    bool Remap::SetPerspective(const float * mat)
+    {
+        double m[9], i[9];
+        for (size_t k = 0; k < 9; ++k)
+            m[k] = mat[k];
+        i[0] = m[4] * m[8] - m[5] * m[7];
+        i[1] = m[2] * m[7] - m[1] * m[8];
+        i[2] = m[1] * m[5] - m[2] * m[4];
+        i[3] = m[5] * m[6] - m[3] * m[8];
+        i[4] = m[0] * m[8] - m[2] * m[6];
+        i[5] = m[2] * m[3] - m[0] * m[5];
+        i[6] = m[3] * m[7] - m[4] * m[6];
+        i[7] = m[1] * m[6] - m[0] * m[7];
+        i[8] = m[0] * m[4] - m[1] * m[3];
+        double det = m[0] * i[0] + m[1] * i[3] + m[2] * i[6];
+        if (det == 0.0)
+            return false;
+        for (size_t y = 0; y < _param.dstH; ++y)
+        {
+            for (size_t x = 0; x < _param.dstW; ++x)
+            {
+                double w = i[6] * x + i[7] * y + i[8];
+                if (w != 0.0)
+                    SetCoord(x, y, (i[0] * x + i[1] * y + i[2]) / w, (i[3] * x + i[4] * y + i[5]) / w);
+                else
+                    SetCoord(x, y, -2.0, -2.0);
+            }
+        }
+        SetSegments();
+        return true;
+    }
+
+    bool Remap::Inside(size_t offset) const
+    {
+        int ix = _mapX[offset] >> WARP_SHIFT, iy = _mapY[offset] >> WARP_SHIFT;
+        int w = (int)_param.srcW, h = (int)_param.srcH;
+        if (_param.IsBilinear())
+            w--, h--;
+        return ix >= 0 && ix < w && iy >= 0 && iy < h;
+    }
+
+    void Remap::SetSegments()
+    {
+        _segments.clear();
+        _rows.resize(_param.dstH + 1);
+        for (size_t y = 0, offset = 0; y < _param.dstH; ++y)
+        {
+            _rows[y] = _segments.size();
+            for (size_t x = 0; x < _param.dstW; ++x, ++offset)
+            {
+                bool inside = Inside(offset);
+                if (x == 0 || _segments.back().inside != inside)
+                {
+                    Segment segment = { (int32_t)x, (int32_t)x + 1, inside };
+                    _segments.push_back(segment);
+                }
+                else
+                    _segments.back().end++;
+            }
+        }
+        _rows[_param.dstH] = _segments.size();
+    }
+
+    void Remap::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd) const
+    {
+        assert(srcStride * _param.srcH <= INT32_MAX);
+        dst += yBeg * dstStride;
+        for (size_t y = yBeg; y < yEnd; ++y, dst += dstStride)
+        {
+            for (size_t i = _rows[y]; i < _rows[y + 1]; ++i)
+            {
+                const Segment & segment = _segments[i];
+                if (segment.inside)
+                    RunInterior(src, srcStride, y, segment.beg, segment.end, dst);
+                else
+                    RunBorder(src, srcStride, y, segment.beg, segment.end, dst);
+            }
+        }
+    }
+
+    namespace Base
+    {
+        RemapNearest::RemapNearest(const WarpParam & param)
+            : Remap(param)
+        {
+        }
+
+        void RemapNearest::RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t pixelSize = _param.PixelSize();
+            const int32_t * mapX = _mapX.data + y * _param.dstW, * mapY = _mapY.data + y * _param.dstW;
+            for (size_t x = beg; x < end; ++x)
+            {
+                const uint8_t * ps = WarpPixel(src, srcStride, _param, mapX[x] >> WARP_SHIFT, mapY[x] >> WARP_SHIFT);
+                WarpCopyPixel(ps, pixelSize, dst + x * pixelSize);
+            }
+        }
+
+        void RemapNearest::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t pixelSize = _param.PixelSize();
+            const int32_t * mapX = _mapX.data + y * _param.dstW, * mapY = _mapY.data + y * _param.dstW;
+            for (size_t x = beg; x < end; ++x)
+            {
+                const uint8_t * ps = src + (mapY[x] >> WARP_SHIFT) * srcStride + (mapX[x] >> WARP_SHIFT) * pixelSize;
+                WarpCopyPixel(ps, pixelSize, dst + x * pixelSize);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        RemapByteBilinear::RemapByteBilinear(const WarpParam & param)
+            : Remap(param)
+        {
+        }
+
+        void RemapByteBilinear::RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels;
+            const int32_t * mapX = _mapX.data + y * _param.dstW, * mapY = _mapY.data + y * _param.dstW;
+            for (size_t x = beg; x < end; ++x)
+            {
+                int ix = mapX[x] >> WARP_SHIFT, iy = mapY[x] >> WARP_SHIFT;
+                WarpByteInterp(WarpPixel(src, srcStride, _param, ix, iy), WarpPixel(src, srcStride, _param, ix + 1, iy),
+                    WarpPixel(src, srcStride, _param, ix, iy + 1), WarpPixel(src, srcStride, _param, ix + 1, iy + 1),
+                    cn, mapX[x] & WARP_MASK, mapY[x] & WARP_MASK, dst + x * cn);
+            }
+        }
+
+        void RemapByteBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels;
+            const int32_t * mapX = _mapX.data + y * _param.dstW, * mapY = _mapY.data + y * _param.dstW;
+            for (size_t x = beg; x < end; ++x)
+            {
+                const uint8_t * p0 = src + (mapY[x] >> WARP_SHIFT) * srcStride + (mapX[x] >> WARP_SHIFT) * cn, * p1 = p0 + srcStride;
+                WarpByteInterp(p0, p0 + cn, p1, p1 + cn, cn, mapX[x] & WARP_MASK, mapY[x] & WARP_MASK, dst + x * cn);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        RemapFloatBilinear::RemapFloatBilinear(const WarpParam & param)
+            : Remap(param)
+        {
+        }
+
+        SIMD_INLINE void RemapFloatInterp(const float * p00, const float * p01, const float * p10, const float * p11, size_t channels, int ix, int iy, float * dst)
+        {
+            float fx = float(ix & WARP_MASK) * (1.0f / WARP_RANGE), gx = 1.0f - fx;
+            float fy = float(iy & WARP_MASK) * (1.0f / WARP_RANGE), gy = 1.0f - fy;
+            for (size_t c = 0; c < channels; ++c)
+                dst[c] = (p00[c] * gx + p01[c] * fx) * gy + (p10[c] * gx + p11[c] * fx) * fy;
+        }
+
+        void RemapFloatBilinear::RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels;
+            const int32_t * mapX = _mapX.data + y * _param.dstW, * mapY = _mapY.data + y * _param.dstW;
+            for (size_t x = beg; x < end; ++x)
+            {
+                int ix = mapX[x] >> WARP_SHIFT, iy = mapY[x] >> WARP_SHIFT;
+                RemapFloatInterp((float*)WarpPixel(src, srcStride, _param, ix, iy), (float*)WarpPixel(src, srcStride, _param, ix + 1, iy),
+                    (float*)WarpPixel(src, srcStride, _param, ix, iy + 1), (float*)WarpPixel(src, srcStride, _param, ix + 1, iy + 1),
+                    cn, mapX[x], mapY[x], (float*)dst + x * cn);
+            }
+        }
+
+        void RemapFloatBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels, stride = srcStride / sizeof(float);
+            const int32_t * mapX = _mapX.data + y * _param.dstW, * mapY = _mapY.data + y * _param.dstW;
+            for (size_t x = beg; x < end; ++x)
+            {
+                const float * p0 = (float*)src + (mapY[x] >> WARP_SHIFT) * stride + (mapX[x] >> WARP_SHIFT) * cn, * p1 = p0 + stride;
+                RemapFloatInterp(p0, p0 + cn, p1, p1 + cn, cn, mapX[x], mapY[x], (float*)dst + x * cn);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE Remap * CreateRemap(const WarpParam & param)
+        {
+            if (param.IsNearest())
+                return new RemapNearest(param);
+            else if (param.IsByte())
+                return new RemapByteBilinear(param);
+            else
+                return new RemapFloatBilinear(param);
+        }
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, flags, border);
+            if (!param.Valid() || map == NULL)
+                return NULL;
+            Remap * remap = CreateRemap(param);
+            remap->SetMap(map, mapStride);
+            return remap;
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, flags, border);
+            if (!param.Valid())
+                return NULL;
+            Remap * remap = CreateRemap(param);
+            if (!remap->SetPerspective(mat))
+            {
+                delete remap;
+                return NULL;
+            }
+            return remap;
+        }
+    }
+}
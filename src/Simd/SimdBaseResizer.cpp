@@ -23,9 +23,70 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdCpu.h"
 
 namespace Simd
 {
+    ResizerPyramid::ResizerPyramid(Resizer::InitPtr init, size_t srcX, size_t srcY, const size_t * dstX, const size_t * dstY, size_t count,
+        size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        : _init(init)
+        , _threads(0)
+    {
+        for (size_t i = 0; i < count; ++i)
+            _params.push_back(ResParam(srcX, srcY, dstX[i], dstY[i], channels, type, method, sizeof(void*)));
+        size_t rowSize = srcX * channels * (count ? _params[0].ChannelSize() : 1);
+        _tile = Max<size_t>(Base::AlgCacheL2() / 2 / Max<size_t>(rowSize, 1), 4);
+    }
+
+    ResizerPyramid::~ResizerPyramid()
+    {
+        for (size_t i = 0; i < _resizers.size(); ++i)
+            delete _resizers[i];
+    }
+
+    bool ResizerPyramid::InitThreads(size_t number)
+    {
+        size_t threads = _threads, size = _resizers.size();
+        for (; _threads < number; ++_threads)
+        {
+            for (size_t i = 0; i < _params.size(); ++i)
+            {
+                const ResParam & p = _params[i];
+                Resizer * resizer = (Resizer*)_init(p.srcW, p.srcH, p.dstW, p.dstH, p.channels, p.type, p.method);
+                if (resizer == NULL)
+                {
+                    for (size_t j = size; j < _resizers.size(); ++j)
+                        delete _resizers[j];
+                    _resizers.resize(size);
+                    _threads = threads;
+                    return false;
+                }
+                _resizers.push_back(resizer);
+            }
+        }
+        return true;
+    }
+
+    void ResizerPyramid::Run(size_t thread, size_t srcBeg, size_t srcEnd, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride)
+    {
+        size_t count = _params.size();
+        Resizer ** resizers = _resizers.data() + thread * count;
+        std::vector<size_t> rows(count);
+        for (size_t i = 0; i < count; ++i)
+            rows[i] = DstRow(i, srcBeg);
+        for (size_t tile = srcBeg; tile < srcEnd;)
+        {
+            tile = Min(tile + _tile, srcEnd);
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t end = DstRow(i, tile);
+                if (end > rows[i])
+                    resizers[i]->RunRows(rows[i], end, src, srcStride, dst[i] + rows[i] * dstStride[i], dstStride[i]);
+                rows[i] = end;
+            }
+        }
+    }
+
     namespace Base
     {
         ResizerByteBilinear::ResizerByteBilinear(const ResParam & param)
@@ -81,7 +142,7 @@ namespace Simd
             }
             int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 int32_t fy = _ay[dy];
                 int32_t sy = _iy[dy];
@@ -195,7 +256,7 @@ namespace Simd
         {
             int32_t ts[N], rs[N];
             int32_t ayb = _ay.data[0], axb = _ax.data[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 size_t by = _iy.data[dy], ey = _iy.data[dy + 1];
                 int32_t ayn = _ay.data[dy], ayt = - _ay.data[dy + 1];
@@ -239,18 +300,18 @@ namespace Simd
         {
             _ay.Resize(_param.dstH, false, _param.align);
             _iy.Resize(_param.dstH, false, _param.align);
-            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
+            EstimateIndexAlpha(_param.method, _param.srcH, _param.dstH, 1, _iy.data, _ay.data);
             size_t rs = _param.dstW * _param.channels;
             _ax.Resize(rs, false, _param.align);
             _ix.Resize(rs, false, _param.align);
-            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+            EstimateIndexAlpha(_param.method, _param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
             _bx[0].Resize(rs, false, _param.align);
             _bx[1].Resize(rs, false, _param.align);
         }
 
-        void ResizerFloatBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas)
+        void ResizerFloatBilinear::EstimateIndexAlpha(SimdResizeMethodType method, size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas)
         {
-            if (_param.method == SimdResizeMethodBilinear)
+            if (method == SimdResizeMethodBilinear)
             {
                 float scale = (float)srcSize / dstSize;
                 for (size_t i = 0; i < dstSize; ++i)
@@ -276,7 +337,7 @@ namespace Simd
                     }
                 }
             }            
-            else if (_param.method == SimdResizeMethodCaffeInterp)
+            else if (method == SimdResizeMethodCaffeInterp)
             {
                 float scale = dstSize > 1 ? float(srcSize - 1) / float(dstSize - 1) : 0.0f;
                 for (size_t i = 0; i < dstSize; ++i)
@@ -297,7 +358,7 @@ namespace Simd
                     }
                 }
             }
-            else if (_param.method == SimdResizeMethodInferenceEngineInterp)
+            else if (method == SimdResizeMethodInferenceEngineInterp)
             {
                 float scale = (float)srcSize / dstSize;
                 for (size_t i = 0; i < dstSize; ++i)
@@ -339,7 +400,7 @@ namespace Simd
             size_t rs = _param.dstW * cn;
             float * pbx[2] = { _bx[0].data, _bx[1].data };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -375,6 +436,388 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SIMD_INLINE float ResizerFilterBicubic(float x)
+        {
+            const float a = -0.5f;
+            x = ::fabs(x);
+            if (x < 1.0f)
+                return ((a + 2.0f) * x - (a + 3.0f)) * x * x + 1.0f;
+            if (x < 2.0f)
+                return (((x - 5.0f) * x + 8.0f) * x - 4.0f) * a;
+            return 0.0f;
+        }
+
+        SIMD_INLINE float ResizerFilterSinc(float x)
+        {
+            if (x == 0.0f)
+                return 1.0f;
+            x *= 3.14159265358979f;
+            return ::sin(x) / x;
+        }
+
+        SIMD_INLINE float ResizerFilterLanczos3(float x)
+        {
+            if (x > -3.0f && x < 3.0f)
+                return ResizerFilterSinc(x) * ResizerFilterSinc(x / 3.0f);
+            return 0.0f;
+        }
+
+        void ResizerFilterWeights(SimdResizeMethodType method, size_t srcSize, size_t dstSize, size_t & kernel, int32_t * indices, float * weights)
+        {
+            float (*filter)(float) = method == SimdResizeMethodBicubic ? ResizerFilterBicubic : ResizerFilterLanczos3;
+            float support = method == SimdResizeMethodBicubic ? 2.0f : 3.0f;
+            float scale = float(srcSize) / float(dstSize);
+            float fscale = Simd::Max(scale, 1.0f);
+            support *= fscale;
+            kernel = Simd::Min<size_t>((size_t)::ceil(support) * 2 + 1, srcSize);
+            if (weights == NULL)
+                return;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float center = (float(i) + 0.5f) * scale;
+                ptrdiff_t lo = Simd::Max<ptrdiff_t>((ptrdiff_t)::floor(center - support + 0.5f), 0);
+                ptrdiff_t hi = Simd::Min<ptrdiff_t>((ptrdiff_t)::floor(center + support + 0.5f), srcSize);
+                ptrdiff_t beg = Simd::Min<ptrdiff_t>(lo, srcSize - kernel);
+                float * w = weights + i * kernel, sum = 0.0f;
+                for (size_t k = 0; k < kernel; ++k)
+                {
+                    ptrdiff_t j = beg + k;
+                    w[k] = j >= lo && j < hi ? filter((float(j) - center + 0.5f) / fscale) : 0.0f;
+                    sum += w[k];
+                }
+                if (sum != 0.0f)
+                    for (size_t k = 0; k < kernel; ++k)
+                        w[k] /= sum;
+                indices[i] = (int32_t)beg;
+            }
+        }
+
+        static void ResizerFilterQuantize(const float * src, size_t size, int16_t * dst)
+        {
+            int32_t sum = 0;
+            size_t max = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                dst[i] = (int16_t)Round(src[i] * float(1 << FILTER_BITS));
+                sum += dst[i];
+                if (::fabs(src[i]) > ::fabs(src[max]))
+                    max = i;
+            }
+            dst[max] += int16_t((1 << FILTER_BITS) - sum);
+        }
+
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Resizer(param)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+            Array32f weights;
+
+            ResizerFilterWeights(_param.method, _param.srcH, _param.dstH, _ky, NULL, NULL);
+            weights.Resize(_param.dstH * _ky);
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH * _ky);
+            ResizerFilterWeights(_param.method, _param.srcH, _param.dstH, _ky, _iy.data, weights.data);
+            for (size_t dy = 0; dy < _param.dstH; ++dy)
+                ResizerFilterQuantize(weights.data + dy * _ky, _ky, _ay.data + dy * _ky);
+
+            size_t kx;
+            ResizerFilterWeights(_param.method, _param.srcW, _param.dstW, kx, NULL, NULL);
+            weights.Resize(_param.dstW * kx);
+            Array32i ix(_param.dstW);
+            Array16i ax(kx);
+            ResizerFilterWeights(_param.method, _param.srcW, _param.dstW, kx, ix.data, weights.data);
+            _kx = AlignHi(kx * cn, 8);
+            _ix.Resize(rs);
+            _ax.Resize(rs * _kx, true);
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+            {
+                ResizerFilterQuantize(weights.data + dx * kx, kx, ax.data);
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    size_t e = dx * cn + c;
+                    _ix[e] = ix[dx] * (int32_t)cn;
+                    for (size_t k = 0; k < kx; ++k)
+                        _ax[e * _kx + k * cn + c] = ax[k];
+                }
+            }
+            _bx.Resize(_param.srcW * cn + _kx, true);
+        }
+
+        void ResizerByteFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t rs = _param.srcW * _param.channels, rd = _param.dstW * _param.channels;
+            int16_t * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const uint8_t * ps = src + _iy[dy] * srcStride;
+                const int16_t * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rs; ++sx)
+                {
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < _ky; ++k)
+                        sum += ps[k * srcStride + sx] * ay[k];
+                    bx[sx] = (int16_t)((sum + FILTER_ROW_ROUND) >> FILTER_ROW_SHIFT);
+                }
+                for (size_t dx = 0; dx < rd; ++dx)
+                {
+                    const int16_t * pb = bx + _ix[dx];
+                    const int16_t * ax = _ax.data + dx * _kx;
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < _kx; ++k)
+                        sum += pb[k] * ax[k];
+                    dst[dx] = RestrictRange((sum + FILTER_ROUND) >> FILTER_SHIFT, 0, 255);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Resizer(param)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+
+            ResizerFilterWeights(_param.method, _param.srcH, _param.dstH, _ky, NULL, NULL);
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH * _ky);
+            ResizerFilterWeights(_param.method, _param.srcH, _param.dstH, _ky, _iy.data, _ay.data);
+
+            size_t kx;
+            ResizerFilterWeights(_param.method, _param.srcW, _param.dstW, kx, NULL, NULL);
+            Array32f weights(_param.dstW * kx);
+            Array32i ix(_param.dstW);
+            ResizerFilterWeights(_param.method, _param.srcW, _param.dstW, kx, ix.data, weights.data);
+            _kx = AlignHi(kx * cn, 4);
+            _ix.Resize(rs);
+            _ax.Resize(rs * _kx, true);
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+            {
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    size_t e = dx * cn + c;
+                    _ix[e] = ix[dx] * (int32_t)cn;
+                    for (size_t k = 0; k < kx; ++k)
+                        _ax[e * _kx + k * cn + c] = weights[dx * kx + k];
+                }
+            }
+            _bx.Resize(_param.srcW * cn + _kx, true);
+        }
+
+        void ResizerFloatFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            Run((const float*)src, srcStride / sizeof(float), (float*)dst, dstStride / sizeof(float));
+        }
+
+        void ResizerFloatFilter::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            size_t rs = _param.srcW * _param.channels, rd = _param.dstW * _param.channels;
+            float * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const float * ps = src + _iy[dy] * srcStride;
+                const float * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rs; ++sx)
+                {
+                    float sum = 0.0f;
+                    for (size_t k = 0; k < _ky; ++k)
+                        sum += ps[k * srcStride + sx] * ay[k];
+                    bx[sx] = sum;
+                }
+                for (size_t dx = 0; dx < rd; ++dx)
+                {
+                    const float * pb = bx + _ix[dx];
+                    const float * ax = _ax.data + dx * _kx;
+                    float sum = 0.0f;
+                    for (size_t k = 0; k < _kx; ++k)
+                        sum += pb[k] * ax[k];
+                    dst[dx] = sum;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Resizer(param)
+        {
+            _ay.Resize(_param.dstH, false, _param.align);
+            _iy.Resize(_param.dstH, false, _param.align);
+            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
+            size_t rs = _param.dstW * _param.channels;
+            _ax.Resize(rs, false, _param.align);
+            _ix.Resize(rs, false, _param.align);
+            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+            _bx[0].Resize(rs, false, _param.align);
+            _bx[1].Resize(rs, false, _param.align);
+        }
+
+        void ResizerShortBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, int32_t * alphas)
+        {
+            float scale = (float)srcSize / dstSize;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float alpha = (float)((i + 0.5f) * scale - 0.5f);
+                ptrdiff_t index = (ptrdiff_t)::floor(alpha);
+                alpha -= index;
+                if (index < 0)
+                {
+                    index = 0;
+                    alpha = 0;
+                }
+                if (index > (ptrdiff_t)srcSize - 2)
+                {
+                    index = srcSize - 2;
+                    alpha = 1;
+                }
+                for (size_t c = 0; c < channels; c++)
+                {
+                    size_t offset = i * channels + c;
+                    indices[offset] = (int32_t)(channels * index + c);
+                    alphas[offset] = (int32_t)(alpha * SHORT_LINEAR_RANGE + 0.5f);
+                }
+            }
+        }
+
+        void ResizerShortBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            Run((const uint16_t*)src, srcStride / sizeof(uint16_t), (uint16_t*)dst, dstStride / sizeof(uint16_t));
+        }
+
+        void ResizerShortBilinear::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                int32_t fy = _ay[dy];
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    int32_t * pb = pbx[k];
+                    const uint16_t * ps = src + (sy + k) * srcStride;
+                    for (size_t dx = 0; dx < rs; dx++)
+                    {
+                        int32_t sx = _ix[dx];
+                        pb[dx] = ResizerShortBilinearRow(ps[sx], ps[sx + cn], _ax[dx]);
+                    }
+                }
+
+                for (size_t dx = 0; dx < rs; dx++)
+                    dst[dx] = (uint16_t)ResizerShortBilinearCol(pbx[0][dx], pbx[1][dx], fy);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Resizer(param)
+        {
+            _ay.Resize(_param.dstH + 1);
+            _ty.Resize(_param.dstH);
+            _iy.Resize(_param.dstH + 1);
+            EstimateParams(_param.srcH, _param.dstH, _ay.data, _ty.data, _iy.data);
+
+            _ax.Resize(_param.dstW + 1);
+            _tx.Resize(_param.dstW);
+            _ix.Resize(_param.dstW + 1);
+            EstimateParams(_param.srcW, _param.dstW, _ax.data, _tx.data, _ix.data);
+
+            _by.Resize(_param.srcW * _param.channels + 1, false, _param.align);
+        }
+
+        void ResizerShortArea::EstimateParams(size_t srcSize, size_t dstSize, int32_t * alpha, int32_t * tail, int32_t * index)
+        {
+            float scale = (float)srcSize / dstSize;
+            for (size_t ds = 0; ds <= dstSize; ++ds)
+            {
+                float a = (float)ds*scale;
+                size_t i = (size_t)::floor(a);
+                a -= i;
+                if (i == srcSize)
+                {
+                    i--;
+                    a = 1.0f;
+                }
+                alpha[ds] = int32_t(SHORT_AREA_RANGE * (1.0f - a) / scale + 0.5f);
+                index[ds] = int32_t(i);
+            }
+            for (size_t ds = 0; ds < dstSize; ++ds)
+                tail[ds] = alpha[ds] + (index[ds + 1] - index[ds]) * alpha[0] - SHORT_AREA_RANGE;
+        }
+
+        void ResizerShortArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            Run((const uint16_t*)src, srcStride / sizeof(uint16_t), (uint16_t*)dst, dstStride / sizeof(uint16_t));
+        }
+
+        template<size_t N> void ResizerShortArea::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            size_t dstW = _param.dstW, rowSize = _param.srcW * N;
+            const int32_t * iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data, * ty = _ty.data, * tx = _tx.data;
+            int32_t ay0 = ay[0], ax0 = ax[0];
+            int32_t sum[N];
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                int32_t * buf = _by.data;
+                size_t yn = iy[dy + 1] - iy[dy];
+                const uint16_t * s = src + iy[dy] * srcStride;
+                for (size_t i = 0; i < rowSize; ++i)
+                    buf[i] = s[i] * ay[dy];
+                for (size_t y = 0; y < yn; ++y)
+                {
+                    s += srcStride;
+                    for (size_t i = 0; i < rowSize; ++i)
+                        buf[i] += s[i] * ay0;
+                }
+                for (size_t i = 0; i < rowSize; ++i)
+                    buf[i] = (buf[i] - s[i] * ty[dy] + SHORT_AREA_ROW_ROUND) >> SHORT_AREA_ROW_SHIFT;
+                for (size_t dx = 0; dx < dstW; dx++)
+                {
+                    size_t xn = ix[dx + 1] - ix[dx];
+                    const int32_t * b = buf + ix[dx] * N;
+                    for (size_t c = 0; c < N; ++c)
+                        sum[c] = b[c] * ax[dx];
+                    for (size_t x = 0; x < xn; ++x)
+                    {
+                        b += N;
+                        for (size_t c = 0; c < N; ++c)
+                            sum[c] += b[c] * ax0;
+                    }
+                    for (size_t c = 0; c < N; ++c)
+                        dst[dx * N + c] = (uint16_t)RestrictRange((sum[c] - b[c] * tx[dx] + SHORT_AREA_ROUND) >> SHORT_AREA_SHIFT, 0, 0xFFFF);
+                }
+            }
+        }
+
+        void ResizerShortArea::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            switch (_param.channels)
+            {
+            case 1: Run<1>(src, srcStride, dst, dstStride); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
@@ -384,6 +827,14 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
+            else if (param.IsShortBilinear())
+                return new ResizerShortBilinear(param);
+            else if (param.IsShortArea())
+                return new ResizerShortArea(param);
             else
                 return NULL;
         }
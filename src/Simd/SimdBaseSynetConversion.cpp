@@ -25,6 +25,9 @@
 #include "Simd/SimdBase.h"
 #include "Simd/SimdConversion.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetSetInput.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -197,6 +200,265 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        template<class T> SIMD_INLINE int Yuv10ToGray10(int y)
+        {
+            return RestrictRange((T::Y_2_RGB * (y - T::Y_ADJUST) + T::ROUND) >> T::SHIFT, 0, 1023);
+        }
+
+        template<class T> SIMD_INLINE void Yuv10ToBgr10(int y, int u, int v, int * bgr)
+        {
+            int _y = T::Y_2_RGB * (y - T::Y_ADJUST) + T::ROUND;
+            bgr[0] = RestrictRange((_y + T::U_2_B * (u - T::UV_ADJUST)) >> T::SHIFT, 0, 1023);
+            bgr[1] = RestrictRange((_y + T::U_2_G * (u - T::UV_ADJUST) + T::V_2_G * (v - T::UV_ADJUST)) >> T::SHIFT, 0, 1023);
+            bgr[2] = RestrictRange((_y + T::V_2_R * (v - T::UV_ADJUST)) >> T::SHIFT, 0, 1023);
+        }
+
+        template<class T> void SynetSetInputP010(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            const float* scale, const float* shift, float* dst, size_t channels, SimdTensorFormatType format)
+        {
+            typedef Yuv10<T, 10> Y10;
+            size_t size = width * height;
+            size_t stepC = format == SimdTensorFormatNchw ? size : 1;
+            size_t stepX = format == SimdTensorFormatNchw ? 1 : channels;
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t* y0 = (const uint16_t*)y;
+                const uint16_t* uv0 = (const uint16_t*)uv;
+                for (size_t col = 0; col < width; ++col, dst += stepX)
+                {
+                    if (channels == 1)
+                        dst[0] = ToFloat(Yuv10ToGray10<Y10>(y0[col] >> 6), scale[0], shift[0]);
+                    else
+                    {
+                        int bgr[3];
+                        Yuv10ToBgr10<Y10>(y0[col] >> 6, uv0[col & (~1)] >> 6, uv0[col | 1] >> 6, bgr);
+                        for (size_t c = 0; c < 3; ++c)
+                            dst[c * stepC] = ToFloat(bgr[c], scale[c], shift[c]);
+                    }
+                }
+                y += yStride;
+                if (row & 1)
+                    uv += uvStride;
+            }
+        }
+
+        void SynetSetInputP010(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType,
+            const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (channels == 1 || channels == 3));
+
+            float scale[3];
+            for (size_t i = 0; i < channels; ++i)
+                scale[i] = (upper[i] - lower[i]) / 1023.0f;
+            switch (yuvType)
+            {
+            case SimdYuvBt601: SynetSetInputP010<Bt601>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt709: SynetSetInputP010<Bt709>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt2020: SynetSetInputP010<Bt2020>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvTrect871: SynetSetInputP010<Trect871>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt709Full: SynetSetInputP010<Bt709Full>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt2020Full: SynetSetInputP010<Bt2020Full>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        const size_t SYNET_SET_INPUT_BAND_MIN = 64 * 1024;
+
+        template<class T> void SynetSetInputYuvGray(uint8_t * gray)
+        {
+            for (int i = 0; i < 256; ++i)
+                gray[i] = YuvToRed<T>(i, T::UV_ADJUST);
+        }
+
+        SynetSetInputYuv::SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+            size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format)
+            : _srcW(srcW)
+            , _srcH(srcH)
+            , _dstW(dstW)
+            , _dstH(dstH)
+            , _channels(channels)
+            , _yuvType(yuvType)
+            , _method(method)
+            , _format(format)
+        {
+            assert(Supported(srcW, srcH, method, channels, format));
+            SetRange(lower, upper);
+            switch (format)
+            {
+            case SimdTensorFormatNchw: _stepC = dstW * dstH, _stepX = 1; break;
+            case SimdTensorFormatNhwc: _stepC = 1, _stepX = channels; break;
+            case SimdTensorFormatNchw4c: _stepC = 1, _stepX = 4; break;
+            case SimdTensorFormatNchw8c: _stepC = 1, _stepX = 8; break;
+            case SimdTensorFormatNchw16c: _stepC = 1, _stepX = 16; break;
+            default:
+                assert(0);
+            }
+            _iy.Resize(dstH);
+            _ay.Resize(dstH);
+            ResizerFloatBilinear::EstimateIndexAlpha(method, srcH, dstH, 1, _iy.data, _ay.data);
+            _ix.Resize(dstW);
+            _ax.Resize(dstW);
+            ResizerFloatBilinear::EstimateIndexAlpha(method, srcW, dstW, 1, _ix.data, _ax.data);
+            for (size_t dx = 0; dx < dstW; ++dx)
+                _ix[dx] *= (int32_t)channels;
+            switch (yuvType)
+            {
+            case SimdYuvBt601: SynetSetInputYuvGray<Bt601>(_gray); break;
+            case SimdYuvBt709: SynetSetInputYuvGray<Bt709>(_gray); break;
+            case SimdYuvBt2020: SynetSetInputYuvGray<Bt2020>(_gray); break;
+            case SimdYuvTrect871: SynetSetInputYuvGray<Trect871>(_gray); break;
+            case SimdYuvBt709Full: SynetSetInputYuvGray<Bt709Full>(_gray); break;
+            case SimdYuvBt2020Full: SynetSetInputYuvGray<Bt2020Full>(_gray); break;
+            default:
+                assert(0);
+            }
+        }
+
+        bool SynetSetInputYuv::Supported(size_t srcW, size_t srcH, SimdResizeMethodType method, size_t channels, SimdTensorFormatType format)
+        {
+            if (srcW % 2 != 0 || srcH % 2 != 0 || srcW < 2 || srcH < 2 || (channels != 1 && channels != 3))
+                return false;
+            if (method != SimdResizeMethodBilinear && method != SimdResizeMethodCaffeInterp && method != SimdResizeMethodInferenceEngineInterp)
+                return false;
+            return format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc || format == SimdTensorFormatNchw4c ||
+                format == SimdTensorFormatNchw8c || format == SimdTensorFormatNchw16c;
+        }
+
+        bool SynetSetInputYuv::Equal(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format) const
+        {
+            return _srcW == srcW && _srcH == srcH && _yuvType == yuvType && _method == method &&
+                _dstW == dstW && _dstH == dstH && _channels == channels && _format == format;
+        }
+
+        void SynetSetInputYuv::SetRange(const float * lower, const float * upper)
+        {
+            for (size_t c = 0; c < _channels; ++c)
+            {
+                _scale[c] = (upper[c] - lower[c]) / 255.0f;
+                _shift[c] = lower[c];
+            }
+        }
+
+        void SynetSetInputYuv::Run(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, float * dst)
+        {
+            size_t threadNumber = Min(GetThreadNumber(), _dstH / 2);
+            threadNumber = Min(threadNumber, (_srcW * _srcH + _dstW * _dstH * _channels) / SYNET_SET_INPUT_BAND_MIN);
+            if (threadNumber > 1)
+            {
+                Parallel(0, _dstH, [&](size_t thread, size_t begin, size_t end)
+                {
+                    Run(y, yStride, u, uStride, v, vStride, dst, begin, end);
+                }, threadNumber);
+            }
+            else
+                Run(y, yStride, u, uStride, v, vStride, dst, 0, _dstH);
+        }
+
+        void SynetSetInputYuv::Run(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, float * dst, size_t dyBeg, size_t dyEnd)
+        {
+            size_t rs = _dstW * _channels, half = _srcW / 2;
+            Array8u bgr(_srcW * _channels + SIMD_ALIGN, true), uv(v ? 0 : _srcW + SIMD_ALIGN);
+            Array32f rows(2 * rs);
+            float * pbx[2] = { rows.data, rows.data + rs };
+            int32_t prev = -2;
+            for (size_t dy = dyBeg; dy < dyEnd; ++dy)
+            {
+                int32_t sy = _iy[dy], k = 0;
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+                prev = sy;
+                for (; k < 2; ++k)
+                {
+                    size_t row = sy + k;
+                    const uint8_t * py = y + row * yStride;
+                    if (_channels == 1)
+                    {
+                        for (size_t x = 0; x < _srcW; ++x)
+                            bgr[x] = _gray[py[x]];
+                    }
+                    else
+                    {
+                        const uint8_t * pu = u + row / 2 * uStride, * pv;
+                        if (v)
+                            pv = v + row / 2 * vStride;
+                        else
+                        {
+                            DeinterleaveUv(pu, uv.data, uv.data + half);
+                            pu = uv.data, pv = uv.data + half;
+                        }
+                        YuvToBgr(py, pu, pv, bgr.data);
+                    }
+                    ResizeRow(bgr.data, pbx[k]);
+                }
+                StoreRow(pbx[0], pbx[1], _ay[dy], dst + dy * _dstW * (_format == SimdTensorFormatNchw ? 1 : _stepX));
+            }
+        }
+
+        void SynetSetInputYuv::DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v)
+        {
+            Base::DeinterleaveUv(uv, 0, _srcW / 2, 1, u, 0, v, 0);
+        }
+
+        void SynetSetInputYuv::YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        {
+            Base::Yuv422pToBgrV2(y, 0, u, 0, v, 0, _srcW, 1, bgr, 0, _yuvType);
+        }
+
+        void SynetSetInputYuv::ResizeRow(const uint8_t * src, float * dst)
+        {
+            size_t cn = _channels;
+            for (size_t c = 0; c < cn; ++c, dst += _dstW)
+            {
+                for (size_t dx = 0; dx < _dstW; ++dx)
+                {
+                    const uint8_t * ps = src + _ix[dx] + c;
+                    float fx = _ax[dx];
+                    dst[dx] = ps[0] * (1.0f - fx) + ps[cn] * fx;
+                }
+            }
+        }
+
+        void SynetSetInputYuv::StoreRow(const float * src0, const float * src1, float alpha, float * dst)
+        {
+            float fy1 = alpha, fy0 = 1.0f - alpha;
+            for (size_t c = 0; c < _channels; ++c, src0 += _dstW, src1 += _dstW)
+            {
+                float * pd = dst + c * _stepC;
+                for (size_t dx = 0; dx < _dstW; ++dx, pd += _stepX)
+                    *pd = (src0[dx] * fy0 + src1[dx] * fy1) * _scale[c] + _shift[c];
+            }
+            if (_stepX > _channels)
+            {
+                for (size_t dx = 0; dx < _dstW; ++dx)
+                    for (size_t c = _channels; c < _stepX; ++c)
+                        dst[dx * _stepX + c] = 0;
+            }
+        }
+
+        void SynetSetInputYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, u, uStride, v, vStride, dst);
+        }
+
+        void SynetSetInputNv12(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, uv, uvStride, NULL, 0, dst);
+        }
+
+        //---------------------------------------------------------------------
+
         template<size_t N> SIMD_INLINE void Copy(const float * src, float * dst)
         {
             for (size_t i = 0; i < N; ++i)
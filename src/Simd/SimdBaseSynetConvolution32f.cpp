@@ -26,18 +26,53 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdTime.h"
+
+#include <map>
+#include <mutex>
+#include <fstream>
 
 namespace Simd
 {
 #if defined(SIMD_PERFORMANCE_STATISTIC)
     Base::PerformanceMeasurer * SynetConvolution32f::Perf(const String& func)
     {
-        if (_perf == NULL)
-            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
-        return _perf;
+        if (_perf == 0)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Register(func, Param().Info() + " " + Desc(), Param().Flop());
+        return Simd::Base::PerformanceMeasurerStorage::s_storage.Get(_perf);
     }
 #endif
 
+    void SynetConvolution32f::GetInternals(SynetInternals & internals)
+    {
+        internals.push_back(SynetInternal(_nhwcWeight, _nhwcWeight.size));
+    }
+
+    void SynetConvolution32f::SetInternals(const float * bias, const float * params)
+    {
+        _weight = NULL;
+        _bias = bias;
+        _params = params;
+    }
+
+    size_t SynetConvolution32f::Export(void * data, size_t size) const
+    {
+        SynetInternals internals;
+        ((SynetConvolution32f*)this)->GetInternals(internals);
+        return Base::SynetExport(internals, Desc() + " " + Base::SynetConvolution32fSignature(_param), data, size);
+    }
+
+    bool SynetConvolution32f::Import(const void * data, size_t size, const float * bias, const float * params, bool copy)
+    {
+        SynetInternals internals;
+        GetInternals(internals);
+        if (!Base::SynetImport(internals, Desc() + " " + Base::SynetConvolution32fSignature(_param), data, size, copy))
+            return false;
+        SetInternals(bias, params);
+        return true;
+    }
+
     namespace Base
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst)
@@ -305,7 +340,7 @@ namespace Simd
                     if (_nhwcWeight.data)
                     {
                         if (_gemmCb.Size())
-                            _gemmCb.Run(GemmCbArgs(_M*_merge, _N, _K, tmp, _nhwcWeight.data, dst));
+                            _gemmCb.Run(GemmCbArgs(_M*_merge, _N, _K, tmp, _nhwcWeight.data, dst, _threadNumber));
                         else
                             _nhwcRun(_M*_merge, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
                     }
@@ -337,7 +372,7 @@ namespace Simd
                             if (_nhwcWeight.data)
                             {
                                 if (_gemmCb.Size())
-                                    _gemmCb.Run(GemmCbArgs(_M, _N, _K, tmp, _nhwcWeight.data, dst));
+                                    _gemmCb.Run(GemmCbArgs(_M, _N, _K, tmp, _nhwcWeight.data, dst, _threadNumber));
                                 else
                                     _nhwcRun(_M, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
                             }
@@ -548,6 +583,13 @@ namespace Simd
             }
         }
 
+        bool SynetConvolution32fGemmNT::Supported(const ConvParam32f & p)
+        {
+            if (p.group != 1)
+                return false;
+            return p.trans == 0 || (p.Is1x1() && p.dstC == 1);
+        }
+
         bool SynetConvolution32fGemmNT::Preferable(const ConvParam32f & p)
         {
             if (p.group != 1)
@@ -751,6 +793,12 @@ namespace Simd
                 *internal = SimdTrue;
         }
         
+        void SynetConvolution32fWinograd::GetInternals(SynetInternals & internals)
+        {
+            Simd::SynetConvolution32f::GetInternals(internals);
+            internals.push_back(SynetInternal(_winogradWeight, _nhwcWeight.data ? 0 : _strideW * _count));
+        }
+
         void SynetConvolution32fWinograd::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f & p = _param;
@@ -778,6 +826,21 @@ namespace Simd
             }
         }
 
+        bool SynetConvolution32fWinograd::Supported(const ConvParam32f & p)
+        {
+            if (!p.IsDilation(1) || !p.IsStride(1) || p.group != 1)
+                return false;
+            if (p.IsKernel(1, 3))
+                return (p.IsPad(0) || (p.padX == 1 && p.padW == 1)) && p.trans;
+            else if (p.IsKernel(1, 5))
+                return (p.IsPad(0) || (p.padX == 2 && p.padW == 2)) && p.trans;
+            else if (p.IsKernel(2))
+                return (p.IsPad(0) || (p.padY + p.padH == 1 && p.padX + p.padW == 1)) && p.trans;
+            else if (p.IsKernel(3))
+                return p.IsPad(0) || p.IsPad(1);
+            return false;
+        }
+
         bool SynetConvolution32fWinograd::Preferable(const ConvParam32f & p)
         {
             if (!p.IsDilation(1) || !p.IsStride(1) || p.group != 1 || p.srcC <= 16)
@@ -879,7 +942,7 @@ namespace Simd
                     if (_nhwcWeight.data)
                     {
                         if (_gemmCb.Size())
-                            _gemmCb.Run(GemmCbArgs(_M * _merge, _N, _K, bufS + i * _strideS * _merge, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _merge));
+                            _gemmCb.Run(GemmCbArgs(_M * _merge, _N, _K, bufS + i * _strideS * _merge, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _merge, _threadNumber));
                         else
                             _nhwcRun(_M * _merge, _N, _K, bufS + i * _strideS * _merge, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _merge, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
                     }
@@ -916,7 +979,7 @@ namespace Simd
                         if (_nhwcWeight.data)
                         {
                             if (_gemmCb.Size())
-                                _gemmCb.Run(GemmCbArgs(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD));
+                                _gemmCb.Run(GemmCbArgs(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD, _threadNumber));
                             else
                                 _nhwcRun(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
                         }
@@ -950,7 +1013,7 @@ namespace Simd
         size_t SynetConvolution32fDirectNchw::ExternalBufferSize() const
         {
             if (_pad)
-                return _srcC*_srcH*_srcW;
+                return _srcC*_srcH*_srcW*_threadNumber;
             else
                 return 1;
         }
@@ -962,29 +1025,48 @@ namespace Simd
                 buf = Buffer(buf);
             for (size_t b = 0; b < p.batch; ++b)
             {
-                const float * weight = _weight;
-                const float * bias = _bias;
-                const float * params = _params;
-                for (size_t g = 0; g < p.group; ++g)
+                Simd::Parallel(0, p.dstC, [&](size_t thread, size_t begin, size_t end)
                 {
-                    if (_pad)
-                    {
-                        Pad(src, buf);
-                        _convolutionBiasActivation(buf, _srcC, _srcH, _srcW, weight, bias, params, dst, _dstC, p.dstH, p.dstW);
-                    }
-                    else
-                        _convolutionBiasActivation(src, _srcC, _srcH, _srcW, weight, bias, params, dst, _dstC, p.dstH, p.dstW);
-                    weight += _grW;
-                    if (bias)
-                        bias += _dstC;
-                    if (p.activation == ::SimdConvolutionActivationPrelu)
-                        params += _dstC;
-                    src += _grS;
-                    dst += _grD;
+                    ForwardChannels(src, buf + thread * _srcC * _srcH * _srcW, begin, end, dst);
+                }, _threadNumber);
+                src += _grS * p.group;
+                dst += _grD * p.group;
+            }
+        }
+
+        void SynetConvolution32fDirectNchw::ForwardChannels(const float * src, float * buf, size_t dcBeg, size_t dcEnd, float * dst)
+        {
+            const ConvParam32f & p = _param;
+            size_t sizeW = _srcC * p.kernelY * p.kernelX, sizeD = p.dstH * p.dstW;
+            for (size_t dc = dcBeg; dc < dcEnd;)
+            {
+                size_t g = dc / _dstC, dstC = Simd::Min(dcEnd, (g + 1) * _dstC) - dc;
+                const float * bias = _bias ? _bias + dc : NULL;
+                const float * params = p.activation == ::SimdConvolutionActivationPrelu ? _params + dc : _params;
+                if (_pad)
+                {
+                    Pad(src + g * _grS, buf);
+                    _convolutionBiasActivation(buf, _srcC, _srcH, _srcW, _weight + dc * sizeW, bias, params, dst + dc * sizeD, dstC, p.dstH, p.dstW);
                 }
+                else
+                    _convolutionBiasActivation(src + g * _grS, _srcC, _srcH, _srcW, _weight + dc * sizeW, bias, params, dst + dc * sizeD, dstC, p.dstH, p.dstW);
+                dc += dstC;
             }
         }
 
+        bool SynetConvolution32fDirectNchw::Supported(const ConvParam32f & p)
+        {
+            if (!p.IsDilation(1) || p.trans != 0)
+                return false;
+            if (p.IsStride(1))
+                return p.IsKernel(1) || p.IsKernel(2) || p.IsKernel(3);
+            if (p.IsStride(2))
+                return p.IsKernel(2) || p.IsKernel(3);
+            if (p.IsStride(3))
+                return p.IsKernel(3);
+            return false;
+        }
+
         bool SynetConvolution32fDirectNchw::Preferable(const ConvParam32f & p)
         {
             if (!p.IsDilation(1))
@@ -1173,6 +1255,29 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        size_t RowBandCount(const ConvParam32f & p, size_t threads)
+        {
+            size_t minH = p.padY + p.padH + p.kernelY;
+            return Simd::Max<size_t>(1, Simd::Min(threads, p.dstH / minH));
+        }
+
+        ConvParam32f RowBand(const ConvParam32f & p, size_t dyBeg, size_t dyEnd, size_t & syBeg)
+        {
+            ConvParam32f band = p;
+            ptrdiff_t beg = ptrdiff_t(dyBeg * p.strideY) - ptrdiff_t(p.padY);
+            ptrdiff_t end = ptrdiff_t((dyEnd - 1) * p.strideY + (p.kernelY - 1) * p.dilationY + 1) - ptrdiff_t(p.padY);
+            syBeg = Simd::Max<ptrdiff_t>(beg, 0);
+            size_t syEnd = Simd::Min<ptrdiff_t>(end, p.srcH);
+            band.batch = 1;
+            band.srcH = syEnd - syBeg;
+            band.padY = syBeg - beg;
+            band.padH = end - syEnd;
+            band.dstH = dyEnd - dyBeg;
+            return band;
+        }
+
+        //---------------------------------------------------------------------
+
         SynetConvolution32fDirectNhwc::SynetConvolution32fDirectNhwc(const ConvParam32f & p)
             : SynetConvolution32f(p)
         {
@@ -1184,14 +1289,36 @@ namespace Simd
 
         void SynetConvolution32fDirectNhwc::Forward(const float * src, float * buf, float * dst)
         {
+            const ConvParam32f & p = _param;
+            size_t bands = RowBandCount(p, _threadNumber);
             for (size_t b = 0; b < _batch; ++b)
             {
-                _convolutionBiasActivation(src, _param, _weight, _bias, _params, dst);
+                if (bands > 1)
+                {
+                    Simd::Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            size_t dyBeg = i * p.dstH / bands, dyEnd = (i + 1) * p.dstH / bands, syBeg;
+                            ConvParam32f band = RowBand(p, dyBeg, dyEnd, syBeg);
+                            _convolutionBiasActivation(src + syBeg * p.srcW * p.srcC, band, _weight, _bias, _params, dst + dyBeg * p.dstW * p.dstC);
+                        }
+                    }, bands);
+                }
+                else
+                    _convolutionBiasActivation(src, _param, _weight, _bias, _params, dst);
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
+        bool SynetConvolution32fDirectNhwc::Supported(const ConvParam32f & p)
+        {
+            if (p.trans == 0)
+                return false;
+            return p.group == 1 || p.IsDepthwise();
+        }
+
         bool SynetConvolution32fDirectNhwc::Preferable(const ConvParam32f & p)
         {
             if (p.trans == 0)
@@ -1289,24 +1416,30 @@ namespace Simd
         {
             for (size_t b = 0; b < _batch; ++b)
             {
-                if (_bias)
+                Simd::Parallel(0, _count, [&](size_t thread, size_t begin, size_t end)
                 {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
-                }
-                else
-                {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
-                }
-                if (_param.activation)
-                    ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);                
+                    if (_bias)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                            dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
+                    }
+                    else
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                            dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
+                    }
+                    if (_param.activation)
+                    {
+                        const float * params = _param.activation == ::SimdConvolutionActivationPrelu ? _params + begin : _params;
+                        ConvolutionBiasAndActivation(NULL, end - begin, 1, _param.activation, params, ::SimdFalse, dst + begin);
+                    }
+                }, _threadNumber);
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
-        bool SynetConvolution32fDepthwiseDotProduct::Preferable(const ConvParam32f & p)
+        bool SynetConvolution32fDepthwiseDotProduct::Supported(const ConvParam32f & p)
         {
             if (!(p.IsPad(0) && p.IsDilation(1) && p.IsStride(1)))
                 return false;
@@ -1315,6 +1448,11 @@ namespace Simd
             return p.trans == 0;
         }
 
+        bool SynetConvolution32fDepthwiseDotProduct::Preferable(const ConvParam32f & p)
+        {
+            return Supported(p);
+        }
+
         //---------------------------------------------------------------------
 
         SynetConvolution32fNhwcDirect::SynetConvolution32fNhwcDirect(const ConvParam32f & p)
@@ -1357,10 +1495,17 @@ namespace Simd
                 if (internal)
                     *internal = SimdTrue;
             }
+            SetBias(bias, params);
+        }
+
+        void SynetConvolution32fNhwcDirect::SetBias(const float * bias, const float * params)
+        {
             if (_rBias.data)
             {
                 if (bias)
                     memcpy(_rBias.data, bias, _param.dstC * sizeof(float));
+                else
+                    _rBias.Clear();
                 _bias = _rBias.data;
             }
             if (_rParams.data && _param.activation == ::SimdConvolutionActivationPrelu)
@@ -1370,23 +1515,60 @@ namespace Simd
             }
         }
 
+        void SynetConvolution32fNhwcDirect::GetInternals(SynetInternals & internals)
+        {
+            SynetConvolution32f::GetInternals(internals);
+#ifdef SIMD_SYNET_CONVOLUTION_NHWC_DIRECT_OLD
+            internals.push_back(SynetInternal(_old.weight, _old.weight.size));
+#endif
+            internals.push_back(SynetInternal(_rWeight, _rWeight.size));
+        }
+
+        void SynetConvolution32fNhwcDirect::SetInternals(const float * bias, const float * params)
+        {
+            SynetConvolution32f::SetInternals(bias, params);
+#ifdef SIMD_SYNET_CONVOLUTION_NHWC_DIRECT_OLD
+            if (_old.enable && _old.weight.data)
+                _weight = _old.weight.data;
+            else
+#endif
+            if (_rWeight.data)
+                _weight = _rWeight.data;
+            SetBias(bias, params);
+        }
+
         void SynetConvolution32fNhwcDirect::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f & p = _param;
+#ifdef SIMD_SYNET_CONVOLUTION_NHWC_DIRECT_OLD
+            size_t bands = RowBandCount(p, _threadNumber);
+#endif
             for (size_t b = 0; b < p.batch; ++b)
             {
 #ifdef SIMD_SYNET_CONVOLUTION_NHWC_DIRECT_OLD
-                if(_old.enable)
+                if (_old.enable && bands > 1)
+                {
+                    Simd::Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            size_t dyBeg = i * p.dstH / bands, dyEnd = (i + 1) * p.dstH / bands, syBeg;
+                            ConvParam32f band = RowBand(p, dyBeg, dyEnd, syBeg);
+                            _old.convolution(src + syBeg * p.srcW * p.srcC, band, _old.alg, _weight, _bias, _params, dst + dyBeg * p.dstW * p.dstC);
+                        }
+                    }, bands);
+                }
+                else if (_old.enable)
                     _old.convolution(src, _param, _old.alg, _weight, _bias, _params, dst);
                 else
 #endif
-                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst));
+                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst, _threadNumber));
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
-        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
+        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, size_t dyBeg, size_t dyEnd, const float* weight, const float* bias, const float* params, float* dst)
         {
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
@@ -1394,9 +1576,9 @@ namespace Simd
                 for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    for (size_t yBeg = dyBeg; yBeg < dyEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                        size_t yEnd = Simd::Min(yBeg + a.macroH, dyEnd);
                         if (a.macroC == p.srcC)
                             a.convolutions[TermSingle](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc);
                         else if (sc == 0)
@@ -1518,6 +1700,11 @@ namespace Simd
         }
 #endif
 
+        bool SynetConvolution32fNhwcDirect::Supported(const ConvParam32f & p)
+        {
+            return false;
+        }
+
         bool SynetConvolution32fNhwcDirect::Preferable(const ConvParam32f & p)
         {
             return false;
@@ -1527,27 +1714,149 @@ namespace Simd
 
 //#define SIMD_BASE_ONLY_GEMM_NN
 
+        String SynetConvolution32fSignature(const ConvParam32f & p)
+        {
+            std::stringstream ss;
+            ss << SynetCpuSignature() << "-b" << p.batch << "-" << SynetConvSignature(p) << "-e" << (p.gemm ? 1 : 0);
+            return ss.str();
+        }
+
+        //---------------------------------------------------------------------
+
+        const size_t AUTOTUNE_RUN_MIN = 3;
+        const size_t AUTOTUNE_RUN_MAX = 20;
+        const double AUTOTUNE_TIME_MAX = 0.1;
+
+        struct AutotuneCache
+        {
+            std::mutex mutex;
+            String path;
+            std::map<String, String> choices;
+        };
+
+        static AutotuneCache & GetAutotuneCache()
+        {
+            static AutotuneCache cache;
+            return cache;
+        }
+
+        void SynetConvolution32fSetAutotune(const char * path)
+        {
+            AutotuneCache & cache = GetAutotuneCache();
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            cache.path = path ? path : "";
+            cache.choices.clear();
+            if (cache.path.empty())
+                return;
+            std::ifstream ifs(cache.path.c_str());
+            String key, name;
+            while (ifs >> key >> name)
+                cache.choices[key] = name;
+        }
+
+        bool SynetConvolution32fAutotune::Enable()
+        {
+            AutotuneCache & cache = GetAutotuneCache();
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            return !cache.path.empty();
+        }
+
+        String SynetConvolution32fAutotune::Key() const
+        {
+            std::stringstream ss;
+            ss << _isa << "-t" << GetThreadNumber() << "-" << SynetConvolution32fSignature(_param);
+            return ss.str();
+        }
+
+        double SynetConvolution32fAutotune::Measure(const Candidate & candidate) const
+        {
+            const ConvParam32f & p = _param;
+            Array32f src(p.batch * p.srcC * p.srcH * p.srcW), dst(p.batch * p.dstC * p.dstH * p.dstW);
+            Array32f weight(p.kernelY * p.kernelX * p.srcC / p.group * p.dstC), bias(p.dstC), params(Simd::Max<size_t>(p.dstC, 2));
+            uint32_t seed = 1;
+            for (size_t i = 0; i < src.size; ++i)
+                src[i] = float(int((seed = seed * 1664525 + 1013904223) >> 24) - 128) / 128.0f;
+            for (size_t i = 0; i < weight.size; ++i)
+                weight[i] = float(int((seed = seed * 1664525 + 1013904223) >> 24) - 128) / 1024.0f;
+            for (size_t i = 0; i < bias.size; ++i)
+                bias[i] = 0.1f;
+            for (size_t i = 0; i < params.size; ++i)
+                params[i] = 0.1f;
+            params[1] = 1.0f;
+
+            std::unique_ptr<SynetConvolution32f> convolution(candidate.create(p));
+            convolution->SetParams(weight.data, NULL, bias.data, params.data);
+            convolution->Forward(src.data, NULL, dst.data);
+            double best = DBL_MAX, start = Time();
+            for (size_t i = 0; i < AUTOTUNE_RUN_MAX && (i < AUTOTUNE_RUN_MIN || Time() - start < AUTOTUNE_TIME_MAX); ++i)
+            {
+                double time = Time();
+                convolution->Forward(src.data, NULL, dst.data);
+                best = Simd::Min(best, Time() - time);
+            }
+            return best;
+        }
+
+        SynetConvolution32f * SynetConvolution32fAutotune::Select() const
+        {
+            if (!Enable())
+            {
+                for (size_t i = 0; i < _candidates.size(); ++i)
+                    if (_candidates[i].preferable)
+                        return _candidates[i].create(_param);
+                return _candidates.back().create(_param);
+            }
+            if (_candidates.size() == 1)
+                return _candidates[0].create(_param);
+            AutotuneCache & cache = GetAutotuneCache();
+            String key = Key(), name;
+            {
+                std::lock_guard<std::mutex> lock(cache.mutex);
+                std::map<String, String>::const_iterator it = cache.choices.find(key);
+                if (it != cache.choices.end())
+                    name = it->second;
+            }
+            for (size_t i = 0; i < _candidates.size(); ++i)
+                if (_candidates[i].name == name)
+                    return _candidates[i].create(_param);
+            size_t best = 0;
+            double time = DBL_MAX;
+            for (size_t i = 0; i < _candidates.size(); ++i)
+            {
+                double current = Measure(_candidates[i]);
+                if (current < time)
+                    time = current, best = i;
+            }
+            {
+                std::lock_guard<std::mutex> lock(cache.mutex);
+                cache.choices[key] = _candidates[best].name;
+                if (!cache.path.empty())
+                {
+                    std::ofstream ofs(cache.path.c_str(), std::ios::app);
+                    ofs << key << " " << _candidates[best].name << std::endl;
+                }
+            }
+            return _candidates[best].create(_param);
+        }
+
+        //---------------------------------------------------------------------
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
         {
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
+            SynetConvolution32fAutotune autotune(param, "Base");
 #if !defined(SIMD_BASE_ONLY_GEMM_NN)
-            else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
-                return new SynetConvolution32fDepthwiseDotProduct(param);
-            else if(SynetConvolution32fWinograd::Preferable(param))
-                return new SynetConvolution32fWinograd(param);
-            else if (SynetConvolution32fGemmNT::Preferable(param))
-                return new SynetConvolution32fGemmNT(param);
-            else if (SynetConvolution32fDirectNchw::Preferable(param))
-                return new SynetConvolution32fDirectNchw(param);
-            else if (SynetConvolution32fNhwcDirect::Preferable(param))
-                return new SynetConvolution32fNhwcDirect(param);
-            else if (SynetConvolution32fDirectNhwc::Preferable(param))
-                return new SynetConvolution32fDirectNhwc(param);
+            autotune.Add<SynetConvolution32fDepthwiseDotProduct>("DepthwiseDotProduct", SynetConvolution32fDepthwiseDotProduct::Supported(param), SynetConvolution32fDepthwiseDotProduct::Preferable(param));
+            autotune.Add<SynetConvolution32fWinograd>("Winograd", SynetConvolution32fWinograd::Supported(param), SynetConvolution32fWinograd::Preferable(param));
+            autotune.Add<SynetConvolution32fGemmNT>("GemmNT", SynetConvolution32fGemmNT::Supported(param), SynetConvolution32fGemmNT::Preferable(param));
+            autotune.Add<SynetConvolution32fDirectNchw>("DirectNchw", SynetConvolution32fDirectNchw::Supported(param), SynetConvolution32fDirectNchw::Preferable(param));
+            autotune.Add<SynetConvolution32fNhwcDirect>("NhwcDirect", SynetConvolution32fNhwcDirect::Supported(param), SynetConvolution32fNhwcDirect::Preferable(param));
+            autotune.Add<SynetConvolution32fDirectNhwc>("DirectNhwc", SynetConvolution32fDirectNhwc::Supported(param), SynetConvolution32fDirectNhwc::Preferable(param));
 #endif
-            else
-                return new SynetConvolution32fGemmNN(param);
+            autotune.Add<SynetConvolution32fGemmNN>("GemmNN", true, true);
+            return autotune.Select();
         }
     }
 }
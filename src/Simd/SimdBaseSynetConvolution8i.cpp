@@ -27,13 +27,14 @@
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdLog.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
     SynetConvolution8i::SynetConvolution8i(const ConvParam8i& p)
         : _param(p)
 #if defined(SIMD_PERFORMANCE_STATISTIC)
-        , _perf(NULL)
+        , _perf(0)
 #endif
     {
         _sizeS = p.srcC * p.srcH * p.srcW;
@@ -46,6 +47,8 @@ namespace Simd
         _norm32i.Resize(2 * p.dstC);
         _norm32f.Resize(2 * p.dstC);
         _convertSrc = Base::SynetConvert32fTo8u;
+        long long flop = (long long)p.kernelY * p.kernelX * p.srcC / p.group * p.dstH * p.dstW * p.dstC * 2;
+        _threadNumber = flop >= PARALLEL_FLOP_MIN ? Base::GetThreadNumber() : 1;
     }
 
     size_t SynetConvolution8i::ExternalBufferSize() const
@@ -65,6 +68,9 @@ namespace Simd
     void SynetConvolution8i::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
     {
         const ConvParam8i& p = _param;
+        SynetInternals internals;
+        GetInternals(internals);
+        Base::SynetUnshare(internals);
         _srcCvt.Init(stats[0], stats[1], p.srcC);
         _dstCvt.Init(stats[2], stats[3], p.dstC);
         size_t G = p.group, D = p.dstC / G, C = p.srcC / G, K = p.kernelY * p.kernelX, CK = C * K, GD = G * D;
@@ -186,6 +192,56 @@ namespace Simd
         }
     }
 
+    void SynetConvolution8i::GetInternals(SynetInternals & internals)
+    {
+        const ConvParam8i& p = _param;
+        internals.push_back(SynetInternal(_weight8i, p.kernelY * p.kernelX * p.srcC / p.group * p.dstC));
+        internals.push_back(SynetInternal(_norm32i, 2 * p.dstC));
+        internals.push_back(SynetInternal(_norm32f, 2 * p.dstC));
+        CvtParam * cvts[2] = { &_srcCvt, &_dstCvt };
+        size_t sizes[2] = { p.srcC, p.dstC };
+        for (size_t i = 0; i < 2; ++i)
+        {
+            internals.push_back(SynetInternal(cvts[i]->zero, sizes[i]));
+            internals.push_back(SynetInternal(cvts[i]->scale, sizes[i]));
+            internals.push_back(SynetInternal(cvts[i]->shift, sizes[i]));
+            internals.push_back(SynetInternal(cvts[i]->iScale, sizes[i]));
+            internals.push_back(SynetInternal(cvts[i]->iShift, sizes[i]));
+        }
+    }
+
+    void SynetConvolution8i::SetInternals()
+    {
+        _srcCvt.neg = _srcCvt.zero[0] != 0;
+        _dstCvt.neg = _dstCvt.zero[0] != 0;
+    }
+
+    String SynetConvolution8i::Tag() const
+    {
+        const ConvParam8i& p = _param;
+        std::stringstream ss;
+        ss << Desc() << " " << Base::SynetCpuSignature() << "-b" << p.batch << "-" << Base::SynetConvSignature(p);
+        ss << "-t" << p.srcT << "x" << p.dstT << "-o" << p.compatibility;
+        return ss.str();
+    }
+
+    size_t SynetConvolution8i::Export(void * data, size_t size) const
+    {
+        SynetInternals internals;
+        ((SynetConvolution8i*)this)->GetInternals(internals);
+        return Base::SynetExport(internals, Tag(), data, size);
+    }
+
+    bool SynetConvolution8i::Import(const void * data, size_t size, bool copy)
+    {
+        SynetInternals internals;
+        GetInternals(internals);
+        if (!Base::SynetImport(internals, Tag(), data, size, copy))
+            return false;
+        SetInternals();
+        return true;
+    }
+
     void SynetConvolution8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
     {
         if (buf == NULL)
@@ -198,17 +254,41 @@ namespace Simd
         for (size_t b = 0; b < p.batch; b += _merge)
         {
             if (!_src8u)
-                _convertSrc((float*)src + b * _sizeS, _merge, p.srcC, p.srcH, p.srcW, p.srcF, _srcCvt.scale.data, _srcCvt.shift.data, src8u, p.compatibility);
+                ConvertSrc((float*)src + b * _sizeS, src8u);
             Forward8u(_src8u ? src + b * _sizeS : src8u, buf, dst + b * _sizeD * (_dst8u ? sizeof(uint8_t) : sizeof(float)));
         }
     }
 
+    void SynetConvolution8i::ConvertSrc(const float* src, uint8_t* dst)
+    {
+        const ConvParam8i& p = _param;
+        const float* scale = _srcCvt.scale.data, * shift = _srcCvt.shift.data;
+        if (p.trans)
+        {
+            Simd::Parallel(0, p.srcH, [&](size_t thread, size_t begin, size_t end)
+            {
+                size_t offset = begin * p.srcW * p.srcC;
+                for (size_t m = 0; m < _merge; ++m)
+                    _convertSrc(src + m * _sizeS + offset, 1, p.srcC, end - begin, p.srcW, p.srcF, scale, shift, dst + m * _sizeS + offset, p.compatibility);
+            }, _threadNumber);
+        }
+        else
+        {
+            Simd::Parallel(0, p.srcC, [&](size_t thread, size_t begin, size_t end)
+            {
+                size_t offset = begin * p.srcH * p.srcW;
+                for (size_t m = 0; m < _merge; ++m)
+                    _convertSrc(src + m * _sizeS + offset, 1, end - begin, p.srcH, p.srcW, p.srcF, scale + begin, shift + begin, dst + m * _sizeS + offset, p.compatibility);
+            }, _threadNumber);
+        }
+    }
+
 #if defined(SIMD_PERFORMANCE_STATISTIC)
     Base::PerformanceMeasurer * SynetConvolution8i::Perf(const String& func)
     {
-        if (_perf == NULL)
-            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
-        return _perf;
+        if (_perf == 0)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Register(func, Param().Info() + " " + Desc(), Param().Flop());
+        return Simd::Base::PerformanceMeasurerStorage::s_storage.Get(_perf);
     }
 #endif
 
@@ -346,9 +426,19 @@ namespace Simd
                 for (size_t g = 0; g < p.group; ++g)
                 {
                     if (p.trans)
-                        GemmNhwc(_siS, _siD, _siK, _siC, src + _grS * g, _ldS, weight + _grW * g, _ldW, sum + _grD * g, _ldD);
+                    {
+                        Simd::Parallel(0, _siS, [&](size_t thread, size_t begin, size_t end)
+                        {
+                            GemmNhwc(end - begin, _siD, _siK, _siC, src + _grS * g + begin * _ldS, _ldS, weight + _grW * g, _ldW, sum + _grD * g + begin * _ldD, _ldD);
+                        }, _threadNumber);
+                    }
                     else
-                        GemmNchw(_siD, _siS, _siC, _siK, weight + _grW * g, _ldW, src + _grS * g, _ldS, sum + _grD * g, _ldD);
+                    {
+                        Simd::Parallel(0, _siD, [&](size_t thread, size_t begin, size_t end)
+                        {
+                            GemmNchw(end - begin, _siS, _siC, _siK, weight + _grW * g + begin * _ldW, _ldW, src + _grS * g, _ldS, sum + _grD * g + begin * _ldD, _ldD);
+                        }, _threadNumber);
+                    }
                 }
             }
             Convert<int32_t, int32_t, int32_t>(sum, _merge, p.dstC, p.dstH, p.dstW, p.dstF, _norm32i.data, _norm32i.data + p.dstC, sum);
@@ -625,6 +715,20 @@ namespace Simd
             _alg.zero = _srcCvt.neg ? 0x80808080 : 0;
         }
 
+        void SynetConvolution8iNhwcDirect::GetInternals(SynetInternals & internals)
+        {
+            const ConvParam8i& p = _param;
+            SynetConvolution8i::GetInternals(internals);
+            internals[0] = SynetInternal(_weight8i, p.kernelY * p.kernelX * DivHi(p.srcC, 4) * DivHi(p.dstC, _alg.F) * _alg.F * 4);
+        }
+
+        void SynetConvolution8iNhwcDirect::SetInternals()
+        {
+            SynetConvolution8i::SetInternals();
+            _alg.norm = _srcCvt.neg && (_param.compatibility & SimdSynetCompatibility8iOverflow) ? 2 : 1;
+            _alg.zero = _srcCvt.neg ? 0x80808080 : 0;
+        }
+
         bool SynetConvolution8iNhwcDirect::Preferable(const ConvParam8i& p)
         {
             return false;
@@ -683,31 +787,46 @@ namespace Simd
         {
             const ConvParam8i& p = _param;
             int32_t* sum = _alg.macroC < p.srcC ? Allocate<int32_t>(buf, _sizeD) : NULL;
+            size_t bandsH = Simd::Min(_threadNumber, p.dstH), microsD = DivHi(p.dstC, _alg.microD);
+            size_t bandsD = bandsH < _threadNumber ? Simd::Min(DivHi(_threadNumber, bandsH), microsD) : 1;
             for (size_t m = 0; m < _merge; ++m)
             {
-                Forward8u(src, sum, dst);
+                Simd::Parallel(0, bandsH * bandsD, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        size_t bH = i / bandsD, bD = i % bandsD;
+                        size_t dyBeg = bH * p.dstH / bandsH, dyEnd = (bH + 1) * p.dstH / bandsH;
+                        size_t dcBeg = Simd::Min(bD * microsD / bandsD * _alg.microD, p.dstC);
+                        size_t dcEnd = Simd::Min((bD + 1) * microsD / bandsD * _alg.microD, p.dstC);
+                        Forward8u(src, dyBeg, dyEnd, dcBeg, dcEnd, sum, dst);
+                    }
+                }, _threadNumber);
                 src += _sizeS;
                 dst += _sizeD*(_dst8u ? sizeof(uint8_t) : sizeof(float));
             }
         }
 
-        void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, int32_t* buf, uint8_t* dst)
+        void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, size_t dyBeg, size_t dyEnd, size_t dcBeg, size_t dcEnd, int32_t* buf, uint8_t* dst)
         {
             const ConvParam8i& p = _param;
-            const int8_t* weight = _weight8i.data;
-            const int32_t* bias = _norm32i.data + p.dstC;
+            const int8_t* weight = _weight8i.data + dcBeg * p.kernelY * p.kernelX * DivHi(p.srcC, 4) * 4;
+            const int32_t* bias = _norm32i.data + p.dstC + dcBeg;
             const int32_t* params = NULL;
-            const float* scale = _norm32f.data;
-            const float* shift = _norm32f.data + p.dstC;
-            for (size_t dc = 0; dc < p.dstC; dc += _alg.macroD)
+            const float* scale = _norm32f.data + dcBeg;
+            const float* shift = _norm32f.data + p.dstC + dcBeg;
+            if (buf)
+                buf += dcBeg;
+            dst += dcBeg * _alg.size;
+            for (size_t dc = dcBeg; dc < dcEnd; dc += _alg.macroD)
             {
-                size_t macroD = Simd::Min(p.dstC, dc + _alg.macroD) - dc;
+                size_t macroD = Simd::Min(dcEnd, dc + _alg.macroD) - dc;
                 for (size_t sc = 0; sc < p.srcC; sc += _alg.macroC)
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + _alg.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    for (size_t yBeg = dyBeg; yBeg < dyEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + _alg.macroH, p.dstH);
+                        size_t yEnd = Simd::Min(yBeg + _alg.macroH, dyEnd);
                         if (_alg.macroC == p.srcC)
                         {
                             if (_alg.size == 1)
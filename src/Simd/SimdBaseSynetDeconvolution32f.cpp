@@ -32,12 +32,49 @@ namespace Simd
 #if defined(SIMD_PERFORMANCE_STATISTIC)
     Base::PerformanceMeasurer * SynetDeconvolution32f::Perf(const String& func)
     {
-        if (_perf == NULL)
-            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
-        return _perf;
+        if (_perf == 0)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Register(func, Param().Info() + " " + Desc(), Param().Flop());
+        return Simd::Base::PerformanceMeasurerStorage::s_storage.Get(_perf);
     }
 #endif
 
+    void SynetDeconvolution32f::GetInternals(SynetInternals & internals)
+    {
+        internals.push_back(SynetInternal(_nhwcWeight, _nhwcWeight.size));
+        internals.push_back(SynetInternal(_weightT, _weightT.size));
+    }
+
+    void SynetDeconvolution32f::SetInternals(const float * bias, const float * params)
+    {
+        _weight = NULL;
+        _bias = bias;
+        _params = params;
+    }
+
+    String SynetDeconvolution32f::Tag() const
+    {
+        std::stringstream ss;
+        ss << Desc() << " " << Base::SynetCpuSignature() << "-b" << _param.batch << "-" << Base::SynetConvSignature(_param) << "-e" << (_param.gemm ? 1 : 0);
+        return ss.str();
+    }
+
+    size_t SynetDeconvolution32f::Export(void * data, size_t size) const
+    {
+        SynetInternals internals;
+        ((SynetDeconvolution32f*)this)->GetInternals(internals);
+        return Base::SynetExport(internals, Tag(), data, size);
+    }
+
+    bool SynetDeconvolution32f::Import(const void * data, size_t size, const float * bias, const float * params, bool copy)
+    {
+        SynetInternals internals;
+        GetInternals(internals);
+        if (!Base::SynetImport(internals, Tag(), data, size, copy))
+            return false;
+        SetInternals(bias, params);
+        return true;
+    }
+
     namespace Base
     {
         SynetDeconvolution32fGemmNN::SynetDeconvolution32fGemmNN(const DeconvParam32f & p)
@@ -357,10 +394,17 @@ namespace Simd
                 if (internal)
                     *internal = SimdTrue;
             }
+            SetBias(bias, params);
+        }
+
+        void SynetDeconvolution32fNhwcDirect2x2::SetBias(const float * bias, const float * params)
+        {
             if (_rBias.data)
             {
                 if (bias)
                     memcpy(_rBias.data, bias, _param.dstC * sizeof(float));
+                else
+                    _rBias.Clear();
                 _bias = _rBias.data;
             }
             if (_rParams.data && _param.activation == ::SimdConvolutionActivationPrelu)
@@ -370,6 +414,20 @@ namespace Simd
             }
         }
 
+        void SynetDeconvolution32fNhwcDirect2x2::GetInternals(SynetInternals & internals)
+        {
+            SynetDeconvolution32f::GetInternals(internals);
+            internals.push_back(SynetInternal(_rWeight, _rWeight.size));
+        }
+
+        void SynetDeconvolution32fNhwcDirect2x2::SetInternals(const float * bias, const float * params)
+        {
+            SynetDeconvolution32f::SetInternals(bias, params);
+            if (_rWeight.data)
+                _weight = _rWeight.data;
+            SetBias(bias, params);
+        }
+
         void SynetDeconvolution32fNhwcDirect2x2::Forward(const float * src, float * buf, float * dst)
         {
             const DeconvParam32f & p = _param;
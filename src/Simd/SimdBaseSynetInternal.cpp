@@ -0,0 +1,119 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInternal.h"
+#include "Simd/SimdCpu.h"
+
+#include <sstream>
+
+namespace Simd
+{
+    namespace Base
+    {
+        const uint64_t SYNET_EXPORT_MAGIC = 0x746E7953646D6953; // "SimdSynt"
+
+        String SynetCpuSignature()
+        {
+            std::stringstream ss;
+            ss << "c" << Cpu::SOCKET_NUMBER << "x" << Cpu::CORE_NUMBER << "x" << Cpu::THREAD_NUMBER;
+            ss << "-l" << Cpu::L1_CACHE_SIZE << "x" << Cpu::L2_CACHE_SIZE << "x" << Cpu::L3_CACHE_SIZE;
+            return ss.str();
+        }
+
+        String SynetConvSignature(const SimdConvolutionParameters & c)
+        {
+            std::stringstream ss;
+            ss << "s" << c.srcC << "x" << c.srcH << "x" << c.srcW << "-d" << c.dstC << "x" << c.dstH << "x" << c.dstW;
+            ss << "-k" << c.kernelY << "x" << c.kernelX << "-i" << c.dilationY << "x" << c.dilationX << "-r" << c.strideY << "x" << c.strideX;
+            ss << "-p" << c.padY << "x" << c.padX << "x" << c.padH << "x" << c.padW << "-g" << c.group << "-a" << c.activation << "-f" << c.srcF;
+            return ss.str();
+        }
+
+        size_t SynetExport(const SynetInternals & internals, const String & tag, void * data, size_t size)
+        {
+            size_t total = 0;
+            for (size_t i = 0; i < internals.size(); ++i)
+            {
+                size_t actual;
+                internals[i].Data(actual);
+                if (actual != internals[i].Size())
+                    return 0;
+                total += actual;
+            }
+            if (total == 0)
+                return 0;
+            size_t offset = AlignHi(sizeof(uint64_t) * (3 + internals.size()) + tag.size(), SIMD_ALIGN), need = offset;
+            for (size_t i = 0; i < internals.size(); ++i)
+                need += AlignHi(internals[i].Size(), SIMD_ALIGN);
+            if (data == NULL || size < need)
+                return need;
+            memset(data, 0, need);
+            uint64_t * header = (uint64_t*)data;
+            header[0] = SYNET_EXPORT_MAGIC;
+            header[1] = tag.size();
+            header[2] = internals.size();
+            for (size_t i = 0; i < internals.size(); ++i)
+                header[3 + i] = internals[i].Size();
+            memcpy(header + 3 + internals.size(), tag.data(), tag.size());
+            for (size_t i = 0; i < internals.size(); ++i)
+            {
+                size_t actual;
+                const void * src = internals[i].Data(actual);
+                memcpy((uint8_t*)data + offset, src, actual);
+                offset += AlignHi(actual, SIMD_ALIGN);
+            }
+            return need;
+        }
+
+        bool SynetImport(const SynetInternals & internals, const String & tag, const void * data, size_t size, bool copy)
+        {
+            const uint64_t * header = (const uint64_t*)data;
+            if (data == NULL || size < sizeof(uint64_t) * (3 + internals.size()) || header[0] != SYNET_EXPORT_MAGIC || header[2] != internals.size())
+                return false;
+            size_t offset = AlignHi(sizeof(uint64_t) * (3 + internals.size()) + tag.size(), SIMD_ALIGN), need = offset;
+            if (size < offset || header[1] != tag.size() || memcmp(header + 3 + internals.size(), tag.data(), tag.size()) != 0)
+                return false;
+            for (size_t i = 0; i < internals.size(); ++i)
+            {
+                if (header[3 + i] != internals[i].Size())
+                    return false;
+                need += AlignHi(internals[i].Size(), SIMD_ALIGN);
+            }
+            if (size < need)
+                return false;
+            copy = copy || !Aligned(data, SIMD_ALIGN);
+            for (size_t i = 0; i < internals.size(); ++i)
+            {
+                internals[i].Set((uint8_t*)data + offset, !copy);
+                offset += AlignHi(internals[i].Size(), SIMD_ALIGN);
+            }
+            return true;
+        }
+
+        void SynetUnshare(const SynetInternals & internals)
+        {
+            for (size_t i = 0; i < internals.size(); ++i)
+                internals[i].Unshare();
+        }
+    }
+}
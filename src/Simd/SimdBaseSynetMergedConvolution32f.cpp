@@ -33,9 +33,9 @@ namespace Simd
 #if defined(SIMD_PERFORMANCE_STATISTIC)
     Base::PerformanceMeasurer * SynetMergedConvolution32f::Perf(const String& func)
     {
-        if (_perf == NULL)
-            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
-        return _perf;
+        if (_perf == 0)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Register(func, Param().Info() + " " + Desc(), Param().Flop());
+        return Simd::Base::PerformanceMeasurerStorage::s_storage.Get(_perf);
     }
 #endif
 
@@ -290,6 +290,9 @@ namespace Simd
         void SynetMergedConvolution32f::SetParams(const float * const * weight, SimdBool * internal, const float * const * bias, const float * const * params)
         {
             const MergConvParam32f & p = _param;
+            SynetInternals internals;
+            GetInternals(internals);
+            SynetUnshare(internals);
             for (size_t i = 0; i < p.count; ++i)
             {
                 if (_rWeight[i].data)
@@ -311,10 +314,21 @@ namespace Simd
                     if (internal)
                         internal[i] = SimdFalse;
                 }
+            }
+            SetBias(bias, params);
+        }
+
+        void SynetMergedConvolution32f::SetBias(const float * const * bias, const float * const * params)
+        {
+            const MergConvParam32f & p = _param;
+            for (size_t i = 0; i < p.count; ++i)
+            {
                 if (_rBias[i].data)
                 {
                     if (bias[i])
                         memcpy(_rBias[i].data, bias[i], p.conv[i].dstC * sizeof(float));
+                    else
+                        _rBias[i].Clear();
                     _bias[i] = _rBias[i].data;
                 }
                 else
@@ -329,6 +343,42 @@ namespace Simd
             }
         }
 
+        void SynetMergedConvolution32f::GetInternals(SynetInternals & internals)
+        {
+            for (size_t i = 0; i < _param.count; ++i)
+                internals.push_back(SynetInternal(_rWeight[i], _rWeight[i].size));
+        }
+
+        String SynetMergedConvolution32f::Tag() const
+        {
+            const MergConvParam32f & p = _param;
+            std::stringstream ss;
+            ss << Desc() << " " << SynetCpuSignature() << "-b" << p.batch;
+            for (size_t i = 0; i < p.count; ++i)
+                ss << "-" << SynetConvSignature(p.conv[i]);
+            ss << "-m" << p.add;
+            return ss.str();
+        }
+
+        size_t SynetMergedConvolution32f::Export(void * data, size_t size) const
+        {
+            SynetInternals internals;
+            ((SynetMergedConvolution32f*)this)->GetInternals(internals);
+            return SynetExport(internals, Tag(), data, size);
+        }
+
+        bool SynetMergedConvolution32f::Import(const void * data, size_t size, const float * const * bias, const float * const * params, bool copy)
+        {
+            SynetInternals internals;
+            GetInternals(internals);
+            if (!SynetImport(internals, Tag(), data, size, copy))
+                return false;
+            for (size_t i = 0; i < _param.count; ++i)
+                _weight[i] = _rWeight[i].data;
+            SetBias(bias, params);
+            return true;
+        }
+
         void SynetMergedConvolution32f::Forward(const float * src, float * buf, float * dst)
         {
             const MergConvParam32f & p = _param;
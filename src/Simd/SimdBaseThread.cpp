@@ -23,8 +23,12 @@
 */
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 #include <thread>
+#include <mutex>
 
 namespace Simd
 {
@@ -32,14 +36,134 @@ namespace Simd
     {
         size_t g_threadNumber = 1;
 
+        struct Context;
+
+        struct Binding
+        {
+            Context * context;
+            std::vector<size_t> saved;
+#ifndef SIMD_FUTURE_DISABLE
+            ThreadPool ** pool;
+#endif
+            Binding();
+            ~Binding();
+        };
+
+        struct Context : public Deletable
+        {
+            size_t threadNumber;
+            std::vector<size_t> mask, cpus;
+            std::vector<Binding*> bindings;
+#ifndef SIMD_FUTURE_DISABLE
+            ThreadPool pool;
+#endif
+            Context(size_t number, SimdAffinityFlags affinity);
+            virtual ~Context();
+
+            static void InitWorker(void * context, size_t thread)
+            {
+                const std::vector<size_t> & cpus = ((Context*)context)->cpus;
+                SetThreadAffinity(std::vector<size_t>(1, cpus[thread % cpus.size()]));
+            }
+        };
+
+        static std::mutex & BindingMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        static Binding & ThreadBinding()
+        {
+            static thread_local Binding binding;
+            return binding;
+        }
+
+        Binding::Binding()
+            : context(NULL)
+        {
+#ifndef SIMD_FUTURE_DISABLE
+            pool = &ThreadPool::Binding();
+#endif
+        }
+
+        Binding::~Binding()
+        {
+            std::lock_guard<std::mutex> lock(BindingMutex());
+            if (context)
+                context->bindings.erase(std::find(context->bindings.begin(), context->bindings.end(), this));
+        }
+
+        Context::Context(size_t number, SimdAffinityFlags affinity)
+            : threadNumber(Simd::Max<size_t>(number, 1))
+        {
+            CpuAffinity(affinity, mask);
+            if (mask.size())
+            {
+                threadNumber = std::min(threadNumber, mask.size());
+                CpuAllocate(mask, threadNumber, cpus);
+            }
+#ifndef SIMD_FUTURE_DISABLE
+            if (cpus.size())
+                pool.SetInitializer(InitWorker, this);
+            pool.SetSize(threadNumber);
+#endif
+        }
+
+        Context::~Context()
+        {
+            if (ThreadBinding().context == this)
+                ContextBind(NULL);
+            std::lock_guard<std::mutex> lock(BindingMutex());
+            for (size_t i = 0; i < bindings.size(); ++i)
+            {
+                bindings[i]->context = NULL;
+#ifndef SIMD_FUTURE_DISABLE
+                *bindings[i]->pool = NULL;
+#endif
+            }
+            CpuRelease(cpus);
+        }
+
         size_t GetThreadNumber()
         {
-            return g_threadNumber;
+            const Context * context = ThreadBinding().context;
+            return context ? context->threadNumber : g_threadNumber;
         }
 
         void SetThreadNumber(size_t threadNumber)
         {
             g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
         }
+
+        void * ContextCreate(size_t threadNumber, SimdAffinityFlags affinity)
+        {
+            return new Context(threadNumber, affinity);
+        }
+
+        void ContextBind(const void * context)
+        {
+            Binding & binding = ThreadBinding();
+            if (binding.context == context && (context || binding.saved.empty()))
+                return;
+            std::lock_guard<std::mutex> lock(BindingMutex());
+            if (binding.context)
+                binding.context->bindings.erase(std::find(binding.context->bindings.begin(), binding.context->bindings.end(), &binding));
+            if (binding.saved.size())
+            {
+                SetThreadAffinity(binding.saved);
+                binding.saved.clear();
+            }
+            binding.context = (Context*)context;
+            if (binding.context)
+            {
+                binding.context->bindings.push_back(&binding);
+                if (binding.context->mask.size() && GetThreadAffinity(binding.saved))
+                    SetThreadAffinity(binding.context->mask);
+            }
+#ifndef SIMD_FUTURE_DISABLE
+            ThreadPool::Bind(binding.context ? &binding.context->pool : NULL);
+#endif
+        }
     }
 }
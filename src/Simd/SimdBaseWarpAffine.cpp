@@ -0,0 +1,235 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdWarpAffine.h"
+
+namespace Simd
+{
+    WarpAffine::WarpAffine(const WarpAffParam & param)
+        : _param(param)
+    {
+        const float * m = _param.inv;
+        double shift = _param.IsNearest() ? 0.5 : 0.0;
+        _maxX = float(_param.IsNearest() ? _param.srcW : _param.srcW - 1);
+        _maxY = float(_param.IsNearest() ? _param.srcH : _param.srcH - 1);
+        _cx.Resize(_param.dstW);
+        _cy.Resize(_param.dstW);
+        for (size_t x = 0; x < _param.dstW; ++x)
+        {
+            _cx[x] = m[0] * (float)x;
+            _cy[x] = m[3] * (float)x;
+        }
+        _rx.Resize(_param.dstH);
+        _ry.Resize(_param.dstH);
+        _beg.Resize(_param.dstH);
+        _end.Resize(_param.dstH);
+        for (size_t y = 0; y < _param.dstH; ++y)
+        {
+            _rx[y] = float((double)m[1] * y + m[2] + shift);
+            _ry[y] = float((double)m[4] * y + m[5] + shift);
+            SetRange(y);
+        }
+    }
+
+    SIMD_INLINE void WarpAffineRange(double a, double b, double max, double & lo, double & hi)
+    {
+        if (a == 0.0)
+            return;
+        double x0 = -b / a, x1 = (max - b) / a;
+        lo = Max(lo, Min(x0, x1) - 2.0);
+        hi = Min(hi, Max(x0, x1) + 2.0);
+    }
+
+    void WarpAffine::SetRange(size_t y)
+    {
+        double lo = 0.0, hi = (double)_param.dstW;
+        WarpAffineRange(_param.inv[0], _rx[y], _maxX, lo, hi);
+        WarpAffineRange(_param.inv[3], _ry[y], _maxY, lo, hi);
+        ptrdiff_t beg = 0, end = 0;
+        if (lo < hi)
+        {
+            beg = (ptrdiff_t)::floor(lo);
+            end = (ptrdiff_t)::ceil(hi);
+        }
+        while (beg < end && !Inside(beg, y))
+            beg++;
+        while (end > beg && !Inside(end - 1, y))
+            end--;
+        if (beg == end)
+            beg = end = 0;
+        _beg[y] = (int32_t)beg;
+        _end[y] = (int32_t)end;
+    }
+
+    void WarpAffine::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd) const
+    {
+        assert(srcStride * _param.srcH <= INT32_MAX);
+        dst += yBeg * dstStride;
+        for (size_t y = yBeg; y < yEnd; ++y, dst += dstStride)
+        {
+            size_t beg = _beg[y], end = _end[y];
+            if (beg)
+                RunBorder(src, srcStride, y, 0, beg, dst);
+            if (beg < end)
+                RunInterior(src, srcStride, y, beg, end, dst);
+            if (end < _param.dstW)
+                RunBorder(src, srcStride, y, end, _param.dstW, dst);
+        }
+    }
+
+    namespace Base
+    {
+        SIMD_INLINE int WarpAffineIndex(float value, size_t size)
+        {
+            return (int)::floor(Simd::RestrictRange(value, -2.0f, float(size + 1)));
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineNearest::WarpAffineNearest(const WarpAffParam & param)
+            : WarpAffine(param)
+        {
+        }
+
+        void WarpAffineNearest::RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t pixelSize = _param.PixelSize();
+            float rx = _rx[y], ry = _ry[y];
+            for (size_t x = beg; x < end; ++x)
+            {
+                int ix = WarpAffineIndex(_cx[x] + rx, _param.srcW);
+                int iy = WarpAffineIndex(_cy[x] + ry, _param.srcH);
+                WarpCopyPixel(WarpPixel(src, srcStride, _param, ix, iy), pixelSize, dst + x * pixelSize);
+            }
+        }
+
+        void WarpAffineNearest::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t pixelSize = _param.PixelSize();
+            float rx = _rx[y], ry = _ry[y];
+            for (size_t x = beg; x < end; ++x)
+            {
+                int ix = (int)(_cx[x] + rx);
+                int iy = (int)(_cy[x] + ry);
+                WarpCopyPixel(src + iy * srcStride + ix * pixelSize, pixelSize, dst + x * pixelSize);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam & param)
+            : WarpAffine(param)
+        {
+        }
+
+        SIMD_INLINE int WarpAffineByteFraction(float value, int index)
+        {
+            return (int)((value - (float)index) * WARP_RANGE + 0.5f);
+        }
+
+        void WarpAffineByteBilinear::RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels;
+            float rx = _rx[y], ry = _ry[y];
+            for (size_t x = beg; x < end; ++x)
+            {
+                float sx = Simd::RestrictRange(_cx[x] + rx, -2.0f, float(_param.srcW + 1));
+                float sy = Simd::RestrictRange(_cy[x] + ry, -2.0f, float(_param.srcH + 1));
+                int ix = (int)::floor(sx), iy = (int)::floor(sy);
+                WarpByteInterp(WarpPixel(src, srcStride, _param, ix, iy), WarpPixel(src, srcStride, _param, ix + 1, iy),
+                    WarpPixel(src, srcStride, _param, ix, iy + 1), WarpPixel(src, srcStride, _param, ix + 1, iy + 1),
+                    cn, WarpAffineByteFraction(sx, ix), WarpAffineByteFraction(sy, iy), dst + x * cn);
+            }
+        }
+
+        void WarpAffineByteBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels;
+            float rx = _rx[y], ry = _ry[y];
+            for (size_t x = beg; x < end; ++x)
+            {
+                float sx = _cx[x] + rx, sy = _cy[x] + ry;
+                int ix = (int)sx, iy = (int)sy;
+                const uint8_t * p0 = src + iy * srcStride + ix * cn, * p1 = p0 + srcStride;
+                WarpByteInterp(p0, p0 + cn, p1, p1 + cn, cn, WarpAffineByteFraction(sx, ix), WarpAffineByteFraction(sy, iy), dst + x * cn);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineFloatBilinear::WarpAffineFloatBilinear(const WarpAffParam & param)
+            : WarpAffine(param)
+        {
+        }
+
+        SIMD_INLINE void WarpAffineFloatInterp(const float * p00, const float * p01, const float * p10, const float * p11, size_t channels, float fx, float fy, float * dst)
+        {
+            float gx = 1.0f - fx, gy = 1.0f - fy;
+            for (size_t c = 0; c < channels; ++c)
+                dst[c] = (p00[c] * gx + p01[c] * fx) * gy + (p10[c] * gx + p11[c] * fx) * fy;
+        }
+
+        void WarpAffineFloatBilinear::RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels;
+            float rx = _rx[y], ry = _ry[y];
+            for (size_t x = beg; x < end; ++x)
+            {
+                float sx = Simd::RestrictRange(_cx[x] + rx, -2.0f, float(_param.srcW + 1));
+                float sy = Simd::RestrictRange(_cy[x] + ry, -2.0f, float(_param.srcH + 1));
+                int ix = (int)::floor(sx), iy = (int)::floor(sy);
+                WarpAffineFloatInterp((float*)WarpPixel(src, srcStride, _param, ix, iy), (float*)WarpPixel(src, srcStride, _param, ix + 1, iy),
+                    (float*)WarpPixel(src, srcStride, _param, ix, iy + 1), (float*)WarpPixel(src, srcStride, _param, ix + 1, iy + 1),
+                    cn, sx - (float)ix, sy - (float)iy, (float*)dst + x * cn);
+            }
+        }
+
+        void WarpAffineFloatBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels, stride = srcStride / sizeof(float);
+            float rx = _rx[y], ry = _ry[y];
+            for (size_t x = beg; x < end; ++x)
+            {
+                float sx = _cx[x] + rx, sy = _cy[x] + ry;
+                int ix = (int)sx, iy = (int)sy;
+                const float * p0 = (float*)src + iy * stride + ix * cn, * p1 = p0 + stride;
+                WarpAffineFloatInterp(p0, p0 + cn, p1, p1 + cn, cn, sx - (float)ix, sy - (float)iy, (float*)dst + x * cn);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+        {
+            WarpAffParam param(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpAffineNearest(param);
+            else if (param.IsByte())
+                return new WarpAffineByteBilinear(param);
+            else
+                return new WarpAffineFloatBilinear(param);
+        }
+    }
+}
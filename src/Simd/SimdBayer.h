@@ -133,6 +133,57 @@ namespace Simd
             dst11[1] = BayerToGreen(src[3][col2], src[2][col3], src[3][col4], src[4][col3], src[3][col1], src[1][col3], src[3][col5], src[5][col3]);
             dst11[2] = src[3][col3];
         }
+
+        SIMD_INLINE void BayerMalvarPattern(SimdPixelFormatType bayerFormat, size_t row, bool & greenEven, bool & redRow)
+        {
+            bool even = (row & 1) == 0;
+            greenEven = (bayerFormat == SimdPixelFormatBayerGrbg || bayerFormat == SimdPixelFormatBayerGbrg) == even;
+            redRow = (bayerFormat == SimdPixelFormatBayerGrbg || bayerFormat == SimdPixelFormatBayerRggb) == even;
+        }
+
+        SIMD_INLINE void BayerMalvarRows(const uint8_t * bayer, size_t bayerStride, size_t row, size_t height, const uint8_t * src[5])
+        {
+            src[2] = bayer + row * bayerStride;
+            src[0] = row > 1 ? src[2] - 2 * bayerStride : src[2];
+            src[1] = row > 0 ? src[2] - bayerStride : src[2] + bayerStride;
+            src[3] = row < height - 1 ? src[2] + bayerStride : src[2] - bayerStride;
+            src[4] = row < height - 2 ? src[2] + 2 * bayerStride : src[2];
+        }
+
+        SIMD_INLINE int BayerMalvar(int sum)
+        {
+            return RestrictRange((sum + 8) >> 4);
+        }
+
+        SIMD_INLINE void BayerToBgrMalvar(const uint8_t * src[5], size_t col, size_t width, bool green, bool red, uint8_t * bgr)
+        {
+            size_t col0 = col > 1 ? col - 2 : col;
+            size_t col1 = col > 0 ? col - 1 : col + 1;
+            size_t col3 = col < width - 1 ? col + 1 : col - 1;
+            size_t col4 = col < width - 2 ? col + 2 : col;
+            int c = src[2][col];
+            int h1 = src[2][col1] + src[2][col3];
+            int h2 = src[2][col0] + src[2][col4];
+            int v1 = src[1][col] + src[3][col];
+            int v2 = src[0][col] + src[4][col];
+            int d = src[1][col1] + src[1][col3] + src[3][col1] + src[3][col3];
+            int x, g, y;
+            if (green)
+            {
+                x = BayerMalvar(2 * (5 * c + 4 * h1 - h2 - d) + v2);
+                g = c;
+                y = BayerMalvar(2 * (5 * c + 4 * v1 - v2 - d) + h2);
+            }
+            else
+            {
+                x = c;
+                g = BayerMalvar(2 * (4 * c + 2 * (h1 + v1) - (h2 + v2)));
+                y = BayerMalvar(4 * (3 * c + d) - 3 * (h2 + v2));
+            }
+            bgr[0] = red ? y : x;
+            bgr[1] = g;
+            bgr[2] = red ? x : y;
+        }
     }
 
 #ifdef SIMD_SSE2_ENABLE
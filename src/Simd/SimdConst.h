@@ -30,6 +30,7 @@
 namespace Simd
 {
     const size_t HISTOGRAM_SIZE = UCHAR_MAX + 1;
+    const size_t LUT8U_SIZE = UCHAR_MAX + 1;
 
     namespace Base
     {
@@ -135,6 +136,7 @@ namespace Simd
         const __m128i K32_00000004 = SIMD_MM_SET1_EPI32(0x00000004);
         const __m128i K32_00000008 = SIMD_MM_SET1_EPI32(0x00000008);
         const __m128i K32_000000FF = SIMD_MM_SET1_EPI32(0x000000FF);
+        const __m128i K32_000001FE = SIMD_MM_SET1_EPI32(0x000001FE);
         const __m128i K32_0000FFFF = SIMD_MM_SET1_EPI32(0x0000FFFF);
         const __m128i K32_00010000 = SIMD_MM_SET1_EPI32(0x00010000);
         const __m128i K32_01000000 = SIMD_MM_SET1_EPI32(0x01000000);
@@ -289,6 +291,7 @@ namespace Simd
         const __m256i K32_00000004 = SIMD_MM256_SET1_EPI32(0x00000004);
         const __m256i K32_00000008 = SIMD_MM256_SET1_EPI32(0x00000008);
         const __m256i K32_000000FF = SIMD_MM256_SET1_EPI32(0x000000FF);
+        const __m256i K32_000001FE = SIMD_MM256_SET1_EPI32(0x000001FE);
         const __m256i K32_0000FFFF = SIMD_MM256_SET1_EPI32(0x0000FFFF);
         const __m256i K32_00010000 = SIMD_MM256_SET1_EPI32(0x00010000);
         const __m256i K32_01000000 = SIMD_MM256_SET1_EPI32(0x01000000);
@@ -456,6 +459,7 @@ namespace Simd
 
         const __m512i K32_00000001 = SIMD_MM512_SET1_EPI32(0x00000001);
         const __m512i K32_000000FF = SIMD_MM512_SET1_EPI32(0x000000FF);
+        const __m512i K32_000001FE = SIMD_MM512_SET1_EPI32(0x000001FE);
         const __m512i K32_0000FFFF = SIMD_MM512_SET1_EPI32(0x0000FFFF);
         const __m512i K32_00010000 = SIMD_MM512_SET1_EPI32(0x00010000);
         const __m512i K32_FFFFFF00 = SIMD_MM512_SET1_EPI32(0xFFFFFF00);
@@ -778,6 +782,7 @@ namespace Simd
         const uint32x4_t K32_00000008 = SIMD_VEC_SET1_EPI32(0x00000008);
         const uint32x4_t K32_00000010 = SIMD_VEC_SET1_EPI32(0x00000010);
         const uint32x4_t K32_000000FF = SIMD_VEC_SET1_EPI32(0x000000FF);
+        const uint32x4_t K32_000001FE = SIMD_VEC_SET1_EPI32(0x000001FE);
         const uint32x4_t K32_0000FFFF = SIMD_VEC_SET1_EPI32(0x0000FFFF);
         const uint32x4_t K32_00010000 = SIMD_VEC_SET1_EPI32(0x00010000);
         const uint32x4_t K32_01000000 = SIMD_VEC_SET1_EPI32(0x01000000);
@@ -28,6 +28,8 @@
 #include "Simd/SimdConst.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdYuvToBgr.h"
 
 namespace Simd
 {
@@ -57,46 +59,6 @@ namespace Simd
                 BGR_TO_YUV_ROUND_TERM) >> BGR_TO_YUV_AVERAGING_SHIFT) + UV_ADJUST);
         }
 
-        SIMD_INLINE int YuvToBlue(int y, int u)
-        {
-            return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + U_TO_BLUE_WEIGHT * (u - UV_ADJUST) +
-                YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
-        }
-
-        SIMD_INLINE int YuvToGreen(int y, int u, int v)
-        {
-            return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + U_TO_GREEN_WEIGHT * (u - UV_ADJUST) +
-                V_TO_GREEN_WEIGHT * (v - UV_ADJUST) + YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
-        }
-
-        SIMD_INLINE int YuvToRed(int y, int v)
-        {
-            return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + V_TO_RED_WEIGHT * (v - UV_ADJUST) +
-                YUV_TO_BGR_ROUND_TERM) >> YUV_TO_BGR_AVERAGING_SHIFT);
-        }
-
-        SIMD_INLINE void YuvToBgr(int y, int u, int v, uint8_t * bgr)
-        {
-            bgr[0] = YuvToBlue(y, u);
-            bgr[1] = YuvToGreen(y, u, v);
-            bgr[2] = YuvToRed(y, v);
-        }
-
-        SIMD_INLINE void YuvToBgra(int y, int u, int v, int alpha, uint8_t * bgra)
-        {
-            bgra[0] = YuvToBlue(y, u);
-            bgra[1] = YuvToGreen(y, u, v);
-            bgra[2] = YuvToRed(y, v);
-            bgra[3] = alpha;
-        }
-
-        SIMD_INLINE void YuvToRgb(int y, int u, int v, uint8_t* rgb)
-        {
-            rgb[0] = YuvToRed(y, v);
-            rgb[1] = YuvToGreen(y, u, v);
-            rgb[2] = YuvToBlue(y, u);
-        }
-
         SIMD_INLINE void BgrToHsv(int blue, int green, int red, uint8_t * hsv)
         {
             int max = Max(red, Max(green, blue));
@@ -177,7 +139,7 @@ namespace Simd
         {
             if (saturation)
             {
-                int sector = hue * 6 / 255;
+                int sector = Min(hue * 6 / 255, 5);
                 int min = (255 - saturation)*value / 255;
                 int delta = (value - min)*(hue * 6 - sector * 255) / 255;
 
@@ -229,9 +191,9 @@ namespace Simd
         {
             if (saturation)
             {
-                int sector = hue * 6 / 255;
+                int sector = Min(hue * 6 / 255, 5);
                 int max;
-                if (lightness <= 128)
+                if (lightness < 128)
                     max = lightness * (255 + saturation) / 255;
                 else
                     max = ((255 - lightness)*saturation + lightness * 255) / 255;
@@ -286,90 +248,6 @@ namespace Simd
 #ifdef SIMD_SSE2_ENABLE    
     namespace Sse2
     {
-        SIMD_INLINE __m128i AdjustY16(__m128i y16)
-        {
-            return _mm_subs_epi16(y16, K16_Y_ADJUST);
-        }
-
-        SIMD_INLINE __m128i AdjustUV16(__m128i uv16)
-        {
-            return _mm_subs_epi16(uv16, K16_UV_ADJUST);
-        }
-
-        SIMD_INLINE __m128i AdjustedYuvToRed32(__m128i y16_1, __m128i v16_0)
-        {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
-        }
-
-        SIMD_INLINE __m128i AdjustedYuvToRed16(__m128i y16, __m128i v16)
-        {
-            return SaturateI16ToU8(_mm_packs_epi32(
-                AdjustedYuvToRed32(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(v16, K_ZERO)),
-                AdjustedYuvToRed32(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(v16, K_ZERO))));
-        }
-
-        SIMD_INLINE __m128i AdjustedYuvToGreen32(__m128i y16_1, __m128i u16_v16)
-        {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
-        }
-
-        SIMD_INLINE __m128i AdjustedYuvToGreen16(__m128i y16, __m128i u16, __m128i v16)
-        {
-            return SaturateI16ToU8(_mm_packs_epi32(
-                AdjustedYuvToGreen32(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, v16)),
-                AdjustedYuvToGreen32(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, v16))));
-        }
-
-        SIMD_INLINE __m128i AdjustedYuvToBlue32(__m128i y16_1, __m128i u16_0)
-        {
-            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
-        }
-
-        SIMD_INLINE __m128i AdjustedYuvToBlue16(__m128i y16, __m128i u16)
-        {
-            return SaturateI16ToU8(_mm_packs_epi32(
-                AdjustedYuvToBlue32(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, K_ZERO)),
-                AdjustedYuvToBlue32(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, K_ZERO))));
-        }
-
-        SIMD_INLINE __m128i YuvToRed(__m128i y, __m128i v)
-        {
-            __m128i lo = AdjustedYuvToRed16(
-                AdjustY16(_mm_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpacklo_epi8(v, K_ZERO)));
-            __m128i hi = AdjustedYuvToRed16(
-                AdjustY16(_mm_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpackhi_epi8(v, K_ZERO)));
-            return _mm_packus_epi16(lo, hi);
-        }
-
-        SIMD_INLINE __m128i YuvToGreen(__m128i y, __m128i u, __m128i v)
-        {
-            __m128i lo = AdjustedYuvToGreen16(
-                AdjustY16(_mm_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpacklo_epi8(u, K_ZERO)),
-                AdjustUV16(_mm_unpacklo_epi8(v, K_ZERO)));
-            __m128i hi = AdjustedYuvToGreen16(
-                AdjustY16(_mm_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpackhi_epi8(u, K_ZERO)),
-                AdjustUV16(_mm_unpackhi_epi8(v, K_ZERO)));
-            return _mm_packus_epi16(lo, hi);
-        }
-
-        SIMD_INLINE __m128i YuvToBlue(__m128i y, __m128i u)
-        {
-            __m128i lo = AdjustedYuvToBlue16(
-                AdjustY16(_mm_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpacklo_epi8(u, K_ZERO)));
-            __m128i hi = AdjustedYuvToBlue16(
-                AdjustY16(_mm_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm_unpackhi_epi8(u, K_ZERO)));
-            return _mm_packus_epi16(lo, hi);
-        }
-
         SIMD_INLINE __m128i BgrToY32(__m128i b16_r16, __m128i g16_1)
         {
             return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, K16_BY_RY),
@@ -429,6 +307,73 @@ namespace Simd
                 BgrToV16(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
                 BgrToV16(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
         }
+
+        template <bool align, bool nv21> SIMD_INLINE void LoadUv(const uint8_t * uv, __m128i & u, __m128i & v)
+        {
+            __m128i uv0 = Load<align>((__m128i*)uv + 0);
+            __m128i uv1 = Load<align>((__m128i*)uv + 1);
+            __m128i even = _mm_packus_epi16(_mm_and_si128(uv0, K16_00FF), _mm_and_si128(uv1, K16_00FF));
+            __m128i odd = _mm_packus_epi16(_mm_srli_epi16(uv0, 8), _mm_srli_epi16(uv1, 8));
+            u = nv21 ? odd : even;
+            v = nv21 ? even : odd;
+        }
+
+        template <bool align, bool p010> SIMD_INLINE __m128i LoadY10(const uint8_t * y)
+        {
+            __m128i y16 = Load<align>((__m128i*)y);
+            return p010 ? _mm_srli_epi16(y16, 6) : y16;
+        }
+
+        // u and v are duplicated for each pixel, A pixels are covered by two registers.
+        template <bool align> SIMD_INLINE void LoadP010Uv(const uint8_t * uv, __m128i * u, __m128i * v)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m128i uv16 = _mm_srli_epi16(Load<align>((__m128i*)uv + i), 6);
+                u[i] = _mm_shufflehi_epi16(_mm_shufflelo_epi16(uv16, 0xA0), 0xA0);
+                v[i] = _mm_shufflehi_epi16(_mm_shufflelo_epi16(uv16, 0xF5), 0xF5);
+            }
+        }
+
+        template <bool align> SIMD_INLINE void LoadYuv420p10Uv(const uint8_t * u, const uint8_t * v, __m128i * u16, __m128i * v16)
+        {
+            __m128i _u = Load<align>((__m128i*)u);
+            __m128i _v = Load<align>((__m128i*)v);
+            u16[0] = _mm_unpacklo_epi16(_u, _u);
+            u16[1] = _mm_unpackhi_epi16(_u, _u);
+            v16[0] = _mm_unpacklo_epi16(_v, _v);
+            v16[1] = _mm_unpackhi_epi16(_v, _v);
+        }
+
+        template <bool align, bool uyvy> SIMD_INLINE void LoadYuyv(const uint8_t * yuyv, __m128i * y, __m128i & u, __m128i & v)
+        {
+            const size_t Y = uyvy ? 1 : 0, C = 1 - Y;
+            __m128i s[2][4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                __m128i _yuyv = Load<align>((__m128i*)yuyv + i);
+                s[0][i] = _mm_and_si128(_yuyv, K16_00FF);
+                s[1][i] = _mm_srli_epi16(_yuyv, 8);
+            }
+            y[0] = _mm_packus_epi16(s[Y][0], s[Y][1]);
+            y[1] = _mm_packus_epi16(s[Y][2], s[Y][3]);
+            __m128i uv0 = _mm_packus_epi16(s[C][0], s[C][1]);
+            __m128i uv1 = _mm_packus_epi16(s[C][2], s[C][3]);
+            u = _mm_packus_epi16(_mm_and_si128(uv0, K16_00FF), _mm_and_si128(uv1, K16_00FF));
+            v = _mm_packus_epi16(_mm_srli_epi16(uv0, 8), _mm_srli_epi16(uv1, 8));
+        }
+
+        template <bool align, bool uyvy> SIMD_INLINE void StoreYuyv(uint8_t * yuyv, __m128i y, __m128i uv)
+        {
+            Store<align>((__m128i*)yuyv + 0, uyvy ? _mm_unpacklo_epi8(uv, y) : _mm_unpacklo_epi8(y, uv));
+            Store<align>((__m128i*)yuyv + 1, uyvy ? _mm_unpackhi_epi8(uv, y) : _mm_unpackhi_epi8(y, uv));
+        }
+
+        template <bool align, bool uyvy> SIMD_INLINE void StoreYuyv(uint8_t * yuyv, const __m128i * y, __m128i u, __m128i v)
+        {
+            StoreYuyv<align, uyvy>(yuyv + 0, y[0], _mm_unpacklo_epi8(u, v));
+            StoreYuyv<align, uyvy>(yuyv + DA, y[1], _mm_unpackhi_epi8(u, v));
+        }
     }
 #endif// SIMD_SSE2_ENABLE
 
@@ -487,93 +432,103 @@ namespace Simd
     }
 #endif//SIMD_SSSE3_ENABLE
 
-#ifdef SIMD_AVX2_ENABLE    
-    namespace Avx2
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
     {
-        SIMD_INLINE __m256i AdjustY16(__m256i y16)
+        SIMD_INLINE __m128i BgrToHue32(__m128i blue, __m128i green, __m128i red, __m128i max, __m128i range)
         {
-            return _mm256_subs_epi16(y16, K16_Y_ADJUST);
+            __m128i dividend = _mm_add_epi32(_mm_sub_epi32(red, green), _mm_slli_epi32(range, 2));
+            dividend = _mm_blendv_epi8(dividend, _mm_add_epi32(_mm_sub_epi32(blue, red), _mm_slli_epi32(range, 1)), _mm_cmpeq_epi32(green, max));
+            dividend = _mm_blendv_epi8(dividend, _mm_add_epi32(_mm_sub_epi32(green, blue), _mm_add_epi32(_mm_slli_epi32(range, 2), _mm_slli_epi32(range, 1))), _mm_cmpeq_epi32(red, max));
+            __m128 hue = _mm_div_ps(_mm_mul_ps(_mm_set1_ps(Base::KF_255_DIV_6), _mm_cvtepi32_ps(dividend)), _mm_cvtepi32_ps(range));
+            return _mm_andnot_si128(_mm_cmpeq_epi32(range, K_ZERO), _mm_and_si128(_mm_cvttps_epi32(hue), K32_000000FF));
         }
 
-        SIMD_INLINE __m256i AdjustUV16(__m256i uv16)
+        SIMD_INLINE __m128i DivideI32(__m128i dividend, __m128i divisor)
         {
-            return _mm256_subs_epi16(uv16, K16_UV_ADJUST);
+            __m128i quotient = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(dividend), _mm_cvtepi32_ps(divisor)));
+            return _mm_andnot_si128(_mm_cmpeq_epi32(divisor, K_ZERO), quotient);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToRed32(__m256i y16_1, __m256i v16_0)
+        SIMD_INLINE void BgrToHsv32(__m128i blue, __m128i green, __m128i red, __m128i & hue, __m128i & saturation, __m128i & value)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm256_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            __m128i max = _mm_max_epi32(red, _mm_max_epi32(green, blue));
+            __m128i range = _mm_sub_epi32(max, _mm_min_epi32(red, _mm_min_epi32(green, blue)));
+            hue = BgrToHue32(blue, green, red, max, range);
+            saturation = DivideI32(_mm_sub_epi32(_mm_slli_epi32(range, 8), range), max);
+            value = max;
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToRed16(__m256i y16, __m256i v16)
+        SIMD_INLINE void BgrToHsl32(__m128i blue, __m128i green, __m128i red, __m128i & hue, __m128i & saturation, __m128i & lightness)
         {
-            return SaturateI16ToU8(_mm256_packs_epi32(
-                AdjustedYuvToRed32(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(v16, K_ZERO)),
-                AdjustedYuvToRed32(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(v16, K_ZERO))));
+            __m128i max = _mm_max_epi32(red, _mm_max_epi32(green, blue));
+            __m128i min = _mm_min_epi32(red, _mm_min_epi32(green, blue));
+            __m128i range = _mm_sub_epi32(max, min);
+            __m128i sum = _mm_add_epi32(max, min);
+            hue = BgrToHue32(blue, green, red, max, range);
+            saturation = DivideI32(_mm_sub_epi32(_mm_slli_epi32(range, 8), range), _mm_min_epi32(sum, _mm_sub_epi32(K32_000001FE, sum)));
+            lightness = _mm_srli_epi32(sum, 1);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToGreen32(__m256i y16_1, __m256i u16_v16)
+        SIMD_INLINE void HueToBgr16(__m128i hue, __m128i min, __m128i max, __m128i & blue, __m128i & green, __m128i & red)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm256_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            __m128i hue6 = _mm_mullo_epi16(hue, K16_0006);
+            __m128i sector = _mm_min_epi16(DivideI16By255(hue6), K16_0005);
+            __m128i delta = DivideI16By255(_mm_mullo_epi16(_mm_sub_epi16(max, min), _mm_sub_epi16(hue6, _mm_mullo_epi16(sector, K16_00FF))));
+            __m128i up = _mm_add_epi16(min, delta), down = _mm_sub_epi16(max, delta);
+            __m128i lt1 = _mm_cmplt_epi16(sector, K16_0001), lt2 = _mm_cmplt_epi16(sector, K16_0002);
+            __m128i lt3 = _mm_cmplt_epi16(sector, K16_0003), lt4 = _mm_cmplt_epi16(sector, K16_0004), lt5 = _mm_cmplt_epi16(sector, K16_0005);
+            blue = _mm_blendv_epi8(_mm_blendv_epi8(_mm_blendv_epi8(down, max, lt5), up, lt3), min, lt2);
+            green = _mm_blendv_epi8(_mm_blendv_epi8(_mm_blendv_epi8(min, down, lt4), max, lt3), up, lt1);
+            red = _mm_blendv_epi8(_mm_blendv_epi8(_mm_blendv_epi8(_mm_blendv_epi8(max, up, lt5), min, lt4), down, lt2), max, lt1);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToGreen16(__m256i y16, __m256i u16, __m256i v16)
+        SIMD_INLINE void HsvToBgr16(__m128i hue, __m128i saturation, __m128i value, __m128i & blue, __m128i & green, __m128i & red)
         {
-            return SaturateI16ToU8(_mm256_packs_epi32(
-                AdjustedYuvToGreen32(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, v16)),
-                AdjustedYuvToGreen32(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, v16))));
+            __m128i min = DivideI16By255(_mm_mullo_epi16(_mm_sub_epi16(K16_00FF, saturation), value));
+            HueToBgr16(hue, min, value, blue, green, red);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToBlue32(__m256i y16_1, __m256i u16_0)
+        SIMD_INLINE void HslToBgr16(__m128i hue, __m128i saturation, __m128i lightness, __m128i & blue, __m128i & green, __m128i & red)
         {
-            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm256_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            __m128i max = _mm_add_epi16(lightness, DivideI16By255(_mm_mullo_epi16(_mm_min_epi16(lightness, _mm_sub_epi16(K16_00FF, lightness)), saturation)));
+            __m128i min = DivideI16By255(_mm_mullo_epi16(_mm_sub_epi16(K16_00FF, saturation), max));
+            HueToBgr16(hue, min, max, blue, green, red);
         }
 
-        SIMD_INLINE __m256i AdjustedYuvToBlue16(__m256i y16, __m256i u16)
-        {
-            return SaturateI16ToU8(_mm256_packs_epi32(
-                AdjustedYuvToBlue32(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, K_ZERO)),
-                AdjustedYuvToBlue32(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, K_ZERO))));
-        }
+        typedef void(*ColorConverterPtr)(__m128i src0, __m128i src1, __m128i src2, __m128i & dst0, __m128i & dst1, __m128i & dst2);
 
-        SIMD_INLINE __m256i YuvToRed(__m256i y, __m256i v)
+        template<ColorConverterPtr convert> SIMD_INLINE void ConvertColor32(const __m128i * src, __m128i * dst)
         {
-            __m256i lo = AdjustedYuvToRed16(
-                AdjustY16(_mm256_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpacklo_epi8(v, K_ZERO)));
-            __m256i hi = AdjustedYuvToRed16(
-                AdjustY16(_mm256_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpackhi_epi8(v, K_ZERO)));
-            return _mm256_packus_epi16(lo, hi);
-        }
-
-        SIMD_INLINE __m256i YuvToGreen(__m256i y, __m256i u, __m256i v)
-        {
-            __m256i lo = AdjustedYuvToGreen16(
-                AdjustY16(_mm256_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpacklo_epi8(u, K_ZERO)),
-                AdjustUV16(_mm256_unpacklo_epi8(v, K_ZERO)));
-            __m256i hi = AdjustedYuvToGreen16(
-                AdjustY16(_mm256_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpackhi_epi8(u, K_ZERO)),
-                AdjustUV16(_mm256_unpackhi_epi8(v, K_ZERO)));
-            return _mm256_packus_epi16(lo, hi);
+            __m128i s16[3][2], d32[3][4];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                s16[c][0] = UnpackU8<0>(src[c]);
+                s16[c][1] = UnpackU8<1>(src[c]);
+            }
+            for (size_t i = 0; i < 2; ++i)
+            {
+                convert(UnpackU16<0>(s16[0][i]), UnpackU16<0>(s16[1][i]), UnpackU16<0>(s16[2][i]), d32[0][2 * i + 0], d32[1][2 * i + 0], d32[2][2 * i + 0]);
+                convert(UnpackU16<1>(s16[0][i]), UnpackU16<1>(s16[1][i]), UnpackU16<1>(s16[2][i]), d32[0][2 * i + 1], d32[1][2 * i + 1], d32[2][2 * i + 1]);
+            }
+            for (size_t c = 0; c < 3; ++c)
+                dst[c] = _mm_packus_epi16(_mm_packs_epi32(d32[c][0], d32[c][1]), _mm_packs_epi32(d32[c][2], d32[c][3]));
         }
 
-        SIMD_INLINE __m256i YuvToBlue(__m256i y, __m256i u)
+        template<ColorConverterPtr convert> SIMD_INLINE void ConvertColor16(const __m128i * src, __m128i * dst)
         {
-            __m256i lo = AdjustedYuvToBlue16(
-                AdjustY16(_mm256_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpacklo_epi8(u, K_ZERO)));
-            __m256i hi = AdjustedYuvToBlue16(
-                AdjustY16(_mm256_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm256_unpackhi_epi8(u, K_ZERO)));
-            return _mm256_packus_epi16(lo, hi);
+            __m128i d16[3][2];
+            convert(UnpackU8<0>(src[0]), UnpackU8<0>(src[1]), UnpackU8<0>(src[2]), d16[0][0], d16[1][0], d16[2][0]);
+            convert(UnpackU8<1>(src[0]), UnpackU8<1>(src[1]), UnpackU8<1>(src[2]), d16[0][1], d16[1][1], d16[2][1]);
+            for (size_t c = 0; c < 3; ++c)
+                dst[c] = _mm_packus_epi16(d16[c][0], d16[c][1]);
         }
+    }
+#endif//SIMD_SSE41_ENABLE
 
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
         SIMD_INLINE __m256i BgrToY32(__m256i b16_r16, __m256i g16_1)
         {
             return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, K16_BY_RY),
@@ -730,96 +685,173 @@ namespace Simd
         {
             return _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permute4x64_epi64(rgb, 0xE9), K8_RGB_TO_BGRA_SHUFFLE), alpha);
         }
-    }
-#endif// SIMD_AVX2_ENABLE
 
-#ifdef SIMD_AVX512BW_ENABLE    
-    namespace Avx512bw
-    {
-        SIMD_INLINE __m512i AdjustY16(__m512i y16)
+        // u and v are returned in the same order as LoadPermuted gives.
+        template <bool align, bool nv21> SIMD_INLINE void LoadUv(const uint8_t * uv, __m256i & u, __m256i & v)
         {
-            return _mm512_subs_epi16(y16, K16_Y_ADJUST);
+            __m256i uv0 = Load<align>((__m256i*)uv + 0);
+            __m256i uv1 = Load<align>((__m256i*)uv + 1);
+            __m256i even = _mm256_packus_epi16(_mm256_and_si256(uv0, K16_00FF), _mm256_and_si256(uv1, K16_00FF));
+            __m256i odd = _mm256_packus_epi16(_mm256_srli_epi16(uv0, 8), _mm256_srli_epi16(uv1, 8));
+            u = nv21 ? odd : even;
+            v = nv21 ? even : odd;
         }
 
-        SIMD_INLINE __m512i AdjustUV16(__m512i uv16)
+        template <bool align, bool p010> SIMD_INLINE __m256i LoadY10(const uint8_t * y)
         {
-            return _mm512_subs_epi16(uv16, K16_UV_ADJUST);
+            __m256i y16 = Load<align>((__m256i*)y);
+            return p010 ? _mm256_srli_epi16(y16, 6) : y16;
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToRed32(__m512i y16_1, __m512i v16_0)
+        // u and v are duplicated for each pixel, A pixels are covered by two registers.
+        template <bool align> SIMD_INLINE void LoadP010Uv(const uint8_t * uv, __m256i * u, __m256i * v)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm512_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m256i uv16 = _mm256_srli_epi16(Load<align>((__m256i*)uv + i), 6);
+                u[i] = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(uv16, 0xA0), 0xA0);
+                v[i] = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(uv16, 0xF5), 0xF5);
+            }
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToRed16(__m512i y16, __m512i v16)
+        template <bool align> SIMD_INLINE void LoadYuv420p10Uv(const uint8_t * u, const uint8_t * v, __m256i * u16, __m256i * v16)
         {
-            return SaturateI16ToU8(_mm512_packs_epi32(
-                AdjustedYuvToRed32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(v16, K_ZERO)),
-                AdjustedYuvToRed32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(v16, K_ZERO))));
+            __m256i _u = _mm256_permute4x64_epi64(Load<align>((__m256i*)u), 0xD8);
+            __m256i _v = _mm256_permute4x64_epi64(Load<align>((__m256i*)v), 0xD8);
+            u16[0] = _mm256_unpacklo_epi16(_u, _u);
+            u16[1] = _mm256_unpackhi_epi16(_u, _u);
+            v16[0] = _mm256_unpacklo_epi16(_v, _v);
+            v16[1] = _mm256_unpackhi_epi16(_v, _v);
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToGreen32(__m512i y16_1, __m512i u16_v16)
+        template <bool align, bool uyvy> SIMD_INLINE void LoadYuyv(const uint8_t * yuyv, __m256i * y, __m256i & u, __m256i & v)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm512_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            const size_t Y = uyvy ? 1 : 0, C = 1 - Y;
+            __m256i s[2][4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                __m256i _yuyv = Load<align>((__m256i*)yuyv + i);
+                s[0][i] = _mm256_and_si256(_yuyv, K16_00FF);
+                s[1][i] = _mm256_srli_epi16(_yuyv, 8);
+            }
+            y[0] = PackI16ToU8(s[Y][0], s[Y][1]);
+            y[1] = PackI16ToU8(s[Y][2], s[Y][3]);
+            __m256i uv0 = PackI16ToU8(s[C][0], s[C][1]);
+            __m256i uv1 = PackI16ToU8(s[C][2], s[C][3]);
+            u = _mm256_packus_epi16(_mm256_and_si256(uv0, K16_00FF), _mm256_and_si256(uv1, K16_00FF));
+            v = _mm256_packus_epi16(_mm256_srli_epi16(uv0, 8), _mm256_srli_epi16(uv1, 8));
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToGreen16(__m512i y16, __m512i u16, __m512i v16)
+        template <bool align, bool uyvy> SIMD_INLINE void StoreYuyv(uint8_t * yuyv, __m256i y, __m256i uv)
         {
-            return SaturateI16ToU8(_mm512_packs_epi32(
-                AdjustedYuvToGreen32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, v16)),
-                AdjustedYuvToGreen32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, v16))));
+            __m256i lo = uyvy ? _mm256_unpacklo_epi8(uv, y) : _mm256_unpacklo_epi8(y, uv);
+            __m256i hi = uyvy ? _mm256_unpackhi_epi8(uv, y) : _mm256_unpackhi_epi8(y, uv);
+            Store<align>((__m256i*)yuyv + 0, _mm256_permute2x128_si256(lo, hi, 0x20));
+            Store<align>((__m256i*)yuyv + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToBlue32(__m512i y16_1, __m512i u16_0)
+        template <bool align, bool uyvy> SIMD_INLINE void StoreYuyv(uint8_t * yuyv, const __m256i * y, __m256i u, __m256i v)
         {
-            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
-                _mm512_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            __m256i uv0 = _mm256_unpacklo_epi8(u, v);
+            __m256i uv1 = _mm256_unpackhi_epi8(u, v);
+            StoreYuyv<align, uyvy>(yuyv + 0, y[0], _mm256_permute2x128_si256(uv0, uv1, 0x20));
+            StoreYuyv<align, uyvy>(yuyv + DA, y[1], _mm256_permute2x128_si256(uv0, uv1, 0x31));
         }
 
-        SIMD_INLINE __m512i AdjustedYuvToBlue16(__m512i y16, __m512i u16)
+        SIMD_INLINE __m256i BgrToHue32(__m256i blue, __m256i green, __m256i red, __m256i max, __m256i range)
         {
-            return SaturateI16ToU8(_mm512_packs_epi32(
-                AdjustedYuvToBlue32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, K_ZERO)),
-                AdjustedYuvToBlue32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, K_ZERO))));
+            __m256i dividend = _mm256_add_epi32(_mm256_sub_epi32(red, green), _mm256_slli_epi32(range, 2));
+            dividend = _mm256_blendv_epi8(dividend, _mm256_add_epi32(_mm256_sub_epi32(blue, red), _mm256_slli_epi32(range, 1)), _mm256_cmpeq_epi32(green, max));
+            dividend = _mm256_blendv_epi8(dividend, _mm256_add_epi32(_mm256_sub_epi32(green, blue), _mm256_add_epi32(_mm256_slli_epi32(range, 2), _mm256_slli_epi32(range, 1))), _mm256_cmpeq_epi32(red, max));
+            __m256 hue = _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(Base::KF_255_DIV_6), _mm256_cvtepi32_ps(dividend)), _mm256_cvtepi32_ps(range));
+            return _mm256_andnot_si256(_mm256_cmpeq_epi32(range, K_ZERO), _mm256_and_si256(_mm256_cvttps_epi32(hue), K32_000000FF));
         }
 
-        SIMD_INLINE __m512i YuvToRed(__m512i y, __m512i v)
+        SIMD_INLINE __m256i DivideI32(__m256i dividend, __m256i divisor)
         {
-            __m512i lo = AdjustedYuvToRed16(
-                AdjustY16(_mm512_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpacklo_epi8(v, K_ZERO)));
-            __m512i hi = AdjustedYuvToRed16(
-                AdjustY16(_mm512_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpackhi_epi8(v, K_ZERO)));
-            return _mm512_packus_epi16(lo, hi);
+            __m256i quotient = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(dividend), _mm256_cvtepi32_ps(divisor)));
+            return _mm256_andnot_si256(_mm256_cmpeq_epi32(divisor, K_ZERO), quotient);
         }
 
-        SIMD_INLINE __m512i YuvToGreen(__m512i y, __m512i u, __m512i v)
+        SIMD_INLINE void BgrToHsv32(__m256i blue, __m256i green, __m256i red, __m256i & hue, __m256i & saturation, __m256i & value)
         {
-            __m512i lo = AdjustedYuvToGreen16(
-                AdjustY16(_mm512_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpacklo_epi8(u, K_ZERO)),
-                AdjustUV16(_mm512_unpacklo_epi8(v, K_ZERO)));
-            __m512i hi = AdjustedYuvToGreen16(
-                AdjustY16(_mm512_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpackhi_epi8(u, K_ZERO)),
-                AdjustUV16(_mm512_unpackhi_epi8(v, K_ZERO)));
-            return _mm512_packus_epi16(lo, hi);
+            __m256i max = _mm256_max_epi32(red, _mm256_max_epi32(green, blue));
+            __m256i range = _mm256_sub_epi32(max, _mm256_min_epi32(red, _mm256_min_epi32(green, blue)));
+            hue = BgrToHue32(blue, green, red, max, range);
+            saturation = DivideI32(_mm256_sub_epi32(_mm256_slli_epi32(range, 8), range), max);
+            value = max;
         }
 
-        SIMD_INLINE __m512i YuvToBlue(__m512i y, __m512i u)
+        SIMD_INLINE void BgrToHsl32(__m256i blue, __m256i green, __m256i red, __m256i & hue, __m256i & saturation, __m256i & lightness)
         {
-            __m512i lo = AdjustedYuvToBlue16(
-                AdjustY16(_mm512_unpacklo_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpacklo_epi8(u, K_ZERO)));
-            __m512i hi = AdjustedYuvToBlue16(
-                AdjustY16(_mm512_unpackhi_epi8(y, K_ZERO)),
-                AdjustUV16(_mm512_unpackhi_epi8(u, K_ZERO)));
-            return _mm512_packus_epi16(lo, hi);
+            __m256i max = _mm256_max_epi32(red, _mm256_max_epi32(green, blue));
+            __m256i min = _mm256_min_epi32(red, _mm256_min_epi32(green, blue));
+            __m256i range = _mm256_sub_epi32(max, min);
+            __m256i sum = _mm256_add_epi32(max, min);
+            hue = BgrToHue32(blue, green, red, max, range);
+            saturation = DivideI32(_mm256_sub_epi32(_mm256_slli_epi32(range, 8), range), _mm256_min_epi32(sum, _mm256_sub_epi32(K32_000001FE, sum)));
+            lightness = _mm256_srli_epi32(sum, 1);
         }
 
+        SIMD_INLINE void HueToBgr16(__m256i hue, __m256i min, __m256i max, __m256i & blue, __m256i & green, __m256i & red)
+        {
+            __m256i hue6 = _mm256_mullo_epi16(hue, K16_0006);
+            __m256i sector = _mm256_min_epi16(DivideI16By255(hue6), K16_0005);
+            __m256i delta = DivideI16By255(_mm256_mullo_epi16(_mm256_sub_epi16(max, min), _mm256_sub_epi16(hue6, _mm256_mullo_epi16(sector, K16_00FF))));
+            __m256i up = _mm256_add_epi16(min, delta), down = _mm256_sub_epi16(max, delta);
+            __m256i lt1 = _mm256_cmpgt_epi16(K16_0001, sector), lt2 = _mm256_cmpgt_epi16(K16_0002, sector);
+            __m256i lt3 = _mm256_cmpgt_epi16(K16_0003, sector), lt4 = _mm256_cmpgt_epi16(K16_0004, sector), lt5 = _mm256_cmpgt_epi16(K16_0005, sector);
+            blue = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_blendv_epi8(down, max, lt5), up, lt3), min, lt2);
+            green = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_blendv_epi8(min, down, lt4), max, lt3), up, lt1);
+            red = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_blendv_epi8(max, up, lt5), min, lt4), down, lt2), max, lt1);
+        }
+
+        SIMD_INLINE void HsvToBgr16(__m256i hue, __m256i saturation, __m256i value, __m256i & blue, __m256i & green, __m256i & red)
+        {
+            __m256i min = DivideI16By255(_mm256_mullo_epi16(_mm256_sub_epi16(K16_00FF, saturation), value));
+            HueToBgr16(hue, min, value, blue, green, red);
+        }
+
+        SIMD_INLINE void HslToBgr16(__m256i hue, __m256i saturation, __m256i lightness, __m256i & blue, __m256i & green, __m256i & red)
+        {
+            __m256i max = _mm256_add_epi16(lightness, DivideI16By255(_mm256_mullo_epi16(_mm256_min_epi16(lightness, _mm256_sub_epi16(K16_00FF, lightness)), saturation)));
+            __m256i min = DivideI16By255(_mm256_mullo_epi16(_mm256_sub_epi16(K16_00FF, saturation), max));
+            HueToBgr16(hue, min, max, blue, green, red);
+        }
+
+        typedef void(*ColorConverterPtr)(__m256i src0, __m256i src1, __m256i src2, __m256i & dst0, __m256i & dst1, __m256i & dst2);
+
+        template<ColorConverterPtr convert> SIMD_INLINE void ConvertColor32(const __m256i * src, __m256i * dst)
+        {
+            __m256i s16[3][2], d32[3][4];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                s16[c][0] = UnpackU8<0>(src[c]);
+                s16[c][1] = UnpackU8<1>(src[c]);
+            }
+            for (size_t i = 0; i < 2; ++i)
+            {
+                convert(UnpackU16<0>(s16[0][i]), UnpackU16<0>(s16[1][i]), UnpackU16<0>(s16[2][i]), d32[0][2 * i + 0], d32[1][2 * i + 0], d32[2][2 * i + 0]);
+                convert(UnpackU16<1>(s16[0][i]), UnpackU16<1>(s16[1][i]), UnpackU16<1>(s16[2][i]), d32[0][2 * i + 1], d32[1][2 * i + 1], d32[2][2 * i + 1]);
+            }
+            for (size_t c = 0; c < 3; ++c)
+                dst[c] = _mm256_packus_epi16(_mm256_packs_epi32(d32[c][0], d32[c][1]), _mm256_packs_epi32(d32[c][2], d32[c][3]));
+        }
+
+        template<ColorConverterPtr convert> SIMD_INLINE void ConvertColor16(const __m256i * src, __m256i * dst)
+        {
+            __m256i d16[3][2];
+            convert(UnpackU8<0>(src[0]), UnpackU8<0>(src[1]), UnpackU8<0>(src[2]), d16[0][0], d16[1][0], d16[2][0]);
+            convert(UnpackU8<1>(src[0]), UnpackU8<1>(src[1]), UnpackU8<1>(src[2]), d16[0][1], d16[1][1], d16[2][1]);
+            for (size_t c = 0; c < 3; ++c)
+                dst[c] = _mm256_packus_epi16(d16[c][0], d16[c][1]);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
         template <int index> __m512i GrayToBgr(__m512i gray);
 
         template<> SIMD_INLINE __m512i GrayToBgr<0>(__m512i gray)
@@ -880,6 +912,192 @@ namespace Simd
                     _mm512_or_si512(_mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, green), K8_SHUFFLE_GREEN_TO_BGR2),
                         _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, red), K8_SHUFFLE_RED_TO_BGR2)));
         }
+
+        // u and v are returned in the same order as permutation K64_PERMUTE_FOR_UNPACK gives.
+        template <bool align, bool mask, bool nv21> SIMD_INLINE void LoadUv(const uint8_t * uv, __m512i & u, __m512i & v, const __mmask64 * tails)
+        {
+            __m512i uv0 = Load<align, mask>(uv + 0, tails[0]);
+            __m512i uv1 = Load<align, mask>(uv + A, tails[1]);
+            __m512i even = _mm512_packus_epi16(_mm512_and_si512(uv0, K16_00FF), _mm512_and_si512(uv1, K16_00FF));
+            __m512i odd = _mm512_packus_epi16(_mm512_srli_epi16(uv0, 8), _mm512_srli_epi16(uv1, 8));
+            u = nv21 ? odd : even;
+            v = nv21 ? even : odd;
+        }
+
+        template <bool align, bool p010> SIMD_INLINE __m512i LoadY10(const uint8_t * y)
+        {
+            __m512i y16 = Load<align>(y);
+            return p010 ? _mm512_srli_epi16(y16, 6) : y16;
+        }
+
+        // u and v are duplicated for each pixel, A pixels are covered by two registers.
+        template <bool align> SIMD_INLINE void LoadP010Uv(const uint8_t * uv, __m512i * u, __m512i * v)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m512i uv16 = _mm512_srli_epi16(Load<align>(uv + i * A), 6);
+                u[i] = _mm512_shufflehi_epi16(_mm512_shufflelo_epi16(uv16, 0xA0), 0xA0);
+                v[i] = _mm512_shufflehi_epi16(_mm512_shufflelo_epi16(uv16, 0xF5), 0xF5);
+            }
+        }
+
+        template <bool align> SIMD_INLINE void LoadYuv420p10Uv(const uint8_t * u, const uint8_t * v, __m512i * u16, __m512i * v16)
+        {
+            __m512i _u = Load<align>(u);
+            __m512i _v = Load<align>(v);
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m512i u32 = _mm512_cvtepu16_epi32(i ? _mm512_extracti64x4_epi64(_u, 1) : _mm512_castsi512_si256(_u));
+                __m512i v32 = _mm512_cvtepu16_epi32(i ? _mm512_extracti64x4_epi64(_v, 1) : _mm512_castsi512_si256(_v));
+                u16[i] = _mm512_or_si512(u32, _mm512_slli_epi32(u32, 16));
+                v16[i] = _mm512_or_si512(v32, _mm512_slli_epi32(v32, 16));
+            }
+        }
+
+        template <bool align, bool mask, bool uyvy> SIMD_INLINE void LoadYuyv(const uint8_t * yuyv, __m512i * y, __m512i & u, __m512i & v, const __mmask64 * tails)
+        {
+            const size_t Y = uyvy ? 1 : 0, C = 1 - Y;
+            __m512i s[2][4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                __m512i _yuyv = Load<align, mask>(yuyv + i * A, tails[i]);
+                s[0][i] = _mm512_and_si512(_yuyv, K16_00FF);
+                s[1][i] = _mm512_srli_epi16(_yuyv, 8);
+            }
+            y[0] = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(s[Y][0], s[Y][1]));
+            y[1] = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(s[Y][2], s[Y][3]));
+            __m512i uv0 = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(s[C][0], s[C][1]));
+            __m512i uv1 = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(s[C][2], s[C][3]));
+            u = _mm512_packus_epi16(_mm512_and_si512(uv0, K16_00FF), _mm512_and_si512(uv1, K16_00FF));
+            v = _mm512_packus_epi16(_mm512_srli_epi16(uv0, 8), _mm512_srli_epi16(uv1, 8));
+        }
+
+        template <bool align, bool mask, bool uyvy> SIMD_INLINE void StoreYuyv(uint8_t * yuyv, __m512i y, __m512i uv, const __mmask64 * tails)
+        {
+            y = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, y);
+            uv = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, uv);
+            Store<align, mask>(yuyv + 0, uyvy ? _mm512_unpacklo_epi8(uv, y) : _mm512_unpacklo_epi8(y, uv), tails[0]);
+            Store<align, mask>(yuyv + A, uyvy ? _mm512_unpackhi_epi8(uv, y) : _mm512_unpackhi_epi8(y, uv), tails[1]);
+        }
+
+        template <bool align, bool mask, bool uyvy> SIMD_INLINE void StoreYuyv(uint8_t * yuyv, const __m512i * y, __m512i u, __m512i v, const __mmask64 * tails)
+        {
+            u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, u);
+            v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, v);
+            StoreYuyv<align, mask, uyvy>(yuyv + 0, y[0], _mm512_unpacklo_epi8(u, v), tails + 0);
+            StoreYuyv<align, mask, uyvy>(yuyv + DA, y[1], _mm512_unpackhi_epi8(u, v), tails + 2);
+        }
+
+        SIMD_INLINE __m512i BgrToHue32(__m512i blue, __m512i green, __m512i red, __m512i max, __m512i range)
+        {
+            __m512i dividend = _mm512_add_epi32(_mm512_sub_epi32(red, green), _mm512_slli_epi32(range, 2));
+            dividend = _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(green, max), dividend, _mm512_add_epi32(_mm512_sub_epi32(blue, red), _mm512_slli_epi32(range, 1)));
+            dividend = _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(red, max), dividend, _mm512_add_epi32(_mm512_sub_epi32(green, blue), _mm512_add_epi32(_mm512_slli_epi32(range, 2), _mm512_slli_epi32(range, 1))));
+            __m512 hue = _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(Base::KF_255_DIV_6), _mm512_cvtepi32_ps(dividend)), _mm512_cvtepi32_ps(range));
+            return _mm512_maskz_and_epi32(_mm512_cmpneq_epi32_mask(range, K_ZERO), _mm512_cvttps_epi32(hue), K32_000000FF);
+        }
+
+        SIMD_INLINE __m512i DivideI32(__m512i dividend, __m512i divisor)
+        {
+            return _mm512_maskz_cvttps_epi32(_mm512_cmpneq_epi32_mask(divisor, K_ZERO), _mm512_div_ps(_mm512_cvtepi32_ps(dividend), _mm512_cvtepi32_ps(divisor)));
+        }
+
+        SIMD_INLINE void BgrToHsv32(__m512i blue, __m512i green, __m512i red, __m512i & hue, __m512i & saturation, __m512i & value)
+        {
+            __m512i max = _mm512_max_epi32(red, _mm512_max_epi32(green, blue));
+            __m512i range = _mm512_sub_epi32(max, _mm512_min_epi32(red, _mm512_min_epi32(green, blue)));
+            hue = BgrToHue32(blue, green, red, max, range);
+            saturation = DivideI32(_mm512_sub_epi32(_mm512_slli_epi32(range, 8), range), max);
+            value = max;
+        }
+
+        SIMD_INLINE void BgrToHsl32(__m512i blue, __m512i green, __m512i red, __m512i & hue, __m512i & saturation, __m512i & lightness)
+        {
+            __m512i max = _mm512_max_epi32(red, _mm512_max_epi32(green, blue));
+            __m512i min = _mm512_min_epi32(red, _mm512_min_epi32(green, blue));
+            __m512i range = _mm512_sub_epi32(max, min);
+            __m512i sum = _mm512_add_epi32(max, min);
+            hue = BgrToHue32(blue, green, red, max, range);
+            saturation = DivideI32(_mm512_sub_epi32(_mm512_slli_epi32(range, 8), range), _mm512_min_epi32(sum, _mm512_sub_epi32(K32_000001FE, sum)));
+            lightness = _mm512_srli_epi32(sum, 1);
+        }
+
+        SIMD_INLINE __m512i DivideI32By255(__m512i value)
+        {
+            return _mm512_srli_epi32(_mm512_add_epi32(_mm512_add_epi32(value, K32_00000001), _mm512_srli_epi32(value, 8)), 8);
+        }
+
+        SIMD_INLINE void HueToBgr32(__m512i hue, __m512i min, __m512i max, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            __m512i hue6 = _mm512_add_epi32(_mm512_slli_epi32(hue, 2), _mm512_slli_epi32(hue, 1));
+            __m512i sector = _mm512_min_epi32(DivideI32By255(hue6), _mm512_set1_epi32(5));
+            __m512i delta = DivideI32By255(_mm512_mullo_epi32(_mm512_sub_epi32(max, min), _mm512_sub_epi32(hue6, _mm512_mullo_epi32(sector, K32_000000FF))));
+            __m512i up = _mm512_add_epi32(min, delta), down = _mm512_sub_epi32(max, delta);
+            __mmask16 lt1 = _mm512_cmplt_epi32_mask(sector, _mm512_set1_epi32(1)), lt2 = _mm512_cmplt_epi32_mask(sector, _mm512_set1_epi32(2));
+            __mmask16 lt3 = _mm512_cmplt_epi32_mask(sector, _mm512_set1_epi32(3)), lt4 = _mm512_cmplt_epi32_mask(sector, _mm512_set1_epi32(4));
+            __mmask16 lt5 = _mm512_cmplt_epi32_mask(sector, _mm512_set1_epi32(5));
+            blue = _mm512_mask_blend_epi32(lt2, _mm512_mask_blend_epi32(lt3, _mm512_mask_blend_epi32(lt5, down, max), up), min);
+            green = _mm512_mask_blend_epi32(lt1, _mm512_mask_blend_epi32(lt3, _mm512_mask_blend_epi32(lt4, min, down), max), up);
+            red = _mm512_mask_blend_epi32(lt1, _mm512_mask_blend_epi32(lt2, _mm512_mask_blend_epi32(lt4, _mm512_mask_blend_epi32(lt5, max, up), min), down), max);
+        }
+
+        SIMD_INLINE void HsvToBgr32(__m512i hue, __m512i saturation, __m512i value, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            __m512i min = DivideI32By255(_mm512_mullo_epi32(_mm512_sub_epi32(K32_000000FF, saturation), value));
+            HueToBgr32(hue, min, value, blue, green, red);
+        }
+
+        SIMD_INLINE void HslToBgr32(__m512i hue, __m512i saturation, __m512i lightness, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            __m512i max = _mm512_add_epi32(lightness, DivideI32By255(_mm512_mullo_epi32(_mm512_min_epi32(lightness, _mm512_sub_epi32(K32_000000FF, lightness)), saturation)));
+            __m512i min = DivideI32By255(_mm512_mullo_epi32(_mm512_sub_epi32(K32_000000FF, saturation), max));
+            HueToBgr32(hue, min, max, blue, green, red);
+        }
+
+        const __m512i K8_SHUFFLE_BGR_TO_BLUE32 = SIMD_MM512_SETR_EPI8(
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+            0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1);
+        const __m512i K8_SHUFFLE_BGR_TO_GREEN32 = SIMD_MM512_SETR_EPI8(
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+            0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1);
+        const __m512i K8_SHUFFLE_BGR_TO_RED32 = SIMD_MM512_SETR_EPI8(
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+            0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1);
+        const __m512i K8_SHUFFLE_BGRA32_TO_BGR = SIMD_MM512_SETR_EPI8(
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+        const __m512i K32_PERMUTE_BGRA32_TO_BGR = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+        typedef void(*ColorConverterPtr)(__m512i src0, __m512i src1, __m512i src2, __m512i & dst0, __m512i & dst1, __m512i & dst2);
+
+        // F pixels are converted, the tail mask is applied to 3*F bytes of BGR-like data.
+        template<ColorConverterPtr convert> SIMD_INLINE void ConvertColor32(__m512i src0, __m512i src1, __m512i src2, uint8_t * dst, __mmask64 tail)
+        {
+            __m512i dst0, dst1, dst2;
+            convert(src0, src1, src2, dst0, dst1, dst2);
+            __m512i bgra = _mm512_or_si512(dst0, _mm512_or_si512(_mm512_slli_epi32(dst1, 8), _mm512_slli_epi32(dst2, 16)));
+            Store<false, true>(dst, _mm512_permutexvar_epi32(K32_PERMUTE_BGRA32_TO_BGR, _mm512_shuffle_epi8(bgra, K8_SHUFFLE_BGRA32_TO_BGR)), tail);
+        }
+
+        template<ColorConverterPtr convert> SIMD_INLINE void ConvertColor32(__m128i src0, __m128i src1, __m128i src2, uint8_t * dst, __mmask64 tail)
+        {
+            ConvertColor32<convert>(_mm512_cvtepu8_epi32(src0), _mm512_cvtepu8_epi32(src1), _mm512_cvtepu8_epi32(src2), dst, tail);
+        }
+
+        template<ColorConverterPtr convert> SIMD_INLINE void ConvertColor32(const uint8_t * src, uint8_t * dst, __mmask64 tail)
+        {
+            __m512i bgr = _mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_0, Load<false, true>(src, tail));
+            ConvertColor32<convert>(_mm512_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_BLUE32), _mm512_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_GREEN32),
+                _mm512_shuffle_epi8(bgr, K8_SHUFFLE_BGR_TO_RED32), dst, tail);
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE 
 
@@ -1060,8 +1278,8 @@ namespace Simd
 
         template <int part> SIMD_INLINE int32x4_t BgrToY(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, (int16x4_t)Half<part>(blue), K16_BLUE_TO_Y_WEIGHT),
-                (int16x4_t)Half<part>(green), K16_GREEN_TO_Y_WEIGHT), (int16x4_t)Half<part>(red), K16_RED_TO_Y_WEIGHT), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, vreinterpret_s16_u16(Half<part>(blue)), K16_BLUE_TO_Y_WEIGHT),
+                vreinterpret_s16_u16(Half<part>(green)), K16_GREEN_TO_Y_WEIGHT), vreinterpret_s16_u16(Half<part>(red)), K16_RED_TO_Y_WEIGHT), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
         SIMD_INLINE int16x8_t BgrToY(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
@@ -1078,8 +1296,8 @@ namespace Simd
 
         template <int part> SIMD_INLINE int32x4_t BgrToU(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, (int16x4_t)Half<part>(blue), K16_BLUE_TO_U_WEIGHT),
-                (int16x4_t)Half<part>(green), K16_GREEN_TO_U_WEIGHT), (int16x4_t)Half<part>(red), K16_RED_TO_U_WEIGHT), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, vreinterpret_s16_u16(Half<part>(blue)), K16_BLUE_TO_U_WEIGHT),
+                vreinterpret_s16_u16(Half<part>(green)), K16_GREEN_TO_U_WEIGHT), vreinterpret_s16_u16(Half<part>(red)), K16_RED_TO_U_WEIGHT), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
         SIMD_INLINE int16x8_t BgrToU(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
@@ -1096,8 +1314,8 @@ namespace Simd
 
         template <int part> SIMD_INLINE int32x4_t BgrToV(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, (int16x4_t)Half<part>(blue), K16_BLUE_TO_V_WEIGHT),
-                (int16x4_t)Half<part>(green), K16_GREEN_TO_V_WEIGHT), (int16x4_t)Half<part>(red), K16_RED_TO_V_WEIGHT), Base::BGR_TO_YUV_AVERAGING_SHIFT);
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_BGR_TO_YUV_ROUND_TERM, vreinterpret_s16_u16(Half<part>(blue)), K16_BLUE_TO_V_WEIGHT),
+                vreinterpret_s16_u16(Half<part>(green)), K16_GREEN_TO_V_WEIGHT), vreinterpret_s16_u16(Half<part>(red)), K16_RED_TO_V_WEIGHT), Base::BGR_TO_YUV_AVERAGING_SHIFT);
         }
 
         SIMD_INLINE int16x8_t BgrToV(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
@@ -1112,81 +1330,160 @@ namespace Simd
                 BgrToV(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
         }
 
-        template <int part> SIMD_INLINE int16x8_t AdjustY(uint8x16_t y)
+        template <bool align, bool nv21> SIMD_INLINE void LoadUv(const uint8_t * uv, uint8x16_t & u, uint8x16_t & v)
         {
-            return vsubq_s16((int16x8_t)UnpackU8<part>(y), K16_Y_ADJUST);
+            uint8x16x2_t _uv = Load2<align>(uv);
+            u = _uv.val[nv21 ? 1 : 0];
+            v = _uv.val[nv21 ? 0 : 1];
         }
 
-        template <int part> SIMD_INLINE int16x8_t AdjustUV(uint8x16_t uv)
+        template <bool align, bool p010> SIMD_INLINE uint16x8_t LoadY10(const uint8_t * y)
         {
-            return vsubq_s16((int16x8_t)UnpackU8<part>(uv), K16_UV_ADJUST);
+            uint16x8_t y16 = Load<align>((const uint16_t*)y);
+            return p010 ? vshrq_n_u16(y16, 6) : y16;
         }
 
-        template <int part> SIMD_INLINE int32x4_t YuvToRed(int16x8_t y, int16x8_t v)
+        // u and v are duplicated for each pixel, A pixels are covered by two registers.
+        template <bool align> SIMD_INLINE void LoadP010Uv(const uint8_t * uv, uint16x8_t * u, uint16x8_t * v)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(K32_YUV_TO_BGR_ROUND_TERM, Half<part>(y), K16_Y_TO_RGB_WEIGHT),
-                Half<part>(v), K16_V_TO_RED_WEIGHT), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            uint16x8x2_t _uv = Load2<align>((const uint16_t*)uv);
+            uint16x8x2_t u16 = vzipq_u16(vshrq_n_u16(_uv.val[0], 6), vshrq_n_u16(_uv.val[0], 6));
+            uint16x8x2_t v16 = vzipq_u16(vshrq_n_u16(_uv.val[1], 6), vshrq_n_u16(_uv.val[1], 6));
+            u[0] = u16.val[0];
+            u[1] = u16.val[1];
+            v[0] = v16.val[0];
+            v[1] = v16.val[1];
         }
 
-        SIMD_INLINE int16x8_t YuvToRed(int16x8_t y, int16x8_t v)
+        template <bool align> SIMD_INLINE void LoadYuv420p10Uv(const uint8_t * u, const uint8_t * v, uint16x8_t * u16, uint16x8_t * v16)
         {
-            return PackI32(YuvToRed<0>(y, v), YuvToRed<1>(y, v));
+            uint16x8_t _u = Load<align>((const uint16_t*)u);
+            uint16x8_t _v = Load<align>((const uint16_t*)v);
+            uint16x8x2_t uu = vzipq_u16(_u, _u);
+            uint16x8x2_t vv = vzipq_u16(_v, _v);
+            u16[0] = uu.val[0];
+            u16[1] = uu.val[1];
+            v16[0] = vv.val[0];
+            v16[1] = vv.val[1];
         }
 
-        SIMD_INLINE uint8x16_t YuvToRed(uint8x16_t y, uint8x16_t v)
+        template <bool align, bool uyvy> SIMD_INLINE void LoadYuyv(const uint8_t * yuyv, uint8x16_t * y, uint8x16_t & u, uint8x16_t & v)
         {
-            return PackSaturatedI16(YuvToRed(AdjustY<0>(y), AdjustUV<0>(v)), YuvToRed(AdjustY<1>(y), AdjustUV<1>(v)));
+            uint8x16x4_t _yuyv = Load4<align>(yuyv);
+            uint8x16x2_t _y = vzipq_u8(_yuyv.val[uyvy ? 1 : 0], _yuyv.val[uyvy ? 3 : 2]);
+            y[0] = _y.val[0];
+            y[1] = _y.val[1];
+            u = _yuyv.val[uyvy ? 0 : 1];
+            v = _yuyv.val[uyvy ? 2 : 3];
         }
 
-        template <int part> SIMD_INLINE int32x4_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
+        template <bool align, bool uyvy> SIMD_INLINE void StoreYuyv(uint8_t * yuyv, const uint8x16_t * y, const uint8x16_t & u, const uint8x16_t & v)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(K32_YUV_TO_BGR_ROUND_TERM, Half<part>(y), K16_Y_TO_RGB_WEIGHT),
-                Half<part>(u), K16_U_TO_GREEN_WEIGHT), Half<part>(v), K16_V_TO_GREEN_WEIGHT), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            uint8x16x2_t _y = vuzpq_u8(y[0], y[1]);
+            uint8x16x4_t _yuyv;
+            _yuyv.val[uyvy ? 1 : 0] = _y.val[0];
+            _yuyv.val[uyvy ? 0 : 1] = u;
+            _yuyv.val[uyvy ? 3 : 2] = _y.val[1];
+            _yuyv.val[uyvy ? 2 : 3] = v;
+            Store4<align>(yuyv, _yuyv);
         }
 
-        SIMD_INLINE int16x8_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
+        SIMD_INLINE int32x4_t DivideI32(int32x4_t dividend, int32x4_t divisor)
         {
-            return PackI32(YuvToGreen<0>(y, u, v), YuvToGreen<1>(y, u, v));
+#if defined(SIMD_ARM64_ENABLE)
+            int32x4_t quotient = vcvtq_s32_f32(vdivq_f32(vcvtq_f32_s32(dividend), vcvtq_f32_s32(divisor)));
+#else
+            int32x4_t quotient = vcvtq_s32_f32(Div<2>(vcvtq_f32_s32(dividend), vcvtq_f32_s32(divisor)));
+            int32x4_t remainder = vsubq_s32(dividend, vmulq_s32(quotient, divisor));
+            quotient = vsubq_s32(quotient, vreinterpretq_s32_u32(vcgeq_s32(remainder, divisor)));
+            quotient = vaddq_s32(quotient, vreinterpretq_s32_u32(vcltq_s32(remainder, vreinterpretq_s32_u32(K32_00000000))));
+#endif
+            return vandq_s32(quotient, vreinterpretq_s32_u32(vtstq_s32(divisor, divisor)));
         }
 
-        SIMD_INLINE uint8x16_t YuvToGreen(uint8x16_t y, uint8x16_t u, uint8x16_t v)
+        SIMD_INLINE int32x4_t BgrToHue32(int32x4_t blue, int32x4_t green, int32x4_t red, int32x4_t max, int32x4_t range)
         {
-            return PackSaturatedI16(YuvToGreen(AdjustY<0>(y), AdjustUV<0>(u), AdjustUV<0>(v)),
-                YuvToGreen(AdjustY<1>(y), AdjustUV<1>(u), AdjustUV<1>(v)));
+            int32x4_t dividend = vaddq_s32(vsubq_s32(red, green), vshlq_n_s32(range, 2));
+            dividend = vbslq_s32(vceqq_s32(green, max), vaddq_s32(vsubq_s32(blue, red), vshlq_n_s32(range, 1)), dividend);
+            dividend = vbslq_s32(vceqq_s32(red, max), vaddq_s32(vsubq_s32(green, blue), vmulq_n_s32(range, 6)), dividend);
+            return vandq_s32(DivideI32(vmulq_n_s32(dividend, 85), vshlq_n_s32(range, 1)), vreinterpretq_s32_u32(K32_000000FF));
         }
 
-        template <int part> SIMD_INLINE int32x4_t YuvToBlue(int16x8_t y, int16x8_t u)
+        SIMD_INLINE void BgrToHsv32(int32x4_t blue, int32x4_t green, int32x4_t red, int32x4_t & hue, int32x4_t & saturation, int32x4_t & value)
         {
-            return vshrq_n_s32(vmlal_s16(vmlal_s16(K32_YUV_TO_BGR_ROUND_TERM, Half<part>(y), K16_Y_TO_RGB_WEIGHT),
-                Half<part>(u), K16_U_TO_BLUE_WEIGHT), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+            int32x4_t max = vmaxq_s32(red, vmaxq_s32(green, blue));
+            int32x4_t range = vsubq_s32(max, vminq_s32(red, vminq_s32(green, blue)));
+            hue = BgrToHue32(blue, green, red, max, range);
+            saturation = DivideI32(vmulq_n_s32(range, 255), max);
+            value = max;
         }
 
-        SIMD_INLINE int16x8_t YuvToBlue(int16x8_t y, int16x8_t u)
+        SIMD_INLINE void BgrToHsl32(int32x4_t blue, int32x4_t green, int32x4_t red, int32x4_t & hue, int32x4_t & saturation, int32x4_t & lightness)
         {
-            return PackI32(YuvToBlue<0>(y, u), YuvToBlue<1>(y, u));
+            int32x4_t max = vmaxq_s32(red, vmaxq_s32(green, blue));
+            int32x4_t min = vminq_s32(red, vminq_s32(green, blue));
+            int32x4_t range = vsubq_s32(max, min);
+            int32x4_t sum = vaddq_s32(max, min);
+            hue = BgrToHue32(blue, green, red, max, range);
+            saturation = DivideI32(vmulq_n_s32(range, 255), vminq_s32(sum, vsubq_s32(vreinterpretq_s32_u32(K32_000001FE), sum)));
+            lightness = vshrq_n_s32(sum, 1);
         }
 
-        SIMD_INLINE uint8x16_t YuvToBlue(uint8x16_t y, uint8x16_t u)
+        SIMD_INLINE void HueToBgr16(uint16x8_t hue, uint16x8_t min, uint16x8_t max, uint16x8_t & blue, uint16x8_t & green, uint16x8_t & red)
         {
-            return PackSaturatedI16(YuvToBlue(AdjustY<0>(y), AdjustUV<0>(u)), YuvToBlue(AdjustY<1>(y), AdjustUV<1>(u)));
+            uint16x8_t hue6 = vmulq_u16(hue, K16_0006);
+            uint16x8_t sector = vminq_u16(DivideI16By255(hue6), K16_0005);
+            uint16x8_t delta = DivideI16By255(vmulq_u16(vsubq_u16(max, min), vsubq_u16(hue6, vmulq_u16(sector, K16_00FF))));
+            uint16x8_t up = vaddq_u16(min, delta), down = vsubq_u16(max, delta);
+            uint16x8_t lt1 = vcltq_u16(sector, K16_0001), lt2 = vcltq_u16(sector, K16_0002);
+            uint16x8_t lt3 = vcltq_u16(sector, K16_0003), lt4 = vcltq_u16(sector, K16_0004), lt5 = vcltq_u16(sector, K16_0005);
+            blue = vbslq_u16(lt2, min, vbslq_u16(lt3, up, vbslq_u16(lt5, max, down)));
+            green = vbslq_u16(lt1, up, vbslq_u16(lt3, max, vbslq_u16(lt4, down, min)));
+            red = vbslq_u16(lt1, max, vbslq_u16(lt2, down, vbslq_u16(lt4, min, vbslq_u16(lt5, up, max))));
         }
 
-        SIMD_INLINE void YuvToBgr(uint8x16_t y, uint8x16_t u, uint8x16_t v, uint8x16x3_t & bgr)
+        SIMD_INLINE void HsvToBgr16(uint16x8_t hue, uint16x8_t saturation, uint16x8_t value, uint16x8_t & blue, uint16x8_t & green, uint16x8_t & red)
         {
-            int16x8_t yLo = AdjustY<0>(y), uLo = AdjustUV<0>(u), vLo = AdjustUV<0>(v);
-            int16x8_t yHi = AdjustY<1>(y), uHi = AdjustUV<1>(u), vHi = AdjustUV<1>(v);
-            bgr.val[0] = PackSaturatedI16(YuvToBlue(yLo, uLo), YuvToBlue(yHi, uHi));
-            bgr.val[1] = PackSaturatedI16(YuvToGreen(yLo, uLo, vLo), YuvToGreen(yHi, uHi, vHi));
-            bgr.val[2] = PackSaturatedI16(YuvToRed(yLo, vLo), YuvToRed(yHi, vHi));
+            uint16x8_t min = DivideI16By255(vmulq_u16(vsubq_u16(K16_00FF, saturation), value));
+            HueToBgr16(hue, min, value, blue, green, red);
         }
 
-        SIMD_INLINE void YuvToRgb(uint8x16_t y, uint8x16_t u, uint8x16_t v, uint8x16x3_t& rgb)
+        SIMD_INLINE void HslToBgr16(uint16x8_t hue, uint16x8_t saturation, uint16x8_t lightness, uint16x8_t & blue, uint16x8_t & green, uint16x8_t & red)
+        {
+            uint16x8_t max = vaddq_u16(lightness, DivideI16By255(vmulq_u16(vminq_u16(lightness, vsubq_u16(K16_00FF, lightness)), saturation)));
+            uint16x8_t min = DivideI16By255(vmulq_u16(vsubq_u16(K16_00FF, saturation), max));
+            HueToBgr16(hue, min, max, blue, green, red);
+        }
+
+        typedef void(*ColorConverter32Ptr)(int32x4_t src0, int32x4_t src1, int32x4_t src2, int32x4_t & dst0, int32x4_t & dst1, int32x4_t & dst2);
+
+        template<ColorConverter32Ptr convert> SIMD_INLINE void ConvertColor32(const uint8x16x3_t & src, uint8x16x3_t & dst)
+        {
+            uint16x8_t s16[3][2];
+            int32x4_t d32[3][4];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                s16[c][0] = UnpackU8<0>(src.val[c]);
+                s16[c][1] = UnpackU8<1>(src.val[c]);
+            }
+            for (size_t i = 0; i < 2; ++i)
+            {
+                convert(vreinterpretq_s32_u32(UnpackU16<0>(s16[0][i])), vreinterpretq_s32_u32(UnpackU16<0>(s16[1][i])), vreinterpretq_s32_u32(UnpackU16<0>(s16[2][i])), d32[0][2 * i + 0], d32[1][2 * i + 0], d32[2][2 * i + 0]);
+                convert(vreinterpretq_s32_u32(UnpackU16<1>(s16[0][i])), vreinterpretq_s32_u32(UnpackU16<1>(s16[1][i])), vreinterpretq_s32_u32(UnpackU16<1>(s16[2][i])), d32[0][2 * i + 1], d32[1][2 * i + 1], d32[2][2 * i + 1]);
+            }
+            for (size_t c = 0; c < 3; ++c)
+                dst.val[c] = PackSaturatedI16(PackI32(d32[c][0], d32[c][1]), PackI32(d32[c][2], d32[c][3]));
+        }
+
+        typedef void(*ColorConverter16Ptr)(uint16x8_t src0, uint16x8_t src1, uint16x8_t src2, uint16x8_t & dst0, uint16x8_t & dst1, uint16x8_t & dst2);
+
+        template<ColorConverter16Ptr convert> SIMD_INLINE void ConvertColor16(const uint8x16x3_t & src, uint8x16x3_t & dst)
         {
-            int16x8_t yLo = AdjustY<0>(y), uLo = AdjustUV<0>(u), vLo = AdjustUV<0>(v);
-            int16x8_t yHi = AdjustY<1>(y), uHi = AdjustUV<1>(u), vHi = AdjustUV<1>(v);
-            rgb.val[0] = PackSaturatedI16(YuvToRed(yLo, vLo), YuvToRed(yHi, vHi));
-            rgb.val[1] = PackSaturatedI16(YuvToGreen(yLo, uLo, vLo), YuvToGreen(yHi, uHi, vHi));
-            rgb.val[2] = PackSaturatedI16(YuvToBlue(yLo, uLo), YuvToBlue(yHi, uHi));
+            uint16x8_t d16[3][2];
+            convert(UnpackU8<0>(src.val[0]), UnpackU8<0>(src.val[1]), UnpackU8<0>(src.val[2]), d16[0][0], d16[1][0], d16[2][0]);
+            convert(UnpackU8<1>(src.val[0]), UnpackU8<1>(src.val[1]), UnpackU8<1>(src.val[2]), d16[0][1], d16[1][1], d16[2][1]);
+            for (size_t c = 0; c < 3; ++c)
+                dst.val[c] = PackU16(d16[c][0], d16[c][1]);
         }
     }
 #endif// SIMD_NEON_ENABLE
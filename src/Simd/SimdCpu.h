@@ -26,6 +26,8 @@
 
 #include "Simd/SimdDefs.h"
 
+#include <vector>
+
 namespace Simd
 {
     namespace Base
@@ -37,6 +39,19 @@ namespace Simd
         size_t CpuThreadNumber();
 
         size_t CpuCacheSize(size_t level);
+
+        /*! Gets ordered list of logical CPUs which are appropriate for given affinity (an empty list if affinity is not supported). */
+        void CpuAffinity(SimdAffinityFlags affinity, std::vector<size_t> & cpus);
+
+        /*! Takes given number of CPUs from the list of candidates for an execution context: at first CPUs which are not taken by other contexts, then the least taken ones. */
+        void CpuAllocate(const std::vector<size_t> & candidates, size_t count, std::vector<size_t> & cpus);
+
+        /*! Returns CPUs taken by CpuAllocate. */
+        void CpuRelease(const std::vector<size_t> & cpus);
+
+        bool GetThreadAffinity(std::vector<size_t> & cpus);
+
+        bool SetThreadAffinity(const std::vector<size_t> & cpus);
     }
 
 #ifdef SIMD_SSE_ENABLE
@@ -64,6 +64,10 @@ namespace Simd
             Gray8,
             /*! One plane 24-bit (3 8-bit channels) RGB (Red, Green, Blue) pixel format. */
             Rgb24,
+            /*! One plane 16-bit (2 8-bit channels) packed YUYV 4:2:2 (Y0 U0 Y1 V0 ...) pixel format. */
+            Yuyv422,
+            /*! One plane 16-bit (2 8-bit channels) packed UYVY 4:2:2 (U0 Y0 V0 Y1 ...) pixel format. */
+            Uyvy422,
         };
 
         const size_t width; /*!< \brief A width of the frame. */
@@ -380,6 +384,8 @@ namespace Simd
         case View<A>::Bgr24: (Format&)format = Bgr24; break;
         case View<A>::Bgra32: (Format&)format = Bgra32; break;
         case View<A>::Rgb24: (Format&)format = Rgb24; break;
+        case View<A>::Yuyv16: (Format&)format = Yuyv422; break;
+        case View<A>::Uyvy16: (Format&)format = Uyvy422; break;
         default:
             assert(0);
         }
@@ -441,6 +447,14 @@ namespace Simd
         case Rgb24:
             planes[0] = View<A>(width, height, stride0, View<A>::Rgb24, data0);
             break;
+        case Yuyv422:
+            assert((width & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Yuyv16, data0);
+            break;
+        case Uyvy422:
+            assert((width & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Uyvy16, data0);
+            break;
         default:
             assert(0);
         }
@@ -531,6 +545,14 @@ namespace Simd
         case Rgb24:
             planes[0].Recreate(width, height, View<A>::Rgb24);
             break;
+        case Yuyv422:
+            assert((width & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Yuyv16);
+            break;
+        case Uyvy422:
+            assert((width & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Uyvy16);
+            break;
         default:
             assert(0);
         }
@@ -564,6 +586,12 @@ namespace Simd
                 bottom = (bottom + 1) & ~1;
             }
 
+            if (format == Yuyv422 || format == Uyvy422)
+            {
+                left = left & ~1;
+                right = (right + 1) & ~1;
+            }
+
             Frame frame;
             *(size_t*)&frame.width = right - left;
             *(size_t*)&frame.height = bottom - top;
@@ -647,6 +675,8 @@ namespace Simd
         case Bgr24:   return 1;
         case Gray8:   return 1;
         case Rgb24:   return 1;
+        case Yuyv422: return 1;
+        case Uyvy422: return 1;
         default: assert(0); return 0;
         }
     }
@@ -703,29 +733,26 @@ namespace Simd
                 DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
                 break;
             case Frame<A>::Bgra32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgra(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgra(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Bgr24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgr(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgr(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Gray8:
                 Copy(src.planes[0], dst.planes[0]);
                 break;
             case Frame<A>::Rgb24:
+                Nv12ToRgb(src.planes[0], src.planes[1], dst.planes[0]);
+                break;
+            case Frame<A>::Yuyv422:
+            case Frame<A>::Uyvy422:
             {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
                 View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], u, v, bgr);
-                BgrToRgb(bgr, dst.planes[0]);
+                Nv12ToBgr(src.planes[0], src.planes[1], bgr);
+                if (dst.format == Frame<A>::Yuyv422)
+                    BgrToYuyv422(bgr, dst.planes[0]);
+                else
+                    BgrToUyvy422(bgr, dst.planes[0]);
                 break;
             }
             default:
@@ -756,6 +783,17 @@ namespace Simd
                 BgrToRgb(bgr, dst.planes[0]);
                 break;
             }
+            case Frame<A>::Yuyv422:
+            case Frame<A>::Uyvy422:
+            {
+                View<A> bgr(src.Size(), View<A>::Bgr24);
+                Yuv420pToBgr(src.planes[0], src.planes[1], src.planes[2], bgr);
+                if (dst.format == Frame<A>::Yuyv422)
+                    BgrToYuyv422(bgr, dst.planes[0]);
+                else
+                    BgrToUyvy422(bgr, dst.planes[0]);
+                break;
+            }
             default:
                 assert(0);
             }
@@ -783,6 +821,12 @@ namespace Simd
             case Frame<A>::Rgb24:
                 BgraToRgb(src.planes[0], dst.planes[0]);
                 break;
+            case Frame<A>::Yuyv422:
+                BgraToYuyv422(src.planes[0], dst.planes[0]);
+                break;
+            case Frame<A>::Uyvy422:
+                BgraToUyvy422(src.planes[0], dst.planes[0]);
+                break;
             default:
                 assert(0);
             }
@@ -810,6 +854,12 @@ namespace Simd
             case Frame<A>::Rgb24:
                 BgrToRgb(src.planes[0], dst.planes[0]);
                 break;
+            case Frame<A>::Yuyv422:
+                BgrToYuyv422(src.planes[0], dst.planes[0]);
+                break;
+            case Frame<A>::Uyvy422:
+                BgrToUyvy422(src.planes[0], dst.planes[0]);
+                break;
             default:
                 assert(0);
             }
@@ -836,6 +886,17 @@ namespace Simd
             case Frame<A>::Rgb24:
                 GrayToBgr(src.planes[0], dst.planes[0]);
                 break;
+            case Frame<A>::Yuyv422:
+            case Frame<A>::Uyvy422:
+            {
+                View<A> bgr(src.Size(), View<A>::Bgr24);
+                GrayToBgr(src.planes[0], bgr);
+                if (dst.format == Frame<A>::Yuyv422)
+                    BgrToYuyv422(bgr, dst.planes[0]);
+                else
+                    BgrToUyvy422(bgr, dst.planes[0]);
+                break;
+            }
             default:
                 assert(0);
             }
@@ -869,9 +930,103 @@ namespace Simd
             case Frame<A>::Rgb24:
                 BgrToRgb(src.planes[0], dst.planes[0]);
                 break;
+            case Frame<A>::Yuyv422:
+            case Frame<A>::Uyvy422:
+            {
+                View<A> bgr(src.Size(), View<A>::Bgr24);
+                BgrToRgb(src.planes[0], bgr);
+                if (dst.format == Frame<A>::Yuyv422)
+                    BgrToYuyv422(bgr, dst.planes[0]);
+                else
+                    BgrToUyvy422(bgr, dst.planes[0]);
+                break;
+            }
+            default:
+                assert(0);
+            }
+            break;
+
+        case Frame<A>::Yuyv422:
+            switch (dst.format)
+            {
+            case Frame<A>::Nv12:
+            {
+                View<A> u(src.width / 2, src.height / 2, View<A>::Gray8), v(src.width / 2, src.height / 2, View<A>::Gray8);
+                Yuyv422ToYuv420p(src.planes[0], dst.planes[0], u, v);
+                InterleaveUv(u, v, dst.planes[1]);
+                break;
+            }
+            case Frame<A>::Yuv420p:
+                Yuyv422ToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
+                break;
+            case Frame<A>::Bgra32:
+                Yuyv422ToBgra(src.planes[0], dst.planes[0]);
+                break;
+            case Frame<A>::Bgr24:
+                Yuyv422ToBgr(src.planes[0], dst.planes[0]);
+                break;
+            case Frame<A>::Gray8:
+                Yuyv422ToGray(src.planes[0], dst.planes[0]);
+                break;
+            case Frame<A>::Rgb24:
+            {
+                View<A> bgr(src.Size(), View<A>::Bgr24);
+                Yuyv422ToBgr(src.planes[0], bgr);
+                BgrToRgb(bgr, dst.planes[0]);
+                break;
+            }
+            case Frame<A>::Uyvy422:
+                for (size_t row = 0; row < src.height; ++row)
+                    SimdReorder16bit(src.planes[0].data + row * src.planes[0].stride, src.width * 2, dst.planes[0].data + row * dst.planes[0].stride);
+                break;
+            default:
+                assert(0);
+            }
+            break;
+
+        case Frame<A>::Uyvy422:
+            switch (dst.format)
+            {
+            case Frame<A>::Nv12:
+            case Frame<A>::Yuv420p:
+            case Frame<A>::Gray8:
+            {
+                View<A> yuyv(src.Size(), View<A>::Yuyv16);
+                for (size_t row = 0; row < src.height; ++row)
+                    SimdReorder16bit(src.planes[0].data + row * src.planes[0].stride, src.width * 2, yuyv.data + row * yuyv.stride);
+                if (dst.format == Frame<A>::Gray8)
+                    Yuyv422ToGray(yuyv, dst.planes[0]);
+                else if (dst.format == Frame<A>::Yuv420p)
+                    Yuyv422ToYuv420p(yuyv, dst.planes[0], dst.planes[1], dst.planes[2]);
+                else
+                {
+                    View<A> u(src.width / 2, src.height / 2, View<A>::Gray8), v(src.width / 2, src.height / 2, View<A>::Gray8);
+                    Yuyv422ToYuv420p(yuyv, dst.planes[0], u, v);
+                    InterleaveUv(u, v, dst.planes[1]);
+                }
+                break;
+            }
+            case Frame<A>::Bgra32:
+                Uyvy422ToBgra(src.planes[0], dst.planes[0]);
+                break;
+            case Frame<A>::Bgr24:
+                Uyvy422ToBgr(src.planes[0], dst.planes[0]);
+                break;
+            case Frame<A>::Rgb24:
+            {
+                View<A> bgr(src.Size(), View<A>::Bgr24);
+                Uyvy422ToBgr(src.planes[0], bgr);
+                BgrToRgb(bgr, dst.planes[0]);
+                break;
+            }
+            case Frame<A>::Yuyv422:
+                for (size_t row = 0; row < src.height; ++row)
+                    SimdReorder16bit(src.planes[0].data + row * src.planes[0].stride, src.width * 2, dst.planes[0].data + row * dst.planes[0].stride);
+                break;
             default:
                 assert(0);
             }
+            break;
 
         default:
             assert(0);
@@ -60,12 +60,18 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdParallel.hpp"
 
+#include "Simd/SimdRemap.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution32f.h"
+#include "Simd/SimdSynetSetInput.h"
+#include "Simd/SimdWarpAffine.h"
+
+#include <map>
 
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse1.h"
@@ -95,6 +101,123 @@ SIMD_API const char * SimdVersion()
 
 using namespace Simd;
 
+namespace Simd
+{
+    const size_t PARALLEL_ROWS_BAND_MIN = 64 * 1024;
+
+    SIMD_INLINE size_t ParallelRowsThreadNumber(size_t height, size_t rowSize, size_t align)
+    {
+        size_t threadNumber = Base::GetThreadNumber();
+        if (threadNumber > 1)
+            threadNumber = Min(threadNumber, Min(height * rowSize / PARALLEL_ROWS_BAND_MIN, height / align));
+        return Max<size_t>(threadNumber, 1);
+    }
+
+    template<class Function> SIMD_INLINE void ParallelRows(size_t height, size_t rowSize, size_t align, const Function & function)
+    {
+        size_t threadNumber = ParallelRowsThreadNumber(height, rowSize, align);
+        if (threadNumber > 1)
+            Parallel(0, height, function, threadNumber, align);
+        else
+            function(0, 0, height);
+    }
+
+    template<class Function> SIMD_INLINE void ParallelRowsSum(size_t height, size_t rowSize, uint64_t * sum, const Function & function)
+    {
+        size_t threadNumber = ParallelRowsThreadNumber(height, rowSize, 1);
+        if (threadNumber > 1)
+        {
+            std::vector<uint64_t> sums(threadNumber, 0);
+            Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                function(begin, end, sums.data() + thread);
+            }, threadNumber);
+            *sum = 0;
+            for (size_t i = 0; i < threadNumber; ++i)
+                *sum += sums[i];
+        }
+        else
+            function(0, height, sum);
+    }
+
+    template<class Function> SIMD_INLINE void ParallelHistogram(size_t height, size_t rowSize, uint32_t * histogram, const Function & function)
+    {
+        size_t threadNumber = ParallelRowsThreadNumber(height, rowSize, 1);
+        if (threadNumber > 1)
+        {
+            std::vector<uint32_t> histograms(threadNumber * HISTOGRAM_SIZE, 0);
+            Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                function(begin, end, histograms.data() + thread * HISTOGRAM_SIZE);
+            }, threadNumber);
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                histogram[i] = 0;
+                for (size_t t = 0; t < threadNumber; ++t)
+                    histogram[i] += histograms[t * HISTOGRAM_SIZE + i];
+            }
+        }
+        else
+            function(0, height, histogram);
+    }
+
+    typedef void(*FilterPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+
+    static void FilterRows(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride,
+        size_t halo, FilterPtr filter, size_t first, size_t last, uint8_t * buffer)
+    {
+        size_t rowSize = width * channelCount;
+        size_t top = first - Min(first, halo), bottom = Min(last + halo, height);
+        filter(src + top * srcStride, srcStride, width, bottom - top, channelCount, buffer, rowSize);
+        for (size_t row = first; row < last; ++row)
+            memcpy(dst + row * dstStride, buffer + (row - top) * rowSize, rowSize);
+    }
+
+    static void ParallelFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride,
+        size_t halo, FilterPtr filter)
+    {
+        size_t rowSize = width * channelCount;
+        ParallelRows(height, rowSize, 2 * halo, [&](size_t, size_t begin, size_t end)
+        {
+            filter(src + begin * srcStride, srcStride, width, end - begin, channelCount, dst + begin * dstStride, dstStride);
+            if (begin == 0 && end == height)
+                return;
+            std::vector<uint8_t> buffer(rowSize * 3 * halo);
+            if (begin > 0)
+                FilterRows(src, srcStride, width, height, channelCount, dst, dstStride, halo, filter, begin, Min(begin + halo, end), buffer.data());
+            if (end < height)
+                FilterRows(src, srcStride, width, height, channelCount, dst, dstStride, halo, filter, Max(end - halo, begin), end, buffer.data());
+        });
+    }
+
+    template<class Convert> static void BayerRows(const uint8_t * bayer, size_t bayerStride, size_t height, size_t rowSize, uint8_t * dst, size_t dstStride,
+        size_t halo, size_t first, size_t last, uint8_t * buffer, const Convert & convert)
+    {
+        size_t top = first - Min(first, halo), bottom = Min(last + halo, height);
+        convert(bayer + top * bayerStride, bottom - top, buffer, rowSize);
+        for (size_t row = first; row < last; ++row)
+            memcpy(dst + row * dstStride, buffer + (row - top) * rowSize, rowSize);
+    }
+
+    template<class Convert> static void ParallelBayer(const uint8_t * bayer, size_t bayerStride, size_t width, size_t height, size_t pixelSize, 
+        uint8_t * dst, size_t dstStride, const Convert & convert)
+    {
+        const size_t halo = 2;
+        size_t rowSize = width * pixelSize;
+        ParallelRows(height, rowSize, 2 * halo, [&](size_t, size_t begin, size_t end)
+        {
+            convert(bayer + begin * bayerStride, end - begin, dst + begin * dstStride, dstStride);
+            if (begin == 0 && end == height)
+                return;
+            std::vector<uint8_t> buffer(rowSize * 3 * halo);
+            if (begin > 0)
+                BayerRows(bayer, bayerStride, height, rowSize, dst, dstStride, halo, begin, Min(begin + halo, end), buffer.data(), convert);
+            if (end < height)
+                BayerRows(bayer, bayerStride, height, rowSize, dst, dstStride, halo, Max(end - halo, begin), end, buffer.data(), convert);
+        });
+    }
+}
+
 SIMD_API size_t SimdCpuInfo(SimdCpuInfoType type)
 {
     switch (type)
@@ -164,6 +287,31 @@ SIMD_API const char * SimdPerformanceStatistic()
 #endif
 }
 
+SIMD_API size_t SimdPerformanceCounters(SimdPerformanceCounter * counters, size_t size)
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && defined(NDEBUG)
+    return Base::PerformanceMeasurerStorage::s_storage.Counters(counters, size);
+#else
+    return 0;
+#endif
+}
+
+SIMD_API const char * SimdPerformanceJson()
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && defined(NDEBUG)
+    return Base::PerformanceMeasurerStorage::s_storage.PerformanceJson();
+#else
+    return "[]";
+#endif
+}
+
+SIMD_API void SimdPerformanceReset()
+{
+#if defined(SIMD_PERFORMANCE_STATISTIC) && defined(NDEBUG)
+    Base::PerformanceMeasurerStorage::s_storage.Reset();
+#endif
+}
+
 SIMD_API void * SimdAllocate(size_t size, size_t align)
 {
     return Allocate(size, align);
@@ -199,6 +347,16 @@ SIMD_API void SimdSetThreadNumber(size_t threadNumber)
     Base::SetThreadNumber(threadNumber);
 }
 
+SIMD_API void * SimdContextCreate(size_t threadNumber, SimdAffinityFlags affinity)
+{
+    return Base::ContextCreate(threadNumber, affinity);
+}
+
+SIMD_API void SimdContextBind(const void * context)
+{
+    Base::ContextBind(context);
+}
+
 SIMD_API SimdBool SimdGetFastMode()
 {
 #ifdef SIMD_SSE_ENABLE
@@ -236,7 +394,7 @@ SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
         return Base::Crc32c(src, size);
 }
 
-SIMD_API void SimdAbsDifference(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, uint8_t *c, size_t cStride,
+static void SingleAbsDifference(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, uint8_t *c, size_t cStride,
     size_t width, size_t height)
 {
 #ifdef SIMD_AVX2_ENABLE
@@ -247,7 +405,16 @@ SIMD_API void SimdAbsDifference(const uint8_t *a, size_t aStride, const uint8_t
     Base::AbsDifference(a, aStride, b, bStride, c, cStride, width, height);
 }
 
-SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride,
+SIMD_API void SimdAbsDifference(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride, uint8_t *c, size_t cStride,
+    size_t width, size_t height)
+{
+    ParallelRows(height, width, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleAbsDifference(a + begin * aStride, aStride, b + begin * bStride, bStride, c + begin * cStride, cStride, width, end - begin);
+    });
+}
+
+static void SingleAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride,
                                    size_t width, size_t height, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -278,7 +445,16 @@ SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8
         Base::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
 }
 
-SIMD_API void SimdAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride,
+                                   size_t width, size_t height, uint64_t * sum)
+{
+    ParallelRowsSum(height, width, sum, [&](size_t begin, size_t end, uint64_t * sum)
+    {
+        SingleAbsDifferenceSum(a + begin * aStride, aStride, b + begin * bStride, bStride, width, end - begin, sum);
+    });
+}
+
+static void SingleAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                                          const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -309,6 +485,15 @@ SIMD_API void SimdAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const
         Base::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
+SIMD_API void SimdAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+                                         const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
+{
+    ParallelRowsSum(height, width, sum, [&](size_t begin, size_t end, uint64_t * sum)
+    {
+        SingleAbsDifferenceSumMasked(a + begin * aStride, aStride, b + begin * bStride, bStride, mask + begin * maskStride, maskStride, index, width, end - begin, sum);
+    });
+}
+
 SIMD_API void SimdAbsDifferenceSums3x3(const uint8_t *current, size_t currentStride, const uint8_t * background, size_t backgroundStride,
                                        size_t width, size_t height, uint64_t * sums)
 {
@@ -763,7 +948,7 @@ SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size
         Base::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
 }
 
-SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+static void SingleBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::A + 2)
@@ -788,7 +973,7 @@ SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height,
         Base::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
 }
 
-SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+static void SingleBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::A + 2)
@@ -813,6 +998,88 @@ SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height
         Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
+static void SingleBayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride, SimdBayerDemosaicType demosaic)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A + 4)
+        Avx512bw::BayerToBgrV2(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride, demosaic);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A + 4)
+        Avx2::BayerToBgrV2(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride, demosaic);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A + 4)
+        Ssse3::BayerToBgrV2(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride, demosaic);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A + 4)
+        Neon::BayerToBgrV2(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride, demosaic);
+    else
+#endif
+        Base::BayerToBgrV2(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride, demosaic);
+}
+
+static void SingleBayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBayerDemosaicType demosaic)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A + 4)
+        Avx512bw::BayerToBgraV2(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha, demosaic);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A + 4)
+        Avx2::BayerToBgraV2(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha, demosaic);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A + 4)
+        Ssse3::BayerToBgraV2(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha, demosaic);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A + 4)
+        Neon::BayerToBgraV2(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha, demosaic);
+    else
+#endif
+        Base::BayerToBgraV2(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha, demosaic);
+}
+
+SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelBayer(bayer, bayerStride, width, height, 3, bgr, bgrStride, [&](const uint8_t * src, size_t rows, uint8_t * dst, size_t dstStride)
+    {
+        SingleBayerToBgr(src, width, rows, bayerStride, bayerFormat, dst, dstStride);
+    });
+}
+
+SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelBayer(bayer, bayerStride, width, height, 4, bgra, bgraStride, [&](const uint8_t * src, size_t rows, uint8_t * dst, size_t dstStride)
+    {
+        SingleBayerToBgra(src, width, rows, bayerStride, bayerFormat, dst, dstStride, alpha);
+    });
+}
+
+SIMD_API void SimdBayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride, SimdBayerDemosaicType demosaic)
+{
+    ParallelBayer(bayer, bayerStride, width, height, 3, bgr, bgrStride, [&](const uint8_t * src, size_t rows, uint8_t * dst, size_t dstStride)
+    {
+        SingleBayerToBgrV2(src, width, rows, bayerStride, bayerFormat, dst, dstStride, demosaic);
+    });
+}
+
+SIMD_API void SimdBayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBayerDemosaicType demosaic)
+{
+    ParallelBayer(bayer, bayerStride, width, height, 4, bgra, bgraStride, [&](const uint8_t * src, size_t rows, uint8_t * dst, size_t dstStride)
+    {
+        SingleBayerToBgraV2(src, width, rows, bayerStride, bayerFormat, dst, dstStride, alpha, demosaic);
+    });
+}
+
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -838,7 +1105,7 @@ SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height,
         Base::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
 }
 
-SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
+static void SingleBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -868,7 +1135,15 @@ SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, s
         Base::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
 }
 
-SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
+SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgraToBgr(bgra + begin * bgraStride, width, end - begin, bgraStride, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void SingleBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -898,6 +1173,14 @@ SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, s
         Base::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
 }
 
+SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgraToGray(bgra + begin * bgraStride, width, end - begin, bgraStride, gray + begin * grayStride, grayStride);
+    });
+}
+
 SIMD_API void SimdBgraToRgb(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* rgb, size_t rgbStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -923,7 +1206,7 @@ SIMD_API void SimdBgraToRgb(const uint8_t* bgra, size_t width, size_t height, si
         Base::BgraToRgb(bgra, width, height, bgraStride, rgb, rgbStride);
 }
 
-SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+static void SingleBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -958,6 +1241,14 @@ SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t heigh
         Base::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(height, width * 4, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgraToYuv420p(bgra + begin * bgraStride, width, end - begin, bgraStride, y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride);
+    });
+}
+
 SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1054,6 +1345,72 @@ SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t
         Base::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
 }
 
+static void SingleBgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToYuyv422(bgra, bgraStride, width, height, yuyv, yuyvStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuyv422(bgra, bgraStride, width, height, yuyv, yuyvStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuyv422(bgra, bgraStride, width, height, yuyv, yuyvStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToYuyv422(bgra, bgraStride, width, height, yuyv, yuyvStride);
+    else
+#endif
+        Base::BgraToYuyv422(bgra, bgraStride, width, height, yuyv, yuyvStride);
+}
+
+SIMD_API void SimdBgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgraToYuyv422(bgra + begin * bgraStride, bgraStride, width, end - begin, yuyv + begin * yuyvStride, yuyvStride);
+    });
+}
+
+static void SingleBgraToUyvy422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToUyvy422(bgra, bgraStride, width, height, uyvy, uyvyStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToUyvy422(bgra, bgraStride, width, height, uyvy, uyvyStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToUyvy422(bgra, bgraStride, width, height, uyvy, uyvyStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToUyvy422(bgra, bgraStride, width, height, uyvy, uyvyStride);
+    else
+#endif
+        Base::BgraToUyvy422(bgra, bgraStride, width, height, uyvy, uyvyStride);
+}
+
+SIMD_API void SimdBgraToUyvy422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgraToUyvy422(bgra + begin * bgraStride, bgraStride, width, end - begin, uyvy + begin * uyvyStride, uyvyStride);
+    });
+}
+
 SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1079,7 +1436,7 @@ SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, s
         Base::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
 }
 
-SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
+static void SingleBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1109,6 +1466,14 @@ SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, siz
         Base::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgrToBgra(bgr + begin * bgrStride, width, end - begin, bgrStride, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
 SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
     const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
@@ -1140,7 +1505,7 @@ SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t
         Base::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
+static void SingleBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1175,17 +1540,65 @@ SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, siz
         Base::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
 }
 
+SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgrToGray(bgr + begin * bgrStride, width, end - begin, bgrStride, gray + begin * grayStride, grayStride);
+    });
+}
+
 SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
 {
-    Base::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+    else
+#endif
+        Base::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
 }
 
 SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
 {
-    Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+    else
+#endif
+        Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
 }
 
-SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+static void SingleBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1210,7 +1623,15 @@ SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, s
         Base::BgrToRgb(bgr, bgrStride, width, height, rgb, rgbStride);
 }
 
-SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgrToRgb(bgr + begin * bgrStride, bgrStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+    });
+}
+
+static void SingleBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -1240,6 +1661,14 @@ SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height,
         Base::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgrToYuv420p(bgr + begin * bgrStride, width, end - begin, bgrStride, y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride);
+    });
+}
+
 SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1300,23 +1729,89 @@ SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height,
         Base::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
-SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                  uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
+static void SingleBgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+        Avx512bw::BgrToYuyv422(bgr, bgrStride, width, height, yuyv, yuyvStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuyv422(bgr, bgrStride, width, height, yuyv, yuyvStride);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuyv422(bgr, bgrStride, width, height, yuyv, yuyvStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToYuyv422(bgr, bgrStride, width, height, yuyv, yuyvStride);
+    else
+#endif
+        Base::BgrToYuyv422(bgr, bgrStride, width, height, yuyv, yuyvStride);
+}
+
+SIMD_API void SimdBgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgrToYuyv422(bgr + begin * bgrStride, bgrStride, width, end - begin, yuyv + begin * yuyvStride, yuyvStride);
+    });
+}
+
+static void SingleBgrToUyvy422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToUyvy422(bgr, bgrStride, width, height, uyvy, uyvyStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToUyvy422(bgr, bgrStride, width, height, uyvy, uyvyStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToUyvy422(bgr, bgrStride, width, height, uyvy, uyvyStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToUyvy422(bgr, bgrStride, width, height, uyvy, uyvyStride);
+    else
+#endif
+        Base::BgrToUyvy422(bgr, bgrStride, width, height, uyvy, uyvyStride);
+}
+
+SIMD_API void SimdBgrToUyvy422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBgrToUyvy422(bgr + begin * bgrStride, bgrStride, width, end - begin, uyvy + begin * uyvyStride, uyvyStride);
+    });
+}
+
+static void SingleBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                  uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+    else
 #endif
 #ifdef SIMD_VMX_ENABLE
     if(Vmx::Enable && width >= Vmx::A)
@@ -1331,6 +1826,15 @@ SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t wid
         Base::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
 }
 
+SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                  uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
+{
+    ParallelRows(height, width, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleBinarization(src + begin * srcStride, srcStride, width, end - begin, value, positive, negative, dst + begin * dstStride, dstStride, compareType);
+    });
+}
+
 SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                            uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
                            uint8_t * dst, size_t dstStride, SimdCompareType compareType)
@@ -1559,7 +2063,7 @@ SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width,
     Base::CopyFrame(src, srcStride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, dst, dstStride);
 }
 
-SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+static void SingleDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
                     uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1590,6 +2094,15 @@ SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t wid
         Base::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+                    uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(height, width * 2, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleDeinterleaveUv(uv + begin * uvStride, uvStride, width, end - begin, u + begin * uStride, uStride, v + begin * vStride, vStride);
+    });
+}
+
 SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
     uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride)
 {
@@ -2284,7 +2797,7 @@ SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t siz
     simdCosineDistance32f(a, b, size, distance);
 }
 
-SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+static void SingleGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                      size_t channelCount, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -2320,6 +2833,12 @@ SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t
         Base::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                     size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelFilter(src, srcStride, width, height, channelCount, dst, dstStride, 1, SingleGaussianBlur3x3);
+}
+
 typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
 SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
@@ -2336,7 +2855,7 @@ SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, c
     simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
-SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
+static void SingleGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -2366,7 +2885,15 @@ SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, s
         Base::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
 }
 
-SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleGrayToBgr(gray + begin * grayStride, width, end - begin, grayStride, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void SingleGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -2396,6 +2923,14 @@ SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height,
         Base::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleGrayToBgra(gray + begin * grayStride, width, end - begin, grayStride, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
 SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -2426,11 +2961,19 @@ SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width,
         Base::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
 }
 
-SIMD_API void SimdHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, uint32_t * histogram)
+static void SingleHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, uint32_t * histogram)
 {
     Base::Histogram(src, width, height, stride, histogram);
 }
 
+SIMD_API void SimdHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, uint32_t * histogram)
+{
+    ParallelHistogram(height, width, histogram, [&](size_t begin, size_t end, uint32_t * histogram)
+    {
+        SingleHistogram(src + begin * stride, width, end - begin, stride, histogram);
+    });
+}
+
 SIMD_API void SimdHistogramMasked(const uint8_t *src, size_t srcStride, size_t width, size_t height, 
                                   const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
 {
@@ -2503,6 +3046,57 @@ SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t wid
         Base::ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
 }
 
+static void SingleLut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, const uint8_t * table, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Lut8u(src, srcStride, width, height, channels, table, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Lut8u(src, srcStride, width, height, channels, table, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Lut8u(src, srcStride, width, height, channels, table, dst, dstStride);
+    else
+#endif
+        Base::Lut8u(src, srcStride, width, height, channels, table, dst, dstStride);
+}
+
+static void SingleLut16uTo8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, size_t bits, uint8_t * dst, size_t dstStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && bits >= 2)
+        Avx512bw::Lut16uTo8u(src, srcStride, width, height, table, bits, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A && bits >= 2)
+        Avx2::Lut16uTo8u(src, srcStride, width, height, table, bits, dst, dstStride);
+    else
+#endif
+        Base::Lut16uTo8u(src, srcStride, width, height, table, bits, dst, dstStride);
+}
+
+SIMD_API void SimdLut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, const uint8_t * table, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(height, width * channels, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleLut8u(src + begin * srcStride, srcStride, width, end - begin, channels, table, dst + begin * dstStride, dstStride);
+    });
+}
+
+SIMD_API void SimdLut16uTo8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, size_t bits, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(height, width * 2, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleLut16uTo8u(src + begin * srcStride, srcStride, width, end - begin, table, bits, dst + begin * dstStride, dstStride);
+    });
+}
+
 SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -2789,6 +3383,56 @@ SIMD_API void SimdHogLiteCreateMask(const float * src, size_t srcStride, size_t
     simdHogLiteCreateMask(src, srcStride, srcWidth, srcHeight, threshold, scale, size, dst, dstStride);
 }
 
+SIMD_API void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+        Base::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+}
+
+SIMD_API void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+        Base::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+}
+
 SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -3160,7 +3804,7 @@ SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t widt
         Base::LbpEstimate(src, srcStride, width, height, dst, dstStride);
 }
 
-SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+static void SingleMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
@@ -3195,7 +3839,12 @@ SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t wi
         Base::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
-SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelFilter(src, srcStride, width, height, channelCount, dst, dstStride, 1, SingleMeanFilter3x3);
+}
+
+static void SingleMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
@@ -3225,7 +3874,12 @@ SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, si
         Base::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
-SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelFilter(src, srcStride, width, height, channelCount, dst, dstStride, 1, SingleMedianFilterRhomb3x3);
+}
+
+static void SingleMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
@@ -3255,7 +3909,12 @@ SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, si
         Base::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
-SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelFilter(src, srcStride, width, height, channelCount, dst, dstStride, 2, SingleMedianFilterRhomb5x5);
+}
+
+static void SingleMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
@@ -3285,7 +3944,12 @@ SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
-SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelFilter(src, srcStride, width, height, channelCount, dst, dstStride, 1, SingleMedianFilterSquare3x3);
+}
+
+static void SingleMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
@@ -3315,6 +3979,11 @@ SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelFilter(src, srcStride, width, height, channelCount, dst, dstStride, 2, SingleMedianFilterSquare5x5);
+}
+
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -3828,7 +4497,7 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
-SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+static void SingleOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -3864,6 +4533,15 @@ SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uin
         Base::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
 }
 
+SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+               size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
+{
+    ParallelRows(height, width * channelCount, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleOperationBinary8u(a + begin * aStride, aStride, b + begin * bStride, bStride, width, end - begin, channelCount, dst + begin * dstStride, dstStride, type);
+    });
+}
+
 SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                                     size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type)
 {
@@ -4095,6 +4773,25 @@ SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcH
         Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
+typedef void* (*SimdRemapInitPtr) (size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border);
+
+SIMD_API void * SimdRemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border)
+{
+    const static SimdRemapInitPtr simdRemapInit = SIMD_FUNC4(RemapInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdRemapInit(srcW, srcH, dstW, dstH, channels, map, mapStride, flags, border);
+}
+
+SIMD_API void SimdRemapRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    const Remap * remap = (const Remap*)context;
+    const WarpParam & p = remap->Param();
+    ParallelRows(p.dstH, p.dstW * p.PixelSize(), 1, [&](size_t, size_t begin, size_t end)
+    {
+        remap->Run(src, srcStride, dst, dstStride, begin, end);
+    });
+}
+
 SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -4236,87 +4933,295 @@ SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t src
         Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
 }
 
-SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+namespace Simd
 {
+    Resizer::InitPtr ResizerInitPtr()
+    {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        return Avx512bw::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        if (Avx512bw::Enable)
+            return Avx512bw::ResizerInit;
+        else
 #endif
 #ifdef SIMD_AVX512F_ENABLE
-    if (Avx512f::Enable)
-        return Avx512f::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        if (Avx512f::Enable)
+            return Avx512f::ResizerInit;
+        else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable)
-        return Avx2::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        if (Avx2::Enable)
+            return Avx2::ResizerInit;
+        else
 #endif
 #ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable)
-        return Avx::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        if (Avx::Enable)
+            return Avx::ResizerInit;
+        else
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable)
-        return Sse41::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        if (Sse41::Enable)
+            return Sse41::ResizerInit;
+        else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable)
-        return Ssse3::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        if (Ssse3::Enable)
+            return Ssse3::ResizerInit;
+        else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable)
-        return Sse2::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        if (Sse2::Enable)
+            return Sse2::ResizerInit;
+        else
 #endif
 #ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable)
-        return Sse::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        if (Sse::Enable)
+            return Sse::ResizerInit;
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        return Neon::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
-    else
+        if (Neon::Enable)
+            return Neon::ResizerInit;
+        else
 #endif
-        return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+            return Base::ResizerInit;
+    }
 }
 
-SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
 {
-    ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
+    Resizer::InitPtr init = ResizerInitPtr();
+    Resizer * resizer = (Resizer*)init(srcX, srcY, dstX, dstY, channels, type, method);
+    if (resizer)
+        resizer->SetInit(init);
+    return resizer;
 }
 
-SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
-#endif
-#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
+    Resizer * origin = (Resizer*)resizer;
+    const ResParam & p = origin->Param();
+    size_t rowSize = Max(p.dstW, p.srcW * p.srcH / Max<size_t>(p.dstH, 1)) * p.channels * p.ChannelSize();
+    size_t threadNumber = ParallelRowsThreadNumber(p.dstH, rowSize, 1);
+    if (threadNumber > 1 && origin->InitBands(threadNumber))
+    {
+        Parallel(0, p.dstH, [&](size_t thread, size_t begin, size_t end)
+        {
+            origin->RunBand(thread, begin, end, src, srcStride, dst, dstStride);
+        }, threadNumber);
+    }
     else
-#endif
-        Base::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
+        origin->Run(src, srcStride, dst, dstStride);
 }
 
-SIMD_API void SimdRgbToGray(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* gray, size_t grayStride)
+SIMD_API void * SimdResizerPyramidInit(size_t srcX, size_t srcY, const size_t * dstX, const size_t * dstY, size_t count,
+    size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+{
+    ResizerPyramid * pyramid = new ResizerPyramid(ResizerInitPtr(), srcX, srcY, dstX, dstY, count, channels, type, method);
+    if (!pyramid->InitThreads(1))
+    {
+        delete pyramid;
+        return NULL;
+    }
+    return pyramid;
+}
+
+SIMD_API void SimdResizerPyramidRun(const void * pyramid, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride)
+{
+    ResizerPyramid * resizer = (ResizerPyramid*)pyramid;
+    if (resizer->Count() == 0)
+        return;
+    const ResParam & p = resizer->Param(0);
+    size_t rowSize = p.srcW * p.channels * p.ChannelSize();
+    size_t threadNumber = ParallelRowsThreadNumber(p.srcH, rowSize, 1);
+    if (threadNumber > 1 && resizer->InitThreads(threadNumber))
+    {
+        Parallel(0, p.srcH, [&](size_t thread, size_t begin, size_t end)
+        {
+            resizer->Run(thread, begin, end, src, srcStride, dst, dstStride);
+        }, threadNumber);
+    }
+    else
+        resizer->Run(0, 0, p.srcH, src, srcStride, dst, dstStride);
+}
+
+namespace Simd
+{
+    struct ResizeRoi
+    {
+        size_t index, left, top, width, height;
+
+        bool operator < (const ResizeRoi & other) const
+        {
+            size_t w = Max<size_t>(width, 2), h = Max<size_t>(height, 2);
+            size_t ow = Max<size_t>(other.width, 2), oh = Max<size_t>(other.height, 2);
+            return w < ow || (w == ow && h < oh);
+        }
+    };
+
+    class ResizeRoiCache
+    {
+    public:
+        ResizeRoiCache(Resizer::InitPtr init, size_t dstW, size_t dstH, size_t channels, SimdResizeMethodType method)
+            : _init(init)
+            , _dstW(dstW)
+            , _dstH(dstH)
+            , _channels(channels)
+            , _method(method)
+        {
+        }
+
+        ~ResizeRoiCache()
+        {
+            for (Resizers::iterator it = _resizers.begin(); it != _resizers.end(); ++it)
+                delete it->second;
+        }
+
+        Resizer * Get(size_t srcW, size_t srcH)
+        {
+            Key key(srcW, srcH);
+            Resizers::iterator it = _resizers.find(key);
+            if (it == _resizers.end())
+            {
+                Resizer * resizer = (Resizer*)_init(srcW, srcH, _dstW, _dstH, _channels, SimdResizeChannelByte, _method);
+                it = _resizers.insert(Resizers::value_type(key, resizer)).first;
+            }
+            return it->second;
+        }
+
+    private:
+        typedef std::pair<size_t, size_t> Key;
+        typedef std::map<Key, Resizer*> Resizers;
+
+        Resizer::InitPtr _init;
+        size_t _dstW, _dstH, _channels;
+        SimdResizeMethodType _method;
+        Resizers _resizers;
+    };
+
+    SIMD_INLINE void ResizeRoiStore(const uint8_t * buf, uint8_t * tmp, size_t width, size_t height, size_t channels, 
+        SimdResizeChannelType type, SimdTensorFormatType format, uint8_t * dst)
+    {
+        size_t size = width * height, stride = width * channels;
+        if (format == SimdTensorFormatNchw && channels > 1)
+        {
+            uint8_t * planes = type == SimdResizeChannelFloat ? tmp : dst;
+            switch (channels)
+            {
+            case 2: SimdDeinterleaveUv(buf, stride, width, height, planes, width, planes + size, width); break;
+            case 3: SimdDeinterleaveBgr(buf, stride, width, height, planes, width, planes + size, width, planes + 2 * size, width); break;
+            case 4: SimdDeinterleaveBgra(buf, stride, width, height, planes, width, planes + size, width, planes + 2 * size, width, planes + 3 * size, width); break;
+            default: assert(0);
+            }
+            buf = planes;
+        }
+        if (type == SimdResizeChannelFloat)
+        {
+            const float lower = 0.0f, upper = 255.0f;
+            SimdUint8ToFloat32(buf, size * channels, &lower, &upper, (float*)dst);
+        }
+    }
+
+    SIMD_INLINE const uint8_t * ResizeRoiPad(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, std::vector<uint8_t> & pad)
+    {
+        size_t padW = Max<size_t>(width, 2), padH = Max<size_t>(height, 2), padStride = padW * channels;
+        pad.resize(padH * padStride);
+        for (size_t y = 0; y < padH; ++y)
+        {
+            const uint8_t * s = src + Min(y, height - 1) * srcStride;
+            uint8_t * d = pad.data() + y * padStride;
+            for (size_t x = 0; x < padW; ++x)
+                memcpy(d + x * channels, s + Min(x, width - 1) * channels, channels);
+        }
+        return pad.data();
+    }
+}
+
+SIMD_API void SimdResizeRois(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, const ptrdiff_t * rois, size_t roiCount,
+    SimdResizeMethodType method, uint8_t * dst, size_t dstWidth, size_t dstHeight, SimdResizeChannelType dstType, SimdTensorFormatType dstFormat)
+{
+    assert(dstType == SimdResizeChannelByte || dstType == SimdResizeChannelFloat);
+    assert(dstFormat == SimdTensorFormatNchw || dstFormat == SimdTensorFormatNhwc);
+
+    std::vector<ResizeRoi> order(roiCount);
+    for (size_t i = 0; i < roiCount; ++i)
+    {
+        const ptrdiff_t * rect = rois + i * 4;
+        ptrdiff_t left = RestrictRange<ptrdiff_t>(rect[0], 0, srcWidth), top = RestrictRange<ptrdiff_t>(rect[1], 0, srcHeight);
+        ptrdiff_t right = RestrictRange<ptrdiff_t>(rect[2], left, srcWidth), bottom = RestrictRange<ptrdiff_t>(rect[3], top, srcHeight);
+        order[i].index = i;
+        order[i].left = left;
+        order[i].top = top;
+        order[i].width = right - left;
+        order[i].height = bottom - top;
+    }
+    std::stable_sort(order.begin(), order.end());
+
+    Resizer::InitPtr init = ResizerInitPtr();
+    size_t dstSize = dstWidth * dstHeight * channels * (dstType == SimdResizeChannelFloat ? 4 : 1);
+    bool direct = dstType == SimdResizeChannelByte && (dstFormat == SimdTensorFormatNhwc || channels == 1);
+    size_t threadNumber = ParallelRowsThreadNumber(roiCount, dstSize, 1);
+    Parallel(0, roiCount, [&](size_t thread, size_t begin, size_t end)
+    {
+        ResizeRoiCache cache(init, dstWidth, dstHeight, channels, method);
+        std::vector<uint8_t> buffer(direct ? 0 : dstWidth * dstHeight * channels * 2), pad;
+        for (size_t i = begin; i < end; ++i)
+        {
+            const ResizeRoi & roi = order[i];
+            uint8_t * out = dst + roi.index * dstSize;
+            if (roi.width == 0 || roi.height == 0)
+            {
+                memset(out, 0, dstSize);
+                continue;
+            }
+            const uint8_t * ptr = src + roi.top * srcStride + roi.left * channels;
+            size_t width = Max<size_t>(roi.width, 2), height = Max<size_t>(roi.height, 2), stride = srcStride;
+            if (width != roi.width || height != roi.height)
+            {
+                ptr = ResizeRoiPad(ptr, srcStride, roi.width, roi.height, channels, pad);
+                stride = width * channels;
+            }
+            Resizer * resizer = cache.Get(width, height);
+            if (resizer == NULL)
+            {
+                memset(out, 0, dstSize);
+                continue;
+            }
+            if (direct)
+                resizer->Run(ptr, stride, out, dstWidth * channels);
+            else
+            {
+                resizer->Run(ptr, stride, buffer.data(), dstWidth * channels);
+                ResizeRoiStore(buffer.data(), buffer.data() + buffer.size() / 2, dstWidth, dstHeight, channels, dstType, dstFormat, out);
+            }
+        }
+    }, threadNumber);
+}
+
+SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
+    else
+#endif
+#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::RgbToBgra(rgb, width, height, rgbStride, bgra, bgraStride, alpha);
+}
+
+static void SingleRgbToGray(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* gray, size_t grayStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -4341,6 +5246,14 @@ SIMD_API void SimdRgbToGray(const uint8_t* rgb, size_t width, size_t height, siz
         Base::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
 }
 
+SIMD_API void SimdRgbToGray(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* gray, size_t grayStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleRgbToGray(rgb + begin * rgbStride, width, end - begin, rgbStride, gray + begin * grayStride, grayStride);
+    });
+}
+
 SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -4789,7 +5702,7 @@ SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t w
         Base::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
 }
 
-SIMD_API void SimdSquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+static void SingleSquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           size_t width, size_t height, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -4825,7 +5738,16 @@ SIMD_API void SimdSquaredDifferenceSum(const uint8_t *a, size_t aStride, const u
         Base::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
 }
 
-SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+SIMD_API void SimdSquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+                          size_t width, size_t height, uint64_t * sum)
+{
+    ParallelRowsSum(height, width, sum, [&](size_t begin, size_t end, uint64_t * sum)
+    {
+        SingleSquaredDifferenceSum(a + begin * aStride, aStride, b + begin * bStride, bStride, width, end - begin, sum);
+    });
+}
+
+static void SingleSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -4861,6 +5783,15 @@ SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, c
         Base::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
+SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+                          const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
+{
+    ParallelRowsSum(height, width, sum, [&](size_t begin, size_t end, uint64_t * sum)
+    {
+        SingleSquaredDifferenceSumMasked(a + begin * aStride, aStride, b + begin * bStride, bStride, mask + begin * maskStride, maskStride, index, width, end - begin, sum);
+    });
+}
+
 SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
 {
     typedef void (* SimdSquaredDifferenceSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
@@ -5086,7 +6017,7 @@ SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t wid
         Base::GetAbsDxColSums(src, stride, width, height, sums);
 }
 
-SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+static void SingleValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -5116,7 +6047,15 @@ SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, siz
         Base::ValueSum(src, stride, width, height, sum);
 }
 
-SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+{
+    ParallelRowsSum(height, width, sum, [&](size_t begin, size_t end, uint64_t * sum)
+    {
+        SingleValueSum(src + begin * stride, stride, width, end - begin, sum);
+    });
+}
+
+static void SingleSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -5146,6 +6085,14 @@ SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, si
         Base::SquareSum(src, stride, width, height, sum);
 }
 
+SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
+{
+    ParallelRowsSum(height, width, sum, [&](size_t begin, size_t end, uint64_t * sum)
+    {
+        SingleSquareSum(src + begin * stride, stride, width, end - begin, sum);
+    });
+}
+
 SIMD_API void SimdValueSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * valueSum, uint64_t * squareSum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -5308,6 +6255,21 @@ SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src,
     c->Forward(src, buf, dst);
 }
 
+SIMD_API size_t SimdSynetConvolution32fExport(const void * context, void * data, size_t size)
+{
+    return ((SynetConvolution32f*)context)->Export(data, size);
+}
+
+SIMD_API SimdBool SimdSynetConvolution32fImport(void * context, const void * data, size_t size, const float * bias, const float * params, SimdBool copy)
+{
+    return ((SynetConvolution32f*)context)->Import(data, size, bias, params, copy == SimdTrue) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void SimdSynetConvolution32fSetAutotune(const char * path)
+{
+    Base::SynetConvolution32fSetAutotune(path);
+}
+
 SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
     typedef void* (*SimdSynetConvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
@@ -5339,6 +6301,16 @@ SIMD_API void SimdSynetConvolution8iForward(void* context, const uint8_t* src, u
     c->Forward(src, buf, dst);
 }
 
+SIMD_API size_t SimdSynetConvolution8iExport(const void* context, void* data, size_t size)
+{
+    return ((SynetConvolution8i*)context)->Export(data, size);
+}
+
+SIMD_API SimdBool SimdSynetConvolution8iImport(void* context, const void* data, size_t size, SimdBool copy)
+{
+    return ((SynetConvolution8i*)context)->Import(data, size, copy == SimdTrue) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm)
 {
     typedef void* (*SimdSynetDeconvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm);
@@ -5369,6 +6341,16 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
     d->Forward(src, buf, dst);
 }
 
+SIMD_API size_t SimdSynetDeconvolution32fExport(const void * context, void * data, size_t size)
+{
+    return ((SynetDeconvolution32f*)context)->Export(data, size);
+}
+
+SIMD_API SimdBool SimdSynetDeconvolution32fImport(void * context, const void * data, size_t size, const float * bias, const float * params, SimdBool copy)
+{
+    return ((SynetDeconvolution32f*)context)->Import(data, size, bias, params, copy == SimdTrue) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst)
 {
     typedef void(*SimdSynetEltwiseLayerForwardPtr) (float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
@@ -5495,6 +6477,16 @@ SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float *
     c->Forward(src, buf, dst);
 }
 
+SIMD_API size_t SimdSynetMergedConvolution32fExport(const void * context, void * data, size_t size)
+{
+    return ((SynetMergedConvolution32f*)context)->Export(data, size);
+}
+
+SIMD_API SimdBool SimdSynetMergedConvolution32fImport(void * context, const void * data, size_t size, const float * const * bias, const float * const * params, SimdBool copy)
+{
+    return ((SynetMergedConvolution32f*)context)->Import(data, size, bias, params, copy == SimdTrue) ? SimdTrue : SimdFalse;
+}
+
 void SimdSynetPoolingForwardAverage(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
     size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format)
 {
@@ -5599,6 +6591,78 @@ SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height
         Base::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
 }
 
+SIMD_API void SimdSynetSetInputP010(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType,
+    const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+{
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::SynetSetInputP010(y, yStride, uv, uvStride, width, height, yuvType, lower, upper, dst, channels, dstFormat);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::SynetSetInputP010(y, yStride, uv, uvStride, width, height, yuvType, lower, upper, dst, channels, dstFormat);
+    else
+#endif
+        Base::SynetSetInputP010(y, yStride, uv, uvStride, width, height, yuvType, lower, upper, dst, channels, dstFormat);
+}
+
+SIMD_API void SimdSynetSetInputYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t srcWidth, size_t srcHeight,
+    SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+{
+    if (!Base::SynetSetInputYuv::Supported(srcWidth, srcHeight, method, channels, dstFormat))
+        return;
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::SynetSetInputYuv420p(y, yStride, u, uStride, v, vStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::SynetSetInputYuv420p(y, yStride, u, uStride, v, vStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::SynetSetInputYuv420p(y, yStride, u, uStride, v, vStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        Neon::SynetSetInputYuv420p(y, yStride, u, uStride, v, vStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+    else
+#endif
+        Base::SynetSetInputYuv420p(y, yStride, u, uStride, v, vStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+}
+
+SIMD_API void SimdSynetSetInputNv12(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+    SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+{
+    if (!Base::SynetSetInputYuv::Supported(srcWidth, srcHeight, method, channels, dstFormat))
+        return;
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::SynetSetInputNv12(y, yStride, uv, uvStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::SynetSetInputNv12(y, yStride, uv, uvStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::SynetSetInputNv12(y, yStride, uv, uvStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        Neon::SynetSetInputNv12(y, yStride, uv, uvStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+    else
+#endif
+        Base::SynetSetInputNv12(y, yStride, uv, uvStride, srcWidth, srcHeight, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, dstFormat);
+}
+
 SIMD_API void SimdSynetShuffleLayerForward(const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type)
 {
     typedef void(*SimdSynetShuffleLayerForwardPtr) (const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type);
@@ -5802,6 +6866,39 @@ SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t w
         Base::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
 }
 
+typedef void* (*SimdWarpAffineInitPtr) (size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+{
+    const static SimdWarpAffineInitPtr simdWarpAffineInit = SIMD_FUNC4(WarpAffineInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdWarpAffineInit(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+}
+
+SIMD_API void SimdWarpAffineRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    const WarpAffine * warp = (const WarpAffine*)context;
+    const WarpAffParam & p = warp->Param();
+    ParallelRows(p.dstH, p.dstW * p.PixelSize(), 1, [&](size_t, size_t begin, size_t end)
+    {
+        warp->Run(src, srcStride, dst, dstStride, begin, end);
+    });
+}
+
+typedef void* (*SimdWarpPerspectiveInitPtr) (size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+SIMD_API void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+{
+    const static SimdWarpPerspectiveInitPtr simdWarpPerspectiveInit = SIMD_FUNC4(WarpPerspectiveInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdWarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+}
+
+SIMD_API void SimdWarpPerspectiveRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    SimdRemapRun(context, src, srcStride, dst, dstStride);
+}
+
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
 typedef void(*SimdWinogradSetInputPtr) (const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
 typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
@@ -5986,7 +7083,7 @@ SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_
         Base::Yuva420pToBgra(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride);
 }
 
-SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+static void SingleYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -6017,7 +7114,51 @@ SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
-SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv420pToBgr(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void SingleYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv420pToBgrV2(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void SingleYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -6048,7 +7189,51 @@ SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
-SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv422pToBgr(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void SingleYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv422pToBgrV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void SingleYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -6079,21 +7264,65 @@ SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
-SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
-                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv444pToBgr(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void SingleYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        Avx512bw::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv444pToBgrV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void SingleYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
         Sse2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
@@ -6110,7 +7339,51 @@ SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(height, width * 4, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv420pToBgra(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void SingleYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 4, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv420pToBgraV2(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void SingleYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -6141,7 +7414,51 @@ SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv422pToBgra(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void SingleYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv422pToBgraV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void SingleYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -6172,16 +7489,100 @@ SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv444pToBgra(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void SingleYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv444pToBgraV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
 SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsl, size_t hslStride)
 {
-    Base::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+        Base::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
 }
 
 SIMD_API void SimdYuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
 {
-    Base::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+        Base::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
 }
 
 SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
@@ -6246,7 +7647,7 @@ SIMD_API void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
 }
 
-SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+static void SingleYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -6272,6 +7673,50 @@ SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
         Base::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
+SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv420pToRgb(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+    });
+}
+
+static void SingleYuv420pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdYuv420pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv420pToRgbV2(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+    });
+}
+
 SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
@@ -6298,6 +7743,32 @@ SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
         Base::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
+SIMD_API void SimdYuv422pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv422pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv422pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Yuv422pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
 SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
@@ -6324,5 +7795,665 @@ SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
         Base::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
+SIMD_API void SimdYuv444pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::Yuv444pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Yuv444pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
+static void SingleNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+}
+
+SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleNv12ToBgr(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void SingleNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleNv12ToBgrV2(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void SingleNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+}
+
+SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(height, width * 4, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleNv12ToBgra(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void SingleNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 4, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleNv12ToBgraV2(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void SingleNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+    else
+#endif
+        Base::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+}
+
+SIMD_API void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleNv12ToRgb(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+    });
+}
+
+static void SingleNv12ToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleNv12ToRgbV2(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+    });
+}
+
+static void SingleNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+}
+
+SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleNv21ToBgr(y + begin * yStride, yStride, vu + begin / 2 * vuStride, vuStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void SingleNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha);
+}
+
+SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(height, width * 4, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleNv21ToBgra(y + begin * yStride, yStride, vu + begin / 2 * vuStride, vuStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void SingleNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToRgb(y, yStride, vu, vuStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToRgb(y, yStride, vu, vuStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv21ToRgb(y, yStride, vu, vuStride, width, height, rgb, rgbStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv21ToRgb(y, yStride, vu, vuStride, width, height, rgb, rgbStride);
+    else
+#endif
+        Base::Nv21ToRgb(y, yStride, vu, vuStride, width, height, rgb, rgbStride);
+}
+
+SIMD_API void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleNv21ToRgb(y + begin * yStride, yStride, vu + begin / 2 * vuStride, vuStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+    });
+}
+
+static void SingleP010ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdP010ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleP010ToBgr(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void SingleP010ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdP010ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 4, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleP010ToBgra(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void SingleYuv420p10ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv420p10ToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv420p10ToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::Yuv420p10ToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv420p10ToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv420p10ToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv420p10ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 3, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv420p10ToBgr(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+    });
+}
+
+static void SingleYuv420p10ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv420p10ToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv420p10ToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::Yuv420p10ToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv420p10ToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv420p10ToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv420p10ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    ParallelRows(height, width * 4, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuv420p10ToBgra(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+    });
+}
+
+static void SingleYuyv422ToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuyv422ToBgr(yuyv, yuyvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuyv422ToBgr(yuyv, yuyvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuyv422ToBgr(yuyv, yuyvStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuyv422ToBgr(yuyv, yuyvStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Yuyv422ToBgr(yuyv, yuyvStride, width, height, bgr, bgrStride);
+}
+
+SIMD_API void SimdYuyv422ToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuyv422ToBgr(yuyv + begin * yuyvStride, yuyvStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void SingleUyvy422ToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride);
+    else
+#endif
+        Base::Uyvy422ToBgr(uyvy, uyvyStride, width, height, bgr, bgrStride);
+}
+
+SIMD_API void SimdUyvy422ToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    ParallelRows(height, width * 3, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleUyvy422ToBgr(uyvy + begin * uyvyStride, uyvyStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+    });
+}
+
+static void SingleYuyv422ToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuyv422ToBgra(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuyv422ToBgra(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuyv422ToBgra(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuyv422ToBgra(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::Yuyv422ToBgra(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha);
+}
+
+SIMD_API void SimdYuyv422ToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuyv422ToBgra(yuyv + begin * yuyvStride, yuyvStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void SingleUyvy422ToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Uyvy422ToBgra(uyvy, uyvyStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Uyvy422ToBgra(uyvy, uyvyStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Uyvy422ToBgra(uyvy, uyvyStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Uyvy422ToBgra(uyvy, uyvyStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::Uyvy422ToBgra(uyvy, uyvyStride, width, height, bgra, bgraStride, alpha);
+}
+
+SIMD_API void SimdUyvy422ToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    ParallelRows(height, width * 4, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleUyvy422ToBgra(uyvy + begin * uyvyStride, uyvyStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+    });
+}
+
+static void SingleYuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuyv422ToGray(yuyv, yuyvStride, width, height, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuyv422ToGray(yuyv, yuyvStride, width, height, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::A)
+        Sse2::Yuyv422ToGray(yuyv, yuyvStride, width, height, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuyv422ToGray(yuyv, yuyvStride, width, height, gray, grayStride);
+    else
+#endif
+        Base::Yuyv422ToGray(yuyv, yuyvStride, width, height, gray, grayStride);
+}
+
+SIMD_API void SimdYuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+{
+    ParallelRows(height, width, 1, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuyv422ToGray(yuyv + begin * yuyvStride, yuyvStride, width, end - begin, gray + begin * grayStride, grayStride);
+    });
+}
+
+static void SingleYuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuyv422ToYuv420p(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuyv422ToYuv420p(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuyv422ToYuv420p(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuyv422ToYuv420p(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::Yuyv422ToYuv420p(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+}
+
+SIMD_API void SimdYuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+    uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+{
+    ParallelRows(height, width * 2, 2, [&](size_t, size_t begin, size_t end)
+    {
+        SingleYuyv422ToYuv420p(yuyv + begin * yuyvStride, yuyvStride, width, end - begin,
+            y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride);
+    });
+}
+
 
 
@@ -182,6 +182,65 @@ typedef enum
     SimdCpuInfoMsa, /*!< Availability of MSA (MIPS). */
 } SimdCpuInfoType;
 
+/*! @ingroup c_types
+    Describes placement of worker threads of execution context created by function ::SimdContextCreate.
+*/
+typedef enum
+{
+    /*! Threads are not pinned to CPUs. */
+    SimdAffinityNone = 0,
+    /*! Every thread is pinned to its own physical CPU core (SMT siblings are skipped). */
+    SimdAffinityCore = 1,
+    /*! All threads are pinned to CPUs of NUMA node of the thread which creates the context. */
+    SimdAffinityNode = 2,
+    /*! Every thread is pinned to its own physical CPU core of NUMA node of the thread which creates the context. */
+    SimdAffinityCoreNode = 3,
+} SimdAffinityFlags;
+
+/*! @ingroup c_types
+    A number of bins of latency histogram in ::SimdPerformanceCounter.
+*/
+#define SIMD_PERFORMANCE_HISTOGRAM_SIZE 24
+
+/*! @ingroup c_types
+    Describes internal performance counter of %Simd Library. It is used in function ::SimdPerformanceCounters.
+*/
+typedef struct SimdPerformanceCounter
+{
+    /*!
+        A name of the counter (function name and optional description). It is valid during whole lifetime of the library.
+    */
+    const char * name;
+    /*!
+        A number of measured calls.
+    */
+    uint64_t count;
+    /*!
+        A total time of all calls (in milliseconds).
+    */
+    double total;
+    /*!
+        A minimal time of one call (in milliseconds).
+    */
+    double min;
+    /*!
+        An average time of one call (in milliseconds).
+    */
+    double average;
+    /*!
+        A maximal time of one call (in milliseconds).
+    */
+    double max;
+    /*!
+        A performance in GFLOPS (zero if number of floating point operations of the call is unknown).
+    */
+    double gflops;
+    /*!
+        A latency histogram. The bin 0 counts calls shorter than 1 microsecond, the bin i counts calls with duration in range [2^(i-1), 2^i) microseconds, the last bin counts all longer calls.
+    */
+    uint64_t histogram[SIMD_PERFORMANCE_HISTOGRAM_SIZE];
+} SimdPerformanceCounter;
+
 /*! @ingroup c_types
     Describes types and flags to get information about classifier cascade with using function ::SimdDetectionInfo.
     \note This type is used for implementation of Simd::Detection.
@@ -275,6 +334,10 @@ typedef enum
     SimdPixelFormatHsl24,
     /*! A 24-bit (3 8-bit channels) RGB (Red, Green, Blue) pixel format. */
     SimdPixelFormatRgb24,
+    /*! A 16-bit (2 8-bit channels) packed YUYV 4:2:2 pixel format (Y0 U0 Y1 V0 ...). */
+    SimdPixelFormatYuyv16,
+    /*! A 16-bit (2 8-bit channels) packed UYVY 4:2:2 pixel format (U0 Y0 V0 Y1 ...). */
+    SimdPixelFormatUyvy16,
 } SimdPixelFormatType;
 
 /*! @ingroup c_types
@@ -297,6 +360,8 @@ typedef enum
     SimdResizeChannelByte,
     /*! 32-bit float channel type.  */
     SimdResizeChannelFloat,
+    /*! 16-bit unsigned integer channel type. It is supported by methods ::SimdResizeMethodBilinear and ::SimdResizeMethodArea (downscale only). */
+    SimdResizeChannelShort,
 } SimdResizeChannelType;
 
 /*! @ingroup resizing
@@ -312,6 +377,10 @@ typedef enum
     SimdResizeMethodArea,
     /*! InferenceEngine::Extension::Cpu::Interp compatible method. */
     SimdResizeMethodInferenceEngineInterp,
+    /*! Bicubic method (cubic convolution with a = -0.5). It applies antialiasing at downscaling. */
+    SimdResizeMethodBicubic,
+    /*! Lanczos method with 3 lobes. It applies antialiasing at downscaling. */
+    SimdResizeMethodLanczos3,
 } SimdResizeMethodType;
 
 /*! @ingroup synet
@@ -411,6 +480,47 @@ typedef enum
     SimdTransformTransposeRotate270, /*!< Image transposed and rotated 270 degrees counterclockwise. It is equal to vertical mirroring of image. The output image has the same size as input image.*/
 } SimdTransformType;
 
+/*! @ingroup transform
+    Describes flags of image warping (see functions ::SimdWarpAffineInit, ::SimdWarpPerspectiveInit and ::SimdRemapInit): type of image channels, interpolation and border mode.
+*/
+typedef enum
+{
+    SimdWarpAffineChannelByte = 0, /*!< 8-bit integer channel type.  */
+    SimdWarpAffineChannelFloat = 1, /*!< 32-bit float channel type.  */
+    SimdWarpAffineChannelMask = 1, /*!< Bit mask of channel type.  */
+    SimdWarpAffineInterpNearest = 0, /*!< Nearest pixel interpolation.  */
+    SimdWarpAffineInterpBilinear = 2, /*!< Bilinear interpolation.  */
+    SimdWarpAffineInterpMask = 2, /*!< Bit mask of interpolation type.  */
+    SimdWarpAffineBorderConstant = 0, /*!< Pixels outside of the input image are equal to the border value.  */
+    SimdWarpAffineBorderReplicate = 4, /*!< Pixels outside of the input image are equal to the nearest edge pixel.  */
+    SimdWarpAffineBorderMask = 4, /*!< Bit mask of border mode.  */
+} SimdWarpAffineFlags;
+
+/*! @ingroup yuv_conversion
+    Describes YUV format type (color matrix and range). It is used in YUV to BGR conversion functions (for example in ::SimdYuv420pToBgrV2).
+*/
+typedef enum
+{
+    SimdYuvUnknown = -1, /*!< Unknown YUV standard. */
+    SimdYuvBt601, /*!< Corresponds to BT.601 standard. Uses limited range (Y in [16..235], U and V in [16..240]). It is the default type of the functions without 'V2' suffix. */
+    SimdYuvBt709, /*!< Corresponds to BT.709 standard (HD video). Uses limited range (Y in [16..235], U and V in [16..240]). */
+    SimdYuvBt2020, /*!< Corresponds to BT.2020 standard (UHD video). Uses limited range (Y in [16..235], U and V in [16..240]). */
+    SimdYuvTrect871, /*!< Corresponds to T-REC-T.871 standard (JPEG, BT.601 matrix). Uses full range (Y, U and V in [0..255]). */
+    SimdYuvBt709Full, /*!< Corresponds to BT.709 standard (HD video). Uses full range (Y, U and V in [0..255]). */
+    SimdYuvBt2020Full, /*!< Corresponds to BT.2020 standard (UHD video). Uses full range (Y, U and V in [0..255]). */
+} SimdYuvType;
+
+/*! @ingroup bayer_conversion
+    Describes demosaicing algorithm of Bayer image. It is used in functions ::SimdBayerToBgrV2 and ::SimdBayerToBgraV2.
+*/
+typedef enum
+{
+    /*! Bilinear interpolation with edge-directed estimation of green channel. It is the algorithm of functions ::SimdBayerToBgr and ::SimdBayerToBgra. */
+    SimdBayerDemosaicBilinear,
+    /*! Gradient-corrected bilinear interpolation (Malvar-He-Cutler) with 5x5 kernels. It reduces zipper artifacts and false colors on edges. */
+    SimdBayerDemosaicMalvar,
+} SimdBayerDemosaicType;
+
 /*! @ingroup synet
     \brief Callback function type "SimdGemm32fNNPtr";
 
@@ -611,6 +721,48 @@ extern "C"
     */
     SIMD_API const char * SimdPerformanceStatistic();
 
+    /*! @ingroup info
+
+        \fn size_t SimdPerformanceCounters(SimdPerformanceCounter * counters, size_t size);
+
+        \short Gets internal performance counters of %Simd Library.
+
+        Measurements of all threads are combined. Only counters which have at least one measurement since the last call of ::SimdPerformanceReset are returned.
+
+        \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro.
+
+        \param [out] counters - a pointer to output array of counters. Can be NULL.
+        \param [in] size - a size of output array. 
+        \return a total number of available counters. If it is greater than size then only first size counters are written.
+    */
+    SIMD_API size_t SimdPerformanceCounters(SimdPerformanceCounter * counters, size_t size);
+
+    /*! @ingroup info
+
+        \fn const char * SimdPerformanceJson();
+
+        \short Gets internal performance counters of %Simd Library in JSON format.
+
+        The output is an array of objects with fields "name", "count", "total", "min", "average", "max", "gflops" and "histogram" (see ::SimdPerformanceCounter).
+
+        \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro. The returned string is valid until the next call of this function.
+
+        \return string with internal performance counters of %Simd Library in JSON format.
+    */
+    SIMD_API const char * SimdPerformanceJson();
+
+    /*! @ingroup info
+
+        \fn void SimdPerformanceReset();
+
+        \short Resets internal performance counters of %Simd Library.
+
+        It can be used for periodical collection of statistics. Registered counters (and their names) are kept.
+
+        \note %Simd Library have to be build with defined SIMD_PERFORMANCE_STATISTIC macro.
+    */
+    SIMD_API void SimdPerformanceReset();
+
     /*! @ingroup memory
 
         \fn void * SimdAllocate(size_t size, size_t align);
@@ -679,6 +831,8 @@ extern "C"
 
         \short Gets number of threads used by Simd Library to parallelize some algorithms.
 
+        \note If an execution context is bound to calling thread (see ::SimdContextBind) the function returns its thread number.
+
         \return current thread number.
     */
     SIMD_API size_t SimdGetThreadNumber();
@@ -689,10 +843,55 @@ extern "C"
 
         \short Sets number of threads used by Simd Library to parallelize some algorithms.
 
+        \note The library keeps a persistent pool of worker threads (they are created on demand), so parallel algorithms don't create new threads on every call.
+
         \param [in] threadNumber - a number of threads.
     */
     SIMD_API void SimdSetThreadNumber(size_t threadNumber);
 
+    /*! @ingroup thread
+
+        \fn void * SimdContextCreate(size_t threadNumber, SimdAffinityFlags affinity);
+
+        \short Creates execution context with its own number of threads and its own pool of worker threads.
+
+        The execution context allows independent streams of processing to use different numbers of threads without races on global settings
+        (see ::SimdSetThreadNumber). The context has to be bound to a thread with using of function ::SimdContextBind.
+
+        The thread number of the context is not restricted by the number of logical CPUs, so a context can be used to check multithreaded algorithms on any machine.
+        If affinity is not ::SimdAffinityNone then every worker thread is pinned to its own logical CPU, and the thread number is restricted by number of such CPUs.
+        The CPUs are taken from a process-wide list: contexts get CPUs which are not used by other contexts while there are such CPUs, and a released context returns its CPUs.
+        The thread which binds the context is restricted to all CPUs appropriate for the affinity (for example to CPUs of NUMA node) until it unbinds the context (then its previous affinity is restored).
+        So with ::SimdAffinityNode all work and (due to first-touch policy of OS) memory buffers allocated and filled during initialization and run stay on one NUMA node.
+
+        \note Affinity is supported on Linux and Windows. On other platforms it is ignored.
+
+        \param [in] threadNumber - a number of threads used by the context.
+        \param [in] affinity - a placement of threads of the context (see ::SimdAffinityFlags).
+        \return a pointer to execution context. On error it returns NULL.
+            This pointer is used in function ::SimdContextBind.
+            It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdContextCreate(size_t threadNumber, SimdAffinityFlags affinity);
+
+    /*! @ingroup thread
+
+        \fn void SimdContextBind(const void * context);
+
+        \short Binds execution context to calling thread.
+
+        After binding all algorithms called from this thread use thread number and worker pool of the context instead of global ones.
+        Algorithms which fix thread number at initialization (for example ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit)
+        take it from the context bound at the moment of their initialization, so the context must be bound both to initialization and to the run.
+        A context must not be bound to several threads which work at the same time.
+
+        \note Release of the bound context (see ::SimdRelease) unbinds it from all threads, so they return to global settings.
+            If the context is released from another thread, previous affinity of the bound thread is restored at its next call of ::SimdContextBind.
+
+        \param [in] context - a pointer to execution context created by function ::SimdContextCreate. NULL restores usage of global settings.
+    */
+    SIMD_API void SimdContextBind(const void * context);
+
     /*! @ingroup cpu_flags
 
         \fn SimdBool SimdGetFastMode();
@@ -737,6 +936,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::AbsDifference(const View<A> & a, const View<A> & b, View<A> & c).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] a - a pointer to pixels data of first image.
         \param [in] aStride - a row size of first image.
         \param [in] b - a pointer to pixels data of second image.
@@ -758,6 +959,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::AbsDifferenceSum(const View<A> & a, const View<A> & b, uint64_t & sum).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] a - a pointer to pixels data of first image.
         \param [in] aStride - a row size of first image.
         \param [in] b - a pointer to pixels data of second image.
@@ -779,6 +982,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::AbsDifferenceSum(const View<A>& a, const View<A>& b, const View<A>& mask, uint8_t index, uint64_t & sum).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] a - a pointer to pixels data of first image.
         \param [in] aStride - a row size of first image.
         \param [in] b - a pointer to pixels data of second image.
@@ -1295,6 +1500,49 @@ extern "C"
     */
     SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup bayer_conversion
+
+        \fn void SimdBayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride, SimdBayerDemosaicType demosaic);
+
+        \short Converts 8-bit Bayer image to 24-bit BGR with using of given demosaicing algorithm.
+
+        All images must have the same width and height. The width and the height must be even.
+
+        \note This function has a C++ wrapper Simd::BayerToBgrV2(const View<A>& bayer, View<A>& bgr, SimdBayerDemosaicType demosaic).
+
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] demosaic - a demosaicing algorithm (see ::SimdBayerDemosaicType).
+    */
+    SIMD_API void SimdBayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride, SimdBayerDemosaicType demosaic);
+
+    /*! @ingroup bayer_conversion
+
+        \fn void SimdBayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBayerDemosaicType demosaic);
+
+        \short Converts 8-bit Bayer image to 32-bit BGRA with using of given demosaicing algorithm.
+
+        All images must have the same width and height. The width and the height must be even.
+
+        \note This function has a C++ wrapper Simd::BayerToBgraV2(const View<A>& bayer, View<A>& bgra, SimdBayerDemosaicType demosaic, uint8_t alpha).
+
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] demosaic - a demosaicing algorithm (see ::SimdBayerDemosaicType).
+    */
+    SIMD_API void SimdBayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBayerDemosaicType demosaic);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
@@ -1325,6 +1573,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgraToBgr(const View<A>& bgra, View<A>& bgr).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1344,6 +1594,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgraToGray(const View<A>& bgra, View<A>& gray).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1383,6 +1635,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1470,6 +1724,52 @@ extern "C"
     SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
         uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride);
+
+        \short Converts 32-bit BGRA image to packed YUYV 4:2:2 image.
+
+        The input BGRA and output YUYV images must have the same width and height. The width must be even.
+        Each pair of horizontally adjacent pixels of the output image is packed into 4 bytes (Y0 U0 Y1 V0 Y2 U1 Y3 V1 ...).
+        U and V components are averaged over the pair of pixels.
+
+        \note This function has a C++ wrapper Simd::BgraToYuyv422(const View<A>& bgra, View<A>& yuyv).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] yuyv - a pointer to pixels data of output 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [in] yuyvStride - a row size of the yuyv image.
+    */
+    SIMD_API void SimdBgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride);
+
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToUyvy422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride);
+
+        \short Converts 32-bit BGRA image to packed UYVY 4:2:2 image.
+
+        The input BGRA and output UYVY images must have the same width and height. The width must be even.
+        Each pair of horizontally adjacent pixels of the output image is packed into 4 bytes (U0 Y0 V0 Y1 U1 Y2 V1 Y3 ...).
+        U and V components are averaged over the pair of pixels.
+
+        \note This function has a C++ wrapper Simd::BgraToUyvy422(const View<A>& bgra, View<A>& uyvy).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] uyvy - a pointer to pixels data of output 16-bit image with packed UYVY 4:2:2 pixels.
+        \param [in] uyvyStride - a row size of the uyvy image.
+    */
+    SIMD_API void SimdBgraToUyvy422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
@@ -1500,6 +1800,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgrToBgra(const View<A>& bgr, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1545,6 +1847,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgrToGray(const View<A>& bgr, View<A>& gray).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1602,6 +1906,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgrToRgb(const View<A> & bgr, View<A> & rgb).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] bgrStride - a row size of the bgr image.
         \param [in] width - an image width.
@@ -1622,6 +1928,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1682,6 +1990,52 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride);
+
+        \short Converts 24-bit BGR image to packed YUYV 4:2:2 image.
+
+        The input BGR and output YUYV images must have the same width and height. The width must be even.
+        Each pair of horizontally adjacent pixels of the output image is packed into 4 bytes (Y0 U0 Y1 V0 Y2 U1 Y3 V1 ...).
+        U and V components are averaged over the pair of pixels.
+
+        \note This function has a C++ wrapper Simd::BgrToYuyv422(const View<A>& bgr, View<A>& yuyv).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] yuyv - a pointer to pixels data of output 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [in] yuyvStride - a row size of the yuyv image.
+    */
+    SIMD_API void SimdBgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride);
+
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToUyvy422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride);
+
+        \short Converts 24-bit BGR image to packed UYVY 4:2:2 image.
+
+        The input BGR and output UYVY images must have the same width and height. The width must be even.
+        Each pair of horizontally adjacent pixels of the output image is packed into 4 bytes (U0 Y0 V0 Y1 U1 Y2 V1 Y3 ...).
+        U and V components are averaged over the pair of pixels.
+
+        \note This function has a C++ wrapper Simd::BgrToUyvy422(const View<A>& bgr, View<A>& uyvy).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] uyvy - a pointer to pixels data of output 16-bit image with packed UYVY 4:2:2 pixels.
+        \param [in] uyvyStride - a row size of the uyvy image.
+    */
+    SIMD_API void SimdBgrToUyvy422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride);
+
     /*! @ingroup binarization
 
         \fn void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
@@ -1698,6 +2052,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::Binarization(const View<A>& src, uint8_t value, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of input 8-bit gray image (first value for compare operation).
         \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
@@ -1990,6 +2346,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::DeinterleaveUv(const View<A>& uv, View<A>& u, View<A>& v).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] uv - a pointer to pixels data of input 16-bit UV interleaved image.
         \param [in] uvStride - a row size of the uv image.
         \param [in] width - an image width.
@@ -2760,6 +3118,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::GaussianBlur3x3(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of source image.
         \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
@@ -2833,6 +3193,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::GrayToBgr(const View<A>& gray, View<A>& bgr).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] gray - a pointer to pixels data of input 8-bit gray image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -2852,6 +3214,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::GrayToBgra(const View<A>& gray, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] gray - a pointer to pixels data of input 8-bit gray image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -2902,6 +3266,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::Histogram(const View<A>& src, uint32_t * histogram).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of input 8-bit gray image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -3000,6 +3366,61 @@ extern "C"
     */
     SIMD_API void SimdChangeColors(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * colors, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup histogram
+
+        \fn void SimdLut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, const uint8_t * table, uint8_t * dst, size_t dstStride);
+
+        \short Transforms 8-bit image with 1, 3 or 4 channels with using of lookup tables (separate table for every channel).
+
+        The input and output images must have the same size and the same number of channels. 
+        Algorithm description:
+        \verbatim
+        for(y = 0; y < height; ++y)
+            for(x = 0; x < width; ++x)
+                for(c = 0; c < channels; ++c)
+                    dst[x, y, c] = table[c*256 + src[x, y, c]];
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::Lut8u(const View<A> & src, const uint8_t * table, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a number of channels in the image. It can be 1, 3 or 4.
+        \param [in] table - a pointer to the lookup tables (array of channels*256 unsigned 8-bit values, 256 values for every channel).
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdLut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, const uint8_t * table, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup histogram
+
+        \fn void SimdLut16uTo8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, size_t bits, uint8_t * dst, size_t dstStride);
+
+        \short Transforms 16-bit gray image (for example raw sensor data) to 8-bit gray image with using of lookup table.
+
+        The input and output images must have the same size. Input values greater than 2^bits - 1 are saturated.
+        Algorithm description:
+        \verbatim
+        for(y = 0; y < height; ++y)
+            for(x = 0; x < width; ++x)
+                dst[x, y] = table[Min(src[x, y], (1 << bits) - 1)];
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::Lut16uTo8u(const View<A> & src, const uint8_t * table, size_t bits, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of input 16-bit image.
+        \param [in] srcStride - a row size of the input image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] table - a pointer to the lookup table (array of 2^bits unsigned 8-bit values).
+        \param [in] bits - a bit depth of input values. It must be in range [1, 16].
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdLut16uTo8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, size_t bits, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup histogram
 
         \fn void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
@@ -3304,25 +3725,63 @@ extern "C"
 
     /*! @ingroup other_conversion
 
-        \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
-
-        \short Converts 16-bit signed integer image to 8-bit gray image with saturation
+        \fn void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
 
-        All images must have the same width and height.
+        \short Converts 24-bit HSL(Hue, Saturation, Lightness) image to 24-bit BGR image.
 
-        For every point:
-        \verbatim
-        dst[i] = Max(0, Min(255, src[i]));
-        \endverbatim
+        It is an inverse of ::SimdBgrToHsl. All images must have the same width and height.
 
-        \note This function has a C++ wrapper Simd::Int16ToGray(const View<A> & src, View<A> & dst).
+        \note This function has a C++ wrapper Simd::HslToBgr(const View<A>& hsl, View<A>& bgr).
 
-        \param [in] src - a pointer to pixels data of input 16-bit signed integer image.
+        \param [in] hsl - a pointer to pixels data of input 24-bit HSL image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [in] srcStride - a row size of the 16-bit signed integer image.
-        \param [out] dst - a pointer to pixels data of input 8-bit gray image.
-        \param [out] dstStride - a row size of the gray image.
+        \param [in] hslStride - a row size of the hsl image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts 24-bit HSV(Hue, Saturation, Value) image to 24-bit BGR image.
+
+        It is an inverse of ::SimdBgrToHsv. All images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::HsvToBgr(const View<A>& hsv, View<A>& bgr).
+
+        \param [in] hsv - a pointer to pixels data of input 24-bit HSV image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] hsvStride - a row size of the hsv image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Converts 16-bit signed integer image to 8-bit gray image with saturation
+
+        All images must have the same width and height.
+
+        For every point:
+        \verbatim
+        dst[i] = Max(0, Min(255, src[i]));
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::Int16ToGray(const View<A> & src, View<A> & dst).
+
+        \param [in] src - a pointer to pixels data of input 16-bit signed integer image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] srcStride - a row size of the 16-bit signed integer image.
+        \param [out] dst - a pointer to pixels data of input 8-bit gray image.
+        \param [out] dstStride - a row size of the gray image.
     */
     SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
 
@@ -3653,6 +4112,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::MeanFilter3x3(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of source image.
         \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
@@ -3674,6 +4135,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::MedianFilterRhomb3x3(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of original input image.
         \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
@@ -3695,6 +4158,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::MedianFilterRhomb5x5(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of original input image.
         \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
@@ -3716,6 +4181,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::MedianFilterSquare3x3(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of original input image.
         \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
@@ -3737,6 +4204,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::MedianFilterSquare5x5(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of original input image.
         \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
@@ -4402,6 +4871,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] a - a pointer to pixels data of the first input image.
         \param [in] aStride - a row size of the first image.
         \param [in] b - a pointer to pixels data of the second input image.
@@ -4611,6 +5082,50 @@ extern "C"
     SIMD_API void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
         uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
 
+    /*! @ingroup transform
+
+        \fn void * SimdRemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates context of generic image remapping.
+
+        The context samples the input image at point (map[2*x + 0], map[2*x + 1]) of row y of the map for every output pixel (x, y).
+        The map is converted once to fixed point coordinates (with precision 1/128 of pixel) together with per-row ranges of output pixels
+        which are mapped inside of the input image, so every following call of ::SimdRemapRun is a single gather and interpolation pass
+        (for example in lens distortion correction of video frames).
+
+        \note This function has a C++ wrapper: Simd::Remap(const View<A> & src, const float * map, size_t mapStride, View<A> & dst, SimdWarpAffineFlags flags, const uint8_t * border).
+
+        \param [in] srcW - a width of the input image.
+        \param [in] srcH - a height of the input image.
+        \param [in] dstW - a width of the output image.
+        \param [in] dstH - a height of the output image.
+        \param [in] channels - a channel number of input and output image. It can be 1, 2, 3 or 4.
+        \param [in] map - a pointer to the map of input coordinates. Its size is dstW*dstH*2 (interleaved x and y coordinates).
+        \param [in] mapStride - a row size (in bytes) of the map.
+        \param [in] flags - a flags of channel type, interpolation and border mode (see ::SimdWarpAffineFlags).
+        \param [in] border - a pointer to pixel value used for ::SimdWarpAffineBorderConstant mode (it has channels elements of channel type). It can be NULL (zero value).
+        \return a pointer to remap context. On error (wrong parameters) it returns NULL.
+                This pointer is used in function ::SimdRemapRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdRemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border);
+
+    /*! @ingroup transform
+
+        \fn void SimdRemapRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs remapping of image.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] context - a remap context. It must be created by function ::SimdRemapInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdRemapRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup reordering
 
         \fn void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
@@ -4689,6 +5204,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::ResizeBilinear(const View<A>& src, View<A>& dst).
 
+        \note This function is not multithreaded. Use functions ::SimdResizerInit and ::SimdResizerRun with ::SimdResizeMethodBilinear to resize big images in several threads.
+
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcWidth - a width of the input image.
         \param [in] srcHeight - a height of the input image.
@@ -4727,6 +5244,10 @@ extern "C"
 
         \short Performs image resizing.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            Output rows are split into bands, each band is processed by its own copy of the resize context (with its own row buffers),
+            so the result does not depend on the thread number.
+
         \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
@@ -4735,6 +5256,84 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn void SimdResizeRois(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, const ptrdiff_t * rois, size_t roiCount, SimdResizeMethodType method, uint8_t * dst, size_t dstWidth, size_t dstHeight, SimdResizeChannelType dstType, SimdTensorFormatType dstFormat);
+
+        \short Crops several regions of interest from 8-bit image and resizes them into a packed batch of output images.
+
+        Every rectangle is clipped by image borders and resized to size (dstWidth, dstHeight). Output image of i-th rectangle 
+        begins at offset i*dstHeight*dstWidth*channels (in elements of output type). Empty rectangles produce zeroed output.
+        Rectangles of 1 pixel width or height are resized as if their border pixels were replicated to 2 pixels.
+        If the method is not supported for 8-bit images, the output is zeroed. Rectangles of the same size share coefficient tables of resizing.
+
+        \note This function has a C++ wrapper Simd::ResizeRois(const View<A> & src, const std::vector<Rectangle<ptrdiff_t>> & rois, uint8_t * dst, size_t dstWidth, size_t dstHeight, SimdResizeChannelType dstType, SimdTensorFormatType dstFormat, SimdResizeMethodType method).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber). Rectangles are distributed between threads.
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] channels - a channel number of the input image. It can be 1, 2, 3 or 4.
+        \param [in] rois - a pointer to the array of rectangles. Every rectangle is given by 4 values: left, top, right and bottom.
+        \param [in] roiCount - a number of rectangles.
+        \param [in] method - a method used in order to resize image. There are supported following methods: ::SimdResizeMethodBilinear, 
+            ::SimdResizeMethodArea, ::SimdResizeMethodBicubic, ::SimdResizeMethodLanczos3.
+        \param [out] dst - a pointer to the output batch. Its size must be at least roiCount*dstHeight*dstWidth*channels elements of output type.
+        \param [in] dstWidth - a width of output images.
+        \param [in] dstHeight - a height of output images.
+        \param [in] dstType - a type of output channel. ::SimdResizeChannelFloat output contains values in range [0, 255].
+        \param [in] dstFormat - a format of output images. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+    */
+    SIMD_API void SimdResizeRois(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, const ptrdiff_t * rois, size_t roiCount,
+        SimdResizeMethodType method, uint8_t * dst, size_t dstWidth, size_t dstHeight, SimdResizeChannelType dstType, SimdTensorFormatType dstFormat);
+
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerPyramidInit(size_t srcX, size_t srcY, const size_t * dstX, const size_t * dstY, size_t count, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        \short Creates resize context for building of several scaled copies (levels) of one image at a single pass.
+
+        Levels can have arbitrary sizes (for example scale factor 1.1 or 1.2 between neighboring levels). 
+        All levels are produced directly from the input image, not from the previous level.
+
+        \param [in] srcX - a width of the input image.
+        \param [in] srcY - a height of the input image.
+        \param [in] dstX - a pointer to the array with widths of output levels.
+        \param [in] dstY - a pointer to the array with heights of output levels.
+        \param [in] count - a number of output levels.
+        \param [in] channels - a channel number of input and output images.
+        \param [in] type - a type of input and output image channel.
+        \param [in] method - a method used in order to resize image.
+        \return a pointer to resize context. On error it returns NULL.
+                This pointer is used in function ::SimdResizerPyramidRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerPyramidInit(size_t srcX, size_t srcY, const size_t * dstX, const size_t * dstY, size_t count, 
+        size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerPyramidRun(const void * pyramid, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride);
+
+        \short Builds all levels of resize pyramid from the input image.
+
+        The input image is processed by horizontal tiles which fit in L2 cache. Every tile is used to produce rows of all levels 
+        before the next one is loaded, so the input image is read from memory only once. 
+        The result is equal to separate resizing of the input image to every level with using of ::SimdResizerRun.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The input image is split into bands, every thread builds rows of all levels which correspond to its band.
+
+        \param [in] pyramid - a resize pyramid context. It must be created by function ::SimdResizerPyramidInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to the array of pointers to pixels data of output levels.
+        \param [in] dstStride - a pointer to the array of row sizes (in bytes) of output levels.
+    */
+    SIMD_API void SimdResizerPyramidRun(const void * pyramid, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride);
+
     /*! @ingroup rgb_conversion
 
         \fn void SimdRgbToBgra(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -4765,6 +5364,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::RgbToGray(const View<A>& rgb, View<A>& gray).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] rgb - a pointer to pixels data of input 24-bit RGB image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -5143,6 +5744,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::SquaredDifferenceSum(const View<A>& a, const View<A>& b, uint64_t & sum).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] a - a pointer to pixels data of the first image.
         \param [in] aStride - a row size of the first image.
         \param [in] b - a pointer to pixels data of the second image.
@@ -5170,6 +5773,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::SquaredDifferenceSum(const View<A>& a, const View<A>& b, const View<A>& mask, uint8_t index, uint64_t & sum).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] a - a pointer to pixels data of the first image.
         \param [in] aStride - a row size of the first image.
         \param [in] b - a pointer to pixels data of the second image.
@@ -5437,6 +6042,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::ValueSum(const View<A>& src, uint64_t & sum).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of the image.
         \param [in] stride - a row size of the image.
         \param [in] width - an image width.
@@ -5453,6 +6060,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::SquareSum(const View<A>& src, uint64_t & sum).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of the image.
         \param [in] stride - a row size of the image.
         \param [in] width - an image width.
@@ -5599,6 +6208,8 @@ extern "C"
 
         \short Initilizes FP32 convolution algorithm.
 
+        \note Number of threads used by ::SimdSynetConvolution32fForward is fixed at the moment of initialization (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] batch - a batch size.
         \param [in] conv - a pointer to convolution parameters.
         \param [in] gemm - a pointer to external function of matrix multiplication. Can be NULL.
@@ -5649,6 +6260,8 @@ extern "C"
 
         \short Performs forward propagation of FP32 convolution algorithm.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
         \param [in] src - a pointer to input tensor.
         \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
@@ -5656,12 +6269,71 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution
+
+        \fn size_t SimdSynetConvolution32fExport(const void * context, void * data, size_t size);
+
+        \short Exports internal (reordered) weights of FP32 convolution algorithm to a binary blob.
+
+        The blob is tagged by description of the algorithm (including used SIMD extension), convolution parameters and CPU signature.
+        It can be loaded back into an equal context (even in other process) with using of function ::SimdSynetConvolution32fImport
+        instead of a call of ::SimdSynetConvolution32fSetParams, so repacking of weights is skipped.
+
+        \param [in] context - a pointer to FP32 convolution context. Function ::SimdSynetConvolution32fSetParams must be called before.
+        \param [out] data - a pointer to output buffer. Can be NULL.
+        \param [in] size - a size of output buffer (in bytes).
+        \return size of the blob (in bytes). The blob is written only if data is not NULL and size is enough.
+            It returns 0 if the algorithm does not keep weights internally (see parameter internal of function ::SimdSynetConvolution32fSetParams)
+            or if sizes of internal buffers do not match to the parameters of the context.
+    */
+    SIMD_API size_t SimdSynetConvolution32fExport(const void * context, void * data, size_t size);
+
+    /*! @ingroup synet_convolution
+
+        \fn SimdBool SimdSynetConvolution32fImport(void * context, const void * data, size_t size, const float * bias, const float * params, SimdBool copy);
+
+        \short Imports internal weights of FP32 convolution algorithm from a blob created by function ::SimdSynetConvolution32fExport.
+
+        This function replaces a call of ::SimdSynetConvolution32fSetParams.
+
+        \note If copy is ::SimdFalse the context uses the blob memory directly (for example memory mapped file) and the blob must be alive while the context is used.
+            In this case the blob must be aligned by ::SimdAlignment (otherwise it is copied).
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit with the same parameters.
+        \param [in] data - a pointer to the blob.
+        \param [in] size - a size of the blob (in bytes).
+        \param [in] bias - a pointer to bias. Can be NULL.
+        \param [in] params - a pointer to parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+        \param [in] copy - a flag to copy data of the blob into internal buffers of the context.
+        \return ::SimdTrue on success. It returns ::SimdFalse if the blob is incompatible with the context (other algorithm, SIMD extension, parameters or CPU)
+            or if sizes of buffers declared in the blob do not match to the parameters of the context.
+    */
+    SIMD_API SimdBool SimdSynetConvolution32fImport(void * context, const void * data, size_t size, const float * bias, const float * params, SimdBool copy);
+
+    /*! @ingroup synet_convolution
+
+        \fn void SimdSynetConvolution32fSetAutotune(const char * path);
+
+        \short Enables (or disables) autotuning mode of FP32 convolution algorithm selection.
+
+        In autotuning mode function ::SimdSynetConvolution32fInit measures all implementations which are eligible for given convolution parameters
+        on the current CPU and selects the fastest one. The choice is saved in the cache file (keyed by convolution parameters, thread number and CPU signature),
+        so later initializations (also in other processes) reuse it without measurement.
+
+        \note Measurement uses synthetic data and takes noticeable time (up to a fraction of a second per implementation) at the first initialization of every new convolution.
+
+        \param [in] path - a path to the cache file. It is created if it does not exist. NULL or empty string disables autotuning.
+    */
+    SIMD_API void SimdSynetConvolution32fSetAutotune(const char * path);
+
     /*! @ingroup synet_convolution
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
 
         \short Initilizes INT8 convolution algorithm.
 
+        \note Number of threads used by ::SimdSynetConvolution8iForward is fixed at the moment of initialization (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] batch - a batch size.
         \param [in] conv - a pointer to convolution parameters.
         \param [in] compatibility - a flags of bitwise compatibility.
@@ -5712,6 +6384,8 @@ extern "C"
 
         \short Performs forward propagation of INT8 convolution algorithm.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease.
         \param [in] src - a pointer to input tensor.
         \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution8iExternalBufferSize. Can be NULL (it causes usage of internal buffer).
@@ -5719,6 +6393,38 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
 
+    /*! @ingroup synet_convolution
+
+        \fn size_t SimdSynetConvolution8iExport(const void * context, void * data, size_t size);
+
+        \short Exports internal (quantized and reordered) weights and quantization parameters of INT8 convolution algorithm to a binary blob.
+
+        The blob can be loaded back into an equal context with using of function ::SimdSynetConvolution8iImport instead of a call of ::SimdSynetConvolution8iSetParams.
+
+        \param [in] context - a pointer to INT8 convolution context. Function ::SimdSynetConvolution8iSetParams must be called before.
+        \param [out] data - a pointer to output buffer. Can be NULL.
+        \param [in] size - a size of output buffer (in bytes).
+        \return size of the blob (in bytes). The blob is written only if data is not NULL and size is enough.
+            It returns 0 if sizes of internal buffers do not match to the parameters of the context.
+    */
+    SIMD_API size_t SimdSynetConvolution8iExport(const void * context, void * data, size_t size);
+
+    /*! @ingroup synet_convolution
+
+        \fn SimdBool SimdSynetConvolution8iImport(void * context, const void * data, size_t size, SimdBool copy);
+
+        \short Imports internal weights and quantization parameters of INT8 convolution algorithm from a blob created by function ::SimdSynetConvolution8iExport.
+
+        This function replaces a call of ::SimdSynetConvolution8iSetParams. See also ::SimdSynetConvolution32fImport.
+
+        \param [in, out] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit with the same parameters.
+        \param [in] data - a pointer to the blob.
+        \param [in] size - a size of the blob (in bytes).
+        \param [in] copy - a flag to copy data of the blob into internal buffers of the context.
+        \return ::SimdTrue on success. It returns ::SimdFalse if the blob is incompatible with the context.
+    */
+    SIMD_API SimdBool SimdSynetConvolution8iImport(void * context, const void * data, size_t size, SimdBool copy);
+
     /*! @ingroup synet
 
         \fn void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
@@ -5782,6 +6488,40 @@ extern "C"
     */
     SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet
+
+        \fn size_t SimdSynetDeconvolution32fExport(const void * context, void * data, size_t size);
+
+        \short Exports internal (reordered) weights of FP32 deconvolution algorithm to a binary blob.
+
+        The blob can be loaded back into an equal context with using of function ::SimdSynetDeconvolution32fImport instead of a call of ::SimdSynetDeconvolution32fSetParams.
+
+        \param [in] context - a pointer to FP32 deconvolution context. Function ::SimdSynetDeconvolution32fSetParams must be called before.
+        \param [out] data - a pointer to output buffer. Can be NULL.
+        \param [in] size - a size of output buffer (in bytes).
+        \return size of the blob (in bytes). The blob is written only if data is not NULL and size is enough.
+            It returns 0 if the algorithm does not keep weights internally or if sizes of internal buffers do not match to the parameters of the context.
+    */
+    SIMD_API size_t SimdSynetDeconvolution32fExport(const void * context, void * data, size_t size);
+
+    /*! @ingroup synet
+
+        \fn SimdBool SimdSynetDeconvolution32fImport(void * context, const void * data, size_t size, const float * bias, const float * params, SimdBool copy);
+
+        \short Imports internal weights of FP32 deconvolution algorithm from a blob created by function ::SimdSynetDeconvolution32fExport.
+
+        This function replaces a call of ::SimdSynetDeconvolution32fSetParams. See also ::SimdSynetConvolution32fImport.
+
+        \param [in, out] context - a pointer to FP32 deconvolution context. It must be created by function ::SimdSynetDeconvolution32fInit with the same parameters.
+        \param [in] data - a pointer to the blob.
+        \param [in] size - a size of the blob (in bytes).
+        \param [in] bias - a pointer to bias. Can be NULL.
+        \param [in] params - a pointer to parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+        \param [in] copy - a flag to copy data of the blob into internal buffers of the context.
+        \return ::SimdTrue on success. It returns ::SimdFalse if the blob is incompatible with the context.
+    */
+    SIMD_API SimdBool SimdSynetDeconvolution32fImport(void * context, const void * data, size_t size, const float * bias, const float * params, SimdBool copy);
+
     /*! @ingroup synet
 
         \fn void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
@@ -6220,6 +6960,40 @@ extern "C"
     */
     SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet
+
+        \fn size_t SimdSynetMergedConvolution32fExport(const void * context, void * data, size_t size);
+
+        \short Exports internal (reordered) weights of FP32 merged convolution algorithm to a binary blob.
+
+        The blob can be loaded back into an equal context with using of function ::SimdSynetMergedConvolution32fImport instead of a call of ::SimdSynetMergedConvolution32fSetParams.
+
+        \param [in] context - a pointer to FP32 merged convolution context. Function ::SimdSynetMergedConvolution32fSetParams must be called before.
+        \param [out] data - a pointer to output buffer. Can be NULL.
+        \param [in] size - a size of output buffer (in bytes).
+        \return size of the blob (in bytes). The blob is written only if data is not NULL and size is enough.
+            It returns 0 if sizes of internal buffers do not match to the parameters of the context.
+    */
+    SIMD_API size_t SimdSynetMergedConvolution32fExport(const void * context, void * data, size_t size);
+
+    /*! @ingroup synet
+
+        \fn SimdBool SimdSynetMergedConvolution32fImport(void * context, const void * data, size_t size, const float * const * bias, const float * const * params, SimdBool copy);
+
+        \short Imports internal weights of FP32 merged convolution algorithm from a blob created by function ::SimdSynetMergedConvolution32fExport.
+
+        This function replaces a call of ::SimdSynetMergedConvolution32fSetParams. See also ::SimdSynetConvolution32fImport.
+
+        \param [in, out] context - a pointer to FP32 merged convolution context. It must be created by function ::SimdSynetMergedConvolution32fInit with the same parameters.
+        \param [in] data - a pointer to the blob.
+        \param [in] size - a size of the blob (in bytes).
+        \param [in] bias - a pointer to the array with pointers to bias. The array size is determined by number of merged convolutions.
+        \param [in] params - a pointer to the array with pointers to parameters of the activation functions (see ::SimdConvolutionActivationType). The array size is determined by number of merged convolutions.
+        \param [in] copy - a flag to copy data of the blob into internal buffers of the context.
+        \return ::SimdTrue on success. It returns ::SimdFalse if the blob is incompatible with the context.
+    */
+    SIMD_API SimdBool SimdSynetMergedConvolution32fImport(void * context, const void * data, size_t size, const float * const * bias, const float * const * params, SimdBool copy);
+
     /*! @ingroup synet
 
         \fn void SimdSynetPoolingForwardAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
@@ -6461,6 +7235,124 @@ extern "C"
     SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, 
         const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
 
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetSetInputP010(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
+
+        \short Sets 10-bit P010 image to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        The image is converted to BGR (or to luminance if channels is equal to 1) with 10-bit precision without intermediate 8-bit image.
+        Algorithm's details (example for NCHW tensor format):
+        \verbatim
+        for(c = 0; c < channels; ++c)
+            for(y = 0; y < height; ++y)
+                for(x = 0; x < width; ++x)
+                    dst[(c*height + y)*width + x] = YuvToBgr10(y, x, c)*(upper[c] - lower[c])/1023 + lower[c];
+        \endverbatim
+        where YuvToBgr10 is a value of channel c (in BGR order) restricted to range [0, 1023].
+
+        \note This function has a C++ wrappers: Simd::SynetSetInputP010(const View<A>& y, const View<A>& uv, SimdYuvType yuvType, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 32-bit image with UV plane (16-bit U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - a width of input image and output image tensor. It must be even.
+        \param [in] height - a height of input image and output image tensor. It must be even.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [out] dst - a pointer to the output 32-bit float image tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] dstFormat - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+    */
+    SIMD_API void SimdSynetSetInputP010(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType,
+        const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
+
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetSetInputYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t srcWidth, size_t srcHeight, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat);
+
+        \short Converts, resizes and sets YUV420P image to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        The function fuses conversion of the image to BGR (or to luminance if channels is equal to 1), bilinear resizing and normalization 
+        and writes the result directly to the output tensor without intermediate full size images. It uses multiple threads for big images.
+        Algorithm's details (example for NCHW tensor format):
+        \verbatim
+        for(c = 0; c < channels; ++c)
+            for(y = 0; y < dstHeight; ++y)
+                for(x = 0; x < dstWidth; ++x)
+                    dst[(c*dstHeight + y)*dstWidth + x] = Resize(YuvToBgr(src), y, x, c)*(upper[c] - lower[c])/255 + lower[c];
+        \endverbatim
+        Mean/std normalization (dst = (value - mean)/std) corresponds to lower = -mean/std and upper = (255 - mean)/std.
+        The function does nothing if the input size, the resizing method, the number of channels or the tensor format is not supported.
+        Resizing indices and coefficients are cached per thread and reused while these parameters do not change.
+
+        \note This function has a C++ wrappers: Simd::SynetSetInputYuv420p(const View<A>& y, const View<A>& u, const View<A>& v, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType format).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] srcWidth - a width of input image. It must be even.
+        \param [in] srcHeight - a height of input image. It must be even.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] method - a resizing method. It can be ::SimdResizeMethodBilinear, ::SimdResizeMethodCaffeInterp or ::SimdResizeMethodInferenceEngineInterp.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [out] dst - a pointer to the output 32-bit float image tensor.
+        \param [in] dstWidth - a width of output image tensor.
+        \param [in] dstHeight - a height of output image tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] dstFormat - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, 
+            ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c.
+    */
+    SIMD_API void SimdSynetSetInputYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t srcWidth, size_t srcHeight,
+        SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat);
+
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetSetInputNv12(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t srcWidth, size_t srcHeight, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat);
+
+        \short Converts, resizes and sets NV12 image to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        The function fuses conversion of the image to BGR (or to luminance if channels is equal to 1), bilinear resizing and normalization 
+        and writes the result directly to the output tensor without intermediate full size images. It uses multiple threads for big images.
+        Algorithm's details (example for NCHW tensor format):
+        \verbatim
+        for(c = 0; c < channels; ++c)
+            for(y = 0; y < dstHeight; ++y)
+                for(x = 0; x < dstWidth; ++x)
+                    dst[(c*dstHeight + y)*dstWidth + x] = Resize(YuvToBgr(src), y, x, c)*(upper[c] - lower[c])/255 + lower[c];
+        \endverbatim
+        Mean/std normalization (dst = (value - mean)/std) corresponds to lower = -mean/std and upper = (255 - mean)/std.
+        The function does nothing if the input size, the resizing method, the number of channels or the tensor format is not supported.
+        Resizing indices and coefficients are cached per thread and reused while these parameters do not change.
+
+        \note This function has a C++ wrappers: Simd::SynetSetInputNv12(const View<A>& y, const View<A>& uv, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType format).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with UV color plane (U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] srcWidth - a width of input image. It must be even.
+        \param [in] srcHeight - a height of input image. It must be even.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] method - a resizing method. It can be ::SimdResizeMethodBilinear, ::SimdResizeMethodCaffeInterp or ::SimdResizeMethodInferenceEngineInterp.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [out] dst - a pointer to the output 32-bit float image tensor.
+        \param [in] dstWidth - a width of output image tensor.
+        \param [in] dstHeight - a height of output image tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] dstFormat - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, 
+            ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c.
+    */
+    SIMD_API void SimdSynetSetInputNv12(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+        SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat);
+
     /*! @ingroup synet
 
         \fn void SimdSynetShuffleLayerForward(const float * src0, const float * src1, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format, int type);
@@ -6741,7 +7633,93 @@ extern "C"
     */
     SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup synet_winograd
+    /*! @ingroup transform
+
+        \fn void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates affine warp context.
+
+        The context maps every output pixel (x, y) to the input point given by the inverse of matrix mat
+        and samples the input image at this point. Inverse matrix and per-row ranges of output pixels
+        which are mapped inside of the input image are estimated here once, so the context can be reused for many images.
+
+        \note This function has a C++ wrapper: Simd::WarpAffine(const View<A> & src, const float * mat, View<A> & dst, SimdWarpAffineFlags flags, const uint8_t * border).
+
+        \param [in] srcW - a width of the input image.
+        \param [in] srcH - a height of the input image.
+        \param [in] dstW - a width of the output image.
+        \param [in] dstH - a height of the output image.
+        \param [in] channels - a channel number of input and output image. It can be 1, 2, 3 or 4.
+        \param [in] mat - a pointer to 2x3 matrix of forward affine transformation (from input to output image):
+            dx = mat[0]*sx + mat[1]*sy + mat[2], dy = mat[3]*sx + mat[4]*sy + mat[5].
+        \param [in] flags - a flags of channel type, interpolation and border mode (see ::SimdWarpAffineFlags).
+        \param [in] border - a pointer to pixel value used for ::SimdWarpAffineBorderConstant mode (it has channels elements of channel type). It can be NULL (zero value).
+        \return a pointer to warp context. On error (singular matrix or wrong parameters) it returns NULL.
+                This pointer is used in function ::SimdWarpAffineRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+    /*! @ingroup transform
+
+        \fn void SimdWarpAffineRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs affine warping of image.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] context - a warp context. It must be created by function ::SimdWarpAffineInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdWarpAffineRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup transform
+
+        \fn void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates perspective warp context.
+
+        The context maps every output pixel (x, y) to the input point given by the inverse of matrix mat.
+        The resulting map of input coordinates is estimated here once in fixed point, so warping itself is performed
+        by the same code as in ::SimdRemapRun and the context can be reused for many images.
+
+        \note This function has a C++ wrapper: Simd::WarpPerspective(const View<A> & src, const float * mat, View<A> & dst, SimdWarpAffineFlags flags, const uint8_t * border).
+
+        \param [in] srcW - a width of the input image.
+        \param [in] srcH - a height of the input image.
+        \param [in] dstW - a width of the output image.
+        \param [in] dstH - a height of the output image.
+        \param [in] channels - a channel number of input and output image. It can be 1, 2, 3 or 4.
+        \param [in] mat - a pointer to 3x3 matrix of forward perspective transformation (from input to output image):
+            w = mat[6]*sx + mat[7]*sy + mat[8], dx = (mat[0]*sx + mat[1]*sy + mat[2])/w, dy = (mat[3]*sx + mat[4]*sy + mat[5])/w.
+        \param [in] flags - a flags of channel type, interpolation and border mode (see ::SimdWarpAffineFlags).
+        \param [in] border - a pointer to pixel value used for ::SimdWarpAffineBorderConstant mode (it has channels elements of channel type). It can be NULL (zero value).
+        \return a pointer to warp context. On error (singular matrix or wrong parameters) it returns NULL.
+                This pointer is used in function ::SimdWarpPerspectiveRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+    /*! @ingroup transform
+
+        \fn void SimdWarpPerspectiveRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs perspective warping of image.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] context - a warp context. It must be created by function ::SimdWarpPerspectiveInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdWarpPerspectiveRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup synet_winograd
 
         \fn void SimdWinogradKernel1x3Block1x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
 
@@ -7171,6 +8149,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -7185,6 +8165,35 @@ extern "C"
     SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdYuv420pToBgr which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType);
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
@@ -7196,6 +8205,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -7210,6 +8221,35 @@ extern "C"
     SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV422P image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdYuv422pToBgr which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType);
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
@@ -7220,6 +8260,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -7234,6 +8276,34 @@ extern "C"
     SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 24-bit BGR image.
+
+        The input Y, U, V and output BGR images must have the same width and height.
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdYuv444pToBgr which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType);
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -7245,6 +8315,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -7260,6 +8332,36 @@ extern "C"
     SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdYuv420pToBgra which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -7271,6 +8373,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -7286,6 +8390,36 @@ extern "C"
     SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV422P image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdYuv422pToBgra which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -7296,6 +8430,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -7311,6 +8447,35 @@ extern "C"
     SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 32-bit BGRA image.
+
+        The input Y, U, V and output BGRA images must have the same width and height.
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdYuv444pToBgra which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsl, size_t hslStride);
@@ -7419,6 +8584,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb);
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -7433,6 +8600,35 @@ extern "C"
     SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdYuv420pToRgb which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Yuv420pToRgbV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType);
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv422pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
@@ -7458,6 +8654,33 @@ extern "C"
     SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV422P image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdYuv422pToRgb which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Yuv422pToRgbV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv422pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToRgb(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
@@ -7482,6 +8705,523 @@ extern "C"
     SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 24-bit RGB image.
+
+        The input Y, U, V and output RGB images must have the same width and height.
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdYuv444pToRgb which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToRgbV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image has half height and the same row size in bytes as Y image (it contains width/2 interleaved UV pairs).
+        The conversion is performed directly without deinterleaving of UV plane to separate U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with UV plane (U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image has half height and the same row size in bytes as Y image (it contains width/2 interleaved UV pairs).
+        The conversion is performed directly without deinterleaving of UV plane to separate U and V planes.
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdNv12ToBgr which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgrV2(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with UV plane (U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image has half height and the same row size in bytes as Y image (it contains width/2 interleaved UV pairs).
+        The conversion is performed directly without deinterleaving of UV plane to separate U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with UV plane (U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image has half height and the same row size in bytes as Y image (it contains width/2 interleaved UV pairs).
+        The conversion is performed directly without deinterleaving of UV plane to separate U and V planes.
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdNv12ToBgra which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgraV2(const View<A>& y, const View<A>& uv, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with UV plane (U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image has half height and the same row size in bytes as Y image (it contains width/2 interleaved UV pairs).
+        The conversion is performed directly without deinterleaving of UV plane to separate U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with UV plane (U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+    */
+    SIMD_API void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image has half height and the same row size in bytes as Y image (it contains width/2 interleaved UV pairs).
+        The conversion is performed directly without deinterleaving of UV plane to separate U and V planes.
+        The function allows to select YUV standard (color matrix and range) in contrast to ::SimdNv12ToRgb which always uses BT.601.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToRgbV2(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with UV plane (U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input VU image has half height and the same row size in bytes as Y image (it contains width/2 interleaved VU pairs).
+        The conversion is performed directly without deinterleaving of VU plane to separate U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with VU plane (V and U values are interleaved: V0 U0 V1 U1 ...).
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image has half height and the same row size in bytes as Y image (it contains width/2 interleaved VU pairs).
+        The conversion is performed directly without deinterleaving of VU plane to separate U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with VU plane (V and U values are interleaved: V0 U0 V1 U1 ...).
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input VU image has half height and the same row size in bytes as Y image (it contains width/2 interleaved VU pairs).
+        The conversion is performed directly without deinterleaving of VU plane to separate U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with VU plane (V and U values are interleaved: V0 U0 V1 U1 ...).
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+    */
+    SIMD_API void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts 10-bit P010 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        All input samples are 16-bit little-endian values with 10-bit data in the most significant bits.
+        The input UV image has half height and the same row size in bytes as Y image (it contains width/2 interleaved UV pairs).
+        Results which exceed the 8-bit range are saturated (tone clipping).
+
+        \note This function has a C++ wrappers: Simd::P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 32-bit image with UV plane (16-bit U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts 10-bit P010 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        All input samples are 16-bit little-endian values with 10-bit data in the most significant bits.
+        The input UV image has half height and the same row size in bytes as Y image (it contains width/2 interleaved UV pairs).
+        Results which exceed the 8-bit range are saturated (tone clipping).
+
+        \note This function has a C++ wrappers: Simd::P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 32-bit image with UV plane (16-bit U and V values are interleaved: U0 V0 U1 V1 ...).
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p10ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts 10-bit YUV420P (I010) image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        All input samples are 16-bit little-endian values with 10-bit data in the least significant bits (in range [0, 1023]).
+        Results which exceed the 8-bit range are saturated (tone clipping).
+
+        \note This function has a C++ wrappers: Simd::Yuv420p10ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p10ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p10ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts 10-bit YUV420P (I010) image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        All input samples are 16-bit little-endian values with 10-bit data in the least significant bits (in range [0, 1023]).
+        Results which exceed the 8-bit range are saturated (tone clipping).
+
+        \note This function has a C++ wrappers: Simd::Yuv420p10ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p10ToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuyv422ToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts packed YUYV 4:2:2 image to 24-bit BGR image.
+
+        The input YUYV and output BGR images must have the same width and height. The width must be even.
+        Each pair of horizontally adjacent pixels of the input image is packed into 4 bytes (Y0 U0 Y1 V0 Y2 U1 Y3 V1 ...).
+
+        \note This function has a C++ wrapper Simd::Yuyv422ToBgr(const View<A>& yuyv, View<A>& bgr).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdYuyv422ToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdUyvy422ToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts packed UYVY 4:2:2 image to 24-bit BGR image.
+
+        The input UYVY and output BGR images must have the same width and height. The width must be even.
+        Each pair of horizontally adjacent pixels of the input image is packed into 4 bytes (U0 Y0 V0 Y1 U1 Y2 V1 Y3 ...).
+
+        \note This function has a C++ wrapper Simd::Uyvy422ToBgr(const View<A>& uyvy, View<A>& bgr).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] uyvy - a pointer to pixels data of input 16-bit image with packed UYVY 4:2:2 pixels.
+        \param [in] uyvyStride - a row size of the uyvy image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdUyvy422ToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuyv422ToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts packed YUYV 4:2:2 image to 32-bit BGRA image.
+
+        The input YUYV and output BGRA images must have the same width and height. The width must be even.
+        Each pair of horizontally adjacent pixels of the input image is packed into 4 bytes (Y0 U0 Y1 V0 Y2 U1 Y3 V1 ...).
+
+        \note This function has a C++ wrapper Simd::Yuyv422ToBgra(const View<A>& yuyv, View<A>& bgra, uint8_t alpha = 0xFF).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdYuyv422ToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdUyvy422ToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts packed UYVY 4:2:2 image to 32-bit BGRA image.
+
+        The input UYVY and output BGRA images must have the same width and height. The width must be even.
+        Each pair of horizontally adjacent pixels of the input image is packed into 4 bytes (U0 Y0 V0 Y1 U1 Y2 V1 Y3 ...).
+
+        \note This function has a C++ wrapper Simd::Uyvy422ToBgra(const View<A>& uyvy, View<A>& bgra, uint8_t alpha = 0xFF).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] uyvy - a pointer to pixels data of input 16-bit image with packed UYVY 4:2:2 pixels.
+        \param [in] uyvyStride - a row size of the uyvy image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdUyvy422ToBgra(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+        \short Converts packed YUYV 4:2:2 image to 8-bit gray image.
+
+        The input YUYV and output gray images must have the same width and height. The width must be even.
+        Each pair of horizontally adjacent pixels of the input image is packed into 4 bytes (Y0 U0 Y1 V0 Y2 U1 Y3 V1 ...).
+        The output image contains Y component of the input image.
+
+        \note This function has a C++ wrapper Simd::Yuyv422ToGray(const View<A>& yuyv, View<A>& gray).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
+        \param [in] grayStride - a row size of the gray image.
+    */
+    SIMD_API void SimdYuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+        \short Converts packed YUYV 4:2:2 image to YUV420P image.
+
+        The input YUYV and output Y images must have the same width and height. The width and the height must be even.
+        The output U and V images must have the same width and height (half size relative to Y component).
+        U and V components of the output image are averaged over two adjacent rows of the input image.
+
+        \note This function has a C++ wrapper Simd::Yuyv422ToYuv420p(const View<A>& yuyv, View<A>& y, View<A>& u, View<A>& v).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [in] yuyvStride - a row size of the yuyv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdYuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -627,6 +627,53 @@ namespace Simd
         SimdBayerToBgra(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToBgrV2(const View<A>& bayer, View<A>& bgr, SimdBayerDemosaicType demosaic);
+
+        \short Converts 8-bit Bayer image to 24-bit BGR with using of given demosaicing algorithm.
+
+        All images must have the same width and height. The width and the height must be even.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToBgrV2.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] demosaic - a demosaicing algorithm (see ::SimdBayerDemosaicType).
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToBgrV2(const View<A>& bayer, View<A>& bgr, SimdBayerDemosaicType demosaic)
+    {
+        assert(EqualSize(bgr, bayer) && bgr.format == View<A>::Bgr24);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0));
+
+        SimdBayerToBgrV2(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgr.data, bgr.stride, demosaic);
+    }
+
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToBgraV2(const View<A>& bayer, View<A>& bgra, SimdBayerDemosaicType demosaic, uint8_t alpha = 0xFF);
+
+        \short Converts 8-bit Bayer image to 32-bit BGRA with using of given demosaicing algorithm.
+
+        All images must have the same width and height. The width and the height must be even.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToBgraV2.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] demosaic - a demosaicing algorithm (see ::SimdBayerDemosaicType).
+        \param [in] alpha - a value of alpha channel. It is equal to 256 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToBgraV2(const View<A>& bayer, View<A>& bgra, SimdBayerDemosaicType demosaic, uint8_t alpha = 0xFF)
+    {
+        assert(EqualSize(bgra, bayer) && bgra.format == View<A>::Bgra32);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0));
+
+        SimdBayerToBgraV2(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgra.data, bgra.stride, alpha, demosaic);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToBayer(const View<A>& bgra, View<A>& bayer)
@@ -1893,6 +1940,60 @@ namespace Simd
         SimdChangeColors(src.data, src.stride, src.width, src.height, colors, dst.data, dst.stride);
     }
 
+    /*! @ingroup histogram
+
+        \fn void Lut8u(const View<A> & src, const uint8_t * table, View<A> & dst)
+
+        \short Transforms 8-bit image with 1, 3 or 4 channels with using of lookup tables (separate table for every channel).
+
+        The input and output images must have the same size and format.
+        Algorithm description:
+        \verbatim
+        for(y = 0; y < height; ++y)
+            for(x = 0; x < width; ++x)
+                for(c = 0; c < channels; ++c)
+                    dst[x, y, c] = table[c*256 + src[x, y, c]];
+        \endverbatim
+        \note This function is a C++ wrapper for function ::SimdLut8u.
+
+        \param [in] src - an input 8-bit image.
+        \param [in] table - a pointer to the lookup tables (array of channels*256 unsigned 8-bit values).
+        \param [out] dst - an output 8-bit image.
+    */
+    template<template<class> class A> SIMD_INLINE void Lut8u(const View<A> & src, const uint8_t * table, View<A> & dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1 && (src.ChannelCount() == 1 || src.ChannelCount() == 3 || src.ChannelCount() == 4));
+
+        SimdLut8u(src.data, src.stride, src.width, src.height, src.ChannelCount(), table, dst.data, dst.stride);
+    }
+
+    /*! @ingroup histogram
+
+        \fn void Lut16uTo8u(const View<A> & src, const uint8_t * table, size_t bits, View<A> & dst)
+
+        \short Transforms 16-bit gray image (for example raw sensor data) to 8-bit gray image with using of lookup table.
+
+        The input and output images must have the same size. Input values greater than 2^bits - 1 are saturated.
+        Algorithm description:
+        \verbatim
+        for(y = 0; y < height; ++y)
+            for(x = 0; x < width; ++x)
+                dst[x, y] = table[Min(src[x, y], (1 << bits) - 1)];
+        \endverbatim
+        \note This function is a C++ wrapper for function ::SimdLut16uTo8u.
+
+        \param [in] src - an input 16-bit image.
+        \param [in] table - a pointer to the lookup table (array of 2^bits unsigned 8-bit values).
+        \param [in] bits - a bit depth of input values. It must be in range [1, 16].
+        \param [out] dst - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void Lut16uTo8u(const View<A> & src, const uint8_t * table, size_t bits, View<A> & dst)
+    {
+        assert(EqualSize(src, dst) && src.format == View<A>::Int16 && dst.format == View<A>::Gray8);
+
+        SimdLut16uTo8u(src.data, src.stride, src.width, src.height, table, bits, dst.data, dst.stride);
+    }
+
     /*! @ingroup histogram
 
         \fn void NormalizeHistogram(const View<A> & src, View<A> & dst)
@@ -1978,6 +2079,46 @@ namespace Simd
         SimdHogLiteExtractFeatures(src.data, src.stride, src.width, src.height, cell, features, featuresStride);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void HslToBgr(const View<A> & hsl, View<A> & bgr)
+
+        \short Converts 24-bit HSL(Hue, Saturation, Lightness) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdHslToBgr.
+
+        \param [in] hsl - an input 24-bit HSL image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void HslToBgr(const View<A> & hsl, View<A> & bgr)
+    {
+        assert(EqualSize(hsl, bgr) && hsl.format == View<A>::Hsl24 && bgr.format == View<A>::Bgr24);
+
+        SimdHslToBgr(hsl.data, hsl.width, hsl.height, hsl.stride, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void HsvToBgr(const View<A> & hsv, View<A> & bgr)
+
+        \short Converts 24-bit HSV(Hue, Saturation, Value) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdHsvToBgr.
+
+        \param [in] hsv - an input 24-bit HSV image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void HsvToBgr(const View<A> & hsv, View<A> & bgr)
+    {
+        assert(EqualSize(hsv, bgr) && hsv.format == View<A>::Hsv24 && bgr.format == View<A>::Bgr24);
+
+        SimdHsvToBgr(hsv.data, hsv.width, hsv.height, hsv.stride, bgr.data, bgr.stride);
+    }
+
     /*! @ingroup other_conversion
 
         \fn void Int16ToGray(const View<A> & src, View<A> & dst)
@@ -2727,6 +2868,38 @@ namespace Simd
         }
     }
 
+    /*! @ingroup transform
+
+        \fn void Remap(const View<A> & src, const float * map, size_t mapStride, View<A> & dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear, const uint8_t * border = NULL);
+
+        \short Performs remapping of input image with using of map of input coordinates.
+
+        The input and output images must have the same format (8-bit images with 1-4 channels or 32-bit float image).
+        The map has size dst.width*dst.height*2 (interleaved x and y coordinates). Use ::SimdRemapInit directly to reuse the map for many images.
+
+        \note This function is a C++ wrapper for functions ::SimdRemapInit and ::SimdRemapRun.
+
+        \param [in] src - an input image.
+        \param [in] map - a pointer to the map of input coordinates.
+        \param [in] mapStride - a row size (in bytes) of the map.
+        \param [out] dst - an output image.
+        \param [in] flags - a flags of interpolation and border mode (channel type is defined by image format). By default it is equal to ::SimdWarpAffineInterpBilinear.
+        \param [in] border - a pointer to pixel value used for ::SimdWarpAffineBorderConstant mode. It can be NULL (zero value).
+    */
+    template<template<class> class A> SIMD_INLINE void Remap(const View<A> & src, const float * map, size_t mapStride, View<A> & dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear, const uint8_t * border = NULL)
+    {
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+
+        int type = src.format == View<A>::Float ? SimdWarpAffineChannelFloat : SimdWarpAffineChannelByte;
+        void * context = SimdRemapInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), map, mapStride,
+            (SimdWarpAffineFlags)((flags & ~SimdWarpAffineChannelMask) | type), border);
+        if (context)
+        {
+            SimdRemapRun(context, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(context);
+        }
+    }
+
     /*! @ingroup resizing
 
         \fn void Reduce2x2(const View<A> & src, View<A> & dst)
@@ -2866,7 +3039,7 @@ namespace Simd
     */
     template<template<class> class A> SIMD_INLINE void Resize(const View<A> & src, View<A> & dst, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear)
     {
-        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.format == View<A>::Int16 || src.ChannelSize() == 1));
 
         if (EqualSize(src, dst))
         {
@@ -2874,7 +3047,7 @@ namespace Simd
         }
         else
         {
-            SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : SimdResizeChannelByte;
+            SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : (src.format == View<A>::Int16 ? SimdResizeChannelShort : SimdResizeChannelByte);
             void * resizer = SimdResizerInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, method);
             if (resizer)
             {
@@ -2886,6 +3059,72 @@ namespace Simd
         }
     }
 
+    /*! @ingroup resizing
+
+        \fn void ResizePyramid(const View<A> & src, std::vector<View<A>> & levels, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear)
+
+        \short Resizes image to several output images (levels of pyramid) of arbitrary sizes at a single pass.
+
+        All images must have the same format.
+
+        \note This function is a C++ wrapper for functions ::SimdResizerPyramidInit and ::SimdResizerPyramidRun.
+
+        \param [in] src - an original input image.
+        \param [out] levels - a vector of resized output images.
+        \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+    */
+    template<template<class> class A> SIMD_INLINE void ResizePyramid(const View<A> & src, std::vector<View<A>> & levels, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear)
+    {
+        assert(src.format == View<A>::Float || src.format == View<A>::Int16 || src.ChannelSize() == 1);
+
+        size_t count = levels.size(), channels = src.ChannelCount();
+        std::vector<size_t> width(count), height(count), stride(count);
+        std::vector<uint8_t*> data(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            assert(levels[i].format == src.format);
+            width[i] = levels[i].width;
+            height[i] = levels[i].height;
+            stride[i] = levels[i].stride;
+            data[i] = levels[i].data;
+        }
+        SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : (src.format == View<A>::Int16 ? SimdResizeChannelShort : SimdResizeChannelByte);
+        void * pyramid = SimdResizerPyramidInit(src.width, src.height, width.data(), height.data(), count, channels, type, method);
+        if (pyramid)
+        {
+            SimdResizerPyramidRun(pyramid, src.data, src.stride, data.data(), stride.data());
+            SimdRelease(pyramid);
+        }
+        else
+            assert(0);
+    }
+
+    /*! @ingroup resizing
+
+        \fn void ResizeRois(const View<A> & src, const std::vector<Rectangle<ptrdiff_t>> & rois, uint8_t * dst, size_t dstWidth, size_t dstHeight, SimdResizeChannelType dstType = SimdResizeChannelByte, SimdTensorFormatType dstFormat = SimdTensorFormatNhwc, SimdResizeMethodType method = SimdResizeMethodBilinear)
+
+        \short Crops several regions of interest from image and resizes them into a packed batch of output images.
+
+        \note This function is a C++ wrapper for function ::SimdResizeRois.
+
+        \param [in] src - an original input image. It must have 8-bit channels.
+        \param [in] rois - a vector of rectangles.
+        \param [out] dst - a pointer to the output batch.
+        \param [in] dstWidth - a width of output images.
+        \param [in] dstHeight - a height of output images.
+        \param [in] dstType - a type of output channel. By default it is equal to ::SimdResizeChannelByte.
+        \param [in] dstFormat - a format of output images. By default it is equal to ::SimdTensorFormatNhwc.
+        \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+    */
+    template<template<class> class A> SIMD_INLINE void ResizeRois(const View<A> & src, const std::vector<Rectangle<ptrdiff_t>> & rois, uint8_t * dst, size_t dstWidth, size_t dstHeight,
+        SimdResizeChannelType dstType = SimdResizeChannelByte, SimdTensorFormatType dstFormat = SimdTensorFormatNhwc, SimdResizeMethodType method = SimdResizeMethodBilinear)
+    {
+        assert(src.ChannelSize() == 1 && src.ChannelCount() <= 4);
+
+        SimdResizeRois(src.data, src.width, src.height, src.stride, src.ChannelCount(), rois.empty() ? NULL : &rois[0].left, rois.size(),
+            method, dst, dstWidth, dstHeight, dstType, dstFormat);
+    }
+
     /*! @ingroup rgb_conversion
 
         \fn void RgbToGray(const View<A>& rgb, View<A>& gray)
@@ -3691,6 +3930,93 @@ namespace Simd
         SimdSynetSetInput(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, lower, upper, dst, channels, format);
     }
 
+    /*! @ingroup synet_conversion
+
+        \fn void SynetSetInputP010(const View<A>& y, const View<A>& uv, SimdYuvType yuvType, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format)
+
+        \short Sets 10-bit P010 image to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \note This function is a C++ wrapper for function ::SimdSynetSetInputP010.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit UV color planes. It must have half size relative to Y component.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [out] dst - a pointer to the output 32-bit float image tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] format - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+    */
+    template<template<class> class A> SIMD_INLINE void SynetSetInputP010(const View<A>& y, const View<A>& uv, SimdYuvType yuvType, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32);
+        assert(format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc);
+
+        SimdSynetSetInputP010(y.data, y.stride, uv.data, uv.stride, y.width, y.height, yuvType, lower, upper, dst, channels, format);
+    }
+
+    /*! @ingroup synet_conversion
+
+        \fn void SynetSetInputYuv420p(const View<A>& y, const View<A>& u, const View<A>& v, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType format)
+
+        \short Converts, resizes and sets YUV420P image to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \note This function is a C++ wrapper for function ::SimdSynetSetInputYuv420p.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane. It must have half size relative to Y component.
+        \param [in] v - an input 8-bit image with V color plane. It must have half size relative to Y component.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] method - a resizing method. It can be ::SimdResizeMethodBilinear, ::SimdResizeMethodCaffeInterp or ::SimdResizeMethodInferenceEngineInterp.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [out] dst - a pointer to the output 32-bit float image tensor.
+        \param [in] dstWidth - a width of output image tensor.
+        \param [in] dstHeight - a height of output image tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] format - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, 
+            ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c.
+    */
+    template<template<class> class A> SIMD_INLINE void SynetSetInputYuv420p(const View<A>& y, const View<A>& u, const View<A>& v, SimdYuvType yuvType, SimdResizeMethodType method,
+        const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType format)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && Compatible(u, v));
+        assert(y.format == View<A>::Gray8 && u.format == View<A>::Gray8);
+
+        SimdSynetSetInputYuv420p(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, format);
+    }
+
+    /*! @ingroup synet_conversion
+
+        \fn void SynetSetInputNv12(const View<A>& y, const View<A>& uv, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType format)
+
+        \short Converts, resizes and sets NV12 image to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \note This function is a C++ wrapper for function ::SimdSynetSetInputNv12.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes. It must have half size relative to Y component.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] method - a resizing method. It can be ::SimdResizeMethodBilinear, ::SimdResizeMethodCaffeInterp or ::SimdResizeMethodInferenceEngineInterp.
+        \param [in] lower - a pointer to the array with lower bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [in] upper - a pointer to the array with upper bound of values of the output tensor. The size of the array have to correspond number of channels in the output image tensor.
+        \param [out] dst - a pointer to the output 32-bit float image tensor.
+        \param [in] dstWidth - a width of output image tensor.
+        \param [in] dstHeight - a height of output image tensor.
+        \param [in] channels - a number of channels in the output image tensor. It can be 1 or 3.
+        \param [in] format - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, 
+            ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c.
+    */
+    template<template<class> class A> SIMD_INLINE void SynetSetInputNv12(const View<A>& y, const View<A>& uv, SimdYuvType yuvType, SimdResizeMethodType method,
+        const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType format)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+
+        SimdSynetSetInputNv12(y.data, y.stride, uv.data, uv.stride, y.width, y.height, yuvType, method, lower, upper, dst, dstWidth, dstHeight, channels, format);
+    }
+
     /*! @ingroup texture_estimation
 
         \fn void TextureBoostedSaturatedGradient(const View<A>& src, uint8_t saturation, uint8_t boost, View<A>& dx, View<A>& dy)
@@ -3855,6 +4181,66 @@ namespace Simd
         SimdTransformImage(src.data, src.stride, src.width, src.height, src.PixelSize(), transform, dst.data, dst.stride);
     }
 
+    /*! @ingroup transform
+
+        \fn void WarpAffine(const View<A> & src, const float * mat, View<A> & dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear, const uint8_t * border = NULL);
+
+        \short Performs affine warping of input image.
+
+        The input and output images must have the same format (8-bit images with 1-4 channels or 32-bit float image).
+
+        \note This function is a C++ wrapper for functions ::SimdWarpAffineInit and ::SimdWarpAffineRun.
+
+        \param [in] src - an input image.
+        \param [in] mat - a pointer to 2x3 matrix of forward affine transformation (from input to output image).
+        \param [out] dst - an output image.
+        \param [in] flags - a flags of interpolation and border mode (channel type is defined by image format). By default it is equal to ::SimdWarpAffineInterpBilinear.
+        \param [in] border - a pointer to pixel value used for ::SimdWarpAffineBorderConstant mode. It can be NULL (zero value).
+    */
+    template<template<class> class A> SIMD_INLINE void WarpAffine(const View<A> & src, const float * mat, View<A> & dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear, const uint8_t * border = NULL)
+    {
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+
+        int type = src.format == View<A>::Float ? SimdWarpAffineChannelFloat : SimdWarpAffineChannelByte;
+        void * context = SimdWarpAffineInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), mat, 
+            (SimdWarpAffineFlags)((flags & ~SimdWarpAffineChannelMask) | type), border);
+        if (context)
+        {
+            SimdWarpAffineRun(context, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(context);
+        }
+    }
+
+    /*! @ingroup transform
+
+        \fn void WarpPerspective(const View<A> & src, const float * mat, View<A> & dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear, const uint8_t * border = NULL);
+
+        \short Performs perspective warping of input image.
+
+        The input and output images must have the same format (8-bit images with 1-4 channels or 32-bit float image).
+
+        \note This function is a C++ wrapper for functions ::SimdWarpPerspectiveInit and ::SimdWarpPerspectiveRun.
+
+        \param [in] src - an input image.
+        \param [in] mat - a pointer to 3x3 matrix of forward perspective transformation (from input to output image).
+        \param [out] dst - an output image.
+        \param [in] flags - a flags of interpolation and border mode (channel type is defined by image format). By default it is equal to ::SimdWarpAffineInterpBilinear.
+        \param [in] border - a pointer to pixel value used for ::SimdWarpAffineBorderConstant mode. It can be NULL (zero value).
+    */
+    template<template<class> class A> SIMD_INLINE void WarpPerspective(const View<A> & src, const float * mat, View<A> & dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear, const uint8_t * border = NULL)
+    {
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+
+        int type = src.format == View<A>::Float ? SimdWarpAffineChannelFloat : SimdWarpAffineChannelByte;
+        void * context = SimdWarpPerspectiveInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), mat,
+            (SimdWarpAffineFlags)((flags & ~SimdWarpAffineChannelMask) | type), border);
+        if (context)
+        {
+            SimdWarpPerspectiveRun(context, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(context);
+        }
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A>& a, View<A>& bgra)
@@ -3908,6 +4294,33 @@ namespace Simd
         SimdYuv420pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+
+        \short Converts YUV420P image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv420pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
@@ -3936,29 +4349,79 @@ namespace Simd
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+        \fn void Yuv422pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
 
-        \short Converts YUV444P image to 24-bit BGR image.
+        \short Converts YUV422P image to 24-bit BGR image.
 
-        The input Y, U, V and output BGR images must have the same width and height.
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
 
-        \note This function is a C++ wrapper for function ::SimdYuv444pToBgr.
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgrV2.
 
         \param [in] y - an input 8-bit image with Y color plane.
         \param [in] u - an input 8-bit image with U color plane.
         \param [in] v - an input 8-bit image with V color plane.
         \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
     */
-    template<template<class> class A> SIMD_INLINE void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
     {
-        assert(Compatible(y, u, v) && EqualSize(y, bgr) && y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
 
-        SimdYuv444pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+        SimdYuv422pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
     }
 
     /*! @ingroup yuv_conversion
 
-        \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
+        \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+
+        \short Converts YUV444P image to 24-bit BGR image.
+
+        The input Y, U, V and output BGR images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, bgr) && y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv444pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+
+        \short Converts YUV444P image to 24-bit BGR image.
+
+        The input Y, U, V and output BGR images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, bgr) && y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv444pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
 
         \short Converts YUV420P image to 32-bit BGRA image.
 
@@ -3983,6 +4446,34 @@ namespace Simd
         SimdYuv420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+
+        \short Converts YUV420P image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv420pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
@@ -4010,6 +4501,34 @@ namespace Simd
         SimdYuv422pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv422pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+
+        \short Converts YUV422P image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv422pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
@@ -4033,6 +4552,30 @@ namespace Simd
         SimdYuv444pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+
+        \short Converts YUV444P image to 32-bit BGRA image.
+
+        The input Y, U, V and output BGRA images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, bgra) && y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv444pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv444pToHsl(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsl)
@@ -4150,6 +4693,33 @@ namespace Simd
         SimdYuv420pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToRgbV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType)
+
+        \short Converts YUV420P image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420pToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420pToRgbV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdYuv420pToRgbV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
@@ -4176,6 +4746,33 @@ namespace Simd
         SimdYuv422pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv422pToRgbV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType)
+
+        \short Converts YUV422P image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv422pToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv422pToRgbV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdYuv422pToRgbV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb)
@@ -4198,6 +4795,552 @@ namespace Simd
         SimdYuv444pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToRgbV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType)
+
+        \short Converts YUV444P image to 24-bit RGB image.
+
+        The input Y, U, V and output RGB images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToRgbV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb, SimdYuvType yuvType)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, rgb) && y.format == View<A>::Gray8 && rgb.format == View<A>::Rgb24);
+
+        SimdYuv444pToRgbV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgr));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgrV2(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgrV2(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgr));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgrV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgra));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgraV2(const View<A>& y, const View<A>& uv, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgraV2(const View<A>& y, const View<A>& uv, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgra));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgraV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb)
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, rgb));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && rgb.format == View<A>::Rgb24);
+
+        SimdNv12ToRgb(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgbV2(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType)
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgbV2(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, rgb));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && rgb.format == View<A>::Rgb24);
+
+        SimdNv12ToRgbV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr)
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input VU image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && EqualSize(y, bgr));
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv21ToBgr(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF)
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && EqualSize(y, bgra));
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv21ToBgra(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb)
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input VU image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && EqualSize(y, rgb));
+        assert(y.format == View<A>::Gray8 && vu.format == View<A>::Uv16 && rgb.format == View<A>::Rgb24);
+
+        SimdNv21ToRgb(y.data, y.stride, vu.data, vu.stride, y.width, y.height, rgb.data, rgb.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType)
+
+        \short Converts 10-bit P010 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgr.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgr));
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgr.format == View<A>::Bgr24);
+
+        SimdP010ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+
+        \short Converts 10-bit P010 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgra));
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgra.format == View<A>::Bgra32);
+
+        SimdP010ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p10ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+
+        \short Converts 10-bit YUV420P (I010) image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p10ToBgr.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p10ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Int16 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv420p10ToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p10ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+
+        \short Converts 10-bit YUV420P (I010) image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p10ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] yuvType - a type of input YUV image (see descriptions of ::SimdYuvType).
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p10ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, SimdYuvType yuvType, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Int16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv420p10ToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuyv422ToBgr(const View<A>& yuyv, View<A>& bgr)
+
+        \short Converts packed YUYV 4:2:2 image to 24-bit BGR image.
+
+        The input YUYV and output BGR images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuyv422ToBgr.
+
+        \param [in] yuyv - an input 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuyv422ToBgr(const View<A>& yuyv, View<A>& bgr)
+    {
+        assert(EqualSize(yuyv, bgr) && yuyv.format == View<A>::Yuyv16 && bgr.format == View<A>::Bgr24);
+
+        SimdYuyv422ToBgr(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Uyvy422ToBgr(const View<A>& uyvy, View<A>& bgr)
+
+        \short Converts packed UYVY 4:2:2 image to 24-bit BGR image.
+
+        The input UYVY and output BGR images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdUyvy422ToBgr.
+
+        \param [in] uyvy - an input 16-bit image with packed UYVY 4:2:2 pixels.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Uyvy422ToBgr(const View<A>& uyvy, View<A>& bgr)
+    {
+        assert(EqualSize(uyvy, bgr) && uyvy.format == View<A>::Uyvy16 && bgr.format == View<A>::Bgr24);
+
+        SimdUyvy422ToBgr(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuyv422ToBgra(const View<A>& yuyv, View<A>& bgra, uint8_t alpha = 0xFF)
+
+        \short Converts packed YUYV 4:2:2 image to 32-bit BGRA image.
+
+        The input YUYV and output BGRA images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuyv422ToBgra.
+
+        \param [in] yuyv - an input 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuyv422ToBgra(const View<A>& yuyv, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(EqualSize(yuyv, bgra) && yuyv.format == View<A>::Yuyv16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuyv422ToBgra(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Uyvy422ToBgra(const View<A>& uyvy, View<A>& bgra, uint8_t alpha = 0xFF)
+
+        \short Converts packed UYVY 4:2:2 image to 32-bit BGRA image.
+
+        The input UYVY and output BGRA images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdUyvy422ToBgra.
+
+        \param [in] uyvy - an input 16-bit image with packed UYVY 4:2:2 pixels.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Uyvy422ToBgra(const View<A>& uyvy, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(EqualSize(uyvy, bgra) && uyvy.format == View<A>::Uyvy16 && bgra.format == View<A>::Bgra32);
+
+        SimdUyvy422ToBgra(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuyv422ToGray(const View<A>& yuyv, View<A>& gray)
+
+        \short Converts packed YUYV 4:2:2 image to 8-bit gray image.
+
+        The input YUYV and output gray images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuyv422ToGray.
+
+        \param [in] yuyv - an input 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [out] gray - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuyv422ToGray(const View<A>& yuyv, View<A>& gray)
+    {
+        assert(EqualSize(yuyv, gray) && yuyv.format == View<A>::Yuyv16 && gray.format == View<A>::Gray8);
+
+        SimdYuyv422ToGray(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, gray.data, gray.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuyv422ToYuv420p(const View<A>& yuyv, View<A>& y, View<A>& u, View<A>& v)
+
+        \short Converts packed YUYV 4:2:2 image to YUV420P image.
+
+        The input YUYV and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuyv422ToYuv420p.
+
+        \param [in] yuyv - an input 16-bit image with packed YUYV 4:2:2 pixels.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuyv422ToYuv420p(const View<A>& yuyv, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(EqualSize(yuyv, y) && y.width == 2 * u.width && y.height == 2 * u.height && EqualSize(u, v));
+        assert(yuyv.format == View<A>::Yuyv16 && y.format == View<A>::Gray8 && u.format == View<A>::Gray8 && v.format == View<A>::Gray8);
+
+        SimdYuyv422ToYuv420p(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuyv422(const View<A>& bgr, View<A>& yuyv)
+
+        \short Converts 24-bit BGR image to packed YUYV 4:2:2 image.
+
+        The input BGR and output YUYV images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuyv422.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] yuyv - an output 16-bit image with packed YUYV 4:2:2 pixels.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuyv422(const View<A>& bgr, View<A>& yuyv)
+    {
+        assert(EqualSize(bgr, yuyv) && bgr.format == View<A>::Bgr24 && yuyv.format == View<A>::Yuyv16);
+
+        SimdBgrToYuyv422(bgr.data, bgr.stride, bgr.width, bgr.height, yuyv.data, yuyv.stride);
+    }
+
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToUyvy422(const View<A>& bgr, View<A>& uyvy)
+
+        \short Converts 24-bit BGR image to packed UYVY 4:2:2 image.
+
+        The input BGR and output UYVY images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToUyvy422.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] uyvy - an output 16-bit image with packed UYVY 4:2:2 pixels.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToUyvy422(const View<A>& bgr, View<A>& uyvy)
+    {
+        assert(EqualSize(bgr, uyvy) && bgr.format == View<A>::Bgr24 && uyvy.format == View<A>::Uyvy16);
+
+        SimdBgrToUyvy422(bgr.data, bgr.stride, bgr.width, bgr.height, uyvy.data, uyvy.stride);
+    }
+
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuyv422(const View<A>& bgra, View<A>& yuyv)
+
+        \short Converts 32-bit BGRA image to packed YUYV 4:2:2 image.
+
+        The input BGRA and output YUYV images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToYuyv422.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] yuyv - an output 16-bit image with packed YUYV 4:2:2 pixels.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToYuyv422(const View<A>& bgra, View<A>& yuyv)
+    {
+        assert(EqualSize(bgra, yuyv) && bgra.format == View<A>::Bgra32 && yuyv.format == View<A>::Yuyv16);
+
+        SimdBgraToYuyv422(bgra.data, bgra.stride, bgra.width, bgra.height, yuyv.data, yuyv.stride);
+    }
+
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToUyvy422(const View<A>& bgra, View<A>& uyvy)
+
+        \short Converts 32-bit BGRA image to packed UYVY 4:2:2 image.
+
+        The input BGRA and output UYVY images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToUyvy422.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] uyvy - an output 16-bit image with packed UYVY 4:2:2 pixels.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToUyvy422(const View<A>& bgra, View<A>& uyvy)
+    {
+        assert(EqualSize(bgra, uyvy) && bgra.format == View<A>::Bgra32 && uyvy.format == View<A>::Uyvy16);
+
+        SimdBgraToUyvy422(bgra.data, bgra.stride, bgra.width, bgra.height, uyvy.data, uyvy.stride);
+    }
+
     /*! @ingroup universal_conversion
 
         \fn void Convert(const View<A> & src, View<A> & dst)
@@ -4207,6 +5350,7 @@ namespace Simd
         The input and output images must have the same width and height.
 
         \note This function supports conversion between Gray8, Bgr24, Bgra32 and Rgb24 image formats.
+        Also it supports conversion of Yuyv16 and Uyvy16 images to Bgr24 and Bgra32 (and Yuyv16 to Gray8) and back.
 
         \param [in] src - an input image.
         \param [out] dst - an output image.
@@ -4250,6 +5394,12 @@ namespace Simd
             case View<A>::Rgb24:
                 BgrToRgb(src, dst);
                 break;
+            case View<A>::Yuyv16:
+                BgrToYuyv422(src, dst);
+                break;
+            case View<A>::Uyvy16:
+                BgrToUyvy422(src, dst);
+                break;
             default:
                 assert(0);
             }
@@ -4284,6 +5434,43 @@ namespace Simd
             case View<A>::Rgb24:
                 BgraToRgb(src, dst);
                 break;
+            case View<A>::Yuyv16:
+                BgraToYuyv422(src, dst);
+                break;
+            case View<A>::Uyvy16:
+                BgraToUyvy422(src, dst);
+                break;
+            default:
+                assert(0);
+            }
+            break;
+
+        case View<A>::Yuyv16:
+            switch (dst.format)
+            {
+            case View<A>::Bgr24:
+                Yuyv422ToBgr(src, dst);
+                break;
+            case View<A>::Bgra32:
+                Yuyv422ToBgra(src, dst);
+                break;
+            case View<A>::Gray8:
+                Yuyv422ToGray(src, dst);
+                break;
+            default:
+                assert(0);
+            }
+            break;
+
+        case View<A>::Uyvy16:
+            switch (dst.format)
+            {
+            case View<A>::Bgr24:
+                Uyvy422ToBgr(src, dst);
+                break;
+            case View<A>::Bgra32:
+                Uyvy422ToBgra(src, dst);
+                break;
             default:
                 assert(0);
             }
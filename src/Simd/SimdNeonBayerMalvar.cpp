@@ -0,0 +1,227 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdNeon.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        template<int part> SIMD_INLINE int16x8_t BayerPart(const uint8x8x2_t & value)
+        {
+            return vreinterpretq_s16_u16(vmovl_u8(value.val[part]));
+        }
+
+        template<int part, bool green> SIMD_INLINE void BayerMalvar(const uint8x8x2_t src[13], uint8x8_t & x, uint8x8_t & g, uint8x8_t & y)
+        {
+            int16x8_t c = BayerPart<part>(src[2]);
+            int16x8_t h1 = vaddq_s16(BayerPart<part>(src[1]), BayerPart<part>(src[3]));
+            int16x8_t h2 = vaddq_s16(BayerPart<part>(src[0]), BayerPart<part>(src[4]));
+            int16x8_t v1 = vaddq_s16(BayerPart<part>(src[6]), BayerPart<part>(src[9]));
+            int16x8_t v2 = vaddq_s16(BayerPart<part>(src[11]), BayerPart<part>(src[12]));
+            int16x8_t d = vaddq_s16(vaddq_s16(BayerPart<part>(src[5]), BayerPart<part>(src[7])),
+                vaddq_s16(BayerPart<part>(src[8]), BayerPart<part>(src[10])));
+            if (green)
+            {
+                int16x8_t c5 = vaddq_s16(vshlq_n_s16(c, 2), c);
+                int16x8_t hd = vsubq_s16(vaddq_s16(c5, vshlq_n_s16(h1, 2)), vaddq_s16(h2, d));
+                int16x8_t vd = vsubq_s16(vaddq_s16(c5, vshlq_n_s16(v1, 2)), vaddq_s16(v2, d));
+                x = vqrshrun_n_s16(vaddq_s16(vshlq_n_s16(hd, 1), v2), 4);
+                g = src[2].val[part];
+                y = vqrshrun_n_s16(vaddq_s16(vshlq_n_s16(vd, 1), h2), 4);
+            }
+            else
+            {
+                int16x8_t a2 = vaddq_s16(h2, v2);
+                int16x8_t c3d = vaddq_s16(vaddq_s16(vshlq_n_s16(c, 1), c), d);
+                x = src[2].val[part];
+                g = vqrshrun_n_s16(vshlq_n_s16(vsubq_s16(vaddq_s16(vshlq_n_s16(c, 2), vshlq_n_s16(vaddq_s16(h1, v1), 1)), a2), 1), 4);
+                y = vqrshrun_n_s16(vsubq_s16(vshlq_n_s16(c3d, 2), vaddq_s16(vshlq_n_s16(a2, 1), a2)), 4);
+            }
+        }
+
+        SIMD_INLINE uint8x16_t BayerMerge(uint8x8_t even, uint8x8_t odd)
+        {
+            uint8x8x2_t merged = vzip_u8(even, odd);
+            return vcombine_u8(merged.val[0], merged.val[1]);
+        }
+
+        template<bool greenEven, bool redRow> SIMD_INLINE void BayerToBgrMalvar(const uint8_t * src[5], size_t col, uint8x16_t bgr[3])
+        {
+            uint8x8x2_t s[13];
+            uint8x8_t x[2], g[2], y[2];
+            s[0] = vld2_u8(src[2] + col - 2);
+            s[1] = vld2_u8(src[2] + col - 1);
+            s[2] = vld2_u8(src[2] + col);
+            s[3] = vld2_u8(src[2] + col + 1);
+            s[4] = vld2_u8(src[2] + col + 2);
+            s[5] = vld2_u8(src[1] + col - 1);
+            s[6] = vld2_u8(src[1] + col);
+            s[7] = vld2_u8(src[1] + col + 1);
+            s[8] = vld2_u8(src[3] + col - 1);
+            s[9] = vld2_u8(src[3] + col);
+            s[10] = vld2_u8(src[3] + col + 1);
+            s[11] = vld2_u8(src[0] + col);
+            s[12] = vld2_u8(src[4] + col);
+            BayerMalvar<0, greenEven>(s, x[0], g[0], y[0]);
+            BayerMalvar<1, !greenEven>(s, x[1], g[1], y[1]);
+            bgr[redRow ? 2 : 0] = BayerMerge(x[0], x[1]);
+            bgr[1] = BayerMerge(g[0], g[1]);
+            bgr[redRow ? 0 : 2] = BayerMerge(y[0], y[1]);
+        }
+
+        template<bool greenEven, bool redRow> void BayerToBgrMalvar(const uint8_t * src[5], size_t width, uint8_t * bgr)
+        {
+            uint8x16x3_t _bgr;
+            size_t body = width - 2 - A;
+            for (size_t col = 2; col < body; col += A)
+            {
+                BayerToBgrMalvar<greenEven, redRow>(src, col, _bgr.val);
+                Store3<false>(bgr + 3 * col, _bgr);
+            }
+            BayerToBgrMalvar<greenEven, redRow>(src, body, _bgr.val);
+            Store3<false>(bgr + 3 * body, _bgr);
+        }
+
+        template<bool greenEven, bool redRow> void BayerToBgraMalvar(const uint8_t * src[5], size_t width, const uint8x16_t & alpha, uint8_t * bgra)
+        {
+            uint8x16x4_t _bgra;
+            _bgra.val[3] = alpha;
+            size_t body = width - 2 - A;
+            for (size_t col = 2; col < body; col += A)
+            {
+                BayerToBgrMalvar<greenEven, redRow>(src, col, _bgra.val);
+                Store4<false>(bgra + 4 * col, _bgra);
+            }
+            BayerToBgrMalvar<greenEven, redRow>(src, body, _bgra.val);
+            Store4<false>(bgra + 4 * body, _bgra);
+        }
+
+        template<size_t channels> SIMD_INLINE void BayerMalvarBorder(const uint8_t * src[5], size_t width, bool greenEven, bool redRow, uint8_t * dst, uint8_t alpha)
+        {
+            const size_t cols[4] = { 0, 1, width - 2, width - 1 };
+            for (size_t i = 0; i < 4; ++i)
+            {
+                Base::BayerToBgrMalvar(src, cols[i], width, ((cols[i] & 1) == 0) == greenEven, redRow, dst + cols[i] * channels);
+                if (channels == 4)
+                    dst[cols[i] * channels + 3] = alpha;
+            }
+        }
+
+        void BayerToBgrMalvar(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            const uint8_t * src[5];
+            bool greenEven, redRow;
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BayerMalvarRows(bayer, bayerStride, row, height, src);
+                Base::BayerMalvarPattern(bayerFormat, row, greenEven, redRow);
+                if (greenEven)
+                {
+                    if (redRow)
+                        BayerToBgrMalvar<true, true>(src, width, bgr);
+                    else
+                        BayerToBgrMalvar<true, false>(src, width, bgr);
+                }
+                else
+                {
+                    if (redRow)
+                        BayerToBgrMalvar<false, true>(src, width, bgr);
+                    else
+                        BayerToBgrMalvar<false, false>(src, width, bgr);
+                }
+                BayerMalvarBorder<3>(src, width, greenEven, redRow, bgr, 0);
+                bgr += bgrStride;
+            }
+        }
+
+        void BayerToBgraMalvar(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            const uint8_t * src[5];
+            bool greenEven, redRow;
+            uint8x16_t _alpha = vdupq_n_u8(alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BayerMalvarRows(bayer, bayerStride, row, height, src);
+                Base::BayerMalvarPattern(bayerFormat, row, greenEven, redRow);
+                if (greenEven)
+                {
+                    if (redRow)
+                        BayerToBgraMalvar<true, true>(src, width, _alpha, bgra);
+                    else
+                        BayerToBgraMalvar<true, false>(src, width, _alpha, bgra);
+                }
+                else
+                {
+                    if (redRow)
+                        BayerToBgraMalvar<false, true>(src, width, _alpha, bgra);
+                    else
+                        BayerToBgraMalvar<false, false>(src, width, _alpha, bgra);
+                }
+                BayerMalvarBorder<4>(src, width, greenEven, redRow, bgra, alpha);
+                bgra += bgraStride;
+            }
+        }
+
+        void BayerToBgrV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+            uint8_t * bgr, size_t bgrStride, SimdBayerDemosaicType demosaic)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A + 4);
+
+            switch (demosaic)
+            {
+            case SimdBayerDemosaicBilinear:
+                BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+                break;
+            case SimdBayerDemosaicMalvar:
+                BayerToBgrMalvar(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void BayerToBgraV2(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat,
+            uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBayerDemosaicType demosaic)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= A + 4);
+
+            switch (demosaic)
+            {
+            case SimdBayerDemosaicBilinear:
+                BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+                break;
+            case SimdBayerDemosaicMalvar:
+                BayerToBgraMalvar(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
@@ -51,7 +51,7 @@ namespace Simd
         {
             const uint8_t * src[3];
             uint8x8x2_t _src[12];
-            size_t body = AlignHi(width - 2, A) - A;
+            size_t body = AlignHi(width - A, A);
             for (size_t row = 0; row < height; row += 2)
             {
                 src[0] = (row == 0 ? bayer : bayer - 2 * bayerStride);
@@ -213,6 +213,65 @@ namespace Simd
             else
                 BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
+
+        template <bool align, bool uyvy> SIMD_INLINE void BgrToYuyv422(const uint8_t * bgr, uint8_t * yuyv)
+        {
+            uint8x16_t y[2];
+
+            uint8x16x3_t bgr0 = Load3<align>(bgr);
+            y[0] = BgrToY(bgr0.val[0], bgr0.val[1], bgr0.val[2]);
+
+            uint16x8_t b0 = Average(bgr0.val[0]);
+            uint16x8_t g0 = Average(bgr0.val[1]);
+            uint16x8_t r0 = Average(bgr0.val[2]);
+
+            uint8x16x3_t bgr1 = Load3<align>(bgr + A3);
+            y[1] = BgrToY(bgr1.val[0], bgr1.val[1], bgr1.val[2]);
+
+            uint16x8_t b1 = Average(bgr1.val[0]);
+            uint16x8_t g1 = Average(bgr1.val[1]);
+            uint16x8_t r1 = Average(bgr1.val[2]);
+
+            StoreYuyv<align, uyvy>(yuyv, y, PackSaturatedI16(BgrToU(b0, g0, r0), BgrToU(b1, g1, r1)), PackSaturatedI16(BgrToV(b0, g0, r0), BgrToV(b1, g1, r1)));
+        }
+
+        template <bool align, bool uyvy> void BgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            assert((width % 2 == 0) && (width >= DA));
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(yuyv) && Aligned(yuyvStride));
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                    BgrToYuyv422<align, uyvy>(bgr + 3 * col, yuyv + 2 * col);
+                if (tail)
+                {
+                    size_t col = width - DA;
+                    BgrToYuyv422<false, uyvy>(bgr + 3 * col, yuyv + 2 * col);
+                }
+                bgr += bgrStride;
+                yuyv += yuyvStride;
+            }
+        }
+
+        void BgrToYuyv422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(yuyv) && Aligned(yuyvStride))
+                BgrToYuyv422<true, false>(bgr, bgrStride, width, height, yuyv, yuyvStride);
+            else
+                BgrToYuyv422<false, false>(bgr, bgrStride, width, height, yuyv, yuyvStride);
+        }
+
+        void BgrToUyvy422(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(uyvy) && Aligned(uyvyStride))
+                BgrToYuyv422<true, true>(bgr, bgrStride, width, height, uyvy, uyvyStride);
+            else
+                BgrToYuyv422<false, true>(bgr, bgrStride, width, height, uyvy, uyvyStride);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -284,6 +284,65 @@ namespace Simd
             else
                 BgraToYuva420p<false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
         }
+
+        template <bool align, bool uyvy> SIMD_INLINE void BgraToYuyv422(const uint8_t * bgra, uint8_t * yuyv)
+        {
+            uint8x16_t y[2];
+
+            uint8x16x4_t bgra0 = Load4<align>(bgra);
+            y[0] = BgrToY(bgra0.val[0], bgra0.val[1], bgra0.val[2]);
+
+            uint16x8_t b0 = Average(bgra0.val[0]);
+            uint16x8_t g0 = Average(bgra0.val[1]);
+            uint16x8_t r0 = Average(bgra0.val[2]);
+
+            uint8x16x4_t bgra1 = Load4<align>(bgra + QA);
+            y[1] = BgrToY(bgra1.val[0], bgra1.val[1], bgra1.val[2]);
+
+            uint16x8_t b1 = Average(bgra1.val[0]);
+            uint16x8_t g1 = Average(bgra1.val[1]);
+            uint16x8_t r1 = Average(bgra1.val[2]);
+
+            StoreYuyv<align, uyvy>(yuyv, y, PackSaturatedI16(BgrToU(b0, g0, r0), BgrToU(b1, g1, r1)), PackSaturatedI16(BgrToV(b0, g0, r0), BgrToV(b1, g1, r1)));
+        }
+
+        template <bool align, bool uyvy> void BgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            assert((width % 2 == 0) && (width >= DA));
+            if (align)
+                assert(Aligned(bgra) && Aligned(bgraStride) && Aligned(yuyv) && Aligned(yuyvStride));
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                    BgraToYuyv422<align, uyvy>(bgra + 4 * col, yuyv + 2 * col);
+                if (tail)
+                {
+                    size_t col = width - DA;
+                    BgraToYuyv422<false, uyvy>(bgra + 4 * col, yuyv + 2 * col);
+                }
+                bgra += bgraStride;
+                yuyv += yuyvStride;
+            }
+        }
+
+        void BgraToYuyv422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride)
+        {
+            if (Aligned(bgra) && Aligned(bgraStride) && Aligned(yuyv) && Aligned(yuyvStride))
+                BgraToYuyv422<true, false>(bgra, bgraStride, width, height, yuyv, yuyvStride);
+            else
+                BgraToYuyv422<false, false>(bgra, bgraStride, width, height, yuyv, yuyvStride);
+        }
+
+        void BgraToUyvy422(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * uyvy, size_t uyvyStride)
+        {
+            if (Aligned(bgra) && Aligned(bgraStride) && Aligned(uyvy) && Aligned(uyvyStride))
+                BgraToYuyv422<true, true>(bgra, bgraStride, width, height, uyvy, uyvyStride);
+            else
+                BgraToYuyv422<false, true>(bgra, bgraStride, width, height, uyvy, uyvyStride);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
 
 namespace Simd
 {
@@ -167,6 +168,92 @@ namespace Simd
             else
                 DeinterleaveBgra<false>(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
         }
+
+        template <bool align> SIMD_INLINE void Yuyv422ToGray(const uint8_t * yuyv, uint8_t * gray)
+        {
+            Store<align>(gray, Load2<align>(yuyv).val[0]);
+        }
+
+        template <bool align> void Yuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(gray) && Aligned(grayStride));
+
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < bodyWidth; col += A)
+                    Yuyv422ToGray<align>(yuyv + 2 * col, gray + col);
+                if (tail)
+                {
+                    size_t col = width - A;
+                    Yuyv422ToGray<false>(yuyv + 2 * col, gray + col);
+                }
+                yuyv += yuyvStride;
+                gray += grayStride;
+            }
+        }
+
+        void Yuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(gray) && Aligned(grayStride))
+                Yuyv422ToGray<true>(yuyv, yuyvStride, width, height, gray, grayStride);
+            else
+                Yuyv422ToGray<false>(yuyv, yuyvStride, width, height, gray, grayStride);
+        }
+
+        template <bool align> SIMD_INLINE void Yuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, uint8_t * y, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            uint8x16_t y0[2], u0, v0, y1[2], u1, v1;
+            LoadYuyv<align, false>(yuyv, y0, u0, v0);
+            LoadYuyv<align, false>(yuyv + yuyvStride, y1, u1, v1);
+            Store<align>(y + 0, y0[0]);
+            Store<align>(y + A, y0[1]);
+            Store<align>(y + yStride + 0, y1[0]);
+            Store<align>(y + yStride + A, y1[1]);
+            Store<align>(u, vrhaddq_u8(u0, u1));
+            Store<align>(v, vrhaddq_u8(v0, v1));
+        }
+
+        template <bool align> void Yuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(y) && Aligned(yStride));
+                assert(Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colUV = 0; colY < bodyWidth; colY += DA, colUV += A)
+                    Yuyv422ToYuv420p<align>(yuyv + 2 * colY, yuyvStride, y + colY, yStride, u + colUV, v + colUV);
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    Yuyv422ToYuv420p<false>(yuyv + 2 * offset, yuyvStride, y + offset, yStride, u + offset / 2, v + offset / 2);
+                }
+                yuyv += 2 * yuyvStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void Yuyv422ToYuv420p(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(y) && Aligned(yStride)
+                && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride))
+                Yuyv422ToYuv420p<true>(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+            else
+                Yuyv422ToYuv420p<false>(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
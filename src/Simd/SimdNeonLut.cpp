@@ -0,0 +1,138 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdNeon.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+#if defined(SIMD_ARM64_ENABLE)
+        const size_t LUT8U_STEP = 64;
+        typedef uint8x16x4_t Lut8uPart;
+
+        SIMD_INLINE void LoadLut8u(const uint8_t * table, Lut8uPart & part)
+        {
+            for (size_t i = 0; i < 4; ++i)
+                part.val[i] = vld1q_u8(table + i * A);
+        }
+
+        SIMD_INLINE uint8x16_t Lut8u(uint8x16_t src, const Lut8uPart * table)
+        {
+            uint8x16_t dst = vqtbl4q_u8(table[0], src);
+            for (size_t i = 1; i < LUT8U_SIZE / LUT8U_STEP; ++i)
+            {
+                src = vsubq_u8(src, vdupq_n_u8(LUT8U_STEP));
+                dst = vqtbx4q_u8(dst, table[i], src);
+            }
+            return dst;
+        }
+#else
+        const size_t LUT8U_STEP = 32;
+        typedef uint8x8x4_t Lut8uPart;
+
+        SIMD_INLINE void LoadLut8u(const uint8_t * table, Lut8uPart & part)
+        {
+            for (size_t i = 0; i < 4; ++i)
+                part.val[i] = vld1_u8(table + i * HA);
+        }
+
+        SIMD_INLINE uint8x8_t Lut8u(uint8x8_t src, const Lut8uPart * table)
+        {
+            uint8x8_t dst = vtbl4_u8(table[0], src);
+            for (size_t i = 1; i < LUT8U_SIZE / LUT8U_STEP; ++i)
+            {
+                src = vsub_u8(src, vdup_n_u8(LUT8U_STEP));
+                dst = vtbx4_u8(dst, table[i], src);
+            }
+            return dst;
+        }
+
+        SIMD_INLINE uint8x16_t Lut8u(uint8x16_t src, const Lut8uPart * table)
+        {
+            return vcombine_u8(Lut8u(vget_low_u8(src), table), Lut8u(vget_high_u8(src), table));
+        }
+#endif
+        const size_t LUT8U_PARTS = LUT8U_SIZE / LUT8U_STEP;
+
+        template<size_t channels> SIMD_INLINE void Lut8u(const uint8_t * src, const Lut8uPart * table, uint8_t * dst);
+
+        template<> SIMD_INLINE void Lut8u<1>(const uint8_t * src, const Lut8uPart * table, uint8_t * dst)
+        {
+            Store<false>(dst, Lut8u(Load<false>(src), table));
+        }
+
+        template<> SIMD_INLINE void Lut8u<3>(const uint8_t * src, const Lut8uPart * table, uint8_t * dst)
+        {
+            uint8x16x3_t value = Load3<false>(src);
+            for (size_t c = 0; c < 3; ++c)
+                value.val[c] = Lut8u(value.val[c], table + c * LUT8U_PARTS);
+            Store3<false>(dst, value);
+        }
+
+        template<> SIMD_INLINE void Lut8u<4>(const uint8_t * src, const Lut8uPart * table, uint8_t * dst)
+        {
+            uint8x16x4_t value = Load4<false>(src);
+            for (size_t c = 0; c < 4; ++c)
+                value.val[c] = Lut8u(value.val[c], table + c * LUT8U_PARTS);
+            Store4<false>(dst, value);
+        }
+
+        template<size_t channels> void Lut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * table, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A);
+
+            Lut8uPart _table[channels * LUT8U_PARTS];
+            for (size_t i = 0; i < channels * LUT8U_PARTS; ++i)
+                LoadLut8u(table + i * LUT8U_STEP, _table[i]);
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Lut8u<channels>(src + col * channels, _table, dst + col * channels);
+                if (widthA < width)
+                    Base::Lut8u(src + widthA * channels, srcStride, width - widthA, 1, channels, table, dst + widthA * channels, dstStride);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void Lut8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, const uint8_t * table, uint8_t * dst, size_t dstStride)
+        {
+            switch (channels)
+            {
+            case 1: Lut8u<1>(src, srcStride, width, height, table, dst, dstStride); break;
+            case 3: Lut8u<3>(src, srcStride, width, height, table, dst, dstStride); break;
+            case 4: Lut8u<4>(src, srcStride, width, height, table, dst, dstStride); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
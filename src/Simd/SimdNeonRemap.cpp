@@ -0,0 +1,270 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdRemap.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE int32x4_t RemapOffset(int32x4_t mapX, int32x4_t mapY, int32x4_t pixelSize, int32x4_t srcStride)
+        {
+            int32x4_t ix = vshrq_n_s32(mapX, WARP_SHIFT), iy = vshrq_n_s32(mapY, WARP_SHIFT);
+            return vmlaq_s32(vmulq_s32(ix, pixelSize), iy, srcStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        RemapNearest::RemapNearest(const WarpParam & param)
+            : Base::RemapNearest(param)
+        {
+        }
+
+        void RemapNearest::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t pixelSize = _param.PixelSize(), x = beg, end4 = beg + AlignLoAny(end - beg, 4);
+            const int32_t * mapX = _mapX.data + y * _param.dstW, * mapY = _mapY.data + y * _param.dstW;
+            int32x4_t _pixelSize = vdupq_n_s32((int)pixelSize), _srcStride = vdupq_n_s32((int)srcStride);
+            SIMD_ALIGNED(16) int32_t offs[4];
+            for (; x < end4; x += 4)
+            {
+                Store<true>(offs, RemapOffset(Load<false>(mapX + x), Load<false>(mapY + x), _pixelSize, _srcStride));
+                for (size_t i = 0; i < 4; ++i)
+                    Base::WarpCopyPixel(src + offs[i], pixelSize, dst + (x + i) * pixelSize);
+            }
+            Base::RemapNearest::RunInterior(src, srcStride, y, x, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        RemapByteBilinear::RemapByteBilinear(const WarpParam & param)
+            : Base::RemapByteBilinear(param)
+        {
+        }
+
+        template<int N> SIMD_INLINE uint32_t LoadPixel(const uint8_t * src)
+        {
+            switch (N)
+            {
+            case 2: return *(uint16_t*)src;
+            case 3: return *(uint16_t*)src | (src[2] << 16);
+            case 4: return *(uint32_t*)src;
+            }
+            return 0;
+        }
+
+        template<int N> SIMD_INLINE void StorePixel(uint32_t pixel, uint8_t * dst)
+        {
+            switch (N)
+            {
+            case 2: *(uint16_t*)dst = (uint16_t)pixel; break;
+            case 3: *(uint16_t*)dst = (uint16_t)pixel; dst[2] = (uint8_t)(pixel >> 16); break;
+            case 4: *(uint32_t*)dst = pixel; break;
+            }
+        }
+
+        template<int N> SIMD_INLINE uint16x4_t LoadPixel16(const uint8_t * src)
+        {
+            return vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(LoadPixel<N>(src)))));
+        }
+
+        template<int N> SIMD_INLINE void ByteBilinearPixel(const uint8_t * p0, size_t srcStride, const int32_t * w, uint8_t * dst)
+        {
+            const uint8_t * p1 = p0 + srcStride;
+            uint32x4_t sum = vmull_n_u16(LoadPixel16<N>(p0), (uint16_t)w[0]);
+            sum = vmlal_n_u16(sum, LoadPixel16<N>(p0 + N), (uint16_t)w[1]);
+            sum = vmlal_n_u16(sum, LoadPixel16<N>(p1), (uint16_t)w[2]);
+            sum = vmlal_n_u16(sum, LoadPixel16<N>(p1 + N), (uint16_t)w[3]);
+            sum = vshrq_n_u32(vaddq_u32(sum, vdupq_n_u32(WARP_ROUND)), 2 * WARP_SHIFT);
+            uint16x4_t sum16 = vmovn_u32(sum);
+            StorePixel<N>(vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(sum16, sum16))), 0), dst);
+        }
+
+        template<int N> void ByteBilinearInterior(const uint8_t * src, size_t srcStride, const int32_t * mapX, const int32_t * mapY, size_t & x, size_t end, uint8_t * dst)
+        {
+            size_t end4 = x + AlignLoAny(end - x, 4);
+            int32x4_t _pixelSize = vdupq_n_s32(N), _srcStride = vdupq_n_s32((int)srcStride);
+            int32x4_t _mask = vdupq_n_s32(WARP_MASK), _range = vdupq_n_s32(WARP_RANGE);
+            SIMD_ALIGNED(16) int32_t offs[4], w[4][4];
+            for (; x < end4; x += 4)
+            {
+                int32x4_t _mapX = Load<false>(mapX + x), _mapY = Load<false>(mapY + x);
+                int32x4_t fx = vandq_s32(_mapX, _mask), gx = vsubq_s32(_range, fx);
+                int32x4_t fy = vandq_s32(_mapY, _mask), gy = vsubq_s32(_range, fy);
+                int32x4_t w00 = vmulq_s32(gx, gy), w01 = vmulq_s32(fx, gy), w10 = vmulq_s32(gx, fy), w11 = vmulq_s32(fx, fy);
+                Store<true>(offs, RemapOffset(_mapX, _mapY, _pixelSize, _srcStride));
+                if (N == 1)
+                {
+                    const uint8_t * src1 = src + srcStride;
+                    SIMD_ALIGNED(16) int32_t p[4][4];
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        p[0][i] = src[offs[i] + 0];
+                        p[1][i] = src[offs[i] + 1];
+                        p[2][i] = src1[offs[i] + 0];
+                        p[3][i] = src1[offs[i] + 1];
+                    }
+                    int32x4_t sum = vmulq_s32(Load<true>(p[0]), w00);
+                    sum = vmlaq_s32(sum, Load<true>(p[1]), w01);
+                    sum = vmlaq_s32(sum, Load<true>(p[2]), w10);
+                    sum = vmlaq_s32(sum, Load<true>(p[3]), w11);
+                    sum = vshrq_n_s32(vaddq_s32(sum, vdupq_n_s32(WARP_ROUND)), 2 * WARP_SHIFT);
+                    uint16x4_t sum16 = vqmovun_s32(sum);
+                    vst1_lane_u32((uint32_t*)(dst + x), vreinterpret_u32_u8(vqmovn_u16(vcombine_u16(sum16, sum16))), 0);
+                }
+                else
+                {
+                    Store<true>(w[0], w00);
+                    Store<true>(w[1], w01);
+                    Store<true>(w[2], w10);
+                    Store<true>(w[3], w11);
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        const int32_t wi[4] = { w[0][i], w[1][i], w[2][i], w[3][i] };
+                        ByteBilinearPixel<N>(src + offs[i], srcStride, wi, dst + (x + i) * N);
+                    }
+                }
+            }
+        }
+
+        void RemapByteBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t x = beg;
+            const int32_t * mapX = _mapX.data + y * _param.dstW, * mapY = _mapY.data + y * _param.dstW;
+            switch (_param.channels)
+            {
+            case 1: ByteBilinearInterior<1>(src, srcStride, mapX, mapY, x, end, dst); break;
+            case 2: ByteBilinearInterior<2>(src, srcStride, mapX, mapY, x, end, dst); break;
+            case 3: ByteBilinearInterior<3>(src, srcStride, mapX, mapY, x, end, dst); break;
+            case 4: ByteBilinearInterior<4>(src, srcStride, mapX, mapY, x, end, dst); break;
+            }
+            Base::RemapByteBilinear::RunInterior(src, srcStride, y, x, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        RemapFloatBilinear::RemapFloatBilinear(const WarpParam & param)
+            : Base::RemapFloatBilinear(param)
+        {
+        }
+
+        SIMD_INLINE float32x4_t FloatBilinearFraction(int32x4_t map)
+        {
+            return vmulq_f32(vcvtq_f32_s32(vandq_s32(map, vdupq_n_s32(WARP_MASK))), vdupq_n_f32(1.0f / WARP_RANGE));
+        }
+
+        SIMD_INLINE float32x4_t FloatBilinearInterp(float32x4_t p00, float32x4_t p01, float32x4_t p10, float32x4_t p11, float32x4_t fx, float32x4_t fy)
+        {
+            float32x4_t gx = vsubq_f32(vdupq_n_f32(1.0f), fx), gy = vsubq_f32(vdupq_n_f32(1.0f), fy);
+            float32x4_t r0 = vmlaq_f32(vmulq_f32(p00, gx), p01, fx);
+            float32x4_t r1 = vmlaq_f32(vmulq_f32(p10, gx), p11, fx);
+            return vmlaq_f32(vmulq_f32(r0, gy), r1, fy);
+        }
+
+        void RemapFloatBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels, stride = srcStride / sizeof(float), x = beg;
+            if (cn == 1 || cn == 4)
+            {
+                size_t end4 = beg + AlignLoAny(end - beg, 4);
+                const int32_t * mapX = _mapX.data + y * _param.dstW, * mapY = _mapY.data + y * _param.dstW;
+                const float * ps = (float*)src;
+                float * pd = (float*)dst;
+                int32x4_t _cn = vdupq_n_s32((int)cn), _stride = vdupq_n_s32((int)stride);
+                SIMD_ALIGNED(16) int32_t offs[4];
+                SIMD_ALIGNED(16) float fx[4], fy[4];
+                for (; x < end4; x += 4)
+                {
+                    int32x4_t _mapX = Load<false>(mapX + x), _mapY = Load<false>(mapY + x);
+                    float32x4_t _fx = FloatBilinearFraction(_mapX), _fy = FloatBilinearFraction(_mapY);
+                    Store<true>(offs, RemapOffset(_mapX, _mapY, _cn, _stride));
+                    if (cn == 1)
+                    {
+                        const float * p0 = ps, * p1 = ps + stride;
+                        SIMD_ALIGNED(16) float p[4][4];
+                        for (size_t i = 0; i < 4; ++i)
+                        {
+                            p[0][i] = p0[offs[i] + 0];
+                            p[1][i] = p0[offs[i] + 1];
+                            p[2][i] = p1[offs[i] + 0];
+                            p[3][i] = p1[offs[i] + 1];
+                        }
+                        Store<false>(pd + x, FloatBilinearInterp(Load<true>(p[0]), Load<true>(p[1]), Load<true>(p[2]), Load<true>(p[3]), _fx, _fy));
+                    }
+                    else
+                    {
+                        Store<true>(fx, _fx);
+                        Store<true>(fy, _fy);
+                        for (size_t i = 0; i < 4; ++i)
+                        {
+                            const float * p0 = ps + offs[i], * p1 = p0 + stride;
+                            Store<false>(pd + (x + i) * 4, FloatBilinearInterp(Load<false>(p0), Load<false>(p0 + 4),
+                                Load<false>(p1), Load<false>(p1 + 4), vdupq_n_f32(fx[i]), vdupq_n_f32(fy[i])));
+                        }
+                    }
+                }
+            }
+            Base::RemapFloatBilinear::RunInterior(src, srcStride, y, x, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE Remap * CreateRemap(const WarpParam & param)
+        {
+            if (param.IsNearest())
+                return new RemapNearest(param);
+            else if (param.IsByte())
+                return new RemapByteBilinear(param);
+            else
+                return new RemapFloatBilinear(param);
+        }
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, flags, border);
+            if (!param.Valid() || map == NULL)
+                return NULL;
+            Remap * remap = CreateRemap(param);
+            remap->SetMap(map, mapStride);
+            return remap;
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, flags, border);
+            if (!param.Valid())
+                return NULL;
+            Remap * remap = CreateRemap(param);
+            if (!remap->SetPerspective(mat))
+            {
+                delete remap;
+                return NULL;
+            }
+            return remap;
+        }
+    }
+#endif //SIMD_NEON_ENABLE
+}
@@ -25,6 +25,7 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdUpdate.h"
+#include "Simd/SimdExtract.h"
 
 namespace Simd
 {
@@ -46,7 +47,7 @@ namespace Simd
         {
             if (_ax.data)
                 return;
-            if (_param.channels == 1 && _param.srcW < 4 * _param.dstW)
+            if (_param.channels == 1 && _param.srcW < 4 * _param.dstW && _param.srcW >= A)
                 _blocks = BlockCountMax(A);
             float scale = (float)_param.srcW / _param.dstW;
             _ax.Resize(_param.dstW * _param.channels * 2, false, _param.align);
@@ -212,7 +213,7 @@ namespace Simd
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = vdupq_n_u16(int16_t(_ay[yDst]));
@@ -292,7 +293,7 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = vdupq_n_u16(int16_t(_ay[yDst]));
@@ -449,7 +450,11 @@ namespace Simd
                 src += N, sum = vmlaq_s32(sum, Load<false>(src), vdupq_n_s32(zero));
             sum = vmlaq_s32(sum, Load<false>(src), vdupq_n_s32(-next));
             int32x4_t res = vshrq_n_s32(vaddq_s32(sum, vdupq_n_s32(Base::AREA_ROUND)), Base::AREA_SHIFT);
-            *(uint32_t*)dst = vget_lane_u32((uint32x2_t)vqmovn_u16(vcombine_u16(vqmovun_s32(res), vdup_n_u16(0))), 0);
+            uint32_t val = vget_lane_u32((uint32x2_t)vqmovn_u16(vcombine_u16(vqmovun_s32(res), vdup_n_u16(0))), 0);
+            if (N == 4)
+                *(uint32_t*)dst = val;
+            else
+                *(uint16_t*)dst = uint16_t(val), dst[2] = uint8_t(val >> 16);
         }
 
         template<> SIMD_INLINE void ResizerByteAreaResult<4>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint8_t * dst)
@@ -467,7 +472,8 @@ namespace Simd
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW * N;
             const int32_t * iy = _iy.data, *ix = _ix.data, *ay = _ay.data, *ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[_yBeg] * srcStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += rowRest)
             {
                 int32_t * buf = _by.data;
                 size_t yn = iy[dy + 1] - iy[dy];
@@ -507,7 +513,7 @@ namespace Simd
             float * pbx[2] = { _bx[0].data, _bx[1].data };
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, F);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -575,6 +581,335 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        //---------------------------------------------------------------------
+
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Base::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowV(const uint8_t * src, size_t stride, const int16_t * ay, size_t ky, int16_t * dst)
+        {
+            int32x4_t sum0 = vdupq_n_s32(0), sum1 = vdupq_n_s32(0);
+            for (size_t k = 0; k < ky; ++k, src += stride)
+            {
+                int16x8_t s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src)));
+                sum0 = vmlal_n_s16(sum0, vget_low_s16(s), ay[k]);
+                sum1 = vmlal_n_s16(sum1, vget_high_s16(s), ay[k]);
+            }
+            sum0 = vrshrq_n_s32(sum0, Base::FILTER_ROW_SHIFT);
+            sum1 = vrshrq_n_s32(sum1, Base::FILTER_ROW_SHIFT);
+            vst1q_s16(dst, vcombine_s16(vmovn_s32(sum0), vmovn_s32(sum1)));
+        }
+
+        SIMD_INLINE int32x4_t ResizerByteFilterSumH(const int16_t * src, const int16_t * ax, size_t kx)
+        {
+            int32x4_t sum = vdupq_n_s32(0);
+            for (size_t k = 0; k < kx; k += HA)
+            {
+                int16x8_t s = vld1q_s16(src + k);
+                int16x8_t a = vld1q_s16(ax + k);
+                sum = vmlal_s16(sum, vget_low_s16(s), vget_low_s16(a));
+                sum = vmlal_s16(sum, vget_high_s16(s), vget_high_s16(a));
+            }
+            return sum;
+        }
+
+        SIMD_INLINE int32x2_t PairSum(const int32x4_t & a)
+        {
+            return vpadd_s32(vget_low_s32(a), vget_high_s32(a));
+        }
+
+        void ResizerByteFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t rs = _param.srcW * _param.channels, rd = _param.dstW * _param.channels;
+            if (rs < HA)
+            {
+                Base::ResizerByteFilter::Run(src, srcStride, dst, dstStride);
+                return;
+            }
+            size_t rsHA = AlignLo(rs, HA), rd4 = AlignLo(rd, 4), kx = _kx;
+            int16_t * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const uint8_t * ps = src + _iy[dy] * srcStride;
+                const int16_t * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rsHA; sx += HA)
+                    ResizerByteFilterRowV(ps + sx, srcStride, ay, _ky, bx + sx);
+                if (rsHA < rs)
+                    ResizerByteFilterRowV(ps + rs - HA, srcStride, ay, _ky, bx + rs - HA);
+                size_t dx = 0;
+                for (; dx < rd4; dx += 4)
+                {
+                    const int16_t * ax = _ax.data + dx * kx;
+                    int32x4_t s0 = ResizerByteFilterSumH(bx + _ix[dx + 0], ax + 0 * kx, kx);
+                    int32x4_t s1 = ResizerByteFilterSumH(bx + _ix[dx + 1], ax + 1 * kx, kx);
+                    int32x4_t s2 = ResizerByteFilterSumH(bx + _ix[dx + 2], ax + 2 * kx, kx);
+                    int32x4_t s3 = ResizerByteFilterSumH(bx + _ix[dx + 3], ax + 3 * kx, kx);
+                    int32x4_t s01 = vcombine_s32(PairSum(s0), PairSum(s1));
+                    int32x4_t s23 = vcombine_s32(PairSum(s2), PairSum(s3));
+                    int16x4_t sum = vqmovn_s32(vrshrq_n_s32(vcombine_s32(PairSum(s01), PairSum(s23)), Base::FILTER_SHIFT));
+                    uint8x8_t res = vqmovun_s16(vcombine_s16(sum, sum));
+                    vst1_lane_u32((uint32_t*)(dst + dx), vreinterpret_u32_u8(res), 0);
+                }
+                for (; dx < rd; ++dx)
+                {
+                    const int16_t * pb = bx + _ix[dx];
+                    const int16_t * ax = _ax.data + dx * kx;
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < kx; ++k)
+                        sum += pb[k] * ax[k];
+                    dst[dx] = Base::RestrictRange((sum + Base::FILTER_ROUND) >> Base::FILTER_SHIFT, 0, 255);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Base::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowV(const float * src, size_t stride, const float * ay, size_t ky, float * dst)
+        {
+            float32x4_t sum = vdupq_n_f32(0.0f);
+            for (size_t k = 0; k < ky; ++k, src += stride)
+                sum = vmlaq_f32(sum, Load<false>(src), vdupq_n_f32(ay[k]));
+            Store<false>(dst, sum);
+        }
+
+        SIMD_INLINE float32x4_t ResizerFloatFilterSumH(const float * src, const float * ax, size_t kx)
+        {
+            float32x4_t sum = vdupq_n_f32(0.0f);
+            for (size_t k = 0; k < kx; k += F)
+                sum = vmlaq_f32(sum, Load<false>(src + k), Load<false>(ax + k));
+            return sum;
+        }
+
+        void ResizerFloatFilter::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            size_t rs = _param.srcW * _param.channels, rd = _param.dstW * _param.channels;
+            if (rs < F)
+            {
+                Base::ResizerFloatFilter::Run(src, srcStride, dst, dstStride);
+                return;
+            }
+            size_t rsF = AlignLo(rs, F), rdF = AlignLo(rd, F), kx = _kx;
+            float * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const float * ps = src + _iy[dy] * srcStride;
+                const float * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rsF; sx += F)
+                    ResizerFloatFilterRowV(ps + sx, srcStride, ay, _ky, bx + sx);
+                if (rsF < rs)
+                    ResizerFloatFilterRowV(ps + rs - F, srcStride, ay, _ky, bx + rs - F);
+                size_t dx = 0;
+                for (; dx < rdF; dx += F)
+                {
+                    const float * ax = _ax.data + dx * kx;
+                    float32x4_t s0 = ResizerFloatFilterSumH(bx + _ix[dx + 0], ax + 0 * kx, kx);
+                    float32x4_t s1 = ResizerFloatFilterSumH(bx + _ix[dx + 1], ax + 1 * kx, kx);
+                    float32x4_t s2 = ResizerFloatFilterSumH(bx + _ix[dx + 2], ax + 2 * kx, kx);
+                    float32x4_t s3 = ResizerFloatFilterSumH(bx + _ix[dx + 3], ax + 3 * kx, kx);
+                    Store<false>(dst + dx, Extract4Sums(s0, s1, s2, s3));
+                }
+                for (; dx < rd; ++dx)
+                {
+                    const float * pb = bx + _ix[dx];
+                    const float * ax = _ax.data + dx * kx;
+                    float sum = 0.0f;
+                    for (size_t k = 0; k < kx; ++k)
+                        sum += pb[k] * ax[k];
+                    dst[dx] = sum;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Base::ResizerShortBilinear(param)
+        {
+        }
+
+        SIMD_INLINE int32x4_t ResizerShortBilinearRow(const uint16_t * src, const int32_t * ix, size_t cn, const int32_t * ax)
+        {
+            int32_t s0[4], s1[4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                s0[i] = src[ix[i]];
+                s1[i] = src[ix[i] + cn];
+            }
+            int32x4_t _s0 = Load<false>(s0);
+            int32x4_t d = vshrq_n_s32(vaddq_s32(vmulq_s32(vsubq_s32(Load<false>(s1), _s0), Load<false>(ax)), vdupq_n_s32(Base::SHORT_LINEAR_ROW_ROUND)), Base::SHORT_LINEAR_ROW_SHIFT);
+            return vaddq_s32(vshlq_n_s32(_s0, Base::SHORT_LINEAR_BITS), d);
+        }
+
+        SIMD_INLINE uint16x4_t ResizerShortBilinearCol(const int32_t * r0, const int32_t * r1, int32x4_t a)
+        {
+            int32x4_t s0 = Load<false>(r0);
+            int32x4_t d = vshrq_n_s32(vaddq_s32(vmulq_s32(vsubq_s32(Load<false>(r1), s0), a), vdupq_n_s32(Base::SHORT_LINEAR_COL_ROUND)), Base::SHORT_LINEAR_SHIFT);
+            return vqmovun_s32(vshrq_n_s32(vaddq_s32(vaddq_s32(s0, d), vdupq_n_s32(Base::SHORT_LINEAR_ROUND)), Base::SHORT_LINEAR_BITS));
+        }
+
+        void ResizerShortBilinear::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            size_t rs4 = AlignLo(rs, 4), rs8 = AlignLo(rs, 8);
+            int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    int32_t * pb = pbx[k];
+                    const uint16_t * ps = src + (sy + k) * srcStride;
+                    const int32_t * ix = _ix.data;
+                    size_t dx = 0;
+                    for (; dx < rs4; dx += 4)
+                        Store<false>(pb + dx, ResizerShortBilinearRow(ps, ix + dx, cn, _ax.data + dx));
+                    for (; dx < rs; dx++)
+                        pb[dx] = Base::ResizerShortBilinearRow(ps[ix[dx]], ps[ix[dx] + cn], _ax[dx]);
+                }
+
+                int32x4_t fy = vdupq_n_s32(_ay[dy]);
+                size_t dx = 0;
+                for (; dx < rs8; dx += 8)
+                {
+                    uint16x4_t d0 = ResizerShortBilinearCol(pbx[0] + dx + 0, pbx[1] + dx + 0, fy);
+                    uint16x4_t d1 = ResizerShortBilinearCol(pbx[0] + dx + 4, pbx[1] + dx + 4, fy);
+                    vst1q_u16(dst + dx, vcombine_u16(d0, d1));
+                }
+                for (; dx < rs4; dx += 4)
+                    vst1_u16(dst + dx, ResizerShortBilinearCol(pbx[0] + dx, pbx[1] + dx, fy));
+                for (; dx < rs; dx++)
+                    dst[dx] = (uint16_t)Base::ResizerShortBilinearCol(pbx[0][dx], pbx[1][dx], _ay[dy]);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Base::ResizerShortArea(param)
+        {
+        }
+
+        template<UpdateType update> SIMD_INLINE void ResizerShortAreaRowUpdate(const uint16_t * src, size_t size, size_t size8, int32_t a, int32_t * dst)
+        {
+            int32x4_t _a = vdupq_n_s32(a);
+            size_t i = 0;
+            for (; i < size8; i += 8)
+            {
+                uint16x8_t s = vld1q_u16(src + i);
+                Update<update, false>(dst + i + 0, vmulq_s32((int32x4_t)vmovl_u16(vget_low_u16(s)), _a));
+                Update<update, false>(dst + i + 4, vmulq_s32((int32x4_t)vmovl_u16(vget_high_u16(s)), _a));
+            }
+            for (; i < size; ++i)
+                dst[i] = (update == UpdateAdd ? dst[i] : 0) + src[i] * a;
+        }
+
+        SIMD_INLINE void ResizerShortAreaRowSum(const uint16_t * src, size_t stride, size_t count, size_t size, int32_t curr, int32_t zero, int32_t next, int32_t * dst)
+        {
+            size_t size8 = AlignLo(size, 8);
+            ResizerShortAreaRowUpdate<UpdateSet>(src, size, size8, curr, dst);
+            for (size_t i = 0; i < count; ++i)
+                src += stride, ResizerShortAreaRowUpdate<UpdateAdd>(src, size, size8, zero, dst);
+            ResizerShortAreaRowUpdate<UpdateAdd>(src, size, size8, -next, dst);
+            int32x4_t round = vdupq_n_s32(Base::SHORT_AREA_ROW_ROUND);
+            size_t size4 = AlignLo(size, 4), i = 0;
+            for (; i < size4; i += 4)
+                Store<false>(dst + i, vshrq_n_s32(vaddq_s32(Load<false>(dst + i), round), Base::SHORT_AREA_ROW_SHIFT));
+            for (; i < size; ++i)
+                dst[i] = (dst[i] + Base::SHORT_AREA_ROW_ROUND) >> Base::SHORT_AREA_ROW_SHIFT;
+        }
+
+        template<size_t N> SIMD_INLINE void ResizerShortAreaResult(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            int32_t sum[N];
+            for (size_t c = 0; c < N; ++c)
+                sum[c] = src[c] * curr;
+            for (size_t i = 0; i < count; ++i)
+            {
+                src += N;
+                for (size_t c = 0; c < N; ++c)
+                    sum[c] += src[c] * zero;
+            }
+            for (size_t c = 0; c < N; ++c)
+                dst[c] = (uint16_t)RestrictRange((sum[c] - src[c] * next + Base::SHORT_AREA_ROUND) >> Base::SHORT_AREA_SHIFT, 0, 0xFFFF);
+        }
+
+        template<size_t N> SIMD_INLINE void ResizerShortAreaResult34(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            int32x4_t sum = vmulq_s32(Load<false>(src), vdupq_n_s32(curr));
+            for (size_t i = 0; i < count; ++i)
+                src += N, sum = vmlaq_s32(sum, Load<false>(src), vdupq_n_s32(zero));
+            sum = vmlaq_s32(sum, Load<false>(src), vdupq_n_s32(-next));
+            uint16x4_t res = vqmovun_s32(vshrq_n_s32(vaddq_s32(sum, vdupq_n_s32(Base::SHORT_AREA_ROUND)), Base::SHORT_AREA_SHIFT));
+            if (N == 4)
+                vst1_u16(dst, res);
+            else
+                *(uint32_t*)dst = vget_lane_u32((uint32x2_t)res, 0), dst[2] = vget_lane_u16(res, 2);
+        }
+
+        template<> SIMD_INLINE void ResizerShortAreaResult<4>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            ResizerShortAreaResult34<4>(src, count, curr, zero, next, dst);
+        }
+
+        template<> SIMD_INLINE void ResizerShortAreaResult<3>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            ResizerShortAreaResult34<3>(src, count, curr, zero, next, dst);
+        }
+
+        template<size_t N> void ResizerShortArea::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            size_t dstW = _param.dstW, rowSize = _param.srcW * N;
+            const int32_t * iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data, * ty = _ty.data, * tx = _tx.data;
+            int32_t ay0 = ay[0], ax0 = ax[0];
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const int32_t * buf = _by.data;
+                size_t yn = iy[dy + 1] - iy[dy];
+                ResizerShortAreaRowSum(src + iy[dy] * srcStride, srcStride, yn, rowSize, ay[dy], ay0, ty[dy], _by.data);
+                for (size_t dx = 0; dx < dstW; dx++)
+                {
+                    size_t xn = ix[dx + 1] - ix[dx];
+                    ResizerShortAreaResult<N>(buf, xn, ax[dx], ax0, tx[dx], dst + dx * N), buf += xn * N;
+                }
+            }
+        }
+
+        void ResizerShortArea::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            switch (_param.channels)
+            {
+            case 1: Run<1>(src, srcStride, dst, dstStride); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(float32x4_t));
@@ -584,6 +919,14 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
+            else if (param.IsShortBilinear())
+                return new ResizerShortBilinear(param);
+            else if (param.IsShortArea())
+                return new ResizerShortArea(param);
             else
                 return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
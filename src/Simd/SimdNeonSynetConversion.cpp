@@ -27,6 +27,7 @@
 #include "Simd/SimdSet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetSetInput.h"
 
 namespace Simd
 {
@@ -489,6 +490,141 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        const int32x4_t K32_YUV10_MAX = SIMD_VEC_SET1_EPI32(0x3FF);
+
+        SIMD_INLINE float32x4_t Yuv10ToFloat(int32x4_t value, float32x4_t scale, float32x4_t shift)
+        {
+            value = vminq_s32(vmaxq_s32(value, vdupq_n_s32(0)), K32_YUV10_MAX);
+            return vmlaq_f32(shift, vcvtq_f32_s32(value), scale);
+        }
+
+        template <int part, class T> SIMD_INLINE int32x4_t YuvToGray(int16x8_t y)
+        {
+            return vshrq_n_s32(vmlal_s16(vdupq_n_s32(T::ROUND), Half<part>(y), vdup_n_s16(T::Y_2_RGB)), T::SHIFT);
+        }
+
+        template <class T> SIMD_INLINE void Yuv10ToGray(uint16x8_t y16, float32x4_t scale, float32x4_t shift, float * dst)
+        {
+            int16x8_t y = vsubq_s16(vreinterpretq_s16_u16(y16), vdupq_n_s16(T::Y_ADJUST));
+            Store<false>(dst + 0, Yuv10ToFloat(YuvToGray<0, T>(y), scale, shift));
+            Store<false>(dst + F, Yuv10ToFloat(YuvToGray<1, T>(y), scale, shift));
+        }
+
+        template <int part, class T> SIMD_INLINE void Yuv10ToBgr(int16x8_t y, int16x8_t u, int16x8_t v, const float32x4_t * scale, const float32x4_t * shift, float32x4x3_t & bgr)
+        {
+            bgr.val[0] = Yuv10ToFloat(YuvToBlue<part, T>(y, u), scale[0], shift[0]);
+            bgr.val[1] = Yuv10ToFloat(YuvToGreen<part, T>(y, u, v), scale[1], shift[1]);
+            bgr.val[2] = Yuv10ToFloat(YuvToRed<part, T>(y, v), scale[2], shift[2]);
+        }
+
+        template <class T, SimdTensorFormatType format> SIMD_INLINE void SynetSetInputP010Bgr(const uint8_t * y, const uint16x8_t * u16, const uint16x8_t * v16,
+            const float32x4_t * scale, const float32x4_t * shift, float * dst, size_t size)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                int16x8_t _y = vsubq_s16(vreinterpretq_s16_u16(LoadY10<false, true>(y + i * A)), vdupq_n_s16(T::Y_ADJUST));
+                int16x8_t _u = vsubq_s16(vreinterpretq_s16_u16(u16[i]), vdupq_n_s16(T::UV_ADJUST));
+                int16x8_t _v = vsubq_s16(vreinterpretq_s16_u16(v16[i]), vdupq_n_s16(T::UV_ADJUST));
+                float32x4x3_t bgr[2];
+                Yuv10ToBgr<0, T>(_y, _u, _v, scale, shift, bgr[0]);
+                Yuv10ToBgr<1, T>(_y, _u, _v, scale, shift, bgr[1]);
+                if (format == SimdTensorFormatNchw)
+                {
+                    float * dst0 = dst + i * HA;
+                    for (size_t c = 0; c < 3; ++c)
+                    {
+                        Store<false>(dst0 + c * size + 0, bgr[0].val[c]);
+                        Store<false>(dst0 + c * size + F, bgr[1].val[c]);
+                    }
+                }
+                else
+                {
+                    Store3<false>(dst + 3 * i * HA + 0 * F, bgr[0]);
+                    Store3<false>(dst + 3 * i * HA + 3 * F, bgr[1]);
+                }
+            }
+        }
+
+        template <class T, SimdTensorFormatType format> void SynetSetInputP010Bgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, const float32x4_t * scale, const float32x4_t * shift, float * dst)
+        {
+            size_t size = width * height, aligned = AlignLo(width, A), step = format == SimdTensorFormatNchw ? 1 : 3;
+            uint16x8_t u16[2], v16[2];
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < aligned; col += A)
+                {
+                    LoadP010Uv<false>(uv + 2 * col, u16, v16);
+                    SynetSetInputP010Bgr<T, format>(y + 2 * col, u16, v16, scale, shift, dst + step * col, size);
+                }
+                if (aligned < width)
+                {
+                    size_t col = width - A;
+                    LoadP010Uv<false>(uv + 2 * col, u16, v16);
+                    SynetSetInputP010Bgr<T, format>(y + 2 * col, u16, v16, scale, shift, dst + step * col, size);
+                }
+                y += yStride;
+                if (row & 1)
+                    uv += uvStride;
+                dst += step * width;
+            }
+        }
+
+        template <class T> void SynetSetInputP010Gray(const uint8_t * y, size_t yStride, size_t width, size_t height, float32x4_t scale, float32x4_t shift, float * dst)
+        {
+            size_t aligned = AlignLo(width, HA);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < aligned; col += HA)
+                    Yuv10ToGray<T>(LoadY10<false, true>(y + 2 * col), scale, shift, dst + col);
+                if (aligned < width)
+                    Yuv10ToGray<T>(LoadY10<false, true>(y + 2 * (width - HA)), scale, shift, dst + width - HA);
+                y += yStride;
+                dst += width;
+            }
+        }
+
+        template <class T> void SynetSetInputP010(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height,
+            const float * scale, const float * shift, float * dst, size_t channels, SimdTensorFormatType format)
+        {
+            typedef Base::Yuv10<T, 10> Y10;
+            float32x4_t _scale[3], _shift[3];
+            for (size_t i = 0; i < channels; ++i)
+            {
+                _scale[i] = vdupq_n_f32(scale[i]);
+                _shift[i] = vdupq_n_f32(shift[i]);
+            }
+            if (channels == 1)
+                SynetSetInputP010Gray<Y10>(y, yStride, width, height, _scale[0], _shift[0], dst);
+            else if (format == SimdTensorFormatNchw)
+                SynetSetInputP010Bgr<Y10, SimdTensorFormatNchw>(y, yStride, uv, uvStride, width, height, _scale, _shift, dst);
+            else
+                SynetSetInputP010Bgr<Y10, SimdTensorFormatNhwc>(y, yStride, uv, uvStride, width, height, _scale, _shift, dst);
+        }
+
+        void SynetSetInputP010(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType,
+            const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (channels == 1 || channels == 3));
+
+            float scale[3];
+            for (size_t i = 0; i < channels; ++i)
+                scale[i] = (upper[i] - lower[i]) / 1023.0f;
+            switch (yuvType)
+            {
+            case SimdYuvBt601: SynetSetInputP010<Base::Bt601>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt709: SynetSetInputP010<Base::Bt709>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt2020: SynetSetInputP010<Base::Bt2020>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvTrect871: SynetSetInputP010<Base::Trect871>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt709Full: SynetSetInputP010<Base::Bt709Full>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            case SimdYuvBt2020Full: SynetSetInputP010<Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, scale, lower, dst, channels, dstFormat); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         template<bool align> void SynetReorderImage_Chw_Hwc(size_t channels, size_t spatial, const float* src, float* dst)
         {
             size_t channels4 = AlignLo(channels, 4);
@@ -984,6 +1120,43 @@ namespace Simd
             else
                 Base::SynetReorderFilter(output, input, kernel, src, srcFormat, dst, dstFormat);
         }
+        //---------------------------------------------------------------------
+
+        SynetSetInputYuv::SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+            size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format)
+            : Base::SynetSetInputYuv(srcW, srcH, yuvType, method, lower, upper, dstW, dstH, channels, format)
+        {
+        }
+
+        void SynetSetInputYuv::DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v)
+        {
+            if (_srcW >= DA)
+                Neon::DeinterleaveUv(uv, 0, _srcW / 2, 1, u, 0, v, 0);
+            else
+                Base::SynetSetInputYuv::DeinterleaveUv(uv, u, v);
+        }
+
+        void SynetSetInputYuv::YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        {
+            if (_srcW >= DA)
+                Neon::Yuv422pToBgrV2(y, 0, u, 0, v, 0, _srcW, 1, bgr, 0, _yuvType);
+            else
+                Base::SynetSetInputYuv::YuvToBgr(y, u, v, bgr);
+        }
+
+        void SynetSetInputYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, u, uStride, v, vStride, dst);
+        }
+
+        void SynetSetInputNv12(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, uv, uvStride, NULL, 0, dst);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
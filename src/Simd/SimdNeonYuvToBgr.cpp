@@ -33,20 +33,20 @@ namespace Simd
         const size_t A3 = A * 3;
         const size_t A6 = A * 6;
 
-        template <bool align> SIMD_INLINE void YuvToBgr(const uint8x16_t & y, const uint8x16_t & u, const uint8x16_t & v, uint8_t * bgr)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void YuvToBgr(const uint8x16_t & y, const uint8x16_t & u, const uint8x16_t & v, uint8_t * bgr)
         {
             uint8x16x3_t _bgr;
-            YuvToBgr(y, u, v, _bgr);
+            YuvToBgr<T>(y, u, v, _bgr);
             Store3<align>(bgr, _bgr);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8x16x2_t & u, const uint8x16x2_t & v, uint8_t * bgr)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const uint8x16x2_t & u, const uint8x16x2_t & v, uint8_t * bgr)
         {
-            YuvToBgr<align>(Load<align>(y + 0), u.val[0], v.val[0], bgr + 0);
-            YuvToBgr<align>(Load<align>(y + A), u.val[1], v.val[1], bgr + A3);
+            YuvToBgr<align, T>(Load<align>(y + 0), u.val[0], v.val[0], bgr + 0);
+            YuvToBgr<align, T>(Load<align>(y + A), u.val[1], v.val[1], bgr + A3);
         }
 
-        template <bool align> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -67,8 +67,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<align>(v + colUV);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgr<align>(y + colY, _u, _v, bgr + colBgr);
-                    Yuv422pToBgr<align>(y + colY + yStride, _u, _v, bgr + colBgr + bgrStride);
+                    Yuv422pToBgr<align, T>(y + colY, _u, _v, bgr + colBgr);
+                    Yuv422pToBgr<align, T>(y + colY + yStride, _u, _v, bgr + colBgr + bgrStride);
                 }
                 if (tail)
                 {
@@ -77,8 +77,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<false>(v + offset / 2);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgr<false>(y + offset, _u, _v, bgr + 3 * offset);
-                    Yuv422pToBgr<false>(y + offset + yStride, _u, _v, bgr + 3 * offset + bgrStride);
+                    Yuv422pToBgr<false, T>(y + offset, _u, _v, bgr + 3 * offset);
+                    Yuv422pToBgr<false, T>(y + offset + yStride, _u, _v, bgr + 3 * offset + bgrStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -87,17 +87,39 @@ namespace Simd
             }
         }
 
-        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv420pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv420pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv420pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv420pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv420pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Yuv420pToBgr<Base::Trect871>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv420pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv420pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
         }
 
-        template <bool align> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <bool align, class T> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -118,7 +140,7 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<align>(v + colUV);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgr<align>(y + colY, _u, _v, bgr + colBgr);
+                    Yuv422pToBgr<align, T>(y + colY, _u, _v, bgr + colBgr);
                 }
                 if (tail)
                 {
@@ -127,7 +149,7 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<false>(v + offset / 2);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToBgr<false>(y + offset, _u, _v, bgr + 3 * offset);
+                    Yuv422pToBgr<false, T>(y + offset, _u, _v, bgr + 3 * offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -136,17 +158,39 @@ namespace Simd
             }
         }
 
-        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv422pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv422pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv422pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
         }
 
-        template <bool align> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv422pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv422pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Yuv422pToBgr<Base::Trect871>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv422pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv422pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <bool align, class T> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             assert(width >= A);
@@ -165,7 +209,7 @@ namespace Simd
                     uint8x16_t _y = Load<align>(y + col);
                     uint8x16_t _u = Load<align>(u + col);
                     uint8x16_t _v = Load<align>(v + col);
-                    YuvToBgr<align>(_y, _u, _v, bgr + colBgr);
+                    YuvToBgr<align, T>(_y, _u, _v, bgr + colBgr);
                 }
                 if (tail)
                 {
@@ -173,7 +217,7 @@ namespace Simd
                     uint8x16_t _y = Load<false>(y + col);
                     uint8x16_t _u = Load<false>(u + col);
                     uint8x16_t _v = Load<false>(v + col);
-                    YuvToBgr<false>(_y, _u, _v, bgr + 3 * col);
+                    YuvToBgr<false, T>(_y, _u, _v, bgr + 3 * col);
                 }
                 y += yStride;
                 u += uStride;
@@ -182,32 +226,54 @@ namespace Simd
             }
         }
 
-        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        template <class T> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
-                Yuv444pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
             else
-                Yuv444pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+                Yuv444pToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv444pToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv444pToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Yuv444pToBgr<Base::Trect871>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv444pToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv444pToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
         }
 
         //---------------------------------------------------------------------
 
-        template <bool align> SIMD_INLINE void YuvToRgb(const uint8x16_t& y, const uint8x16_t& u, const uint8x16_t& v, uint8_t* rgb)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void YuvToRgb(const uint8x16_t& y, const uint8x16_t& u, const uint8x16_t& v, uint8_t* rgb)
         {
             uint8x16x3_t _rgb;
-            YuvToRgb(y, u, v, _rgb);
+            YuvToRgb<T>(y, u, v, _rgb);
             Store3<align>(rgb, _rgb);
         }
 
-        template <bool align> SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, const uint8x16x2_t& u, const uint8x16x2_t& v, uint8_t* rgb)
+        template <bool align, class T = Base::Bt601> SIMD_INLINE void Yuv422pToRgb(const uint8_t* y, const uint8x16x2_t& u, const uint8x16x2_t& v, uint8_t* rgb)
         {
-            YuvToRgb<align>(Load<align>(y + 0), u.val[0], v.val[0], rgb + 0);
-            YuvToRgb<align>(Load<align>(y + A), u.val[1], v.val[1], rgb + A3);
+            YuvToRgb<align, T>(Load<align>(y + 0), u.val[0], v.val[0], rgb + 0);
+            YuvToRgb<align, T>(Load<align>(y + A), u.val[1], v.val[1], rgb + A3);
         }
 
-        template <bool align> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <bool align, class T> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
@@ -228,8 +294,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<align>(v + colUV);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToRgb<align>(y + colY, _u, _v, rgb + colRgb);
-                    Yuv422pToRgb<align>(y + colY + yStride, _u, _v, rgb + colRgb + rgbStride);
+                    Yuv422pToRgb<align, T>(y + colY, _u, _v, rgb + colRgb);
+                    Yuv422pToRgb<align, T>(y + colY + yStride, _u, _v, rgb + colRgb + rgbStride);
                 }
                 if (tail)
                 {
@@ -238,8 +304,8 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<false>(v + offset / 2);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToRgb<false>(y + offset, _u, _v, rgb + 3 * offset);
-                    Yuv422pToRgb<false>(y + offset + yStride, _u, _v, rgb + 3 * offset + rgbStride);
+                    Yuv422pToRgb<false, T>(y + offset, _u, _v, rgb + 3 * offset);
+                    Yuv422pToRgb<false, T>(y + offset + yStride, _u, _v, rgb + 3 * offset + rgbStride);
                 }
                 y += 2 * yStride;
                 u += uStride;
@@ -248,17 +314,39 @@ namespace Simd
             }
         }
 
-        void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T> void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(rgb) && Aligned(rgbStride))
-                Yuv420pToRgb<true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv420pToRgb<true, T>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
             else
-                Yuv420pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv420pToRgb<false, T>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
         }
 
-        template <bool align> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        void Yuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv420pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv420pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv420pToRgb<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv420pToRgb<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvTrect871: Yuv420pToRgb<Base::Trect871>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv420pToRgb<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv420pToRgb<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <bool align, class T> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert((width % 2 == 0) && (width >= DA));
@@ -279,7 +367,7 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<align>(v + colUV);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToRgb<align>(y + colY, _u, _v, rgb + colRgb);
+                    Yuv422pToRgb<align, T>(y + colY, _u, _v, rgb + colRgb);
                 }
                 if (tail)
                 {
@@ -288,7 +376,7 @@ namespace Simd
                     _u = vzipq_u8(_u.val[0], _u.val[1]);
                     _v.val[1] = _v.val[0] = Load<false>(v + offset / 2);
                     _v = vzipq_u8(_v.val[0], _v.val[1]);
-                    Yuv422pToRgb<false>(y + offset, _u, _v, rgb + 3 * offset);
+                    Yuv422pToRgb<false, T>(y + offset, _u, _v, rgb + 3 * offset);
                 }
                 y += yStride;
                 u += uStride;
@@ -297,17 +385,39 @@ namespace Simd
             }
         }
 
-        void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T> void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(rgb) && Aligned(rgbStride))
-                Yuv422pToRgb<true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv422pToRgb<true, T>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
             else
-                Yuv422pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv422pToRgb<false, T>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv422pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
         }
 
-        template <bool align> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        void Yuv422pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv422pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv422pToRgb<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv422pToRgb<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvTrect871: Yuv422pToRgb<Base::Trect871>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv422pToRgb<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv422pToRgb<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <bool align, class T> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             assert(width >= A);
@@ -326,7 +436,7 @@ namespace Simd
                     uint8x16_t _y = Load<align>(y + col);
                     uint8x16_t _u = Load<align>(u + col);
                     uint8x16_t _v = Load<align>(v + col);
-                    YuvToRgb<align>(_y, _u, _v, rgb + colRgb);
+                    YuvToRgb<align, T>(_y, _u, _v, rgb + colRgb);
                 }
                 if (tail)
                 {
@@ -334,7 +444,7 @@ namespace Simd
                     uint8x16_t _y = Load<false>(y + col);
                     uint8x16_t _u = Load<false>(u + col);
                     uint8x16_t _v = Load<false>(v + col);
-                    YuvToRgb<false>(_y, _u, _v, rgb + 3 * col);
+                    YuvToRgb<false, T>(_y, _u, _v, rgb + 3 * col);
                 }
                 y += yStride;
                 u += uStride;
@@ -343,14 +453,364 @@ namespace Simd
             }
         }
 
-        void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        template <class T> void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
         {
             if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
                 && Aligned(v) && Aligned(vStride) && Aligned(rgb) && Aligned(rgbStride))
-                Yuv444pToRgb<true>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Yuv444pToRgb<true, T>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+            else
+                Yuv444pToRgb<false, T>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            Yuv444pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+        }
+
+        void Yuv444pToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444pToRgb<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Yuv444pToRgb<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Yuv444pToRgb<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvTrect871: Yuv444pToRgb<Base::Trect871>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Yuv444pToRgb<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Yuv444pToRgb<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template <bool align, bool nv21, class T> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            uint8x16x2_t _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < bodyWidth; colY += DA, colBgr += A6)
+                {
+                    LoadUv<align, nv21>(uv + colY, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv422pToBgr<align, T>(y + colY, _u, _v, bgr + colBgr);
+                    Yuv422pToBgr<align, T>(y + colY + yStride, _u, _v, bgr + colBgr + bgrStride);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    LoadUv<false, nv21>(uv + offset, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv422pToBgr<false, T>(y + offset, _u, _v, bgr + 3 * offset);
+                    Yuv422pToBgr<false, T>(y + offset + yStride, _u, _v, bgr + 3 * offset + bgrStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <class T> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                Nv12ToBgr<true, false, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+            else
+                Nv12ToBgr<false, false, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            Nv12ToBgr<Base::Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void Nv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgr<Base::Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgr<Base::Bt709>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgr<Base::Bt2020>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Nv12ToBgr<Base::Trect871>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Nv12ToBgr<Base::Bt709Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Nv12ToBgr<Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(vu) && Aligned(vuStride) && Aligned(bgr) && Aligned(bgrStride))
+                Nv12ToBgr<true, true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
             else
-                Yuv444pToRgb<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
+                Nv12ToBgr<false, true, Base::Bt601>(y, yStride, vu, vuStride, width, height, bgr, bgrStride);
+        }
+
+        template <bool align, bool nv21, class T> void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(rgb) && Aligned(rgbStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            uint8x16x2_t _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colRgb = 0; colY < bodyWidth; colY += DA, colRgb += A6)
+                {
+                    LoadUv<align, nv21>(uv + colY, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv422pToRgb<align, T>(y + colY, _u, _v, rgb + colRgb);
+                    Yuv422pToRgb<align, T>(y + colY + yStride, _u, _v, rgb + colRgb + rgbStride);
+                }
+                if (tail)
+                {
+                    size_t offset = width - DA;
+                    LoadUv<false, nv21>(uv + offset, _u.val[0], _v.val[0]);
+                    _u = vzipq_u8(_u.val[0], _u.val[0]);
+                    _v = vzipq_u8(_v.val[0], _v.val[0]);
+                    Yuv422pToRgb<false, T>(y + offset, _u, _v, rgb + 3 * offset);
+                    Yuv422pToRgb<false, T>(y + offset + yStride, _u, _v, rgb + 3 * offset + rgbStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                rgb += 2 * rgbStride;
+            }
+        }
+
+        template <class T> void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(rgb) && Aligned(rgbStride))
+                Nv12ToRgb<true, false, T>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+            else
+                Nv12ToRgb<false, false, T>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            Nv12ToRgb<Base::Bt601>(y, yStride, uv, uvStride, width, height, rgb, rgbStride);
+        }
+
+        void Nv12ToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToRgb<Base::Bt601>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Nv12ToRgb<Base::Bt709>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Nv12ToRgb<Base::Bt2020>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvTrect871: Nv12ToRgb<Base::Trect871>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709Full: Nv12ToRgb<Base::Bt709Full>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020Full: Nv12ToRgb<Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(vu) && Aligned(vuStride) && Aligned(rgb) && Aligned(rgbStride))
+                Nv12ToRgb<true, true, Base::Bt601>(y, yStride, vu, vuStride, width, height, rgb, rgbStride);
+            else
+                Nv12ToRgb<false, true, Base::Bt601>(y, yStride, vu, vuStride, width, height, rgb, rgbStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        template <bool align, bool uyvy> SIMD_INLINE void Yuyv422ToBgr(const uint8_t * yuyv, uint8_t * bgr)
+        {
+            uint8x16_t y[2], u, v;
+            LoadYuyv<align, uyvy>(yuyv, y, u, v);
+            uint8x16x2_t _u = vzipq_u8(u, u);
+            uint8x16x2_t _v = vzipq_u8(v, v);
+            YuvToBgr<align>(y[0], _u.val[0], _v.val[0], bgr + 0);
+            YuvToBgr<align>(y[1], _u.val[1], _v.val[1], bgr + A3);
+        }
+
+        template <bool align, bool uyvy> void Yuyv422ToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (width >= DA));
+            if (align)
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                    Yuyv422ToBgr<align, uyvy>(yuyv + 2 * col, bgr + 3 * col);
+                if (tail)
+                {
+                    size_t col = width - DA;
+                    Yuyv422ToBgr<false, uyvy>(yuyv + 2 * col, bgr + 3 * col);
+                }
+                yuyv += yuyvStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void Yuyv422ToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgr) && Aligned(bgrStride))
+                Yuyv422ToBgr<true, false>(yuyv, yuyvStride, width, height, bgr, bgrStride);
+            else
+                Yuyv422ToBgr<false, false>(yuyv, yuyvStride, width, height, bgr, bgrStride);
+        }
+
+        void Uyvy422ToBgr(const uint8_t * uyvy, size_t uyvyStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(uyvy) && Aligned(uyvyStride) && Aligned(bgr) && Aligned(bgrStride))
+                Yuyv422ToBgr<true, true>(uyvy, uyvyStride, width, height, bgr, bgrStride);
+            else
+                Yuyv422ToBgr<false, true>(uyvy, uyvyStride, width, height, bgr, bgrStride);
+        }
+
+        //---------------------------------------------------------------------
+        template <bool align, bool p010, class T> SIMD_INLINE void Yuv10ToBgr(const uint8_t * y, const uint16x8_t * u16, const uint16x8_t * v16, uint8_t * bgr)
+        {
+            uint16x8_t y16[2] = { LoadY10<align, p010>(y + 0), LoadY10<align, p010>(y + A) };
+            uint8x16x3_t _bgr;
+            Yuv16ToBgr8<Base::Yuv10<T> >(y16, u16, v16, _bgr.val[0], _bgr.val[1], _bgr.val[2]);
+            Store3<align>(bgr, _bgr);
+        }
+
+        template <bool align, class T> void P010ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+                assert(Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            uint16x8_t u16[2], v16[2];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += A)
+                {
+                    LoadP010Uv<align>(uv + 2 * col, u16, v16);
+                    Yuv10ToBgr<align, true, T>(y + 2 * col, u16, v16, bgr + 3 * col);
+                    Yuv10ToBgr<align, true, T>(y + 2 * col + yStride, u16, v16, bgr + 3 * col + bgrStride);
+                }
+                if (tail)
+                {
+                    size_t col = width - A;
+                    LoadP010Uv<false>(uv + 2 * col, u16, v16);
+                    Yuv10ToBgr<false, true, T>(y + 2 * col, u16, v16, bgr + 3 * col);
+                    Yuv10ToBgr<false, true, T>(y + 2 * col + yStride, u16, v16, bgr + 3 * col + bgrStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <class T> void P010ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+                P010ToBgr<true, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+            else
+                P010ToBgr<false, T>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+        }
+
+        void P010ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P010ToBgr<Base::Bt601>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: P010ToBgr<Base::Bt709>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: P010ToBgr<Base::Bt2020>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: P010ToBgr<Base::Trect871>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: P010ToBgr<Base::Bt709Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: P010ToBgr<Base::Bt2020Full>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <bool align, class T> void Yuv420p10ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride));
+                assert(Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            uint16x8_t u16[2], v16[2];
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += A)
+                {
+                    LoadYuv420p10Uv<align>(u + col, v + col, u16, v16);
+                    Yuv10ToBgr<align, false, T>(y + 2 * col, u16, v16, bgr + 3 * col);
+                    Yuv10ToBgr<align, false, T>(y + 2 * col + yStride, u16, v16, bgr + 3 * col + bgrStride);
+                }
+                if (tail)
+                {
+                    size_t col = width - A;
+                    LoadYuv420p10Uv<false>(u + col, v + col, u16, v16);
+                    Yuv10ToBgr<false, false, T>(y + 2 * col, u16, v16, bgr + 3 * col);
+                    Yuv10ToBgr<false, false, T>(y + 2 * col + yStride, u16, v16, bgr + 3 * col + bgrStride);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <class T> void Yuv420p10ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                Yuv420p10ToBgr<true, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+            else
+                Yuv420p10ToBgr<false, T>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        void Yuv420p10ToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420p10ToBgr<Base::Bt601>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv420p10ToBgr<Base::Bt709>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv420p10ToBgr<Base::Bt2020>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Yuv420p10ToBgr<Base::Trect871>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709Full: Yuv420p10ToBgr<Base::Bt709Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020Full: Yuv420p10ToBgr<Base::Bt2020Full>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
         }
     }
 #endif// SIMD_NEON_ENABLE
@@ -26,38 +26,303 @@
 
 #include <thread>
 #include <vector>
+#include <memory>
+#include <algorithm>
 #ifndef SIMD_FUTURE_DISABLE
-#include <future>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 #endif
 
 namespace Simd
 {
+#ifndef SIMD_FUTURE_DISABLE
+    /*! \brief Persistent pool of worker threads which is used by Simd::Parallel.
+
+        The pool is created on demand and keeps its workers alive between calls, so a parallel call costs only a wake up
+        of sleeping workers instead of thread creation and joining. Workers at first spin for a short time waiting for a new job
+        and only then fall asleep on condition variable (futex on Linux).
+        A job is never split into more threads than the size of the pool. Concurrent and nested jobs are executed in calling thread.
+    */
+    class ThreadPool
+    {
+    public:
+        typedef void(*Invoker)(const void * function, size_t thread, size_t begin, size_t end);
+        typedef void(*Initializer)(void * data, size_t thread);
+
+        ThreadPool(size_t size = std::thread::hardware_concurrency())
+            : _size(std::max<size_t>(size, 1))
+            , _pending(0)
+            , _initializer(NULL)
+            , _data(NULL)
+        {
+        }
+
+        ~ThreadPool()
+        {
+            std::lock_guard<std::mutex> lock(_run);
+            Shrink(0);
+        }
+
+        /*! Gets global pool of the library. */
+        static ThreadPool & Global()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        /*! Sets maximal total number of threads (including calling thread) which are kept in the pool. Workers are created on demand.
+            If the pool is busy (or it is called from a job) extra workers are stopped at the start of the next job. */
+        void SetSize(size_t size)
+        {
+            _size.store(std::max<size_t>(size, 1));
+            if (Inside())
+                return;
+            std::unique_lock<std::mutex> lock(_run, std::try_to_lock);
+            if (lock.owns_lock())
+                Shrink(_size.load() - 1);
+        }
+
+        /*! Sets function which is called at the start of every new worker thread (for example to set its affinity). It must be set before creation of workers. */
+        void SetInitializer(Initializer initializer, void * data)
+        {
+            std::lock_guard<std::mutex> lock(_run);
+            _initializer = initializer;
+            _data = data;
+        }
+
+        /*! Gets maximal total number of threads (including calling thread) which are kept in the pool. */
+        size_t Size() const
+        {
+            return _size.load();
+        }
+
+        /*! Binds given pool to calling thread. Further parallel calls from this thread will use it instead of global pool (NULL restores global pool). */
+        static void Bind(ThreadPool * pool)
+        {
+            Binding() = pool;
+        }
+
+        /*! Gets pool bound to calling thread (NULL if there is no binding). */
+        static ThreadPool * Bound()
+        {
+            return Binding();
+        }
+
+        /*! Gets reference to the binding of calling thread. It stays valid until the thread exits, so the owner of a pool can clear bindings of other threads. */
+        static ThreadPool * & Binding()
+        {
+            static thread_local ThreadPool * pool = NULL;
+            return pool;
+        }
+
+        /*! Gets pool which is used by parallel calls from calling thread: bound one or global. */
+        static ThreadPool & Current()
+        {
+            ThreadPool * pool = Binding();
+            return pool ? *pool : Global();
+        }
+
+        /*! Returns true if calling thread already executes a block of some parallel job. */
+        static bool Nested()
+        {
+            return Inside();
+        }
+
+        /*! Splits range [begin, end) into blocks of given size and executes them in parallel. Blocks of thread i are i, i + n, i + 2*n ...,
+            where n is a number of used threads (no more than the size of the pool). Thread 0 is calling thread.
+            If the pool is busy by another job (concurrent call) the whole range is executed in calling thread.
+            An exception thrown by a block is rethrown in calling thread after the end of all blocks. */
+        void Run(size_t begin, size_t end, size_t blockSize, const void * function, Invoker invoker)
+        {
+            std::unique_lock<std::mutex> lock(_run, std::defer_lock);
+            if (Inside() || !lock.try_lock())
+            {
+                invoker(function, 0, begin, end);
+                return;
+            }
+            Shrink(_size.load() - 1);
+            _job.function = function, _job.invoker = invoker, _job.begin = begin, _job.end = end, _job.size = blockSize;
+            _job.blocks = (end - begin + blockSize - 1) / blockSize;
+            _job.threads = std::min(_job.blocks, _size.load());
+            Grow(_job.threads - 1);
+            _error = std::exception_ptr();
+            _pending.store(_job.threads - 1);
+            for (size_t thread = 1; thread < _job.threads; ++thread)
+                _workers[thread - 1]->Post();
+            Inside() = true;
+            Execute(0);
+            Inside() = false;
+            Wait();
+            if (_error)
+                std::rethrow_exception(_error);
+        }
+
+    private:
+        static const size_t SPIN_COUNT = 256;
+
+        static bool & Inside()
+        {
+            static thread_local bool inside = false;
+            return inside;
+        }
+
+        struct Job
+        {
+            const void * function;
+            Invoker invoker;
+            size_t begin, end, size, blocks, threads;
+        };
+
+        struct Worker
+        {
+            ThreadPool * pool;
+            size_t number;
+            std::thread thread;
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::atomic<bool> ready;
+            bool stop;
+
+            Worker(ThreadPool * p, size_t n)
+                : pool(p)
+                , number(n)
+                , ready(false)
+                , stop(false)
+            {
+                thread = std::thread(&Worker::Loop, this);
+            }
+
+            void Post()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ready.store(true);
+                }
+                cv.notify_one();
+            }
+
+            void Stop()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stop = true;
+                }
+                cv.notify_one();
+                thread.join();
+            }
+
+            void Loop()
+            {
+                Inside() = true;
+                if (pool->_initializer)
+                    pool->_initializer(pool->_data, number);
+                for (;;)
+                {
+                    for (size_t spin = 0; spin < SPIN_COUNT && !ready.load(); ++spin)
+                        std::this_thread::yield();
+                    if (!ready.load())
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        cv.wait(lock, [this] { return ready.load() || stop; });
+                        if (!ready.load())
+                            return;
+                    }
+                    pool->Execute(number);
+                    ready.store(false);
+                    pool->Done();
+                }
+            }
+        };
+        typedef std::unique_ptr<Worker> WorkerPtr;
+
+        std::vector<WorkerPtr> _workers;
+        std::mutex _run, _done;
+        std::condition_variable _finished;
+        std::atomic<size_t> _size, _pending;
+        Initializer _initializer;
+        void * _data;
+        Job _job;
+        std::exception_ptr _error;
+
+        void Grow(size_t size)
+        {
+            while (_workers.size() < size)
+                _workers.push_back(WorkerPtr(new Worker(this, _workers.size() + 1)));
+        }
+
+        void Shrink(size_t size)
+        {
+            while (_workers.size() > size)
+            {
+                _workers.back()->Stop();
+                _workers.pop_back();
+            }
+        }
+
+        void Execute(size_t thread)
+        {
+            try
+            {
+                for (size_t block = thread; block < _job.blocks; block += _job.threads)
+                {
+                    size_t begin = _job.begin + block * _job.size;
+                    _job.invoker(_job.function, thread, begin, std::min(begin + _job.size, _job.end));
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(_done);
+                if (!_error)
+                    _error = std::current_exception();
+            }
+        }
+
+        void Done()
+        {
+            if (_pending.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(_done);
+                _finished.notify_one();
+            }
+        }
+
+        void Wait()
+        {
+            for (size_t spin = 0; spin < SPIN_COUNT && _pending.load(); ++spin)
+                std::this_thread::yield();
+            if (_pending.load())
+            {
+                std::unique_lock<std::mutex> lock(_done);
+                _finished.wait(lock, [this] { return _pending.load() == 0; });
+            }
+        }
+    };
+
+    namespace Detail
+    {
+        template<class Function> void ParallelInvoke(const void * function, size_t thread, size_t begin, size_t end)
+        {
+            (*(const Function*)function)(thread, begin, end);
+        }
+    }
+#endif
+
     template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1)
     {
 #ifdef SIMD_FUTURE_DISABLE
         function(0, begin, end);
 #else
-        threadNumber = std::min<size_t>(threadNumber, std::thread::hardware_concurrency());
-        if (threadNumber <= 1 || size_t(blockAlign*1.5) >= (end - begin))
+        ThreadPool & pool = ThreadPool::Current();
+        threadNumber = std::min<size_t>(threadNumber, pool.Size());
+        if (threadNumber <= 1 || size_t(blockAlign*1.5) >= (end - begin) || ThreadPool::Nested())
             function(0, begin, end);
         else
         {
-            std::vector<std::future<void>> futures;
-
             size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
             blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
-
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
-            {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
-            }
-
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();
+            pool.Run(begin, end, blockSize, &function, Detail::ParallelInvoke<Function>);
         }
 #endif
     }
@@ -53,34 +53,35 @@ namespace Simd
 #include <thread>
 #include <mutex>
 #include <algorithm>
+#include <atomic>
+#include <vector>
+#include <deque>
+#include <tuple>
 
 namespace Simd
 {
     namespace Base
     {
+        const size_t PERFORMANCE_HISTOGRAM_SIZE = SIMD_PERFORMANCE_HISTOGRAM_SIZE;
+
         class PerformanceMeasurer
         {
-            String	_name;
-            int64_t _start, _current, _total, _min, _max;
-            int64_t _count, _flop;
+            int64_t _start, _current;
             bool _entered, _paused;
+            std::atomic<size_t> _generation;
+            std::atomic<int64_t> _count, _total, _min, _max;
+            std::atomic<int64_t> _histogram[PERFORMANCE_HISTOGRAM_SIZE];
 
-        public:
-            PerformanceMeasurer(const String& name = "Unknown", int64_t flop = 0);
+            void Clear(size_t generation);
 
-            PerformanceMeasurer(const PerformanceMeasurer& pm);
+        public:
+            PerformanceMeasurer();
 
             void Enter();
 
             void Leave(bool pause = false);
 
-            String Statistic() const;
-
-            void Combine(const PerformanceMeasurer& other);
-
-        private:
-            double Average() const;
-            double GFlops() const;
+            void Combine(size_t generation, SimdPerformanceCounter & counter) const;
         };
 
         class PerformanceMeasurerHolder
@@ -116,65 +117,144 @@ namespace Simd
 
         class PerformanceMeasurerStorage
         {
-            typedef PerformanceMeasurer Pm;
-            typedef std::shared_ptr<Pm> PmPtr;
-            typedef std::map<String, PmPtr> FunctionMap;
-            typedef std::map<std::thread::id, FunctionMap> ThreadMap;
+            static const size_t CHUNK_SIZE = 64;
+            static const size_t CHUNK_MAX = 256;
+
+            struct Thread
+            {
+                std::atomic<PerformanceMeasurer*> chunks[CHUNK_MAX];
 
-            ThreadMap _map;
+                Thread();
+                ~Thread();
+            };
+            typedef std::shared_ptr<Thread> ThreadPtr;
+            typedef std::vector<ThreadPtr> Threads;
+            typedef std::map<String, size_t> IdMap;
+            typedef std::vector<SimdPerformanceCounter> CounterVector;
+
+            Threads _threads;
+            IdMap _ids;
+            std::deque<String> _names;
+            std::vector<int64_t> _flops;
+            std::atomic<size_t> _generation;
             mutable std::mutex _mutex;
-            String _report;
+            String _report, _json;
 
-            SIMD_INLINE FunctionMap & ThisThread()
+            SIMD_INLINE Thread & ThisThread()
             {
-                static thread_local FunctionMap * thread = NULL;
+                static thread_local Thread * thread = NULL;
                 if (thread == NULL)
                 {
                     std::lock_guard<std::mutex> lock(_mutex);
-                    thread = &_map[std::this_thread::get_id()];
+                    _threads.push_back(ThreadPtr(new Thread()));
+                    thread = _threads.back().get();
                 }
                 return *thread;
             }
 
+            void Combine(CounterVector & counters);
+
         public:
             static PerformanceMeasurerStorage s_storage;
 
-            PerformanceMeasurerStorage()
+            PerformanceMeasurerStorage();
+
+            size_t Register(const String & name, int64_t flop = 0);
+
+            SIMD_INLINE size_t Register(const String & func, const String & desc, int64_t flop = 0)
             {
+                return Register(func + "{ " + desc + " }", flop);
             }
 
-            SIMD_INLINE PerformanceMeasurer * Get(const String & name, int64_t flop = 0)
+            SIMD_INLINE size_t Generation() const
+            {
+                return _generation.load(std::memory_order_relaxed);
+            }
+
+            SIMD_INLINE PerformanceMeasurer * Get(size_t id)
             {
-                FunctionMap & thread = ThisThread();
-                PerformanceMeasurer * pm = NULL;
-                FunctionMap::iterator it = thread.find(name);
-                if (it == thread.end())
+                if (id == 0)
+                    return NULL;
+                std::atomic<PerformanceMeasurer*> & chunk = ThisThread().chunks[id / CHUNK_SIZE];
+                PerformanceMeasurer * measurers = chunk.load(std::memory_order_acquire);
+                if (measurers == NULL)
                 {
-                    pm = new PerformanceMeasurer(name, flop);
-                    thread[name].reset(pm);
+                    measurers = new PerformanceMeasurer[CHUNK_SIZE];
+                    chunk.store(measurers, std::memory_order_release);
                 }
-                else
-                    pm = it->second.get();
-                return pm;
+                return measurers + id % CHUNK_SIZE;
+            }
+
+            SIMD_INLINE PerformanceMeasurer * Get(const String & name, int64_t flop = 0)
+            {
+                return Get(Register(name, flop));
             }
 
-            SIMD_INLINE PerformanceMeasurer * Get(const String func, const String & desc, int64_t flop = 0)
+            SIMD_INLINE PerformanceMeasurer * Get(const String & func, const String & desc, int64_t flop = 0)
             {
-                return Get(func + "{ " + desc + " }", flop);
+                return Get(Register(func, desc, flop));
             }
 
-            const char* PerformanceStatistic();
+            size_t Counters(SimdPerformanceCounter * counters, size_t size);
+
+            const char * PerformanceStatistic();
+
+            const char * PerformanceJson();
+
+            void Reset();
+        };
+
+        /*! Caches ids of measurers registered for a call site (one instance per thread): the storage is locked only for a new key. */
+        template<class Key> class PerformanceMeasurerIds
+        {
+        public:
+            template<class Desc> SIMD_INLINE size_t Get(const char * func, const Key & key, const Desc & desc, int64_t flop)
+            {
+                typename IdMap::const_iterator it = _ids.find(key);
+                if (it != _ids.end())
+                    return it->second;
+                size_t id = PerformanceMeasurerStorage::s_storage.Register(func, desc(), flop);
+                _ids[key] = id;
+                return id;
+            }
+
+        private:
+            typedef std::map<Key, size_t> IdMap;
+            IdMap _ids;
+        };
+
+        class PerformanceMeasurerId
+        {
+        public:
+            SIMD_INLINE size_t Get(const char * func, const String & desc, int64_t flop)
+            {
+                return _ids.Get(func, desc, [&desc]() { return desc; }, flop);
+            }
+
+        private:
+            PerformanceMeasurerIds<String> _ids;
         };
     }
 }
-#define SIMD_PERF_FUNCF(flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, (long long)(flop)))
+#define SIMD_PERF_ID(desc, flop) static thread_local Simd::Base::PerformanceMeasurerId SIMD_CAT(__pmc, __LINE__); \
+    const size_t SIMD_CAT(__pmi, __LINE__) = SIMD_CAT(__pmc, __LINE__).Get(SIMD_FUNCTION, desc, (long long)(flop))
+#define SIMD_PERF_KEY_ID(key, desc, flop) static thread_local Simd::Base::PerformanceMeasurerIds<decltype(key)> SIMD_CAT(__pmc, __LINE__); \
+    const size_t SIMD_CAT(__pmi, __LINE__) = SIMD_CAT(__pmc, __LINE__).Get(SIMD_FUNCTION, key, [&]() { return Simd::String(desc); }, (long long)(flop))
+#define SIMD_PERF_FUNCF(flop) static const size_t SIMD_CAT(__pmi, __LINE__) = Simd::Base::PerformanceMeasurerStorage::s_storage.Register(SIMD_FUNCTION, (long long)(flop)); \
+    Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(__pmi, __LINE__)))
 #define SIMD_PERF_FUNC() SIMD_PERF_FUNCF(0)
-#define SIMD_PERF_BEGF(desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (long long)(flop)))
+#define SIMD_PERF_BEGF(desc, flop) SIMD_PERF_ID(desc, flop); \
+    Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(__pmi, __LINE__)))
 #define SIMD_PERF_BEG(desc) SIMD_PERF_BEGF(desc, 0)
-#define SIMD_PERF_IFF(cond, desc, flop) Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((cond) ? Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (long long)(flop)) : NULL)
+#define SIMD_PERF_BEGKF(key, desc, flop) SIMD_PERF_KEY_ID(key, desc, flop); \
+    Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(__pmi, __LINE__)))
+#define SIMD_PERF_IFF(cond, desc, flop) static thread_local Simd::Base::PerformanceMeasurerId SIMD_CAT(__pmc, __LINE__); \
+    Simd::Base::PerformanceMeasurerHolder SIMD_CAT(__pmh, __LINE__)((cond) ? Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(__pmc, __LINE__).Get(SIMD_FUNCTION, desc, (long long)(flop))) : NULL)
 #define SIMD_PERF_IF(cond, desc) SIMD_PERF_IFF(cond, desc, 0)
-#define SIMD_PERF_END(desc) Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc)->Leave();
-#define SIMD_PERF_INITF(name, desc, flop) Simd::Base::PerformanceMeasurerHolder name(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_FUNCTION, desc, (long long)(flop)), false);
+#define SIMD_PERF_END(desc) { SIMD_PERF_ID(desc, 0); Simd::Base::PerformanceMeasurer * SIMD_CAT(__pmm, __LINE__) = \
+    Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(__pmi, __LINE__)); if (SIMD_CAT(__pmm, __LINE__)) SIMD_CAT(__pmm, __LINE__)->Leave(); }
+#define SIMD_PERF_INITF(name, desc, flop) SIMD_PERF_ID(desc, flop); \
+    Simd::Base::PerformanceMeasurerHolder name(Simd::Base::PerformanceMeasurerStorage::s_storage.Get(SIMD_CAT(__pmi, __LINE__)), false);
 #define SIMD_PERF_INIT(name, desc)  SIMD_PERF_INITF(name, desc, 0);
 #define SIMD_PERF_START(name) name.Enter(); 
 #define SIMD_PERF_PAUSE(name) name.Leave(true);
@@ -184,6 +264,7 @@ namespace Simd
 #define SIMD_PERF_FUNC()
 #define SIMD_PERF_BEGF(desc, flop)
 #define SIMD_PERF_BEG(desc)
+#define SIMD_PERF_BEGKF(key, desc, flop)
 #define SIMD_PERF_IFF(cond, desc, flop)
 #define SIMD_PERF_IF(cond, desc)
 #define SIMD_PERF_END(desc)
@@ -0,0 +1,250 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdRemap_h__
+#define __SimdRemap_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdWarp.h"
+
+#include <vector>
+
+namespace Simd
+{
+    class Remap : public Deletable
+    {
+    public:
+        Remap(const WarpParam & param);
+
+        const WarpParam & Param() const
+        {
+            return _param;
+        }
+
+        void SetMap(const float * map, size_t mapStride);
+        bool SetPerspective(const float * mat);
+
+        void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd) const;
+
+    protected:
+        struct Segment
+        {
+            int32_t beg, end;
+            bool inside;
+        };
+
+        WarpParam _param;
+        Array32i _mapX, _mapY;
+        std::vector<Segment> _segments;
+        std::vector<size_t> _rows;
+
+        void SetCoord(size_t x, size_t y, double sx, double sy);
+        bool Inside(size_t offset) const;
+        void SetSegments();
+
+        virtual void RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const = 0;
+        virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const = 0;
+    };
+
+    namespace Base
+    {
+        class RemapNearest : public Remap
+        {
+        public:
+            RemapNearest(const WarpParam & param);
+
+        protected:
+            virtual void RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapByteBilinear : public Remap
+        {
+        public:
+            RemapByteBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapFloatBilinear : public Remap
+        {
+        public:
+            RemapFloatBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        class RemapNearest : public Base::RemapNearest
+        {
+        public:
+            RemapNearest(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapByteBilinear : public Base::RemapByteBilinear
+        {
+        public:
+            RemapByteBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapFloatBilinear : public Base::RemapFloatBilinear
+        {
+        public:
+            RemapFloatBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class RemapNearest : public Base::RemapNearest
+        {
+        public:
+            RemapNearest(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapByteBilinear : public Base::RemapByteBilinear
+        {
+        public:
+            RemapByteBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapFloatBilinear : public Base::RemapFloatBilinear
+        {
+        public:
+            RemapFloatBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class RemapNearest : public Base::RemapNearest
+        {
+        public:
+            RemapNearest(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapByteBilinear : public Base::RemapByteBilinear
+        {
+        public:
+            RemapByteBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapFloatBilinear : public Base::RemapFloatBilinear
+        {
+        public:
+            RemapFloatBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        class RemapNearest : public Base::RemapNearest
+        {
+        public:
+            RemapNearest(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapByteBilinear : public Base::RemapByteBilinear
+        {
+        public:
+            RemapByteBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class RemapFloatBilinear : public Base::RemapFloatBilinear
+        {
+        public:
+            RemapFloatBilinear(const WarpParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * RemapInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_NEON_ENABLE
+}
+#endif//__SimdRemap_h__
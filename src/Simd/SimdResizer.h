@@ -27,6 +27,8 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
 
+#include <vector>
+
 namespace Simd
 {
     struct ResParam
@@ -62,20 +64,131 @@ namespace Simd
             return type == SimdResizeChannelFloat && 
                 (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp || method == SimdResizeMethodInferenceEngineInterp);
         }
+
+        bool IsByteFilter() const
+        {
+            return type == SimdResizeChannelByte && (method == SimdResizeMethodBicubic || method == SimdResizeMethodLanczos3);
+        }
+
+        bool IsFloatFilter() const
+        {
+            return type == SimdResizeChannelFloat && (method == SimdResizeMethodBicubic || method == SimdResizeMethodLanczos3);
+        }
+
+        bool IsShortBilinear() const
+        {
+            return type == SimdResizeChannelShort && method == SimdResizeMethodBilinear;
+        }
+
+        bool IsShortArea() const
+        {
+            return type == SimdResizeChannelShort && method == SimdResizeMethodArea && dstW <= srcW && dstH <= srcH;
+        }
+
+        size_t ChannelSize() const
+        {
+            return type == SimdResizeChannelFloat ? 4 : (type == SimdResizeChannelShort ? 2 : 1);
+        }
     };
 
     class Resizer : Deletable
     {
     public:
+        typedef void * (*InitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
         Resizer(const ResParam & param)
             : _param(param)
+            , _yBeg(0)
+            , _yEnd(param.dstH)
+            , _init(NULL)
+        {
+        }
+
+        virtual ~Resizer()
+        {
+            for (size_t i = 0; i < _bands.size(); ++i)
+                delete _bands[i];
+        }
+
+        const ResParam & Param() const
         {
+            return _param;
         }
 
         virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
 
+        void SetInit(InitPtr init)
+        {
+            _init = init;
+        }
+
+        bool InitBands(size_t number)
+        {
+            if (_init == NULL)
+                return false;
+            while (_bands.size() < number)
+            {
+                Resizer * band = (Resizer*)_init(_param.srcW, _param.srcH, _param.dstW, _param.dstH, _param.channels, _param.type, _param.method);
+                if (band == NULL)
+                    return false;
+                _bands.push_back(band);
+            }
+            return true;
+        }
+
+        void RunBand(size_t band, size_t yBeg, size_t yEnd, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            _bands[band]->RunRows(yBeg, yEnd, src, srcStride, dst + yBeg * dstStride, dstStride);
+        }
+
+        void RunRows(size_t yBeg, size_t yEnd, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            _yBeg = yBeg;
+            _yEnd = yEnd;
+            Run(src, srcStride, dst, dstStride);
+            _yBeg = 0;
+            _yEnd = _param.dstH;
+        }
+
     protected:
         ResParam _param;
+        size_t _yBeg, _yEnd;
+
+    private:
+        InitPtr _init;
+        std::vector<Resizer*> _bands;
+    };
+
+    class ResizerPyramid : Deletable
+    {
+    public:
+        ResizerPyramid(Resizer::InitPtr init, size_t srcX, size_t srcY, const size_t * dstX, const size_t * dstY, size_t count, 
+            size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+        virtual ~ResizerPyramid();
+
+        size_t Count() const
+        {
+            return _params.size();
+        }
+
+        const ResParam & Param(size_t level) const
+        {
+            return _params[level];
+        }
+
+        bool InitThreads(size_t number);
+        void Run(size_t thread, size_t srcBeg, size_t srcEnd, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride);
+
+    private:
+        Resizer::InitPtr _init;
+        std::vector<ResParam> _params;
+        std::vector<Resizer*> _resizers;
+        size_t _threads, _tile;
+
+        SIMD_INLINE size_t DstRow(size_t level, size_t srcRow) const
+        {
+            return _params[level].dstH * srcRow / _params[level].srcH;
+        }
     };
 
     namespace Base
@@ -105,7 +218,7 @@ namespace Simd
         public:
             ResizerByteArea(const ResParam & param);
 
-            void EstimateParams(size_t srcSize, size_t dstSize, size_t range, int32_t * alpha, int32_t * index);
+            static void EstimateParams(size_t srcSize, size_t dstSize, size_t range, int32_t * alpha, int32_t * index);
 
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
@@ -116,14 +229,103 @@ namespace Simd
             Array32i _ix, _iy;
             Array32f _ax, _ay, _bx[2];
 
-            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas);
-
             virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
 
         public:
             ResizerFloatBilinear(const ResParam & param);
 
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            static void EstimateIndexAlpha(SimdResizeMethodType method, size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas);
+        };
+
+        const int32_t FILTER_BITS = 14;
+        const int32_t FILTER_ROW_SHIFT = 8;
+        const int32_t FILTER_ROW_ROUND = 1 << (FILTER_ROW_SHIFT - 1);
+        const int32_t FILTER_SHIFT = 2 * FILTER_BITS - FILTER_ROW_SHIFT;
+        const int32_t FILTER_ROUND = 1 << (FILTER_SHIFT - 1);
+
+        void ResizerFilterWeights(SimdResizeMethodType method, size_t srcSize, size_t dstSize, size_t & kernel, int32_t * indices, float * weights);
+
+        class ResizerByteFilter : public Resizer
+        {
+        protected:
+            size_t _ky, _kx;
+            Array32i _iy, _ix;
+            Array16i _ay, _ax, _bx;
+
+        public:
+            ResizerByteFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerFloatFilter : public Resizer
+        {
+        protected:
+            size_t _ky, _kx;
+            Array32i _iy, _ix;
+            Array32f _ay, _ax, _bx;
+
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        const int32_t SHORT_LINEAR_SHIFT = 10;
+        const int32_t SHORT_LINEAR_RANGE = 1 << SHORT_LINEAR_SHIFT;
+        const int32_t SHORT_LINEAR_BITS = 4;
+        const int32_t SHORT_LINEAR_ROW_SHIFT = SHORT_LINEAR_SHIFT - SHORT_LINEAR_BITS;
+        const int32_t SHORT_LINEAR_ROW_ROUND = 1 << (SHORT_LINEAR_ROW_SHIFT - 1);
+        const int32_t SHORT_LINEAR_COL_ROUND = 1 << (SHORT_LINEAR_SHIFT - 1);
+        const int32_t SHORT_LINEAR_ROUND = 1 << (SHORT_LINEAR_BITS - 1);
+
+        SIMD_INLINE int32_t ResizerShortBilinearRow(int32_t s0, int32_t s1, int32_t a)
+        {
+            return (s0 << SHORT_LINEAR_BITS) + (((s1 - s0) * a + SHORT_LINEAR_ROW_ROUND) >> SHORT_LINEAR_ROW_SHIFT);
+        }
+
+        SIMD_INLINE int32_t ResizerShortBilinearCol(int32_t r0, int32_t r1, int32_t a)
+        {
+            return (r0 + (((r1 - r0) * a + SHORT_LINEAR_COL_ROUND) >> SHORT_LINEAR_SHIFT) + SHORT_LINEAR_ROUND) >> SHORT_LINEAR_BITS;
+        }
+
+        class ResizerShortBilinear : public Resizer
+        {
+        protected:
+            Array32i _ix, _ax, _iy, _ay, _bx[2];
+
+            virtual void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+        public:
+            ResizerShortBilinear(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            static void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, int32_t * alphas);
+        };
+
+        const int32_t SHORT_AREA_BITS = 12;
+        const int32_t SHORT_AREA_RANGE = 1 << SHORT_AREA_BITS;
+        const int32_t SHORT_AREA_ROW_SHIFT = 11;
+        const int32_t SHORT_AREA_ROW_ROUND = 1 << (SHORT_AREA_ROW_SHIFT - 1);
+        const int32_t SHORT_AREA_SHIFT = 2 * SHORT_AREA_BITS - SHORT_AREA_ROW_SHIFT;
+        const int32_t SHORT_AREA_ROUND = 1 << (SHORT_AREA_SHIFT - 1);
+
+        class ResizerShortArea : public Resizer
+        {
+        protected:
+            Array32i _ax, _tx, _ix, _ay, _ty, _iy, _by;
+
+            static void EstimateParams(size_t srcSize, size_t dstSize, int32_t * alpha, int32_t * tail, int32_t * index);
+
+            template<size_t N> void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+            virtual void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+        public:
+            ResizerShortArea(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
@@ -218,6 +420,38 @@ namespace Simd
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
+        class ResizerByteFilter : public Base::ResizerByteFilter
+        {
+        public:
+            ResizerByteFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerFloatFilter : public Base::ResizerFloatFilter
+        {
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
+        class ResizerShortBilinear : public Base::ResizerShortBilinear
+        {
+        protected:
+            virtual void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Base::ResizerShortArea
+        {
+        protected:
+            template<size_t N> void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+            virtual void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+        public:
+            ResizerShortArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_SSE41_ENABLE
@@ -283,6 +517,42 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerByteFilter : public Base::ResizerByteFilter
+        {
+        protected:
+            void RunH(const int16_t * src, uint8_t * dst);
+        public:
+            ResizerByteFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerFloatFilter : public Base::ResizerFloatFilter
+        {
+        protected:
+            void RunH(const float * src, float * dst);
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
+        class ResizerShortBilinear : public Base::ResizerShortBilinear
+        {
+        protected:
+            virtual void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Base::ResizerShortArea
+        {
+        protected:
+            template<size_t N> void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+            virtual void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+        public:
+            ResizerShortArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX2_ENABLE 
@@ -297,6 +567,13 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerFloatFilter : public Avx2::ResizerFloatFilter
+        {
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX512F_ENABLE 
@@ -325,6 +602,14 @@ namespace Simd
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
+        class ResizerByteFilter : public Avx2::ResizerByteFilter
+        {
+        public:
+            ResizerByteFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX512BW_ENABLE 
@@ -373,6 +658,38 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerByteFilter : public Base::ResizerByteFilter
+        {
+        public:
+            ResizerByteFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerFloatFilter : public Base::ResizerFloatFilter
+        {
+            virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
+        class ResizerShortBilinear : public Base::ResizerShortBilinear
+        {
+        protected:
+            virtual void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Base::ResizerShortArea
+        {
+        protected:
+            template<size_t N> void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+            virtual void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+        public:
+            ResizerShortArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_NEON_ENABLE 
@@ -249,9 +249,9 @@ namespace Simd
 
     struct GemmCbArgs
     {
-        size_t M; size_t N; size_t K; const float * A; const float * pB; float * C;
-        SIMD_INLINE GemmCbArgs(size_t M_, size_t N_, size_t K_, const float * A_, const float * pB_, float * C_)
-            :M(M_), N(N_), K(K_), A(A_), pB(pB_), C(C_)
+        size_t M; size_t N; size_t K; const float * A; const float * pB; float * C; size_t threads;
+        SIMD_INLINE GemmCbArgs(size_t M_, size_t N_, size_t K_, const float * A_, const float * pB_, float * C_, size_t threads_ = 1)
+            :M(M_), N(N_), K(K_), A(A_), pB(pB_), C(C_), threads(threads_)
         {}
     };
 
@@ -274,7 +274,15 @@ namespace Simd
 
         SIMD_INLINE void Run(const GemmCbArgs & args)
         {
-            _run(args.M, args.N, args.K, args.A, args.pB, args.C, _type, _type != GemmKernelAny);
+            if (args.threads > 1)
+            {
+                Simd::Parallel(0, args.M, [&](size_t thread, size_t begin, size_t end)
+                {
+                    _run(end - begin, args.N, args.K, args.A + begin * args.K, args.pB, args.C + begin * args.N, _type, _type != GemmKernelAny);
+                }, args.threads, GEMM_CB_PARALLEL_ROWS);
+            }
+            else
+                _run(args.M, args.N, args.K, args.A, args.pB, args.C, _type, _type != GemmKernelAny);
         }
 
 #ifdef SIMD_RUNTIME_STATISTIC
@@ -299,6 +307,8 @@ namespace Simd
         }
 
     private:
+        static const size_t GEMM_CB_PARALLEL_ROWS = 24;
+
         BufferSizePtr _bufferSize;
         ReorderBPtr _reorderB;
         RunPtr _run;
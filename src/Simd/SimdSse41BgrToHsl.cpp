@@ -0,0 +1,107 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template <bool align> SIMD_INLINE void BgrToHsl(const uint8_t * bgr, uint8_t * hsl)
+        {
+            __m128i _bgr[3] = { Load<align>((__m128i*)bgr + 0), Load<align>((__m128i*)bgr + 1), Load<align>((__m128i*)bgr + 2) };
+            __m128i src[3] = { BgrToBlue(_bgr), BgrToGreen(_bgr), BgrToRed(_bgr) }, dst[3];
+            ConvertColor32<BgrToHsl32>(src, dst);
+            Store<align>((__m128i*)hsl + 0, InterleaveBgr<0>(dst[0], dst[1], dst[2]));
+            Store<align>((__m128i*)hsl + 1, InterleaveBgr<1>(dst[0], dst[1], dst[2]));
+            Store<align>((__m128i*)hsl + 2, InterleaveBgr<2>(dst[0], dst[1], dst[2]));
+        }
+
+        template <bool align> void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(hsl) && Aligned(hslStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BgrToHsl<align>(bgr + col * 3, hsl + col * 3);
+                if (alignedWidth != width)
+                    BgrToHsl<false>(bgr + (width - A) * 3, hsl + (width - A) * 3);
+                bgr += bgrStride;
+                hsl += hslStride;
+            }
+        }
+
+        void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(hsl) && Aligned(hslStride))
+                BgrToHsl<true>(bgr, width, height, bgrStride, hsl, hslStride);
+            else
+                BgrToHsl<false>(bgr, width, height, bgrStride, hsl, hslStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        template <bool align> SIMD_INLINE void HslToBgr(const uint8_t * hsl, uint8_t * bgr)
+        {
+            __m128i _hsl[3] = { Load<align>((__m128i*)hsl + 0), Load<align>((__m128i*)hsl + 1), Load<align>((__m128i*)hsl + 2) };
+            __m128i src[3] = { BgrToBlue(_hsl), BgrToGreen(_hsl), BgrToRed(_hsl) }, dst[3];
+            ConvertColor16<HslToBgr16>(src, dst);
+            Store<align>((__m128i*)bgr + 0, InterleaveBgr<0>(dst[0], dst[1], dst[2]));
+            Store<align>((__m128i*)bgr + 1, InterleaveBgr<1>(dst[0], dst[1], dst[2]));
+            Store<align>((__m128i*)bgr + 2, InterleaveBgr<2>(dst[0], dst[1], dst[2]));
+        }
+
+        template <bool align> void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(hsl) && Aligned(hslStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    HslToBgr<align>(hsl + col * 3, bgr + col * 3);
+                if (alignedWidth != width)
+                    HslToBgr<false>(hsl + (width - A) * 3, bgr + (width - A) * 3);
+                hsl += hslStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(hsl) && Aligned(hslStride) && Aligned(bgr) && Aligned(bgrStride))
+                HslToBgr<true>(hsl, width, height, hslStride, bgr, bgrStride);
+            else
+                HslToBgr<false>(hsl, width, height, hslStride, bgr, bgrStride);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
@@ -0,0 +1,107 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template <bool align> SIMD_INLINE void BgrToHsv(const uint8_t * bgr, uint8_t * hsv)
+        {
+            __m128i _bgr[3] = { Load<align>((__m128i*)bgr + 0), Load<align>((__m128i*)bgr + 1), Load<align>((__m128i*)bgr + 2) };
+            __m128i src[3] = { BgrToBlue(_bgr), BgrToGreen(_bgr), BgrToRed(_bgr) }, dst[3];
+            ConvertColor32<BgrToHsv32>(src, dst);
+            Store<align>((__m128i*)hsv + 0, InterleaveBgr<0>(dst[0], dst[1], dst[2]));
+            Store<align>((__m128i*)hsv + 1, InterleaveBgr<1>(dst[0], dst[1], dst[2]));
+            Store<align>((__m128i*)hsv + 2, InterleaveBgr<2>(dst[0], dst[1], dst[2]));
+        }
+
+        template <bool align> void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(hsv) && Aligned(hsvStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BgrToHsv<align>(bgr + col * 3, hsv + col * 3);
+                if (alignedWidth != width)
+                    BgrToHsv<false>(bgr + (width - A) * 3, hsv + (width - A) * 3);
+                bgr += bgrStride;
+                hsv += hsvStride;
+            }
+        }
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(hsv) && Aligned(hsvStride))
+                BgrToHsv<true>(bgr, width, height, bgrStride, hsv, hsvStride);
+            else
+                BgrToHsv<false>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        template <bool align> SIMD_INLINE void HsvToBgr(const uint8_t * hsv, uint8_t * bgr)
+        {
+            __m128i _hsv[3] = { Load<align>((__m128i*)hsv + 0), Load<align>((__m128i*)hsv + 1), Load<align>((__m128i*)hsv + 2) };
+            __m128i src[3] = { BgrToBlue(_hsv), BgrToGreen(_hsv), BgrToRed(_hsv) }, dst[3];
+            ConvertColor16<HsvToBgr16>(src, dst);
+            Store<align>((__m128i*)bgr + 0, InterleaveBgr<0>(dst[0], dst[1], dst[2]));
+            Store<align>((__m128i*)bgr + 1, InterleaveBgr<1>(dst[0], dst[1], dst[2]));
+            Store<align>((__m128i*)bgr + 2, InterleaveBgr<2>(dst[0], dst[1], dst[2]));
+        }
+
+        template <bool align> void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(hsv) && Aligned(hsvStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    HsvToBgr<align>(hsv + col * 3, bgr + col * 3);
+                if (alignedWidth != width)
+                    HsvToBgr<false>(hsv + (width - A) * 3, bgr + (width - A) * 3);
+                hsv += hsvStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            if (Aligned(hsv) && Aligned(hsvStride) && Aligned(bgr) && Aligned(bgrStride))
+                HsvToBgr<true>(hsv, width, height, hsvStride, bgr, bgrStride);
+            else
+                HsvToBgr<false>(hsv, width, height, hsvStride, bgr, bgrStride);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
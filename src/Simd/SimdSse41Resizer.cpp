@@ -151,7 +151,11 @@ namespace Simd
                 src += N, sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(zero)));
             sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(-next)));
             __m128i res = _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(Base::AREA_ROUND)), Base::AREA_SHIFT);
-            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(res, K_ZERO), K_ZERO));
+            int32_t val = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(res, K_ZERO), K_ZERO));
+            if (N == 4)
+                *(int32_t*)dst = val;
+            else
+                *(int16_t*)dst = int16_t(val), dst[2] = uint8_t(val >> 16);
         }
 
         template<> SIMD_INLINE void ResizerByteAreaResult<4>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint8_t * dst)
@@ -169,7 +173,8 @@ namespace Simd
             size_t dstW = _param.dstW, rowSize = _param.srcW*N, rowRest = dstStride - dstW*N;
             const int32_t * iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += iy[_yBeg] * srcStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += rowRest)
             {
                 int32_t * buf = _by.data;
                 size_t yn = iy[dy + 1] - iy[dy];
@@ -197,11 +202,344 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        //---------------------------------------------------------------------
+
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Base::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowV(const uint8_t * src, size_t stride, const int16_t * ay, size_t ky, int16_t * dst)
+        {
+            static const __m128i ROUND = SIMD_MM_SET1_EPI32(Base::FILTER_ROW_ROUND);
+            __m128i sum0 = _mm_setzero_si128(), sum1 = _mm_setzero_si128();
+            size_t k = 0;
+            for (; k + 1 < ky; k += 2, src += 2 * stride)
+            {
+                __m128i s01 = UnpackU8<0>(_mm_loadl_epi64((__m128i*)src), _mm_loadl_epi64((__m128i*)(src + stride)));
+                __m128i alpha = SetInt16(ay[k + 0], ay[k + 1]);
+                sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(UnpackU8<0>(s01), alpha));
+                sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(UnpackU8<1>(s01), alpha));
+            }
+            if (k < ky)
+            {
+                __m128i s0 = UnpackU8<0>(_mm_loadl_epi64((__m128i*)src));
+                __m128i alpha = SetInt16(ay[k], 0);
+                sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(UnpackU16<0>(s0), alpha));
+                sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(UnpackU16<1>(s0), alpha));
+            }
+            sum0 = _mm_srai_epi32(_mm_add_epi32(sum0, ROUND), Base::FILTER_ROW_SHIFT);
+            sum1 = _mm_srai_epi32(_mm_add_epi32(sum1, ROUND), Base::FILTER_ROW_SHIFT);
+            _mm_storeu_si128((__m128i*)dst, _mm_packs_epi32(sum0, sum1));
+        }
+
+        SIMD_INLINE __m128i ResizerByteFilterSumH(const int16_t * src, const int16_t * ax, size_t kx)
+        {
+            __m128i sum = _mm_setzero_si128();
+            for (size_t k = 0; k < kx; k += HA)
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_loadu_si128((__m128i*)(src + k)), _mm_loadu_si128((__m128i*)(ax + k))));
+            return sum;
+        }
+
+        void ResizerByteFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            static const __m128i ROUND = SIMD_MM_SET1_EPI32(Base::FILTER_ROUND);
+            size_t rs = _param.srcW * _param.channels, rd = _param.dstW * _param.channels;
+            if (rs < HA)
+            {
+                Base::ResizerByteFilter::Run(src, srcStride, dst, dstStride);
+                return;
+            }
+            size_t rsHA = AlignLo(rs, HA), rd4 = AlignLo(rd, 4), kx = _kx;
+            int16_t * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const uint8_t * ps = src + _iy[dy] * srcStride;
+                const int16_t * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rsHA; sx += HA)
+                    ResizerByteFilterRowV(ps + sx, srcStride, ay, _ky, bx + sx);
+                if (rsHA < rs)
+                    ResizerByteFilterRowV(ps + rs - HA, srcStride, ay, _ky, bx + rs - HA);
+                size_t dx = 0;
+                for (; dx < rd4; dx += 4)
+                {
+                    const int16_t * ax = _ax.data + dx * kx;
+                    __m128i s0 = ResizerByteFilterSumH(bx + _ix[dx + 0], ax + 0 * kx, kx);
+                    __m128i s1 = ResizerByteFilterSumH(bx + _ix[dx + 1], ax + 1 * kx, kx);
+                    __m128i s2 = ResizerByteFilterSumH(bx + _ix[dx + 2], ax + 2 * kx, kx);
+                    __m128i s3 = ResizerByteFilterSumH(bx + _ix[dx + 3], ax + 3 * kx, kx);
+                    __m128i sum = _mm_hadd_epi32(_mm_hadd_epi32(s0, s1), _mm_hadd_epi32(s2, s3));
+                    sum = _mm_srai_epi32(_mm_add_epi32(sum, ROUND), Base::FILTER_SHIFT);
+                    *(int32_t*)(dst + dx) = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(sum, K_ZERO), K_ZERO));
+                }
+                for (; dx < rd; ++dx)
+                {
+                    const int16_t * pb = bx + _ix[dx];
+                    const int16_t * ax = _ax.data + dx * kx;
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < kx; ++k)
+                        sum += pb[k] * ax[k];
+                    dst[dx] = Base::RestrictRange((sum + Base::FILTER_ROUND) >> Base::FILTER_SHIFT, 0, 255);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Base::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowV(const float * src, size_t stride, const float * ay, size_t ky, float * dst)
+        {
+            __m128 sum = _mm_setzero_ps();
+            for (size_t k = 0; k < ky; ++k, src += stride)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src), _mm_set1_ps(ay[k])));
+            _mm_storeu_ps(dst, sum);
+        }
+
+        SIMD_INLINE __m128 ResizerFloatFilterSumH(const float * src, const float * ax, size_t kx)
+        {
+            __m128 sum = _mm_setzero_ps();
+            for (size_t k = 0; k < kx; k += F)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + k), _mm_loadu_ps(ax + k)));
+            return sum;
+        }
+
+        void ResizerFloatFilter::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            size_t rs = _param.srcW * _param.channels, rd = _param.dstW * _param.channels;
+            if (rs < F)
+            {
+                Base::ResizerFloatFilter::Run(src, srcStride, dst, dstStride);
+                return;
+            }
+            size_t rsF = AlignLo(rs, F), rdF = AlignLo(rd, F), kx = _kx;
+            float * bx = _bx.data;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const float * ps = src + _iy[dy] * srcStride;
+                const float * ay = _ay.data + dy * _ky;
+                for (size_t sx = 0; sx < rsF; sx += F)
+                    ResizerFloatFilterRowV(ps + sx, srcStride, ay, _ky, bx + sx);
+                if (rsF < rs)
+                    ResizerFloatFilterRowV(ps + rs - F, srcStride, ay, _ky, bx + rs - F);
+                size_t dx = 0;
+                for (; dx < rdF; dx += F)
+                {
+                    const float * ax = _ax.data + dx * kx;
+                    __m128 s0 = ResizerFloatFilterSumH(bx + _ix[dx + 0], ax + 0 * kx, kx);
+                    __m128 s1 = ResizerFloatFilterSumH(bx + _ix[dx + 1], ax + 1 * kx, kx);
+                    __m128 s2 = ResizerFloatFilterSumH(bx + _ix[dx + 2], ax + 2 * kx, kx);
+                    __m128 s3 = ResizerFloatFilterSumH(bx + _ix[dx + 3], ax + 3 * kx, kx);
+                    _mm_storeu_ps(dst + dx, _mm_hadd_ps(_mm_hadd_ps(s0, s1), _mm_hadd_ps(s2, s3)));
+                }
+                for (; dx < rd; ++dx)
+                {
+                    const float * pb = bx + _ix[dx];
+                    const float * ax = _ax.data + dx * kx;
+                    float sum = 0.0f;
+                    for (size_t k = 0; k < kx; ++k)
+                        sum += pb[k] * ax[k];
+                    dst[dx] = sum;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Base::ResizerShortBilinear(param)
+        {
+        }
+
+        SIMD_INLINE __m128i ResizerShortBilinearRow(__m128i s0, __m128i s1, __m128i a)
+        {
+            __m128i d = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(_mm_sub_epi32(s1, s0), a), _mm_set1_epi32(Base::SHORT_LINEAR_ROW_ROUND)), Base::SHORT_LINEAR_ROW_SHIFT);
+            return _mm_add_epi32(_mm_slli_epi32(s0, Base::SHORT_LINEAR_BITS), d);
+        }
+
+        SIMD_INLINE __m128i ResizerShortBilinearCol(const int32_t * r0, const int32_t * r1, __m128i a)
+        {
+            __m128i s0 = _mm_loadu_si128((__m128i*)r0);
+            __m128i d = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(_mm_sub_epi32(_mm_loadu_si128((__m128i*)r1), s0), a), _mm_set1_epi32(Base::SHORT_LINEAR_COL_ROUND)), Base::SHORT_LINEAR_SHIFT);
+            return _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(s0, d), _mm_set1_epi32(Base::SHORT_LINEAR_ROUND)), Base::SHORT_LINEAR_BITS);
+        }
+
+        void ResizerShortBilinear::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            size_t rs4 = AlignLo(rs, 4), rs8 = AlignLo(rs, 8);
+            int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    int32_t * pb = pbx[k];
+                    const uint16_t * ps = src + (sy + k) * srcStride;
+                    const int32_t * ix = _ix.data;
+                    size_t dx = 0;
+                    for (; dx < rs4; dx += 4)
+                    {
+                        __m128i s0 = _mm_setr_epi32(ps[ix[dx + 0]], ps[ix[dx + 1]], ps[ix[dx + 2]], ps[ix[dx + 3]]);
+                        __m128i s1 = _mm_setr_epi32(ps[ix[dx + 0] + cn], ps[ix[dx + 1] + cn], ps[ix[dx + 2] + cn], ps[ix[dx + 3] + cn]);
+                        _mm_storeu_si128((__m128i*)(pb + dx), ResizerShortBilinearRow(s0, s1, _mm_loadu_si128((__m128i*)(_ax.data + dx))));
+                    }
+                    for (; dx < rs; dx++)
+                        pb[dx] = Base::ResizerShortBilinearRow(ps[ix[dx]], ps[ix[dx] + cn], _ax[dx]);
+                }
+
+                __m128i fy = _mm_set1_epi32(_ay[dy]);
+                size_t dx = 0;
+                for (; dx < rs8; dx += 8)
+                {
+                    __m128i d0 = ResizerShortBilinearCol(pbx[0] + dx + 0, pbx[1] + dx + 0, fy);
+                    __m128i d1 = ResizerShortBilinearCol(pbx[0] + dx + 4, pbx[1] + dx + 4, fy);
+                    _mm_storeu_si128((__m128i*)(dst + dx), _mm_packus_epi32(d0, d1));
+                }
+                for (; dx < rs4; dx += 4)
+                    _mm_storel_epi64((__m128i*)(dst + dx), _mm_packus_epi32(ResizerShortBilinearCol(pbx[0] + dx, pbx[1] + dx, fy), K_ZERO));
+                for (; dx < rs; dx++)
+                    dst[dx] = (uint16_t)Base::ResizerShortBilinearCol(pbx[0][dx], pbx[1][dx], _ay[dy]);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Base::ResizerShortArea(param)
+        {
+        }
+
+        template<UpdateType update> SIMD_INLINE void ResizerShortAreaRowUpdate(const uint16_t * src, size_t size, size_t size8, int32_t a, int32_t * dst)
+        {
+            __m128i _a = _mm_set1_epi32(a);
+            size_t i = 0;
+            for (; i < size8; i += 8)
+            {
+                __m128i s = _mm_loadu_si128((__m128i*)(src + i));
+                Update<update, false>(dst + i + 0, _mm_mullo_epi32(_mm_cvtepu16_epi32(s), _a));
+                Update<update, false>(dst + i + 4, _mm_mullo_epi32(_mm_unpackhi_epi16(s, K_ZERO), _a));
+            }
+            for (; i < size; ++i)
+                dst[i] = (update == UpdateAdd ? dst[i] : 0) + src[i] * a;
+        }
+
+        SIMD_INLINE void ResizerShortAreaRowSum(const uint16_t * src, size_t stride, size_t count, size_t size, int32_t curr, int32_t zero, int32_t next, int32_t * dst)
+        {
+            size_t size8 = AlignLo(size, 8);
+            ResizerShortAreaRowUpdate<UpdateSet>(src, size, size8, curr, dst);
+            for (size_t i = 0; i < count; ++i)
+                src += stride, ResizerShortAreaRowUpdate<UpdateAdd>(src, size, size8, zero, dst);
+            ResizerShortAreaRowUpdate<UpdateAdd>(src, size, size8, -next, dst);
+            __m128i round = _mm_set1_epi32(Base::SHORT_AREA_ROW_ROUND);
+            size_t size4 = AlignLo(size, 4), i = 0;
+            for (; i < size4; i += 4)
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_srai_epi32(_mm_add_epi32(_mm_loadu_si128((__m128i*)(dst + i)), round), Base::SHORT_AREA_ROW_SHIFT));
+            for (; i < size; ++i)
+                dst[i] = (dst[i] + Base::SHORT_AREA_ROW_ROUND) >> Base::SHORT_AREA_ROW_SHIFT;
+        }
+
+        template<size_t N> SIMD_INLINE void ResizerShortAreaResult(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            int32_t sum[N];
+            for (size_t c = 0; c < N; ++c)
+                sum[c] = src[c] * curr;
+            for (size_t i = 0; i < count; ++i)
+            {
+                src += N;
+                for (size_t c = 0; c < N; ++c)
+                    sum[c] += src[c] * zero;
+            }
+            for (size_t c = 0; c < N; ++c)
+                dst[c] = (uint16_t)RestrictRange((sum[c] - src[c] * next + Base::SHORT_AREA_ROUND) >> Base::SHORT_AREA_SHIFT, 0, 0xFFFF);
+        }
+
+        template<size_t N> SIMD_INLINE void ResizerShortAreaResult34(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            __m128i sum = _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(curr));
+            for (size_t i = 0; i < count; ++i)
+                src += N, sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(zero)));
+            sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_loadu_si128((__m128i*)src), _mm_set1_epi32(-next)));
+            __m128i res = _mm_packus_epi32(_mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(Base::SHORT_AREA_ROUND)), Base::SHORT_AREA_SHIFT), K_ZERO);
+            if (N == 4)
+                _mm_storel_epi64((__m128i*)dst, res);
+            else
+                *(int32_t*)dst = _mm_cvtsi128_si32(res), dst[2] = (uint16_t)_mm_extract_epi16(res, 2);
+        }
+
+        template<> SIMD_INLINE void ResizerShortAreaResult<4>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            ResizerShortAreaResult34<4>(src, count, curr, zero, next, dst);
+        }
+
+        template<> SIMD_INLINE void ResizerShortAreaResult<3>(const int32_t * src, size_t count, int32_t curr, int32_t zero, int32_t next, uint16_t * dst)
+        {
+            ResizerShortAreaResult34<3>(src, count, curr, zero, next, dst);
+        }
+
+        template<size_t N> void ResizerShortArea::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            size_t dstW = _param.dstW, rowSize = _param.srcW * N;
+            const int32_t * iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data, * ty = _ty.data, * tx = _tx.data;
+            int32_t ay0 = ay[0], ax0 = ax[0];
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                const int32_t * buf = _by.data;
+                size_t yn = iy[dy + 1] - iy[dy];
+                ResizerShortAreaRowSum(src + iy[dy] * srcStride, srcStride, yn, rowSize, ay[dy], ay0, ty[dy], _by.data);
+                for (size_t dx = 0; dx < dstW; dx++)
+                {
+                    size_t xn = ix[dx + 1] - ix[dx];
+                    ResizerShortAreaResult<N>(buf, xn, ax[dx], ax0, tx[dx], dst + dx * N), buf += xn * N;
+                }
+            }
+        }
+
+        void ResizerShortArea::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            switch (_param.channels)
+            {
+            case 1: Run<1>(src, srcStride, dst, dstStride); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128i));
             if (param.IsByteArea())
                 return new ResizerByteArea(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
+            else if (param.IsShortBilinear())
+                return new ResizerShortBilinear(param);
+            else if (param.IsShortArea())
+                return new ResizerShortArea(param);
             else
                 return Ssse3::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
@@ -24,6 +24,9 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdConversion.h"
+#include "Simd/SimdSse2.h"
+#include "Simd/SimdSsse3.h"
+#include "Simd/SimdSynetSetInput.h"
 
 namespace Simd
 {
@@ -350,6 +353,120 @@ namespace Simd
             default: assert(0);
             }
         }
+
+        //---------------------------------------------------------------------
+
+        SynetSetInputYuv::SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+            size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format)
+            : Base::SynetSetInputYuv(srcW, srcH, yuvType, method, lower, upper, dstW, dstH, channels, format)
+        {
+        }
+
+        void SynetSetInputYuv::DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v)
+        {
+            if (_srcW >= DA)
+                Sse2::DeinterleaveUv(uv, 0, _srcW / 2, 1, u, 0, v, 0);
+            else
+                Base::SynetSetInputYuv::DeinterleaveUv(uv, u, v);
+        }
+
+        void SynetSetInputYuv::YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        {
+            if (_srcW >= DA)
+                Ssse3::Yuv422pToBgrV2(y, 0, u, 0, v, 0, _srcW, 1, bgr, 0, _yuvType);
+            else
+                Base::SynetSetInputYuv::YuvToBgr(y, u, v, bgr);
+        }
+
+        SIMD_INLINE void StoreNhwc3(float * dst, __m128 b, __m128 g, __m128 r)
+        {
+            __m128 z = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(b, g, r, z);
+            _mm_storeu_ps(dst + 0, b);
+            _mm_storeu_ps(dst + 3, g);
+            _mm_storeu_ps(dst + 6, r);
+            _mm_storel_pi((__m64*)(dst + 9), z);
+            _mm_store_ss(dst + 11, _mm_movehl_ps(z, z));
+        }
+
+        SIMD_INLINE void StoreNchwXc(float * dst, const __m128 * val, size_t channels, size_t step)
+        {
+            __m128 z = _mm_setzero_ps();
+            __m128 p0 = val[0], p1 = channels > 1 ? val[1] : z, p2 = channels > 1 ? val[2] : z, p3 = z;
+            _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+            _mm_storeu_ps(dst + 0 * step, p0);
+            _mm_storeu_ps(dst + 1 * step, p1);
+            _mm_storeu_ps(dst + 2 * step, p2);
+            _mm_storeu_ps(dst + 3 * step, p3);
+            for (size_t i = 4; i < step; i += 4)
+            {
+                _mm_storeu_ps(dst + 0 * step + i, z);
+                _mm_storeu_ps(dst + 1 * step + i, z);
+                _mm_storeu_ps(dst + 2 * step + i, z);
+                _mm_storeu_ps(dst + 3 * step + i, z);
+            }
+        }
+
+        void SynetSetInputYuv::StoreRow(const float * src0, const float * src1, float alpha, float * dst)
+        {
+            size_t cn = _channels, aligned = AlignLo(_dstW, F), dx = 0;
+            __m128 fy = _mm_set1_ps(alpha), scale[3], shift[3];
+            for (size_t c = 0; c < cn; ++c)
+            {
+                scale[c] = _mm_set1_ps(_scale[c]);
+                shift[c] = _mm_set1_ps(_shift[c]);
+            }
+            for (; dx < aligned; dx += F)
+            {
+                __m128 val[3];
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    __m128 s0 = _mm_loadu_ps(src0 + c * _dstW + dx);
+                    __m128 s1 = _mm_loadu_ps(src1 + c * _dstW + dx);
+                    __m128 s = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(s1, s0), fy), s0);
+                    val[c] = _mm_add_ps(_mm_mul_ps(s, scale[c]), shift[c]);
+                }
+                if (_format == SimdTensorFormatNchw)
+                {
+                    for (size_t c = 0; c < cn; ++c)
+                        _mm_storeu_ps(dst + c * _stepC + dx, val[c]);
+                }
+                else if (_format == SimdTensorFormatNhwc)
+                {
+                    if (cn == 1)
+                        _mm_storeu_ps(dst + dx, val[0]);
+                    else
+                        StoreNhwc3(dst + 3 * dx, val[0], val[1], val[2]);
+                }
+                else
+                    StoreNchwXc(dst + dx * _stepX, val, cn, _stepX);
+            }
+            for (; dx < _dstW; ++dx)
+            {
+                float * pd = dst + dx * _stepX;
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    float s0 = src0[c * _dstW + dx], s1 = src1[c * _dstW + dx];
+                    pd[c * _stepC] = (s0 + (s1 - s0) * alpha) * _scale[c] + _shift[c];
+                }
+                for (size_t c = cn; c < _stepX; ++c)
+                    pd[c] = 0;
+            }
+        }
+
+        void SynetSetInputYuv420p(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, u, uStride, v, vStride, dst);
+        }
+
+        void SynetSetInputNv12(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+            SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper, float * dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat)
+        {
+            SynetSetInputYuv & setInput = Base::GetSynetSetInputYuv<SynetSetInputYuv>(srcWidth, srcHeight, yuvType, method, lower, upper, dstWidth, dstHeight, channels, dstFormat);
+            setInput.Run(y, yStride, uv, uvStride, NULL, 0, dst);
+        }
     }
 #endif//SIMD_SSE41_ENABLE
 }
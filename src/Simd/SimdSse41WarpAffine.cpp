@@ -0,0 +1,240 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarpAffine.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        WarpAffineNearest::WarpAffineNearest(const WarpAffParam & param)
+            : Base::WarpAffineNearest(param)
+        {
+        }
+
+        void WarpAffineNearest::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t pixelSize = _param.PixelSize(), x = beg, end4 = beg + AlignLoAny(end - beg, 4);
+            __m128 rx = _mm_set1_ps(_rx[y]), ry = _mm_set1_ps(_ry[y]);
+            __m128i _pixelSize = _mm_set1_epi32((int)pixelSize), _srcStride = _mm_set1_epi32((int)srcStride);
+            SIMD_ALIGNED(16) int32_t offs[4];
+            for (; x < end4; x += 4)
+            {
+                __m128i ix = _mm_cvttps_epi32(_mm_add_ps(_mm_loadu_ps(_cx.data + x), rx));
+                __m128i iy = _mm_cvttps_epi32(_mm_add_ps(_mm_loadu_ps(_cy.data + x), ry));
+                _mm_store_si128((__m128i*)offs, _mm_add_epi32(_mm_mullo_epi32(ix, _pixelSize), _mm_mullo_epi32(iy, _srcStride)));
+                for (size_t i = 0; i < 4; ++i)
+                    Base::WarpCopyPixel(src + offs[i], pixelSize, dst + (x + i) * pixelSize);
+            }
+            Base::WarpAffineNearest::RunInterior(src, srcStride, y, x, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineByteBilinear::WarpAffineByteBilinear(const WarpAffParam & param)
+            : Base::WarpAffineByteBilinear(param)
+        {
+        }
+
+        SIMD_INLINE void ByteBilinearCoords(const float * cx, const float * cy, __m128 rx, __m128 ry, __m128i pixelSize, __m128i srcStride, 
+            __m128i & offs, __m128i & wA, __m128i & wB)
+        {
+            static const __m128 k_range = _mm_set1_ps((float)WARP_RANGE);
+            static const __m128 k_half = _mm_set1_ps(0.5f);
+            static const __m128i k_irange = _mm_set1_epi32(WARP_RANGE);
+            __m128 sx = _mm_add_ps(_mm_loadu_ps(cx), rx);
+            __m128 sy = _mm_add_ps(_mm_loadu_ps(cy), ry);
+            __m128i ix = _mm_cvttps_epi32(sx), iy = _mm_cvttps_epi32(sy);
+            __m128i fx = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(sx, _mm_cvtepi32_ps(ix)), k_range), k_half));
+            __m128i fy = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(sy, _mm_cvtepi32_ps(iy)), k_range), k_half));
+            __m128i gx = _mm_sub_epi32(k_irange, fx), gy = _mm_sub_epi32(k_irange, fy);
+            offs = _mm_add_epi32(_mm_mullo_epi32(ix, pixelSize), _mm_mullo_epi32(iy, srcStride));
+            wA = _mm_or_si128(_mm_mullo_epi32(gx, gy), _mm_slli_epi32(_mm_mullo_epi32(fx, gy), 16));
+            wB = _mm_or_si128(_mm_mullo_epi32(gx, fy), _mm_slli_epi32(_mm_mullo_epi32(fx, fy), 16));
+        }
+
+        SIMD_INLINE __m128i ByteBilinearSum(__m128i s0, __m128i s1, __m128i wA, __m128i wB)
+        {
+            static const __m128i k_round = _mm_set1_epi32(WARP_ROUND);
+            __m128i sum = _mm_add_epi32(_mm_madd_epi16(s0, wA), _mm_madd_epi16(s1, wB));
+            return _mm_srli_epi32(_mm_add_epi32(sum, k_round), 2 * WARP_SHIFT);
+        }
+
+        template<int N> SIMD_INLINE __m128i LoadPixel(const uint8_t * src)
+        {
+            switch (N)
+            {
+            case 2: return _mm_cvtsi32_si128(*(uint16_t*)src);
+            case 3: return _mm_cvtsi32_si128(*(uint16_t*)src | (src[2] << 16));
+            case 4: return _mm_cvtsi32_si128(*(int32_t*)src);
+            }
+            return _mm_setzero_si128();
+        }
+
+        template<int N> SIMD_INLINE void StorePixel(__m128i value, uint8_t * dst)
+        {
+            int32_t pixel = _mm_cvtsi128_si32(value);
+            switch (N)
+            {
+            case 2: *(uint16_t*)dst = (uint16_t)pixel; break;
+            case 3: *(uint16_t*)dst = (uint16_t)pixel; dst[2] = (uint8_t)(pixel >> 16); break;
+            case 4: *(int32_t*)dst = pixel; break;
+            }
+        }
+
+        template<int N> SIMD_INLINE void ByteBilinearPixel(const uint8_t * p0, size_t srcStride, int32_t wA, int32_t wB, uint8_t * dst)
+        {
+            const uint8_t * p1 = p0 + srcStride;
+            __m128i s0 = _mm_cvtepu8_epi16(_mm_unpacklo_epi8(LoadPixel<N>(p0), LoadPixel<N>(p0 + N)));
+            __m128i s1 = _mm_cvtepu8_epi16(_mm_unpacklo_epi8(LoadPixel<N>(p1), LoadPixel<N>(p1 + N)));
+            __m128i sum = ByteBilinearSum(s0, s1, _mm_set1_epi32(wA), _mm_set1_epi32(wB));
+            StorePixel<N>(_mm_packus_epi16(_mm_packs_epi32(sum, K_ZERO), K_ZERO), dst);
+        }
+
+        SIMD_INLINE int32_t LoadPair(const uint8_t * src)
+        {
+            return src[0] | (src[1] << 16);
+        }
+
+        template<int N> void ByteBilinearInterior(const uint8_t * src, size_t srcStride, const float * cx, const float * cy, float rx, float ry, size_t & x, size_t end, uint8_t * dst)
+        {
+            size_t end4 = x + AlignLoAny(end - x, 4);
+            __m128 _rx = _mm_set1_ps(rx), _ry = _mm_set1_ps(ry);
+            __m128i _pixelSize = _mm_set1_epi32(N), _srcStride = _mm_set1_epi32((int)srcStride);
+            SIMD_ALIGNED(16) int32_t offs[4], wA[4], wB[4];
+            for (; x < end4; x += 4)
+            {
+                __m128i _offs, _wA, _wB;
+                ByteBilinearCoords(cx + x, cy + x, _rx, _ry, _pixelSize, _srcStride, _offs, _wA, _wB);
+                if (N == 1)
+                {
+                    _mm_store_si128((__m128i*)offs, _offs);
+                    const uint8_t * src1 = src + srcStride;
+                    __m128i s0 = _mm_setr_epi32(LoadPair(src + offs[0]), LoadPair(src + offs[1]), LoadPair(src + offs[2]), LoadPair(src + offs[3]));
+                    __m128i s1 = _mm_setr_epi32(LoadPair(src1 + offs[0]), LoadPair(src1 + offs[1]), LoadPair(src1 + offs[2]), LoadPair(src1 + offs[3]));
+                    __m128i sum = ByteBilinearSum(s0, s1, _wA, _wB);
+                    *(int32_t*)(dst + x) = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(sum, K_ZERO), K_ZERO));
+                }
+                else
+                {
+                    _mm_store_si128((__m128i*)offs, _offs);
+                    _mm_store_si128((__m128i*)wA, _wA);
+                    _mm_store_si128((__m128i*)wB, _wB);
+                    for (size_t i = 0; i < 4; ++i)
+                        ByteBilinearPixel<N>(src + offs[i], srcStride, wA[i], wB[i], dst + (x + i) * N);
+                }
+            }
+        }
+
+        void WarpAffineByteBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t x = beg;
+            switch (_param.channels)
+            {
+            case 1: ByteBilinearInterior<1>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], x, end, dst); break;
+            case 2: ByteBilinearInterior<2>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], x, end, dst); break;
+            case 3: ByteBilinearInterior<3>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], x, end, dst); break;
+            case 4: ByteBilinearInterior<4>(src, srcStride, _cx.data, _cy.data, _rx[y], _ry[y], x, end, dst); break;
+            }
+            Base::WarpAffineByteBilinear::RunInterior(src, srcStride, y, x, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpAffineFloatBilinear::WarpAffineFloatBilinear(const WarpAffParam & param)
+            : Base::WarpAffineFloatBilinear(param)
+        {
+        }
+
+        SIMD_INLINE __m128 FloatBilinearInterp(__m128 p00, __m128 p01, __m128 p10, __m128 p11, __m128 fx, __m128 fy)
+        {
+            __m128 gx = _mm_sub_ps(_mm_set1_ps(1.0f), fx), gy = _mm_sub_ps(_mm_set1_ps(1.0f), fy);
+            __m128 r0 = _mm_add_ps(_mm_mul_ps(p00, gx), _mm_mul_ps(p01, fx));
+            __m128 r1 = _mm_add_ps(_mm_mul_ps(p10, gx), _mm_mul_ps(p11, fx));
+            return _mm_add_ps(_mm_mul_ps(r0, gy), _mm_mul_ps(r1, fy));
+        }
+
+        void WarpAffineFloatBilinear::RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const
+        {
+            size_t cn = _param.channels, stride = srcStride / sizeof(float), x = beg;
+            if (cn == 1 || cn == 4)
+            {
+                size_t end4 = beg + AlignLoAny(end - beg, 4);
+                const float * ps = (float*)src;
+                float * pd = (float*)dst;
+                __m128 rx = _mm_set1_ps(_rx[y]), ry = _mm_set1_ps(_ry[y]);
+                __m128i _cn = _mm_set1_epi32((int)cn), _stride = _mm_set1_epi32((int)stride);
+                SIMD_ALIGNED(16) int32_t offs[4];
+                SIMD_ALIGNED(16) float fx[4], fy[4];
+                for (; x < end4; x += 4)
+                {
+                    __m128 sx = _mm_add_ps(_mm_loadu_ps(_cx.data + x), rx);
+                    __m128 sy = _mm_add_ps(_mm_loadu_ps(_cy.data + x), ry);
+                    __m128i ix = _mm_cvttps_epi32(sx), iy = _mm_cvttps_epi32(sy);
+                    __m128 _fx = _mm_sub_ps(sx, _mm_cvtepi32_ps(ix));
+                    __m128 _fy = _mm_sub_ps(sy, _mm_cvtepi32_ps(iy));
+                    _mm_store_si128((__m128i*)offs, _mm_add_epi32(_mm_mullo_epi32(ix, _cn), _mm_mullo_epi32(iy, _stride)));
+                    if (cn == 1)
+                    {
+                        const float * p0 = ps, * p1 = ps + stride;
+                        __m128 p00 = _mm_setr_ps(p0[offs[0] + 0], p0[offs[1] + 0], p0[offs[2] + 0], p0[offs[3] + 0]);
+                        __m128 p01 = _mm_setr_ps(p0[offs[0] + 1], p0[offs[1] + 1], p0[offs[2] + 1], p0[offs[3] + 1]);
+                        __m128 p10 = _mm_setr_ps(p1[offs[0] + 0], p1[offs[1] + 0], p1[offs[2] + 0], p1[offs[3] + 0]);
+                        __m128 p11 = _mm_setr_ps(p1[offs[0] + 1], p1[offs[1] + 1], p1[offs[2] + 1], p1[offs[3] + 1]);
+                        _mm_storeu_ps(pd + x, FloatBilinearInterp(p00, p01, p10, p11, _fx, _fy));
+                    }
+                    else
+                    {
+                        _mm_store_ps(fx, _fx);
+                        _mm_store_ps(fy, _fy);
+                        for (size_t i = 0; i < 4; ++i)
+                        {
+                            const float * p0 = ps + offs[i], * p1 = p0 + stride;
+                            _mm_storeu_ps(pd + (x + i) * 4, FloatBilinearInterp(_mm_loadu_ps(p0), _mm_loadu_ps(p0 + 4), 
+                                _mm_loadu_ps(p1), _mm_loadu_ps(p1 + 4), _mm_set1_ps(fx[i]), _mm_set1_ps(fy[i])));
+                        }
+                    }
+                }
+            }
+            Base::WarpAffineFloatBilinear::RunInterior(src, srcStride, y, x, end, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+        {
+            WarpAffParam param(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpAffineNearest(param);
+            else if (param.IsByte())
+                return new WarpAffineByteBilinear(param);
+            else
+                return new WarpAffineFloatBilinear(param);
+        }
+    }
+#endif //SIMD_SSE41_ENABLE
+}
@@ -45,7 +45,7 @@ namespace Simd
         {
             if (_ax.data)
                 return;
-            if (_param.channels == 1 && _param.srcW < 4 * _param.dstW)
+            if (_param.channels == 1 && _param.srcW < 4 * _param.dstW && _param.srcW >= A)
                 _blocks = BlockCountMax(A);
             float scale = (float)_param.srcW / _param.dstW;
             _ax.Resize(AlignHi(_param.dstW, A) * _param.channels * 2, false, _param.align);
@@ -220,7 +220,7 @@ namespace Simd
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm_set1_epi16(int16_t(_ay[yDst]));
@@ -277,7 +277,7 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm_set1_epi16(int16_t(_ay[yDst]));
@@ -28,6 +28,7 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetInternal.h"
 
 #ifdef _N
 #undef _N
@@ -142,8 +143,9 @@ namespace Simd
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
+            , _threadNumber(p.Flop() / p.batch >= PARALLEL_FLOP_MIN ? Base::GetThreadNumber() : 1)
 #if defined(SIMD_PERFORMANCE_STATISTIC)
-            , _perf(NULL)
+            , _perf(0)
 #endif
         {
         }
@@ -168,6 +170,9 @@ namespace Simd
 
         virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
         {
+            SynetInternals internals;
+            GetInternals(internals);
+            Base::SynetUnshare(internals);
             _weight = weight;
             if (internal)
                 *internal = SimdFalse;
@@ -177,6 +182,9 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        size_t Export(void * data, size_t size) const;
+        bool Import(const void * data, size_t size, const float * bias, const float * params, bool copy);
+
         float * Buffer(float * buffer)
         {
             if (buffer)
@@ -197,6 +205,9 @@ namespace Simd
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        virtual void GetInternals(SynetInternals & internals);
+        virtual void SetInternals(const float * bias, const float * params);
+
         ConvParam32f _param;
         Array32f _buffer;
         float _0, _1;
@@ -207,15 +218,70 @@ namespace Simd
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        size_t _threadNumber;
 #if defined(SIMD_PERFORMANCE_STATISTIC)
-        Base::PerformanceMeasurer * _perf;
+        size_t _perf;
 #endif
+
+        static const long long PARALLEL_FLOP_MIN = 4 * 1024 * 1024;
     };
 
     namespace Base
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        size_t RowBandCount(const ConvParam32f & p, size_t threads);
+        ConvParam32f RowBand(const ConvParam32f & p, size_t dyBeg, size_t dyEnd, size_t & syBeg);
+
+        String SynetConvolution32fSignature(const ConvParam32f & p);
+
+        void SynetConvolution32fSetAutotune(const char * path);
+
+        /*! Implementations that can run the parameters are added in order of priority: without autotuning the first preferable one is selected, else the fastest one. */
+        class SynetConvolution32fAutotune
+        {
+        public:
+            typedef SynetConvolution32f* (*CreatePtr)(const ConvParam32f & p);
+
+            static bool Enable();
+
+            SynetConvolution32fAutotune(const ConvParam32f & p, const char * isa)
+                : _param(p)
+                , _isa(isa)
+            {
+            }
+
+            template<class Convolution> void Add(const char * name, bool supported, bool preferable)
+            {
+                if (supported)
+                    _candidates.push_back(Candidate(name, Create<Convolution>, preferable));
+            }
+
+            SynetConvolution32f * Select() const;
+
+        private:
+            struct Candidate
+            {
+                String name;
+                CreatePtr create;
+                bool preferable;
+                Candidate(const String & n, CreatePtr c, bool p) : name(n), create(c), preferable(p) {}
+            };
+            typedef std::vector<Candidate> Candidates;
+
+            ConvParam32f _param;
+            String _isa;
+            Candidates _candidates;
+
+            template<class Convolution> static SynetConvolution32f * Create(const ConvParam32f & p)
+            {
+                return new Convolution(p);
+            }
+
+            String Key() const;
+            double Measure(const Candidate & candidate) const;
+        };
+
         class SynetConvolution32fGemmNN : public SynetConvolution32f
         {
         public:
@@ -243,6 +309,7 @@ namespace Simd
             virtual size_t ExternalBufferSize() const;
             virtual void Forward(const float * src, float * buf, float * dst);
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
 
         protected:
@@ -262,6 +329,7 @@ namespace Simd
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
 
         protected:
@@ -269,6 +337,8 @@ namespace Simd
             typedef void(*SetInput)(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
             typedef void(*SetOutput)(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
 
+            virtual void GetInternals(SynetInternals & internals);
+
             void SetBlock(size_t blockY, size_t blockX);
             void ForwardMerged(const float * src, float * bufS, float * bufD, float * dst);
             void ForwardSplitted(const float * src, float * bufS, float * bufD, float * dst);
@@ -295,11 +365,13 @@ namespace Simd
             virtual size_t ExternalBufferSize() const;
             virtual void Forward(const float * src, float * buf, float * dst);
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
 
             typedef void(*ConvolutionBiasActivationPtr)(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight, const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW);
         protected:
             void Pad(const float * src, float * dst) const;
+            void ForwardChannels(const float * src, float * buf, size_t dcBeg, size_t dcEnd, float * dst);
             virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
 
             size_t _grW, _grS, _grD, _srcC, _srcH, _srcW, _dstC;
@@ -315,6 +387,7 @@ namespace Simd
             virtual String Desc() const { return Ext() + "::DirectNhwc"; }
             virtual void Forward(const float * src, float * buf, float * dst);
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
 
             typedef void(*ConvolutionBiasActivationPtr)(const float * src, const ConvParam32f & p, const float * weight, const float * bias, const float * params, float * dst);
@@ -333,6 +406,7 @@ namespace Simd
             virtual String Desc() const { return Ext() + "::DepthwiseDotProduct"; }
             virtual void Forward(const float * src, float * buf, float * dst);
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
 
         protected:
@@ -351,6 +425,7 @@ namespace Simd
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
 
             struct AlgParam;
@@ -373,13 +448,17 @@ namespace Simd
             size_t _sizeS, _sizeD;
             Array32f _rWeight, _rBias, _rParams;
 
-            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
+            virtual void GetInternals(SynetInternals & internals);
+            virtual void SetInternals(const float * bias, const float * params);
+            void SetBias(const float * bias, const float * params);
+
+            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, size_t dyBeg, size_t dyEnd, const float* weight, const float* bias, const float* params, float* dst);
 
             struct RunArgs
             {
-                const float* src; const ConvParam32f& p; const float* weight; const float* bias; const float* params; float* dst;
-                SIMD_INLINE RunArgs(const float* src_, const ConvParam32f& p_, const float* weight_, const float* bias_, const float* params_, float* dst_)
-                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), dst(dst_)
+                const float* src; const ConvParam32f& p; const float* weight; const float* bias; const float* params; float* dst; size_t threads;
+                SIMD_INLINE RunArgs(const float* src_, const ConvParam32f& p_, const float* weight_, const float* bias_, const float* params_, float* dst_, size_t threads_)
+                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), dst(dst_), threads(threads_)
                 {}
             };
 
@@ -394,7 +473,10 @@ namespace Simd
 
                 SIMD_INLINE void Run(const RunArgs& args)
                 {
-                    Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.dst);
+                    Simd::Parallel(0, args.p.dstH, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        Forward(args.src, args.p, alg, begin, end, args.weight, args.bias, args.params, args.dst);
+                    }, args.threads);
                 }
 
 #ifdef SIMD_RUNTIME_STATISTIC
@@ -470,6 +552,7 @@ namespace Simd
             SynetConvolution32fDirectNhwc(const ConvParam32f & p);
             virtual String Ext() const { return "Sse2"; }
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
         protected:
             virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
@@ -489,6 +572,7 @@ namespace Simd
             SynetConvolution32fNhwcDirect(const ConvParam32f & p);
             virtual String Ext() const { return "Sse2"; }
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
         private:
             static bool Set2f(const ConvParam32f& p, OldConvolutionPtr& convolution);
@@ -691,6 +775,7 @@ namespace Simd
             SynetConvolution32fDirectNchw(const ConvParam32f & p);
             virtual String Ext() const { return "Avx512f"; }
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
 
         protected:
@@ -770,6 +855,7 @@ namespace Simd
             SynetConvolution32fDirectNhwc(const ConvParam32f & p);
             virtual String Ext() const { return "Neon"; }
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
         protected:
             virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
@@ -789,6 +875,7 @@ namespace Simd
             SynetConvolution32fNhwcDirect(const ConvParam32f & p);
             virtual String Ext() const { return "Neon"; }
 
+            static bool Supported(const ConvParam32f & p);
             static bool Preferable(const ConvParam32f & p);
         private:
             static bool Set2f(const ConvParam32f& p, OldConvolutionPtr& convolution);
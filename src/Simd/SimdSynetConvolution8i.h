@@ -26,6 +26,7 @@
 
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdSynetInternal.h"
 
 #ifdef _N
 #undef _N
@@ -192,6 +193,9 @@ namespace Simd
 
         virtual void Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst);
 
+        size_t Export(void * data, size_t size) const;
+        bool Import(const void * data, size_t size, bool copy);
+
 #if defined(SIMD_PERFORMANCE_STATISTIC)
         Base::PerformanceMeasurer* Perf(const String & func);
 #endif
@@ -199,13 +203,17 @@ namespace Simd
     protected:
         virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst) = 0;
 
+        virtual void GetInternals(SynetInternals & internals);
+        virtual void SetInternals();
+        String Tag() const;
+
         typedef void(*Convert32fTo8u)(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
 
         ConvParam8i _param;
         SimdSynetCompatibilityType _compatibility;
         Array8u _buffer;
 #if defined(SIMD_PERFORMANCE_STATISTIC)
-        Base::PerformanceMeasurer * _perf;
+        size_t _perf;
 #endif
         Convert32fTo8u _convertSrc;
         CvtParam _srcCvt, _dstCvt;
@@ -213,7 +221,11 @@ namespace Simd
         Array32i _norm32i;
         Array32f _norm32f; 
         bool _src8u, _dst8u, _overflow16i;
-        size_t _merge, _sizeS, _sizeD;
+        size_t _merge, _sizeS, _sizeD, _threadNumber;
+
+        static const long long PARALLEL_FLOP_MIN = 4 * 1024 * 1024;
+
+        void ConvertSrc(const float * src, uint8_t * dst);
     };
 
     namespace Base
@@ -272,11 +284,14 @@ namespace Simd
                 const int8_t* weight, const int32_t* bias, const int32_t* params, const float* scale, const float* shift, int32_t* buf, uint8_t* dst);
 
         protected:
+            virtual void GetInternals(SynetInternals & internals);
+            virtual void SetInternals();
+
             void SetAlgParam(size_t F, size_t microD, size_t L1, size_t L2, size_t L3);
             void ReorderWeight();
 
             virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-            void Forward8u(const uint8_t* src, int32_t* buf, uint8_t* dst);
+            void Forward8u(const uint8_t* src, size_t dyBeg, size_t dyEnd, size_t dcBeg, size_t dcEnd, int32_t* buf, uint8_t* dst);
 
             AlgParam _alg;
             ConvolutionPtr _convolutions[Term8iSize];
@@ -28,6 +28,7 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetInternal.h"
 
 #ifdef _N
 #undef _N
@@ -115,7 +116,7 @@ namespace Simd
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
 #if defined(SIMD_PERFORMANCE_STATISTIC)
-            , _perf(NULL)
+            , _perf(0)
 #endif
         {
         }
@@ -140,6 +141,9 @@ namespace Simd
 
         virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
         {
+            SynetInternals internals;
+            GetInternals(internals);
+            Base::SynetUnshare(internals);
             _weight = weight;
             if (internal)
                 *internal = SimdFalse;
@@ -149,6 +153,9 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        size_t Export(void * data, size_t size) const;
+        bool Import(const void * data, size_t size, const float * bias, const float * params, bool copy);
+
         float * Buffer(float * buffer)
         {
             if (buffer)
@@ -169,6 +176,10 @@ namespace Simd
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        virtual void GetInternals(SynetInternals & internals);
+        virtual void SetInternals(const float * bias, const float * params);
+        String Tag() const;
+
         DeconvParam32f _param;
         Array32f _buffer;
         float _0, _1;
@@ -180,7 +191,7 @@ namespace Simd
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
 #if defined(SIMD_PERFORMANCE_STATISTIC)
-        Base::PerformanceMeasurer * _perf;
+        size_t _perf;
 #endif
     };
 
@@ -223,6 +234,10 @@ namespace Simd
             typedef void(*DeconvolutionPtr)(const float * src, const DeconvParam32f & p, const AlgParam & a, const float * weight, const float * bias, const float * params, float * dst);
 
         protected:
+            virtual void GetInternals(SynetInternals & internals);
+            virtual void SetInternals(const float * bias, const float * params);
+            void SetBias(const float * bias, const float * params);
+
             void SetAlgParam(size_t F, size_t L1, size_t L2, size_t L3);
             void ReorderWeight(const float * src, float * dst);
 
@@ -0,0 +1,123 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetInternal_h__
+#define __SimdSynetInternal_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPerformance.h"
+
+#include <vector>
+
+namespace Simd
+{
+    /*! Internal buffer of Synet layer (reordered weights and so on) which is saved by export and restored by import of the layer. */
+    class SynetInternal
+    {
+    public:
+        template<class T> SynetInternal(Array<T> & array, size_t size)
+            : _array(&array)
+            , _size(size * sizeof(T))
+            , _data(Data<T>)
+            , _set(Set<T>)
+        {
+        }
+
+        /*! Gets size (in bytes) which the buffer must have for given parameters of the layer. */
+        SIMD_INLINE size_t Size() const
+        {
+            return _size;
+        }
+
+        SIMD_INLINE const void * Data(size_t & size) const
+        {
+            bool shared;
+            return _data(_array, size, shared);
+        }
+
+        /*! Copies data to own memory of the buffer or uses external memory directly (share). */
+        SIMD_INLINE void Set(const void * data, bool share) const
+        {
+            _set(_array, data, _size, share);
+        }
+
+        /*! Moves content of shared buffer to own memory. */
+        SIMD_INLINE void Unshare() const
+        {
+            size_t size;
+            bool shared;
+            const void * data = _data(_array, size, shared);
+            if (shared)
+                _set(_array, data, size, false);
+        }
+
+    private:
+        typedef const void * (*DataPtr)(void * array, size_t & size, bool & shared);
+        typedef void (*SetPtr)(void * array, const void * data, size_t size, bool share);
+
+        void * _array;
+        size_t _size;
+        DataPtr _data;
+        SetPtr _set;
+
+        template<class T> static const void * Data(void * array, size_t & size, bool & shared)
+        {
+            Array<T> & a = *(Array<T>*)array;
+            size = a.size * sizeof(T);
+            shared = a.Shared();
+            return a.data;
+        }
+
+        template<class T> static void Set(void * array, const void * data, size_t size, bool share)
+        {
+            Array<T> & a = *(Array<T>*)array;
+            if (share)
+                a.Share((T*)data, size / sizeof(T));
+            else
+            {
+                if (a.Shared())
+                    a.Resize(0);
+                a.Resize(size / sizeof(T));
+                if (size)
+                    memcpy(a.data, data, size);
+            }
+        }
+    };
+
+    typedef std::vector<SynetInternal> SynetInternals;
+
+    namespace Base
+    {
+        String SynetCpuSignature();
+
+        String SynetConvSignature(const SimdConvolutionParameters & c);
+
+        size_t SynetExport(const SynetInternals & internals, const String & tag, void * data, size_t size);
+
+        bool SynetImport(const SynetInternals & internals, const String & tag, const void * data, size_t size, bool copy);
+
+        void SynetUnshare(const SynetInternals & internals);
+    }
+}
+
+#endif//__SimdSynetInternal_h__
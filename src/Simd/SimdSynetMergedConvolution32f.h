@@ -27,6 +27,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
+#include "Simd/SimdSynetInternal.h"
 
 #ifdef _N
 #undef _N
@@ -127,7 +128,7 @@ namespace Simd
         SynetMergedConvolution32f()
         {
 #if defined(SIMD_PERFORMANCE_STATISTIC)
-            _perf = NULL;
+            _perf = 0;
 #endif
         }
 
@@ -143,13 +144,17 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        virtual size_t Export(void * data, size_t size) const = 0;
+
+        virtual bool Import(const void * data, size_t size, const float * const * bias, const float * const * params, bool copy) = 0;
+
 #if defined(SIMD_PERFORMANCE_STATISTIC)
         Base::PerformanceMeasurer* Perf(const String& func);
 #endif
 
     private:
 #if defined(SIMD_PERFORMANCE_STATISTIC)
-        Base::PerformanceMeasurer * _perf;
+        size_t _perf;
 #endif
     };
 
@@ -166,11 +171,16 @@ namespace Simd
             virtual size_t InternalBufferSize() const;
             virtual void SetParams(const float * const * weight, SimdBool * internal, const float * const * bias, const float * const * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual size_t Export(void * data, size_t size) const;
+            virtual bool Import(const void * data, size_t size, const float * const * bias, const float * const * params, bool copy);
 
             typedef void(*ConvolutionPtr)(const float * src, const SimdConvolutionParameters & p, size_t maC, size_t yBeg, size_t yEnd, 
                 const size_t bufH[2], const float * weight, const float * bias, const float * params, float * dst);
 
         protected:
+            void GetInternals(SynetInternals & internals);
+            void SetBias(const float * const * bias, const float * const * params);
+            String Tag() const;
             void SetSize(size_t L1, size_t L2, size_t L3, size_t F);
             float * GetBuffer(float * buffer);
             virtual void ReorderInputWeight(const float * src, float * dst) const;
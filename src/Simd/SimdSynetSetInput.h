@@ -0,0 +1,147 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetSetInput_h__
+#define __SimdSynetSetInput_h__
+
+#include "Simd/SimdArray.h"
+
+#include <memory>
+
+namespace Simd
+{
+    namespace Base
+    {
+        class SynetSetInputYuv
+        {
+        public:
+            SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+                size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format);
+            virtual ~SynetSetInputYuv() {}
+
+            static bool Supported(size_t srcW, size_t srcH, SimdResizeMethodType method, size_t channels, SimdTensorFormatType format);
+
+            bool Equal(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format) const;
+
+            void SetRange(const float * lower, const float * upper);
+
+            void Run(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, float * dst);
+
+        protected:
+            size_t _srcW, _srcH, _dstW, _dstH, _channels, _stepC, _stepX;
+            SimdYuvType _yuvType;
+            SimdResizeMethodType _method;
+            SimdTensorFormatType _format;
+            float _scale[3], _shift[3];
+            Array32i _ix, _iy;
+            Array32f _ax, _ay;
+            uint8_t _gray[256];
+
+            void Run(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, float * dst, size_t dyBeg, size_t dyEnd);
+
+            virtual void DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v);
+            virtual void YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr);
+            virtual void ResizeRow(const uint8_t * src, float * dst);
+            virtual void StoreRow(const float * src0, const float * src1, float alpha, float * dst);
+        };
+
+        template<class SetInput> SetInput & GetSynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method,
+            const float * lower, const float * upper, size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format)
+        {
+            static thread_local std::unique_ptr<SetInput> setInput;
+            if (setInput && setInput->Equal(srcW, srcH, yuvType, method, dstW, dstH, channels, format))
+                setInput->SetRange(lower, upper);
+            else
+                setInput.reset(new SetInput(srcW, srcH, yuvType, method, lower, upper, dstW, dstH, channels, format));
+            return *setInput;
+        }
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetSetInputYuv : public Base::SynetSetInputYuv
+        {
+        public:
+            SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+                size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format);
+
+        protected:
+            virtual void DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v);
+            virtual void YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr);
+            virtual void StoreRow(const float * src0, const float * src1, float alpha, float * dst);
+        };
+    }
+#endif //SIMD_SSE41_ENABLE 
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetSetInputYuv : public Base::SynetSetInputYuv
+        {
+        public:
+            SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+                size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format);
+
+        protected:
+            virtual void DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v);
+            virtual void YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr);
+            virtual void ResizeRow(const uint8_t * src, float * dst);
+            virtual void StoreRow(const float * src0, const float * src1, float alpha, float * dst);
+        };
+    }
+#endif //SIMD_AVX2_ENABLE 
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetSetInputYuv : public Avx2::SynetSetInputYuv
+        {
+        public:
+            SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+                size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format);
+
+        protected:
+            virtual void DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v);
+            virtual void YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr);
+        };
+    }
+#endif //SIMD_AVX512BW_ENABLE 
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class SynetSetInputYuv : public Base::SynetSetInputYuv
+        {
+        public:
+            SynetSetInputYuv(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdResizeMethodType method, const float * lower, const float * upper,
+                size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType format);
+
+        protected:
+            virtual void DeinterleaveUv(const uint8_t * uv, uint8_t * u, uint8_t * v);
+            virtual void YuvToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr);
+        };
+    }
+#endif //SIMD_NEON_ENABLE 
+}
+#endif//__SimdSynetSetInput_h__
@@ -109,6 +109,10 @@ namespace Simd
             Hsl24,
             /*! A 24-bit (3 8-bit channels) RGB (Red, Green, Blue) pixel format. */
             Rgb24,
+            /*! A 16-bit (2 8-bit channels) packed YUYV 4:2:2 pixel format (Y0 U0 Y1 V0 ...). */
+            Yuyv16,
+            /*! A 16-bit (2 8-bit channels) packed UYVY 4:2:2 pixel format (U0 Y0 V0 Y1 ...). */
+            Uyvy16,
         };
 
         /*!
@@ -1045,6 +1049,8 @@ namespace Simd
         case Hsv24:     return 3;
         case Hsl24:     return 3;
         case Rgb24:     return 3;
+        case Yuyv16:    return 2;
+        case Uyvy16:    return 2;
         default: assert(0); return 0;
         }
     }
@@ -1075,6 +1081,8 @@ namespace Simd
         case Hsv24:     return 1;
         case Hsl24:     return 1;
         case Rgb24:     return 1;
+        case Yuyv16:    return 1;
+        case Uyvy16:    return 1;
         default: assert(0); return 0;
         }
     }
@@ -1105,6 +1113,8 @@ namespace Simd
         case Hsv24:     return 3;
         case Hsl24:     return 3;
         case Rgb24:     return 3;
+        case Yuyv16:    return 2;
+        case Uyvy16:    return 2;
         default: assert(0); return 0;
         }
     }
@@ -1121,6 +1131,8 @@ namespace Simd
         {
         case Gray8:     return CV_8UC1;
         case Uv16:      return CV_8UC2;
+        case Yuyv16:    return CV_8UC2;
+        case Uyvy16:    return CV_8UC2;
         case Bgr24:     return CV_8UC3;
         case Bgra32:    return CV_8UC4;
         case Int16:     return CV_16SC1;
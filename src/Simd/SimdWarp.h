@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdWarp_h__
+#define __SimdWarp_h__
+
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    const int32_t WARP_SHIFT = 7;
+    const int32_t WARP_RANGE = 1 << WARP_SHIFT;
+    const int32_t WARP_MASK = WARP_RANGE - 1;
+    const int32_t WARP_ROUND = 1 << (2 * WARP_SHIFT - 1);
+
+    struct WarpParam
+    {
+        size_t srcW, srcH, dstW, dstH, channels;
+        SimdWarpAffineFlags flags;
+        uint8_t border[16];
+
+        WarpParam(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t * border)
+        {
+            this->srcW = srcW;
+            this->srcH = srcH;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->channels = channels;
+            this->flags = flags;
+            memset(this->border, 0, sizeof(this->border));
+            if (border && channels <= 4)
+                memcpy(this->border, border, PixelSize());
+        }
+
+        bool Valid() const
+        {
+            return channels >= 1 && channels <= 4 && srcW && srcH && dstW && dstH;
+        }
+
+        bool IsByte() const
+        {
+            return (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte;
+        }
+
+        bool IsFloat() const
+        {
+            return (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat;
+        }
+
+        bool IsNearest() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest;
+        }
+
+        bool IsBilinear() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear;
+        }
+
+        bool IsReplicate() const
+        {
+            return (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderReplicate;
+        }
+
+        size_t ChannelSize() const
+        {
+            return IsFloat() ? 4 : 1;
+        }
+
+        size_t PixelSize() const
+        {
+            return channels * ChannelSize();
+        }
+    };
+
+    namespace Base
+    {
+        SIMD_INLINE void WarpCopyPixel(const uint8_t * src, size_t size, uint8_t * dst)
+        {
+            switch (size)
+            {
+            case 1: dst[0] = src[0]; break;
+            case 2: *(uint16_t*)dst = *(uint16_t*)src; break;
+            case 3: *(uint16_t*)dst = *(uint16_t*)src; dst[2] = src[2]; break;
+            case 4: *(uint32_t*)dst = *(uint32_t*)src; break;
+            default: memcpy(dst, src, size);
+            }
+        }
+
+        SIMD_INLINE const uint8_t * WarpPixel(const uint8_t * src, size_t srcStride, const WarpParam & p, int x, int y)
+        {
+            if (p.IsReplicate())
+                return src + RestrictRange(y, 0, (int)p.srcH - 1) * srcStride + RestrictRange(x, 0, (int)p.srcW - 1) * p.PixelSize();
+            else if (x >= 0 && x < (int)p.srcW && y >= 0 && y < (int)p.srcH)
+                return src + y * srcStride + x * p.PixelSize();
+            else
+                return p.border;
+        }
+
+        SIMD_INLINE void WarpByteInterp(const uint8_t * p00, const uint8_t * p01, const uint8_t * p10, const uint8_t * p11, size_t channels, int fx, int fy, uint8_t * dst)
+        {
+            int w00 = (WARP_RANGE - fx) * (WARP_RANGE - fy);
+            int w01 = fx * (WARP_RANGE - fy);
+            int w10 = (WARP_RANGE - fx) * fy;
+            int w11 = fx * fy;
+            for (size_t c = 0; c < channels; ++c)
+                dst[c] = (p00[c] * w00 + p01[c] * w01 + p10[c] * w10 + p11[c] * w11 + WARP_ROUND) >> (2 * WARP_SHIFT);
+        }
+    }
+}
+#endif//__SimdWarp_h__
@@ -0,0 +1,261 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdWarpAffine_h__
+#define __SimdWarpAffine_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdWarp.h"
+
+namespace Simd
+{
+    struct WarpAffParam : public WarpParam
+    {
+        float inv[6];
+        bool invertible;
+
+        WarpAffParam(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border)
+            : WarpParam(srcW, srcH, dstW, dstH, channels, flags, border)
+        {
+            double det = (double)mat[0] * mat[4] - (double)mat[1] * mat[3];
+            this->invertible = det != 0.0;
+            if (this->invertible)
+            {
+                double i0 = mat[4] / det, i1 = -mat[1] / det, i3 = -mat[3] / det, i4 = mat[0] / det;
+                this->inv[0] = (float)i0;
+                this->inv[1] = (float)i1;
+                this->inv[2] = (float)(-i0 * mat[2] - i1 * mat[5]);
+                this->inv[3] = (float)i3;
+                this->inv[4] = (float)i4;
+                this->inv[5] = (float)(-i3 * mat[2] - i4 * mat[5]);
+            }
+        }
+
+        bool Valid() const
+        {
+            return invertible && WarpParam::Valid();
+        }
+    };
+
+    class WarpAffine : public Deletable
+    {
+    public:
+        WarpAffine(const WarpAffParam & param);
+
+        const WarpAffParam & Param() const
+        {
+            return _param;
+        }
+
+        void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd) const;
+
+    protected:
+        WarpAffParam _param;
+        float _maxX, _maxY;
+        Array32f _cx, _cy, _rx, _ry;
+        Array32i _beg, _end;
+
+        bool Inside(size_t x, size_t y) const
+        {
+            float sx = _cx[x] + _rx[y], sy = _cy[x] + _ry[y];
+            return sx >= 0.0f && sx < _maxX && sy >= 0.0f && sy < _maxY;
+        }
+
+        void SetRange(size_t y);
+
+        virtual void RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const = 0;
+        virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const = 0;
+    };
+
+    namespace Base
+    {
+        class WarpAffineNearest : public WarpAffine
+        {
+        public:
+            WarpAffineNearest(const WarpAffParam & param);
+
+        protected:
+            virtual void RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineByteBilinear : public WarpAffine
+        {
+        public:
+            WarpAffineByteBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineFloatBilinear : public WarpAffine
+        {
+        public:
+            WarpAffineFloatBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunBorder(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        class WarpAffineNearest : public Base::WarpAffineNearest
+        {
+        public:
+            WarpAffineNearest(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineByteBilinear : public Base::WarpAffineByteBilinear
+        {
+        public:
+            WarpAffineByteBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineFloatBilinear : public Base::WarpAffineFloatBilinear
+        {
+        public:
+            WarpAffineFloatBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class WarpAffineNearest : public Base::WarpAffineNearest
+        {
+        public:
+            WarpAffineNearest(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineByteBilinear : public Base::WarpAffineByteBilinear
+        {
+        public:
+            WarpAffineByteBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineFloatBilinear : public Base::WarpAffineFloatBilinear
+        {
+        public:
+            WarpAffineFloatBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class WarpAffineNearest : public Base::WarpAffineNearest
+        {
+        public:
+            WarpAffineNearest(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineByteBilinear : public Base::WarpAffineByteBilinear
+        {
+        public:
+            WarpAffineByteBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineFloatBilinear : public Base::WarpAffineFloatBilinear
+        {
+        public:
+            WarpAffineFloatBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        class WarpAffineNearest : public Base::WarpAffineNearest
+        {
+        public:
+            WarpAffineNearest(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineByteBilinear : public Base::WarpAffineByteBilinear
+        {
+        public:
+            WarpAffineByteBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        class WarpAffineFloatBilinear : public Base::WarpAffineFloatBilinear
+        {
+        public:
+            WarpAffineFloatBilinear(const WarpAffParam & param);
+
+        protected:
+            virtual void RunInterior(const uint8_t * src, size_t srcStride, size_t y, size_t beg, size_t end, uint8_t * dst) const;
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_NEON_ENABLE
+}
+#endif//__SimdWarpAffine_h__
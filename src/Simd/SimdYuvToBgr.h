@@ -0,0 +1,560 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdYuvToBgr_h__
+#define __SimdYuvToBgr_h__
+
+#include "Simd/SimdConst.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSet.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+        * Coefficients of YUV to BGR conversion for different standards (see SimdYuvType).
+        * All weights are fixed point numbers with SHIFT fractional bits.
+        * Y_ADJUST is black level of Y channel (16 for limited range, 0 for full range).
+        */
+
+        struct Bt601
+        {
+            static const int Y_ADJUST = 16;
+            static const int UV_ADJUST = 128;
+            static const int SHIFT = 13;
+            static const int ROUND = 1 << (SHIFT - 1);
+            static const int Y_2_RGB = int(1.164 * (1 << SHIFT) + 0.5);
+            static const int U_2_B = int(2.018 * (1 << SHIFT) + 0.5);
+            static const int U_2_G = -int(0.391 * (1 << SHIFT) + 0.5);
+            static const int V_2_G = -int(0.813 * (1 << SHIFT) + 0.5);
+            static const int V_2_R = int(1.596 * (1 << SHIFT) + 0.5);
+        };
+
+        struct Bt709
+        {
+            static const int Y_ADJUST = 16;
+            static const int UV_ADJUST = 128;
+            static const int SHIFT = 13;
+            static const int ROUND = 1 << (SHIFT - 1);
+            static const int Y_2_RGB = int(1.164384 * (1 << SHIFT) + 0.5);
+            static const int U_2_B = int(2.112402 * (1 << SHIFT) + 0.5);
+            static const int U_2_G = -int(0.213249 * (1 << SHIFT) + 0.5);
+            static const int V_2_G = -int(0.532909 * (1 << SHIFT) + 0.5);
+            static const int V_2_R = int(1.792741 * (1 << SHIFT) + 0.5);
+        };
+
+        struct Bt2020
+        {
+            static const int Y_ADJUST = 16;
+            static const int UV_ADJUST = 128;
+            static const int SHIFT = 13;
+            static const int ROUND = 1 << (SHIFT - 1);
+            static const int Y_2_RGB = int(1.164384 * (1 << SHIFT) + 0.5);
+            static const int U_2_B = int(2.141772 * (1 << SHIFT) + 0.5);
+            static const int U_2_G = -int(0.187326 * (1 << SHIFT) + 0.5);
+            static const int V_2_G = -int(0.650424 * (1 << SHIFT) + 0.5);
+            static const int V_2_R = int(1.678674 * (1 << SHIFT) + 0.5);
+        };
+
+        struct Trect871
+        {
+            static const int Y_ADJUST = 0;
+            static const int UV_ADJUST = 128;
+            static const int SHIFT = 13;
+            static const int ROUND = 1 << (SHIFT - 1);
+            static const int Y_2_RGB = int(1.000000 * (1 << SHIFT) + 0.5);
+            static const int U_2_B = int(1.772000 * (1 << SHIFT) + 0.5);
+            static const int U_2_G = -int(0.344136 * (1 << SHIFT) + 0.5);
+            static const int V_2_G = -int(0.714136 * (1 << SHIFT) + 0.5);
+            static const int V_2_R = int(1.402000 * (1 << SHIFT) + 0.5);
+        };
+
+        struct Bt709Full
+        {
+            static const int Y_ADJUST = 0;
+            static const int UV_ADJUST = 128;
+            static const int SHIFT = 13;
+            static const int ROUND = 1 << (SHIFT - 1);
+            static const int Y_2_RGB = int(1.000000 * (1 << SHIFT) + 0.5);
+            static const int U_2_B = int(1.855600 * (1 << SHIFT) + 0.5);
+            static const int U_2_G = -int(0.187324 * (1 << SHIFT) + 0.5);
+            static const int V_2_G = -int(0.468124 * (1 << SHIFT) + 0.5);
+            static const int V_2_R = int(1.574800 * (1 << SHIFT) + 0.5);
+        };
+
+        struct Bt2020Full
+        {
+            static const int Y_ADJUST = 0;
+            static const int UV_ADJUST = 128;
+            static const int SHIFT = 13;
+            static const int ROUND = 1 << (SHIFT - 1);
+            static const int Y_2_RGB = int(1.000000 * (1 << SHIFT) + 0.5);
+            static const int U_2_B = int(1.881400 * (1 << SHIFT) + 0.5);
+            static const int U_2_G = -int(0.164553 * (1 << SHIFT) + 0.5);
+            static const int V_2_G = -int(0.571353 * (1 << SHIFT) + 0.5);
+            static const int V_2_R = int(1.474600 * (1 << SHIFT) + 0.5);
+        };
+
+        /*
+        * Adapts coefficients of standard T to 10-bit YUV input (P010, Yuv420p10).
+        * Output has 'bits' bit depth: 8 for BGR images, 10 for float tensors.
+        */
+        template <class T, int bits = 8> struct Yuv10
+        {
+            static const int Y_ADJUST = T::Y_ADJUST << 2;
+            static const int UV_ADJUST = T::UV_ADJUST << 2;
+            static const int SHIFT = T::SHIFT + 10 - bits;
+            static const int ROUND = 1 << (SHIFT - 1);
+            static const int Y_2_RGB = T::Y_2_RGB;
+            static const int U_2_B = T::U_2_B;
+            static const int U_2_G = T::U_2_G;
+            static const int V_2_G = T::V_2_G;
+            static const int V_2_R = T::V_2_R;
+        };
+
+        template <class T = Bt601> SIMD_INLINE int YuvToBlue(int y, int u)
+        {
+            return RestrictRange((T::Y_2_RGB * (y - T::Y_ADJUST) + T::U_2_B * (u - T::UV_ADJUST) + T::ROUND) >> T::SHIFT);
+        }
+
+        template <class T = Bt601> SIMD_INLINE int YuvToGreen(int y, int u, int v)
+        {
+            return RestrictRange((T::Y_2_RGB * (y - T::Y_ADJUST) + T::U_2_G * (u - T::UV_ADJUST) +
+                T::V_2_G * (v - T::UV_ADJUST) + T::ROUND) >> T::SHIFT);
+        }
+
+        template <class T = Bt601> SIMD_INLINE int YuvToRed(int y, int v)
+        {
+            return RestrictRange((T::Y_2_RGB * (y - T::Y_ADJUST) + T::V_2_R * (v - T::UV_ADJUST) + T::ROUND) >> T::SHIFT);
+        }
+
+        template <class T = Bt601> SIMD_INLINE void YuvToBgr(int y, int u, int v, uint8_t * bgr)
+        {
+            bgr[0] = YuvToBlue<T>(y, u);
+            bgr[1] = YuvToGreen<T>(y, u, v);
+            bgr[2] = YuvToRed<T>(y, v);
+        }
+
+        template <class T = Bt601> SIMD_INLINE void YuvToBgra(int y, int u, int v, int alpha, uint8_t * bgra)
+        {
+            bgra[0] = YuvToBlue<T>(y, u);
+            bgra[1] = YuvToGreen<T>(y, u, v);
+            bgra[2] = YuvToRed<T>(y, v);
+            bgra[3] = alpha;
+        }
+
+        template <class T = Bt601> SIMD_INLINE void YuvToRgb(int y, int u, int v, uint8_t * rgb)
+        {
+            rgb[0] = YuvToRed<T>(y, v);
+            rgb[1] = YuvToGreen<T>(y, u, v);
+            rgb[2] = YuvToBlue<T>(y, u);
+        }
+    }
+
+#ifdef SIMD_SSE2_ENABLE
+    namespace Sse2
+    {
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustY16(__m128i y16)
+        {
+            return _mm_subs_epi16(y16, _mm_set1_epi16(T::Y_ADJUST));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustUV16(__m128i uv16)
+        {
+            return _mm_subs_epi16(uv16, _mm_set1_epi16(T::UV_ADJUST));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToRed32(__m128i y16_1, __m128i v16_0)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16(T::Y_2_RGB, T::ROUND)),
+                _mm_madd_epi16(v16_0, SetInt16(T::V_2_R, 0))), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToRed16(__m128i y16, __m128i v16)
+        {
+            return SaturateI16ToU8(_mm_packs_epi32(
+                AdjustedYuvToRed32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(v16, K_ZERO))));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToGreen32(__m128i y16_1, __m128i u16_v16)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16(T::Y_2_RGB, T::ROUND)),
+                _mm_madd_epi16(u16_v16, SetInt16(T::U_2_G, T::V_2_G))), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToGreen16(__m128i y16, __m128i u16, __m128i v16)
+        {
+            return SaturateI16ToU8(_mm_packs_epi32(
+                AdjustedYuvToGreen32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, v16))));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToBlue32(__m128i y16_1, __m128i u16_0)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16(T::Y_2_RGB, T::ROUND)),
+                _mm_madd_epi16(u16_0, SetInt16(T::U_2_B, 0))), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i AdjustedYuvToBlue16(__m128i y16, __m128i u16)
+        {
+            return SaturateI16ToU8(_mm_packs_epi32(
+                AdjustedYuvToBlue32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, K_ZERO))));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i YuvToRed(__m128i y, __m128i v)
+        {
+            __m128i lo = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpacklo_epi8(v, K_ZERO)));
+            __m128i hi = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpackhi_epi8(v, K_ZERO)));
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i YuvToGreen(__m128i y, __m128i u, __m128i v)
+        {
+            __m128i lo = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpacklo_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm_unpacklo_epi8(v, K_ZERO)));
+            __m128i hi = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpackhi_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm_unpackhi_epi8(v, K_ZERO)));
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m128i YuvToBlue(__m128i y, __m128i u)
+        {
+            __m128i lo = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpacklo_epi8(u, K_ZERO)));
+            __m128i hi = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpackhi_epi8(u, K_ZERO)));
+            return _mm_packus_epi16(lo, hi);
+        }
+        template <class T = Base::Bt601> SIMD_INLINE void Yuv16ToBgr8(const __m128i * y16, const __m128i * u16, const __m128i * v16, __m128i & blue, __m128i & green, __m128i & red)
+        {
+            __m128i y0 = AdjustY16<T>(y16[0]), u0 = AdjustUV16<T>(u16[0]), v0 = AdjustUV16<T>(v16[0]);
+            __m128i y1 = AdjustY16<T>(y16[1]), u1 = AdjustUV16<T>(u16[1]), v1 = AdjustUV16<T>(v16[1]);
+            blue = _mm_packus_epi16(AdjustedYuvToBlue16<T>(y0, u0), AdjustedYuvToBlue16<T>(y1, u1));
+            green = _mm_packus_epi16(AdjustedYuvToGreen16<T>(y0, u0, v0), AdjustedYuvToGreen16<T>(y1, u1, v1));
+            red = _mm_packus_epi16(AdjustedYuvToRed16<T>(y0, v0), AdjustedYuvToRed16<T>(y1, v1));
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustY16(__m256i y16)
+        {
+            return _mm256_subs_epi16(y16, _mm256_set1_epi16(T::Y_ADJUST));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustUV16(__m256i uv16)
+        {
+            return _mm256_subs_epi16(uv16, _mm256_set1_epi16(T::UV_ADJUST));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToRed32(__m256i y16_1, __m256i v16_0)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16(T::Y_2_RGB, T::ROUND)),
+                _mm256_madd_epi16(v16_0, SetInt16(T::V_2_R, 0))), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToRed16(__m256i y16, __m256i v16)
+        {
+            return SaturateI16ToU8(_mm256_packs_epi32(
+                AdjustedYuvToRed32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(v16, K_ZERO))));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToGreen32(__m256i y16_1, __m256i u16_v16)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16(T::Y_2_RGB, T::ROUND)),
+                _mm256_madd_epi16(u16_v16, SetInt16(T::U_2_G, T::V_2_G))), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToGreen16(__m256i y16, __m256i u16, __m256i v16)
+        {
+            return SaturateI16ToU8(_mm256_packs_epi32(
+                AdjustedYuvToGreen32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, v16))));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToBlue32(__m256i y16_1, __m256i u16_0)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16(T::Y_2_RGB, T::ROUND)),
+                _mm256_madd_epi16(u16_0, SetInt16(T::U_2_B, 0))), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i AdjustedYuvToBlue16(__m256i y16, __m256i u16)
+        {
+            return SaturateI16ToU8(_mm256_packs_epi32(
+                AdjustedYuvToBlue32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, K_ZERO))));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i YuvToRed(__m256i y, __m256i v)
+        {
+            __m256i lo = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpacklo_epi8(v, K_ZERO)));
+            __m256i hi = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpackhi_epi8(v, K_ZERO)));
+            return _mm256_packus_epi16(lo, hi);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i YuvToGreen(__m256i y, __m256i u, __m256i v)
+        {
+            __m256i lo = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpacklo_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpacklo_epi8(v, K_ZERO)));
+            __m256i hi = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpackhi_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpackhi_epi8(v, K_ZERO)));
+            return _mm256_packus_epi16(lo, hi);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m256i YuvToBlue(__m256i y, __m256i u)
+        {
+            __m256i lo = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpacklo_epi8(u, K_ZERO)));
+            __m256i hi = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpackhi_epi8(u, K_ZERO)));
+            return _mm256_packus_epi16(lo, hi);
+        }
+        template <class T = Base::Bt601> SIMD_INLINE void Yuv16ToBgr8(const __m256i * y16, const __m256i * u16, const __m256i * v16, __m256i & blue, __m256i & green, __m256i & red)
+        {
+            __m256i y0 = AdjustY16<T>(y16[0]), u0 = AdjustUV16<T>(u16[0]), v0 = AdjustUV16<T>(v16[0]);
+            __m256i y1 = AdjustY16<T>(y16[1]), u1 = AdjustUV16<T>(u16[1]), v1 = AdjustUV16<T>(v16[1]);
+            blue = PackI16ToU8(AdjustedYuvToBlue16<T>(y0, u0), AdjustedYuvToBlue16<T>(y1, u1));
+            green = PackI16ToU8(AdjustedYuvToGreen16<T>(y0, u0, v0), AdjustedYuvToGreen16<T>(y1, u1, v1));
+            red = PackI16ToU8(AdjustedYuvToRed16<T>(y0, v0), AdjustedYuvToRed16<T>(y1, v1));
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustY16(__m512i y16)
+        {
+            return _mm512_subs_epi16(y16, _mm512_set1_epi16(T::Y_ADJUST));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustUV16(__m512i uv16)
+        {
+            return _mm512_subs_epi16(uv16, _mm512_set1_epi16(T::UV_ADJUST));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToRed32(__m512i y16_1, __m512i v16_0)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16(T::Y_2_RGB, T::ROUND)),
+                _mm512_madd_epi16(v16_0, SetInt16(T::V_2_R, 0))), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToRed16(__m512i y16, __m512i v16)
+        {
+            return SaturateI16ToU8(_mm512_packs_epi32(
+                AdjustedYuvToRed32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(v16, K_ZERO))));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToGreen32(__m512i y16_1, __m512i u16_v16)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16(T::Y_2_RGB, T::ROUND)),
+                _mm512_madd_epi16(u16_v16, SetInt16(T::U_2_G, T::V_2_G))), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToGreen16(__m512i y16, __m512i u16, __m512i v16)
+        {
+            return SaturateI16ToU8(_mm512_packs_epi32(
+                AdjustedYuvToGreen32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, v16))));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToBlue32(__m512i y16_1, __m512i u16_0)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16(T::Y_2_RGB, T::ROUND)),
+                _mm512_madd_epi16(u16_0, SetInt16(T::U_2_B, 0))), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i AdjustedYuvToBlue16(__m512i y16, __m512i u16)
+        {
+            return SaturateI16ToU8(_mm512_packs_epi32(
+                AdjustedYuvToBlue32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, K_ZERO))));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i YuvToRed(__m512i y, __m512i v)
+        {
+            __m512i lo = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpacklo_epi8(v, K_ZERO)));
+            __m512i hi = AdjustedYuvToRed16<T>(
+                AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpackhi_epi8(v, K_ZERO)));
+            return _mm512_packus_epi16(lo, hi);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i YuvToGreen(__m512i y, __m512i u, __m512i v)
+        {
+            __m512i lo = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpacklo_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpacklo_epi8(v, K_ZERO)));
+            __m512i hi = AdjustedYuvToGreen16<T>(
+                AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpackhi_epi8(u, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpackhi_epi8(v, K_ZERO)));
+            return _mm512_packus_epi16(lo, hi);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE __m512i YuvToBlue(__m512i y, __m512i u)
+        {
+            __m512i lo = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpacklo_epi8(u, K_ZERO)));
+            __m512i hi = AdjustedYuvToBlue16<T>(
+                AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpackhi_epi8(u, K_ZERO)));
+            return _mm512_packus_epi16(lo, hi);
+        }
+        template <class T = Base::Bt601> SIMD_INLINE void Yuv16ToBgr8(const __m512i * y16, const __m512i * u16, const __m512i * v16, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            __m512i y0 = AdjustY16<T>(y16[0]), u0 = AdjustUV16<T>(u16[0]), v0 = AdjustUV16<T>(v16[0]);
+            __m512i y1 = AdjustY16<T>(y16[1]), u1 = AdjustUV16<T>(u16[1]), v1 = AdjustUV16<T>(v16[1]);
+            blue = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(AdjustedYuvToBlue16<T>(y0, u0), AdjustedYuvToBlue16<T>(y1, u1)));
+            green = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(AdjustedYuvToGreen16<T>(y0, u0, v0), AdjustedYuvToGreen16<T>(y1, u1, v1)));
+            red = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(AdjustedYuvToRed16<T>(y0, v0), AdjustedYuvToRed16<T>(y1, v1)));
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        template <int part, class T = Base::Bt601> SIMD_INLINE int16x8_t AdjustY(uint8x16_t y)
+        {
+            return vsubq_s16(vreinterpretq_s16_u16(UnpackU8<part>(y)), vdupq_n_s16(T::Y_ADJUST));
+        }
+
+        template <int part, class T = Base::Bt601> SIMD_INLINE int16x8_t AdjustUV(uint8x16_t uv)
+        {
+            return vsubq_s16(vreinterpretq_s16_u16(UnpackU8<part>(uv)), vdupq_n_s16(T::UV_ADJUST));
+        }
+
+        template <int part, class T = Base::Bt601> SIMD_INLINE int32x4_t YuvToRed(int16x8_t y, int16x8_t v)
+        {
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vdupq_n_s32(T::ROUND), Half<part>(y), vdup_n_s16(T::Y_2_RGB)),
+                Half<part>(v), vdup_n_s16(T::V_2_R)), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE int16x8_t YuvToRed(int16x8_t y, int16x8_t v)
+        {
+            return PackI32(YuvToRed<0, T>(y, v), YuvToRed<1, T>(y, v));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE uint8x16_t YuvToRed(uint8x16_t y, uint8x16_t v)
+        {
+            return PackSaturatedI16(YuvToRed<T>(AdjustY<0, T>(y), AdjustUV<0, T>(v)), YuvToRed<T>(AdjustY<1, T>(y), AdjustUV<1, T>(v)));
+        }
+
+        template <int part, class T = Base::Bt601> SIMD_INLINE int32x4_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
+        {
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vmlal_s16(vdupq_n_s32(T::ROUND), Half<part>(y), vdup_n_s16(T::Y_2_RGB)),
+                Half<part>(u), vdup_n_s16(T::U_2_G)), Half<part>(v), vdup_n_s16(T::V_2_G)), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE int16x8_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
+        {
+            return PackI32(YuvToGreen<0, T>(y, u, v), YuvToGreen<1, T>(y, u, v));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE uint8x16_t YuvToGreen(uint8x16_t y, uint8x16_t u, uint8x16_t v)
+        {
+            return PackSaturatedI16(YuvToGreen<T>(AdjustY<0, T>(y), AdjustUV<0, T>(u), AdjustUV<0, T>(v)),
+                YuvToGreen<T>(AdjustY<1, T>(y), AdjustUV<1, T>(u), AdjustUV<1, T>(v)));
+        }
+
+        template <int part, class T = Base::Bt601> SIMD_INLINE int32x4_t YuvToBlue(int16x8_t y, int16x8_t u)
+        {
+            return vshrq_n_s32(vmlal_s16(vmlal_s16(vdupq_n_s32(T::ROUND), Half<part>(y), vdup_n_s16(T::Y_2_RGB)),
+                Half<part>(u), vdup_n_s16(T::U_2_B)), T::SHIFT);
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE int16x8_t YuvToBlue(int16x8_t y, int16x8_t u)
+        {
+            return PackI32(YuvToBlue<0, T>(y, u), YuvToBlue<1, T>(y, u));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE uint8x16_t YuvToBlue(uint8x16_t y, uint8x16_t u)
+        {
+            return PackSaturatedI16(YuvToBlue<T>(AdjustY<0, T>(y), AdjustUV<0, T>(u)), YuvToBlue<T>(AdjustY<1, T>(y), AdjustUV<1, T>(u)));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE void YuvToBgr(uint8x16_t y, uint8x16_t u, uint8x16_t v, uint8x16x3_t & bgr)
+        {
+            int16x8_t yLo = AdjustY<0, T>(y), uLo = AdjustUV<0, T>(u), vLo = AdjustUV<0, T>(v);
+            int16x8_t yHi = AdjustY<1, T>(y), uHi = AdjustUV<1, T>(u), vHi = AdjustUV<1, T>(v);
+            bgr.val[0] = PackSaturatedI16(YuvToBlue<T>(yLo, uLo), YuvToBlue<T>(yHi, uHi));
+            bgr.val[1] = PackSaturatedI16(YuvToGreen<T>(yLo, uLo, vLo), YuvToGreen<T>(yHi, uHi, vHi));
+            bgr.val[2] = PackSaturatedI16(YuvToRed<T>(yLo, vLo), YuvToRed<T>(yHi, vHi));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE void YuvToRgb(uint8x16_t y, uint8x16_t u, uint8x16_t v, uint8x16x3_t & rgb)
+        {
+            int16x8_t yLo = AdjustY<0, T>(y), uLo = AdjustUV<0, T>(u), vLo = AdjustUV<0, T>(v);
+            int16x8_t yHi = AdjustY<1, T>(y), uHi = AdjustUV<1, T>(u), vHi = AdjustUV<1, T>(v);
+            rgb.val[0] = PackSaturatedI16(YuvToRed<T>(yLo, vLo), YuvToRed<T>(yHi, vHi));
+            rgb.val[1] = PackSaturatedI16(YuvToGreen<T>(yLo, uLo, vLo), YuvToGreen<T>(yHi, uHi, vHi));
+            rgb.val[2] = PackSaturatedI16(YuvToBlue<T>(yLo, uLo), YuvToBlue<T>(yHi, uHi));
+        }
+
+        template <class T = Base::Bt601> SIMD_INLINE void Yuv16ToBgr8(const uint16x8_t * y16, const uint16x8_t * u16, const uint16x8_t * v16, uint8x16_t & blue, uint8x16_t & green, uint8x16_t & red)
+        {
+            int16x8_t y0 = vsubq_s16(vreinterpretq_s16_u16(y16[0]), vdupq_n_s16(T::Y_ADJUST)), y1 = vsubq_s16(vreinterpretq_s16_u16(y16[1]), vdupq_n_s16(T::Y_ADJUST));
+            int16x8_t u0 = vsubq_s16(vreinterpretq_s16_u16(u16[0]), vdupq_n_s16(T::UV_ADJUST)), u1 = vsubq_s16(vreinterpretq_s16_u16(u16[1]), vdupq_n_s16(T::UV_ADJUST));
+            int16x8_t v0 = vsubq_s16(vreinterpretq_s16_u16(v16[0]), vdupq_n_s16(T::UV_ADJUST)), v1 = vsubq_s16(vreinterpretq_s16_u16(v16[1]), vdupq_n_s16(T::UV_ADJUST));
+            blue = PackSaturatedI16(YuvToBlue<T>(y0, u0), YuvToBlue<T>(y1, u1));
+            green = PackSaturatedI16(YuvToGreen<T>(y0, u0, v0), YuvToGreen<T>(y1, u1, v1));
+            red = PackSaturatedI16(YuvToRed<T>(y0, v0), YuvToRed<T>(y1, v1));
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
+#endif//__SimdYuvToBgr_h__
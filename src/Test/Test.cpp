@@ -95,6 +95,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(BgrToHsv);
     TEST_ADD_GROUP_A00(BgrToRgb);
     TEST_ADD_GROUP_AD0(GrayToBgr);
+    TEST_ADD_GROUP_AD0(HslToBgr);
+    TEST_ADD_GROUP_AD0(HsvToBgr);
     TEST_ADD_GROUP_AD0(Int16ToGray);
     TEST_ADD_GROUP_A00(RgbToGray);
 
@@ -112,6 +114,10 @@ namespace Test
     TEST_ADD_GROUP_AD0(BgrToYuv422p);
     TEST_ADD_GROUP_AD0(BgrToYuv444p);
     TEST_ADD_GROUP_A00(BgraToYuva420p);
+    TEST_ADD_GROUP_A00(BgraToYuyv422);
+    TEST_ADD_GROUP_A00(BgraToUyvy422);
+    TEST_ADD_GROUP_A00(BgrToYuyv422);
+    TEST_ADD_GROUP_A00(BgrToUyvy422);
 
     TEST_ADD_GROUP_AD0(BackgroundGrowRangeSlow);
     TEST_ADD_GROUP_AD0(BackgroundGrowRangeFast);
@@ -123,8 +129,10 @@ namespace Test
     TEST_ADD_GROUP_AD0(BackgroundInitMask);
 
     TEST_ADD_GROUP_AD0(BayerToBgr);
+    TEST_ADD_GROUP_AD0(BayerToBgrV2);
 
     TEST_ADD_GROUP_AD0(BayerToBgra);
+    TEST_ADD_GROUP_AD0(BayerToBgraV2);
 
     TEST_ADD_GROUP_AD0(Bgr48pToBgra32);
 
@@ -220,6 +228,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(HistogramConditional);
     TEST_ADD_GROUP_AD0(AbsSecondDerivativeHistogram);
     TEST_ADD_GROUP_AD0(ChangeColors);
+    TEST_ADD_GROUP_A00(Lut8u);
+    TEST_ADD_GROUP_A00(Lut16uTo8u);
 
     TEST_ADD_GROUP_AD0(HogDirectionHistograms);
     TEST_ADD_GROUP_AD0(HogExtractFeatures);
@@ -286,6 +296,12 @@ namespace Test
     TEST_ADD_GROUP_AD0(OperationBinary16i);
     TEST_ADD_GROUP_AD0(VectorProduct);
 
+    TEST_ADD_GROUP_A00(ThreadPool);
+    TEST_ADD_GROUP_A00(ParallelRows);
+    TEST_ADD_GROUP_A00(ParallelResizer);
+    TEST_ADD_GROUP_A00(ContextBind);
+    TEST_ADD_GROUP_A00(ContextAffinity);
+
     TEST_ADD_GROUP_AD0(ReduceColor2x2);
     TEST_ADD_GROUP_AD0(ReduceGray2x2);
     TEST_ADD_GROUP_AD0(ReduceGray3x3);
@@ -298,6 +314,8 @@ namespace Test
 
     TEST_ADD_GROUP_ADS(ResizeBilinear);
     TEST_ADD_GROUP_A00(Resizer);
+    TEST_ADD_GROUP_A00(ResizeRois);
+    TEST_ADD_GROUP_A00(ResizerPyramid);
 
     TEST_ADD_GROUP_AD0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_AD0(SegmentationFillSingleHoles);
@@ -347,14 +365,21 @@ namespace Test
 
     TEST_ADD_GROUP_A00(SynetConvert32fTo8u);
     TEST_ADD_GROUP_A00(SynetSetInput);
+    TEST_ADD_GROUP_A00(SynetSetInputP010);
+    TEST_ADD_GROUP_A00(SynetSetInputYuv420p);
+    TEST_ADD_GROUP_A00(SynetSetInputNv12);
     TEST_ADD_GROUP_A00(SynetReorderImage);
     TEST_ADD_GROUP_A00(SynetReorderFilter);
 
     TEST_ADD_GROUP_A00(SynetConvolution8iForward);
+    TEST_ADD_GROUP_A00(SynetConvolution8iExport);
 
     TEST_ADD_GROUP_A00(SynetConvolution32fForward);
+    TEST_ADD_GROUP_A00(SynetConvolution32fAutotune);
+    TEST_ADD_GROUP_A00(SynetConvolution32fExport);
 
     TEST_ADD_GROUP_A00(SynetDeconvolution32fForward);
+    TEST_ADD_GROUP_A00(SynetDeconvolution32fExport);
 
     TEST_ADD_GROUP_A00(SynetFusedLayerForward0);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward1);
@@ -365,6 +390,7 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetFusedLayerForward9);
 
     TEST_ADD_GROUP_A00(SynetMergedConvolution32fForward);
+    TEST_ADD_GROUP_A00(SynetMergedConvolution32fExport);
 
     TEST_ADD_GROUP_A00(SynetPoolingForwardAverage);
     TEST_ADD_GROUP_A00(SynetPoolingForwardMax32f);
@@ -377,6 +403,10 @@ namespace Test
 
     TEST_ADD_GROUP_A00(TransformImage);
 
+    TEST_ADD_GROUP_A00(WarpAffine);
+    TEST_ADD_GROUP_A00(WarpPerspective);
+    TEST_ADD_GROUP_A00(Remap);
+
     TEST_ADD_GROUP_A00(WinogradKernel1x3Block1x4SetFilter);
     TEST_ADD_GROUP_A00(WinogradKernel1x3Block1x4SetInput);
     TEST_ADD_GROUP_A00(WinogradKernel1x3Block1x4SetOutput);
@@ -410,6 +440,9 @@ namespace Test
     TEST_ADD_GROUP_AD0(Yuv444pToBgr);
     TEST_ADD_GROUP_AD0(Yuv422pToBgr);
     TEST_ADD_GROUP_AD0(Yuv420pToBgr);
+    TEST_ADD_GROUP_A00(Yuv444pToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv422pToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv420pToBgrV2);
     TEST_ADD_GROUP_AD0(Yuv444pToHsl);
     TEST_ADD_GROUP_AD0(Yuv444pToHsv);
     TEST_ADD_GROUP_AD0(Yuv444pToHue);
@@ -417,11 +450,39 @@ namespace Test
     TEST_ADD_GROUP_A00(Yuv444pToRgb);
     TEST_ADD_GROUP_A00(Yuv422pToRgb);
     TEST_ADD_GROUP_A00(Yuv420pToRgb);
+    TEST_ADD_GROUP_A00(Yuv444pToRgbV2);
+    TEST_ADD_GROUP_A00(Yuv422pToRgbV2);
+    TEST_ADD_GROUP_A00(Yuv420pToRgbV2);
+
+    TEST_ADD_GROUP_A00(Nv12ToBgr);
+    TEST_ADD_GROUP_A00(Nv21ToBgr);
+    TEST_ADD_GROUP_A00(Nv12ToBgra);
+    TEST_ADD_GROUP_A00(Nv21ToBgra);
+    TEST_ADD_GROUP_A00(Nv12ToRgb);
+    TEST_ADD_GROUP_A00(Nv21ToRgb);
+    TEST_ADD_GROUP_A00(Nv12ToBgrV2);
+    TEST_ADD_GROUP_A00(Nv12ToBgraV2);
+    TEST_ADD_GROUP_A00(Nv12ToRgbV2);
+
+    TEST_ADD_GROUP_A00(P010ToBgr);
+    TEST_ADD_GROUP_A00(P010ToBgra);
+    TEST_ADD_GROUP_A00(Yuv420p10ToBgr);
+    TEST_ADD_GROUP_A00(Yuv420p10ToBgra);
+
+    TEST_ADD_GROUP_A00(Yuyv422ToBgr);
+    TEST_ADD_GROUP_A00(Uyvy422ToBgr);
+    TEST_ADD_GROUP_A00(Yuyv422ToBgra);
+    TEST_ADD_GROUP_A00(Uyvy422ToBgra);
+    TEST_ADD_GROUP_A00(Yuyv422ToGray);
+    TEST_ADD_GROUP_A00(Yuyv422ToYuv420p);
 
     TEST_ADD_GROUP_A00(Yuva420pToBgra);
     TEST_ADD_GROUP_AD0(Yuv444pToBgra);
     TEST_ADD_GROUP_AD0(Yuv422pToBgra);
     TEST_ADD_GROUP_AD0(Yuv420pToBgra);
+    TEST_ADD_GROUP_A00(Yuv444pToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv422pToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv420pToBgraV2);
 
     class Task
     {
@@ -494,18 +555,21 @@ namespace Test
 
         Strings include, exclude;
 
-        String text, html;
+        String text, html, json, baseline;
 
         size_t testThreads, workThreads;
 
         bool printAlign;
 
+        double threshold;
+
         Options(int argc, char* argv[])
             : mode(Auto)
             , help(false)
             , testThreads(0)
             , workThreads(1)
             , printAlign(false)
+            , threshold(0.1)
         {
             for (int i = 1; i < argc; ++i)
             {
@@ -550,6 +614,18 @@ namespace Test
                 {
                     html = arg.substr(4, arg.size() - 4);
                 }
+                else if (arg.find("-bj=") == 0)
+                {
+                    json = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-bc=") == 0)
+                {
+                    baseline = arg.substr(4, arg.size() - 4);
+                }
+                else if (arg.find("-bt=") == 0)
+                {
+                    threshold = FromString<double>(arg.substr(4, arg.size() - 4))*0.01;
+                }
                 else if (arg.find("-r=") == 0)
                 {
                     ROOT_PATH = arg.substr(3, arg.size() - 3);
@@ -658,6 +734,27 @@ namespace Test
         TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.TextReport(options.printAlign, false) << SimdPerformanceStatistic());
         if (!options.html.empty())
             Test::PerformanceMeasurerStorage::s_storage.HtmlReport(options.html, options.printAlign);
+        if (!options.json.empty() && !Test::PerformanceMeasurerStorage::s_storage.JsonReport(options.json))
+        {
+            TEST_LOG_SS(Error, "Can't write benchmark results to '" << options.json << "'!" << std::endl);
+            return 1;
+        }
+        if (!options.baseline.empty())
+        {
+            String report;
+            int regressions = Test::PerformanceMeasurerStorage::s_storage.CompareReport(options.baseline, options.threshold, report);
+            if (regressions < 0)
+            {
+                TEST_LOG_SS(Error, "Can't read benchmark baseline from '" << options.baseline << "'!" << std::endl);
+                return 1;
+            }
+            if (regressions > 0)
+            {
+                TEST_LOG_SS(Error, report << "PERFORMANCE REGRESSIONS ARE DETECTED!" << std::endl);
+                return 1;
+            }
+            TEST_LOG_SS(Info, report);
+        }
 #endif
         return 0;
     }
@@ -736,6 +833,10 @@ namespace Test
         std::cout << "    -wt=1         a thread number used to parallelize algorithms." << std::endl << std::endl;
         std::cout << "    -fe=Abs       an exclude filter to exclude some tests." << std::endl << std::endl;
         std::cout << "    -mt=100       a minimal test execution time (in milliseconds)." << std::endl << std::endl;
+        std::cout << "    -bj=bench.json a file name with benchmark results (in JSON format)." << std::endl << std::endl;
+        std::cout << "    -bc=base.json a file name with baseline benchmark results (created with -bj)." << std::endl;
+        std::cout << "                  The test fails if some function is slower than in baseline." << std::endl << std::endl;
+        std::cout << "    -bt=10        a threshold of performance regression (in percents) for -bc." << std::endl << std::endl;
         return 0;
     }
 
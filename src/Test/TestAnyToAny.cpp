@@ -242,6 +242,26 @@ namespace Test
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Base::BgrToHsl), FUNC_O(SimdBgrToHsl));
 
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Sse41::BgrToHsl), FUNC_O(SimdBgrToHsl));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Avx2::BgrToHsl), FUNC_O(SimdBgrToHsl));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Avx512bw::BgrToHsl), FUNC_O(SimdBgrToHsl));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC_O(Simd::Neon::BgrToHsl), FUNC_O(SimdBgrToHsl));
+#endif
+
         return result;
     }
 
@@ -251,6 +271,26 @@ namespace Test
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Base::BgrToHsv), FUNC_O(SimdBgrToHsv));
 
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Sse41::BgrToHsv), FUNC_O(SimdBgrToHsv));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Avx2::BgrToHsv), FUNC_O(SimdBgrToHsv));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Avx512bw::BgrToHsv), FUNC_O(SimdBgrToHsv));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC_O(Simd::Neon::BgrToHsv), FUNC_O(SimdBgrToHsv));
+#endif
+
         return result;
     }
 
@@ -317,6 +357,64 @@ namespace Test
         return result;
     }
 
+    bool HslToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Base::HslToBgr), FUNC_O(SimdHslToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Sse41::HslToBgr), FUNC_O(SimdHslToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Avx2::HslToBgr), FUNC_O(SimdHslToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Avx512bw::HslToBgr), FUNC_O(SimdHslToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Neon::HslToBgr), FUNC_O(SimdHslToBgr));
+#endif
+
+        return result;
+    }
+
+    bool HsvToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Base::HsvToBgr), FUNC_O(SimdHsvToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Sse41::HsvToBgr), FUNC_O(SimdHsvToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Avx2::HsvToBgr), FUNC_O(SimdHsvToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Avx512bw::HsvToBgr), FUNC_O(SimdHsvToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Neon::HsvToBgr), FUNC_O(SimdHsvToBgr));
+#endif
+
+        return result;
+    }
+
     bool Int16ToGrayAutoTest()
     {
         bool result = true;
@@ -470,6 +568,24 @@ namespace Test
         return result;
     }
 
+    bool HslToBgrDataTest(bool create)
+    {
+        bool result = true;
+
+        result = result && AnyToAnyDataTest(create, DW, DH, View::Hsl24, View::Bgr24, FUNC_O(SimdHslToBgr));
+
+        return result;
+    }
+
+    bool HsvToBgrDataTest(bool create)
+    {
+        bool result = true;
+
+        result = result && AnyToAnyDataTest(create, DW, DH, View::Hsv24, View::Bgr24, FUNC_O(SimdHsvToBgr));
+
+        return result;
+    }
+
     bool Int16ToGrayDataTest(bool create)
     {
         bool result = true;
@@ -403,6 +403,173 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncYuyv
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * yuyv, size_t yuyvStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncYuyv(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & yuyv) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, yuyv.data, yuyv.stride);
+            }
+        };
+    }
+
+#define FUNC_YUYV(function) FuncYuyv(function, #function)
+
+    bool AnyToYuyv422AutoTest(int width, int height, View::Format srcType, View::Format dstType, const FuncYuyv & f1, const FuncYuyv & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool AnyToYuyv422AutoTest(View::Format srcType, View::Format dstType, const FuncYuyv & f1, const FuncYuyv & f2)
+    {
+        bool result = true;
+
+        result = result && AnyToYuyv422AutoTest(W, H, srcType, dstType, f1, f2);
+        result = result && AnyToYuyv422AutoTest(W + E, H - E, srcType, dstType, f1, f2);
+
+        return result;
+    }
+
+    bool BgraToYuyv422AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Yuyv16, FUNC_YUYV(Simd::Base::BgraToYuyv422), FUNC_YUYV(SimdBgraToYuyv422));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Yuyv16, FUNC_YUYV(Simd::Sse2::BgraToYuyv422), FUNC_YUYV(SimdBgraToYuyv422));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Yuyv16, FUNC_YUYV(Simd::Avx2::BgraToYuyv422), FUNC_YUYV(SimdBgraToYuyv422));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Yuyv16, FUNC_YUYV(Simd::Avx512bw::BgraToYuyv422), FUNC_YUYV(SimdBgraToYuyv422));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Yuyv16, FUNC_YUYV(Simd::Neon::BgraToYuyv422), FUNC_YUYV(SimdBgraToYuyv422));
+#endif
+
+        return result;
+    }
+
+    bool BgraToUyvy422AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Uyvy16, FUNC_YUYV(Simd::Base::BgraToUyvy422), FUNC_YUYV(SimdBgraToUyvy422));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Uyvy16, FUNC_YUYV(Simd::Sse2::BgraToUyvy422), FUNC_YUYV(SimdBgraToUyvy422));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Uyvy16, FUNC_YUYV(Simd::Avx2::BgraToUyvy422), FUNC_YUYV(SimdBgraToUyvy422));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Uyvy16, FUNC_YUYV(Simd::Avx512bw::BgraToUyvy422), FUNC_YUYV(SimdBgraToUyvy422));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgra32, View::Uyvy16, FUNC_YUYV(Simd::Neon::BgraToUyvy422), FUNC_YUYV(SimdBgraToUyvy422));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuyv422AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Yuyv16, FUNC_YUYV(Simd::Base::BgrToYuyv422), FUNC_YUYV(SimdBgrToYuyv422));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Yuyv16, FUNC_YUYV(Simd::Ssse3::BgrToYuyv422), FUNC_YUYV(SimdBgrToYuyv422));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Yuyv16, FUNC_YUYV(Simd::Avx2::BgrToYuyv422), FUNC_YUYV(SimdBgrToYuyv422));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Yuyv16, FUNC_YUYV(Simd::Avx512bw::BgrToYuyv422), FUNC_YUYV(SimdBgrToYuyv422));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Yuyv16, FUNC_YUYV(Simd::Neon::BgrToYuyv422), FUNC_YUYV(SimdBgrToYuyv422));
+#endif
+
+        return result;
+    }
+
+    bool BgrToUyvy422AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Uyvy16, FUNC_YUYV(Simd::Base::BgrToUyvy422), FUNC_YUYV(SimdBgrToUyvy422));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Uyvy16, FUNC_YUYV(Simd::Ssse3::BgrToUyvy422), FUNC_YUYV(SimdBgrToUyvy422));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Uyvy16, FUNC_YUYV(Simd::Avx2::BgrToUyvy422), FUNC_YUYV(SimdBgrToUyvy422));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Uyvy16, FUNC_YUYV(Simd::Avx512bw::BgrToUyvy422), FUNC_YUYV(SimdBgrToUyvy422));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuyv422AutoTest(View::Bgr24, View::Uyvy16, FUNC_YUYV(Simd::Neon::BgrToUyvy422), FUNC_YUYV(SimdBgrToUyvy422));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool AnyToYuvDataTest(bool create, int width, int height, View::Format srcType, int dx, int dy, const FuncYuv & f)
@@ -68,7 +68,7 @@ namespace Test
         return result;
     }
 
-    bool BayerToBgraAutoTest(const Func & f1, const Func & f2)
+    bool BayerToBgraAutoTest(const Func & f1, const Func & f2, size_t A)
     {
         bool result = true;
 
@@ -76,6 +76,8 @@ namespace Test
         {
             result = result && BayerToBgraAutoTest(W, H, format, f1, f2);
             result = result && BayerToBgraAutoTest(W + E, H - E, format, f1, f2);
+            for (size_t k = 1; k <= 3; ++k)
+                result = result && BayerToBgraAutoTest(int(2 + k * A), 8, format, f1, f2);
         }
 
         return result;
@@ -85,26 +87,129 @@ namespace Test
     {
         bool result = true;
 
-        result = result && BayerToBgraAutoTest(FUNC(Simd::Base::BayerToBgra), FUNC(SimdBayerToBgra));
+        result = result && BayerToBgraAutoTest(FUNC(Simd::Base::BayerToBgra), FUNC(SimdBayerToBgra), 16);
 
 #ifdef SIMD_SSE2_ENABLE
         if (Simd::Sse2::Enable && W >= Simd::Sse2::A + 2)
-            result = result && BayerToBgraAutoTest(FUNC(Simd::Sse2::BayerToBgra), FUNC(SimdBayerToBgra));
+            result = result && BayerToBgraAutoTest(FUNC(Simd::Sse2::BayerToBgra), FUNC(SimdBayerToBgra), Simd::Sse2::A);
 #endif 
 
 #ifdef SIMD_AVX2_ENABLE
         if (Simd::Avx2::Enable && W >= Simd::Avx2::A + 2)
-            result = result && BayerToBgraAutoTest(FUNC(Simd::Avx2::BayerToBgra), FUNC(SimdBayerToBgra));
+            result = result && BayerToBgraAutoTest(FUNC(Simd::Avx2::BayerToBgra), FUNC(SimdBayerToBgra), Simd::Avx2::A);
 #endif 
 
 #ifdef SIMD_AVX512BW_ENABLE
         if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A + 2)
-            result = result && BayerToBgraAutoTest(FUNC(Simd::Avx512bw::BayerToBgra), FUNC(SimdBayerToBgra));
+            result = result && BayerToBgraAutoTest(FUNC(Simd::Avx512bw::BayerToBgra), FUNC(SimdBayerToBgra), Simd::Avx512bw::A);
 #endif
 
 #ifdef SIMD_NEON_ENABLE
         if (Simd::Neon::Enable && W >= Simd::Neon::A + 2)
-            result = result && BayerToBgraAutoTest(FUNC(Simd::Neon::BayerToBgra), FUNC(SimdBayerToBgra));
+            result = result && BayerToBgraAutoTest(FUNC(Simd::Neon::BayerToBgra), FUNC(SimdBayerToBgra), Simd::Neon::A);
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncV2
+        {
+            typedef void(*FuncPtr)(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdBayerDemosaicType demosaic);
+
+            FuncPtr func;
+            String description;
+            SimdBayerDemosaicType demosaic;
+
+            FuncV2(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdBayerDemosaicType type)
+            {
+                demosaic = type;
+                description = description + "[" + ToString(demosaic) + "]";
+            }
+
+            void Call(const View & src, View & dst, uint8_t alpha) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, dst.data, dst.stride, alpha, demosaic);
+            }
+        };
+    }
+
+#define FUNC_V2(function) FuncV2(function, #function)
+
+    bool BayerToBgraV2AutoTest(int width, int height, View::Format format, const FuncV2 & f1, const FuncV2 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] of " << FormatDescription(format) << ".");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1, 0xFF));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2, 0xFF));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool BayerToBgraV2AutoTest(const FuncV2 & f1, const FuncV2 & f2, size_t A)
+    {
+        bool result = true;
+
+        for (int type = (int)SimdBayerDemosaicBilinear; type <= (int)SimdBayerDemosaicMalvar && result; ++type)
+        {
+            FuncV2 f1t = f1, f2t = f2;
+            f1t.Update((SimdBayerDemosaicType)type);
+            f2t.Update((SimdBayerDemosaicType)type);
+
+            for (View::Format format = View::BayerGrbg; format <= View::BayerBggr; format = View::Format(format + 1))
+            {
+                result = result && BayerToBgraV2AutoTest(W, H, format, f1t, f2t);
+                result = result && BayerToBgraV2AutoTest(W + E, H - E, format, f1t, f2t);
+                result = result && BayerToBgraV2AutoTest(W - E, H + E, format, f1t, f2t);
+                for (size_t k = 2; k <= 3; ++k)
+                    result = result && BayerToBgraV2AutoTest(int(2 + k * A), 8, format, f1t, f2t);
+            }
+        }
+
+        return result;
+    }
+
+    bool BayerToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && BayerToBgraV2AutoTest(FUNC_V2(Simd::Base::BayerToBgraV2), FUNC_V2(SimdBayerToBgraV2), 16);
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A + 4)
+            result = result && BayerToBgraV2AutoTest(FUNC_V2(Simd::Ssse3::BayerToBgraV2), FUNC_V2(SimdBayerToBgraV2), Simd::Ssse3::A);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A + 4)
+            result = result && BayerToBgraV2AutoTest(FUNC_V2(Simd::Avx2::BayerToBgraV2), FUNC_V2(SimdBayerToBgraV2), Simd::Avx2::A);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::A + 4)
+            result = result && BayerToBgraV2AutoTest(FUNC_V2(Simd::Avx512bw::BayerToBgraV2), FUNC_V2(SimdBayerToBgraV2), Simd::Avx512bw::A);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A + 4)
+            result = result && BayerToBgraV2AutoTest(FUNC_V2(Simd::Neon::BayerToBgraV2), FUNC_V2(SimdBayerToBgraV2), Simd::Neon::A);
 #endif 
 
         return result;
@@ -164,4 +269,64 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    bool BayerToBgraV2DataTest(bool create, int width, int height, View::Format format, const FuncV2 & f)
+    {
+        bool result = true;
+
+        Data data(f.description);
+
+        TEST_LOG_SS(Info, (create ? "Create" : "Verify") << " test " << f.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+
+        View dst1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        if (create)
+        {
+            FillRandom(src);
+
+            TEST_SAVE(src);
+
+            f.Call(src, dst1, 0xFF);
+
+            TEST_SAVE(dst1);
+        }
+        else
+        {
+            TEST_LOAD(src);
+
+            TEST_LOAD(dst1);
+
+            f.Call(src, dst2, 0xFF);
+
+            TEST_SAVE(dst2);
+
+            result = result && Compare(dst1, dst2, 0, true, 32, 0);
+        }
+
+        return result;
+    }
+
+    bool BayerToBgraV2DataTest(bool create)
+    {
+        bool result = true;
+
+        for (int type = (int)SimdBayerDemosaicBilinear; type <= (int)SimdBayerDemosaicMalvar; ++type)
+        {
+            FuncV2 f = FUNC_V2(SimdBayerToBgraV2);
+            f.Update((SimdBayerDemosaicType)type);
+            for (View::Format format = View::BayerGrbg; format <= View::BayerBggr; format = View::Format(format + 1))
+            {
+                FuncV2 fc = f;
+                fc.description = f.description + Data::Description(format);
+                result = result && BayerToBgraV2DataTest(create, DW, DH, format, fc);
+            }
+        }
+
+        return result;
+    }
 }
@@ -553,6 +553,10 @@ namespace Test
             return "_Hsv24";
         case View::Hsl24:
             return "_Hsl24";
+        case View::Yuyv16:
+            return "_Yuyv16";
+        case View::Uyvy16:
+            return "_Uyvy16";
         }
         assert(0);
         return "_Unknown";
@@ -336,6 +336,177 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncLut8u
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+                const uint8_t * table, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncLut8u(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, const View & table, const View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, src.ChannelCount(), table.data, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_LUT8U(function) \
+    FuncLut8u(function, std::string(#function))
+
+    bool Lut8uAutoTest(int width, int height, View::Format format, const FuncLut8u & f1, const FuncLut8u & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "] of " << FormatDescription(format) << ".");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View t(Simd::LUT8U_SIZE * View::PixelSize(format), 1, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(t);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, t, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, t, d2));
+
+        result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    bool Lut8uAutoTest(const FuncLut8u & f1, const FuncLut8u & f2)
+    {
+        bool result = true;
+
+        View::Format formats[3] = { View::Gray8, View::Bgr24, View::Bgra32 };
+        for (int i = 0; i < 3; ++i)
+        {
+            result = result && Lut8uAutoTest(W, H, formats[i], f1, f2);
+            result = result && Lut8uAutoTest(W + O, H - O, formats[i], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool Lut8uAutoTest()
+    {
+        bool result = true;
+
+        result = result && Lut8uAutoTest(FUNC_LUT8U(Simd::Base::Lut8u), FUNC_LUT8U(SimdLut8u));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Lut8uAutoTest(FUNC_LUT8U(Simd::Avx2::Lut8u), FUNC_LUT8U(SimdLut8u));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Lut8uAutoTest(FUNC_LUT8U(Simd::Avx512bw::Lut8u), FUNC_LUT8U(SimdLut8u));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && Lut8uAutoTest(FUNC_LUT8U(Simd::Neon::Lut8u), FUNC_LUT8U(SimdLut8u));
+#endif 
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncLut16u
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                const uint8_t * table, size_t bits, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncLut16u(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, const View & table, size_t bits, const View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, table.data, bits, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_LUT16U(function) \
+    FuncLut16u(function, std::string(#function))
+
+    bool Lut16uTo8uAutoTest(int width, int height, size_t bits, const FuncLut16u & f1, const FuncLut16u & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "] for " << bits << " bits.");
+
+        View s(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+        for (size_t row = 0; row < s.height; ++row)
+        {
+            uint16_t * data = (uint16_t*)(s.data + row * s.stride);
+            for (size_t col = 0; col < s.width; ++col)
+                data[col] = uint16_t(data[col] & ((2 << bits) - 1));
+        }
+
+        View t(1 << bits, 1, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(t);
+
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, t, bits, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, t, bits, d2));
+
+        result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    bool Lut16uTo8uAutoTest(const FuncLut16u & f1, const FuncLut16u & f2)
+    {
+        bool result = true;
+
+        size_t bits[3] = { 10, 12, 16 };
+        for (int i = 0; i < 3; ++i)
+        {
+            result = result && Lut16uTo8uAutoTest(W, H, bits[i], f1, f2);
+            result = result && Lut16uTo8uAutoTest(W + O, H - O, bits[i], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool Lut16uTo8uAutoTest()
+    {
+        bool result = true;
+
+        result = result && Lut16uTo8uAutoTest(FUNC_LUT16U(Simd::Base::Lut16uTo8u), FUNC_LUT16U(SimdLut16uTo8u));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Lut16uTo8uAutoTest(FUNC_LUT16U(Simd::Avx2::Lut16uTo8u), FUNC_LUT16U(SimdLut16uTo8u));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Lut16uTo8uAutoTest(FUNC_LUT16U(Simd::Avx512bw::Lut16uTo8u), FUNC_LUT16U(SimdLut16uTo8u));
+#endif 
+
+        return result;
+    }
+
     namespace
     {
         struct FuncHC
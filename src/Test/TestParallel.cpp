@@ -0,0 +1,427 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCpu.h"
+
+#include <functional>
+#include <thread>
+#include <future>
+#include <atomic>
+#include <stdexcept>
+
+namespace Test
+{
+    bool ThreadPoolAutoTest(size_t size, size_t count)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::ThreadPool with " << size << " threads: blocks, nested and concurrent jobs, exceptions.");
+
+        Simd::ThreadPool pool(size);
+        Simd::ThreadPool::Bind(&pool);
+
+        std::vector<int> counts(count, 0);
+        std::atomic<size_t> maxThread(0), nested(0);
+        Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+                counts[i]++;
+            for (size_t max = maxThread.load(); thread > max && !maxThread.compare_exchange_weak(max, thread););
+            Simd::Parallel(0, 64, [&](size_t thread, size_t begin, size_t end)
+            {
+                nested += thread == 0 && begin == 0 && end == 64 ? 1 : 0;
+            }, size);
+        }, size * 4);
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            if (counts[i] != 1)
+            {
+                TEST_LOG_SS(Error, "Element " << i << " is processed " << counts[i] << " times!");
+                result = false;
+            }
+        }
+        if (maxThread.load() >= size)
+        {
+            TEST_LOG_SS(Error, "Thread index " << maxThread.load() << " exceeds size of the pool " << size << " !");
+            result = false;
+        }
+        if (nested.load() != std::min(size, count))
+        {
+            TEST_LOG_SS(Error, "Nested jobs are not executed in calling thread!");
+            result = false;
+        }
+
+        bool thrown = false;
+        try
+        {
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                if (end == count)
+                    throw std::runtime_error("test");
+            }, size);
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        if (!thrown)
+        {
+            TEST_LOG_SS(Error, "Exception of a block is not rethrown in calling thread!");
+            result = false;
+        }
+
+        std::atomic<size_t> sum(0);
+        std::thread concurrent([&]
+        {
+            Simd::ThreadPool::Bind(&pool);
+            for (size_t j = 0; j < 100; ++j)
+                Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end) { sum += end - begin; }, size);
+        });
+        for (size_t j = 0; j < 100; ++j)
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end) { sum += end - begin; }, size);
+        concurrent.join();
+        if (sum.load() != count * 200)
+        {
+            TEST_LOG_SS(Error, "Concurrent jobs process " << sum.load() << " elements instead of " << count * 200 << " !");
+            result = false;
+        }
+
+        Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end) { if (thread == 0) pool.SetSize(1); }, size);
+        if (pool.Size() != 1)
+        {
+            TEST_LOG_SS(Error, "Size of the pool " << pool.Size() << " != 1 after SetSize from a job!");
+            result = false;
+        }
+
+        Simd::ThreadPool::Bind(NULL);
+
+        return result;
+    }
+
+    bool ThreadPoolAutoTest()
+    {
+        bool result = true;
+
+        result = result && ThreadPoolAutoTest(4, 1000);
+        result = result && ThreadPoolAutoTest(3, 2);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncPR
+        {
+            typedef std::function<void(View & dst)> FuncPtr;
+
+            FuncPtr func;
+            String description;
+
+            FuncPR(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(View & dst, void * context) const
+            {
+                SimdContextBind(context);
+                {
+                    TEST_PERFORMANCE_TEST(description + (context ? "<mt>" : "<st>"));
+                    func(dst);
+                }
+                SimdContextBind(NULL);
+            }
+        };
+    }
+
+    bool ParallelRowsAutoTest(const FuncPR & f, View::Format format, size_t width, size_t height, size_t threads)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " [" << width << ", " << height << "]: " << threads << " threads & 1 thread.");
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+        Simd::Fill(dst1, 1);
+        Simd::Fill(dst2, 2);
+
+        void * context = SimdContextCreate(threads, SimdAffinityNone);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(dst1, NULL));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(dst2, context));
+
+        SimdRelease(context);
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ParallelRowsAutoTest()
+    {
+        bool result = true;
+
+        const size_t w = 1000, h = 998, threads = 4;
+
+        View gray(w, h, View::Gray8, NULL, TEST_ALIGN(w));
+        View gray2(w, h, View::Gray8, NULL, TEST_ALIGN(w));
+        View bgra(w, h, View::Bgra32, NULL, TEST_ALIGN(w));
+        View u(w / 2, h / 2, View::Gray8, NULL, TEST_ALIGN(w)), v(w / 2, h / 2, View::Gray8, NULL, TEST_ALIGN(w));
+        View bayer(w, h, View::BayerGrbg, NULL, TEST_ALIGN(w));
+        FillRandom(gray);
+        FillRandom(gray2);
+        FillRandom(bgra);
+        FillRandom(u);
+        FillRandom(v);
+        FillRandom(bayer);
+
+        result = result && ParallelRowsAutoTest(FuncPR([&](View & dst) 
+        {
+            SimdBgraToGray(bgra.data, w, h - 1, bgra.stride, dst.data, dst.stride);
+        }, "SimdBgraToGray"), View::Gray8, w, h - 1, threads);
+
+        result = result && ParallelRowsAutoTest(FuncPR([&](View & dst)
+        {
+            SimdYuv420pToBgra(gray.data, gray.stride, u.data, u.stride, v.data, v.stride, w, h, dst.data, dst.stride, 0xFF);
+        }, "SimdYuv420pToBgra"), View::Bgra32, w, h, threads);
+
+        result = result && ParallelRowsAutoTest(FuncPR([&](View & dst)
+        {
+            SimdGaussianBlur3x3(bgra.data, bgra.stride, w, h - 1, 4, dst.data, dst.stride);
+        }, "SimdGaussianBlur3x3"), View::Bgra32, w, h - 1, threads);
+
+        result = result && ParallelRowsAutoTest(FuncPR([&](View & dst)
+        {
+            SimdMedianFilterSquare5x5(gray.data, gray.stride, w, h - 1, 1, dst.data, dst.stride);
+        }, "SimdMedianFilterSquare5x5"), View::Gray8, w, h - 1, threads);
+
+        result = result && ParallelRowsAutoTest(FuncPR([&](View & dst)
+        {
+            SimdBayerToBgr(bayer.data, w, h, bayer.stride, (SimdPixelFormatType)bayer.format, dst.data, dst.stride);
+        }, "SimdBayerToBgr"), View::Bgr24, w, h, threads);
+
+        result = result && ParallelRowsAutoTest(FuncPR([&](View & dst)
+        {
+            SimdValueSum(gray.data, gray.stride, w, h - 1, (uint64_t*)dst.data);
+            SimdSquaredDifferenceSum(gray.data, gray.stride, gray2.data, gray2.stride, w, h - 1, (uint64_t*)dst.data + 1);
+        }, "SimdValueSum & SimdSquaredDifferenceSum"), View::Int64, 2, 1, threads);
+
+        result = result && ParallelRowsAutoTest(FuncPR([&](View & dst)
+        {
+            SimdHistogram(gray.data, w, h - 1, gray.stride, (uint32_t*)dst.data);
+        }, "SimdHistogram"), View::Int32, Simd::HISTOGRAM_SIZE, 1, threads);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool ParallelResizerAutoTest()
+    {
+        bool result = true;
+
+        const size_t srcW = 1920, srcH = 1080, dstW = 1280, dstH = 720, channels = 3, threads = 4;
+
+        for (int t = SimdResizeChannelByte; t <= SimdResizeChannelShort; ++t)
+        {
+            SimdResizeChannelType type = (SimdResizeChannelType)t;
+            View::Format format = type == SimdResizeChannelByte ? View::Bgr24 : (type == SimdResizeChannelFloat ? View::Float : View::Int16);
+            size_t k = type == SimdResizeChannelByte ? 1 : channels;
+
+            View src(srcW * k, srcH, format, NULL, TEST_ALIGN(srcW * k));
+            if (format == View::Float)
+                FillRandom32f(src);
+            else
+                FillRandom(src);
+
+            for (int m = SimdResizeMethodBilinear; m <= SimdResizeMethodLanczos3; ++m)
+            {
+                void * resizer = SimdResizerInit(srcW, srcH, dstW, dstH, channels, type, (SimdResizeMethodType)m);
+                if (resizer == NULL)
+                    continue;
+
+                std::stringstream description;
+                description << "SimdResizerRun[" << m << "-" << t << "-" << channels << "]";
+                result = result && ParallelRowsAutoTest(FuncPR([&](View & dst)
+                {
+                    SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride);
+                }, description.str()), format, dstW * k, dstH, threads);
+
+                SimdRelease(resizer);
+            }
+        }
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool ContextBindAutoTest(size_t width, size_t height, size_t threads)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdContextBind [" << width << ", " << height << "]: bind and use in one thread, release in another.");
+
+        View src(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::Fill(dst1, 1);
+        Simd::Fill(dst2, 2);
+
+        const size_t global = SimdGetThreadNumber();
+        void * context = SimdContextCreate(threads, SimdAffinityNone);
+        const size_t number = threads;
+
+        std::promise<void> bound, released;
+        size_t numberBound = 0, numberReleased = 0;
+        std::thread thread([&]
+        {
+            SimdContextBind(context);
+            numberBound = SimdGetThreadNumber();
+            SimdBgraToGray(src.data, width, height, src.stride, dst1.data, dst1.stride);
+            bound.set_value();
+            released.get_future().wait();
+            numberReleased = SimdGetThreadNumber();
+            SimdBgraToGray(src.data, width, height, src.stride, dst2.data, dst2.stride);
+            SimdContextBind(NULL);
+        });
+        bound.get_future().wait();
+        SimdRelease(context);
+        released.set_value();
+        thread.join();
+
+        if (numberBound != number)
+        {
+            TEST_LOG_SS(Error, "Thread number of bound context: " << numberBound << " != " << number << " !");
+            result = false;
+        }
+
+        if (numberReleased != global)
+        {
+            TEST_LOG_SS(Error, "Thread number after release of bound context: " << numberReleased << " != " << global << " !");
+            result = false;
+        }
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ContextBindAutoTest()
+    {
+        bool result = true;
+
+        result = result && ContextBindAutoTest(1000, 998, 4);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    static bool Overlap(const std::vector<size_t> & a, const std::vector<size_t> & b)
+    {
+        for (size_t i = 0; i < a.size(); ++i)
+            if (std::find(b.begin(), b.end(), a[i]) != b.end())
+                return true;
+        return false;
+    }
+
+    static std::vector<size_t> WorkerCpus(void * context, size_t threads)
+    {
+        std::vector<size_t> cpus;
+        std::mutex mutex;
+        SimdContextBind(context);
+        Simd::Parallel(0, threads, [&](size_t thread, size_t begin, size_t end)
+        {
+            std::vector<size_t> affinity;
+            if (thread && Simd::Base::GetThreadAffinity(affinity))
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                cpus.insert(cpus.end(), affinity.begin(), affinity.end());
+            }
+        }, threads);
+        SimdContextBind(NULL);
+        return cpus;
+    }
+
+    bool ContextAffinityAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdContextCreate with affinity: contexts get disjoint CPUs.");
+
+        std::vector<size_t> candidates, a, b, c;
+        for (size_t i = 0; i < 8; ++i)
+            candidates.push_back(1000000 + i);
+        Simd::Base::CpuAllocate(candidates, 4, a);
+        Simd::Base::CpuAllocate(candidates, 4, b);
+        if (a.size() != 4 || b.size() != 4 || Overlap(a, b))
+        {
+            TEST_LOG_SS(Error, "CpuAllocate gives overlapped CPUs while there are free ones!");
+            result = false;
+        }
+        Simd::Base::CpuRelease(a);
+        Simd::Base::CpuAllocate(candidates, 4, c);
+        if (c != a)
+        {
+            TEST_LOG_SS(Error, "CpuAllocate does not reuse released CPUs!");
+            result = false;
+        }
+        Simd::Base::CpuRelease(b);
+        Simd::Base::CpuRelease(c);
+
+        std::vector<size_t> cores, before, after;
+        Simd::Base::CpuAffinity(SimdAffinityCore, cores);
+        if (cores.size() >= 4 && Simd::Base::GetThreadAffinity(before))
+        {
+            const size_t threads = 2;
+            void * context1 = SimdContextCreate(threads, SimdAffinityCore);
+            void * context2 = SimdContextCreate(threads, SimdAffinityCore);
+            std::vector<size_t> cpus1 = WorkerCpus(context1, threads);
+            std::vector<size_t> cpus2 = WorkerCpus(context2, threads);
+            if (cpus1.empty() || cpus2.empty() || Overlap(cpus1, cpus2))
+            {
+                TEST_LOG_SS(Error, "Workers of two contexts are pinned to the same CPUs!");
+                result = false;
+            }
+            SimdRelease(context1);
+            SimdRelease(context2);
+            if (!Simd::Base::GetThreadAffinity(after) || after != before)
+            {
+                TEST_LOG_SS(Error, "Affinity of calling thread is not restored after unbind!");
+                result = false;
+            }
+        }
+        else
+            TEST_LOG_SS(Info, "There are only " << cores.size() << " cores (or affinity is not supported): check of real contexts is skipped.");
+
+        return result;
+    }
+}
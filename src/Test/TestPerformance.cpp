@@ -182,6 +182,22 @@ namespace Test
         return thread.align ? SIMD_ALIGN : sizeof(void*);
     }
 
+    PerformanceMeasurerStorage::FunctionMap PerformanceMeasurerStorage::Combined() const
+    {
+        FunctionMap map;
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
+        {
+            for (FunctionMap::const_iterator function = thread->second.map.begin(); function != thread->second.map.end(); ++function)
+            {
+                if (map.find(function->first) == map.end())
+                    map[function->first].reset(new PerformanceMeasurer(function->first));
+                map[function->first]->Combine(*function->second);
+            }
+        }
+        return map;
+    }
+
     static String FunctionShortName(const String & description)
     {
         bool isApi = description.find("Simd::") == std::string::npos;
@@ -196,6 +212,12 @@ namespace Test
         }
     }
 
+    static bool FunctionAlign(const String & description)
+    {
+        static const String tag = "{a}";
+        return description.size() >= tag.size() && description.compare(description.size() - tag.size(), tag.size(), tag) == 0;
+    }
+
     template <class Measurer> double Relation(const Measurer & a, const Measurer & b)
     {
         return b.Average() > 0 ? a.Average() / b.Average() : 0;
@@ -270,8 +292,7 @@ namespace Test
 
     static inline void AddToFunction(const PerformanceMeasurer & src, Function & dst, bool & enable)
     {
-        const String & desc = src.Description();
-        bool align = desc[desc.size() - 2] == 'a';
+        bool align = FunctionAlign(src.Description());
         (align ? dst.first : dst.second) = src;
         enable = true;
     }
@@ -340,19 +361,7 @@ namespace Test
 
     String PerformanceMeasurerStorage::TextReport(bool align, bool raw) const
     {
-        FunctionMap map;
-        {
-            std::lock_guard<std::recursive_mutex> lock(_mutex);
-            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
-            {
-                for (FunctionMap::const_iterator function = thread->second.map.begin(); function != thread->second.map.end(); ++function)
-                {
-                    if (map.find(function->first) == map.end())
-                        map[function->first].reset(new PerformanceMeasurer(function->first));
-                    map[function->first]->Combine(*function->second);
-                }
-            }
-        }
+        FunctionMap map = Combined();
 
         std::stringstream report;
 
@@ -419,19 +428,7 @@ namespace Test
 
     PerformanceMeasurerStorage::TablePtr PerformanceMeasurerStorage::GenerateTable(bool align) const
     {
-        FunctionMap map;
-        {
-            std::lock_guard<std::recursive_mutex> lock(_mutex);
-            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
-            {
-                for (FunctionMap::const_iterator function = thread->second.map.begin(); function != thread->second.map.end(); ++function)
-                {
-                    if (map.find(function->first) == map.end())
-                        map[function->first].reset(new PerformanceMeasurer(function->first));
-                    map[function->first]->Combine(*function->second);
-                }
-            }
-        }
+        FunctionMap map = Combined();
 
         FunctionStatisticMap functions;
         CommonStatistic common;
@@ -447,11 +444,11 @@ namespace Test
         for (FunctionStatisticMap::const_iterator it = functions.begin(); it != functions.end(); ++it)
             AddToCommon(it->second, enable, common);
 
-        size_t size = 0;
+        size_t size = 0, relations = 0;
         for (size_t i = 0; i < enable.Size(); ++i)
             if (enable[i])
-                size++;
-        TablePtr table(new Table(size*(align ? 4 : 3) - 3, 1 + functions.size()));
+                size++, relations += i >= 2 ? 1 : 0;
+        TablePtr table(new Table(1 + size + 2 * relations + (align ? size : 0), 1 + functions.size()));
         AddHeader(*table, names, enable, align);
         size_t row = 0;
         table->SetRowProp(row, true, true);
@@ -489,6 +486,272 @@ namespace Test
         return true;
     }
 
+    static String FunctionIsa(const String & description)
+    {
+        static const char * isas[] = { "Base", "Sse", "Sse2", "Sse3", "Ssse3", "Sse41", "Sse42", "Avx", "Avx2", 
+            "Avx512f", "Avx512bw", "Avx512vnni", "Vmx", "Vsx", "Neon", "Msa" };
+        if (description.find("Simd::") == std::string::npos)
+            return "Simd";
+        for (size_t i = 0; i < sizeof(isas) / sizeof(isas[0]); ++i)
+            if (description.find(String("Simd::") + isas[i] + "::") != std::string::npos)
+                return isas[i];
+        return "Unknown";
+    }
+
+    static String JsonEscape(const String & value)
+    {
+        String escaped;
+        for (size_t i = 0; i < value.size(); ++i)
+        {
+            if (value[i] == '"' || value[i] == '\\')
+                escaped.push_back('\\');
+            escaped.push_back(value[i]);
+        }
+        return escaped;
+    }
+
+    bool PerformanceMeasurerStorage::JsonReport(const String & path) const
+    {
+        CreatePathIfNotExist(path);
+        std::ofstream file(path);
+        if (!file.is_open())
+            return false;
+
+        FunctionMap map = Combined();
+        file << "{" << std::endl;
+        file << "\"date\":\"" << GetCurrentDateTimeString() << "\"," << std::endl;
+        file << "\"functions\":[";
+        for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
+        {
+            const PerformanceMeasurer & pm = *it->second;
+            const String & desc = pm.Description();
+            double bytes = pm.Count() > 0 ? double(pm.Size()) / pm.Count() : 0.0;
+            file << (it == map.begin() ? "\n" : ",\n") << std::setprecision(6) << std::fixed;
+            file << "{\"name\":\"" << JsonEscape(desc) << "\",\"count\":" << pm.Count() << ",\"total\":" << pm.Total() * 1000.0;
+            file << ",\"min\":" << pm.Min() * 1000.0 << ",\"average\":" << pm.Average() * 1000.0 << ",\"max\":" << pm.Max() * 1000.0;
+            file << ",\"function\":\"" << JsonEscape(FunctionShortName(desc)) << "\",\"isa\":\"" << FunctionIsa(desc);
+            file << "\",\"align\":" << (FunctionAlign(desc) ? "true" : "false") << ",\"bytes\":" << bytes << "}";
+        }
+        file << (map.empty() ? "]," : "\n],") << std::endl;
+        file << "\"internal\":" << SimdPerformanceJson() << std::endl;
+        file << "}" << std::endl;
+        file.close();
+
+        return true;
+    }
+
+    /*
+    * Minimal reader of JSON documents written by JsonReport: the arrays "functions" and "internal"
+    * have the format of SimdPerformanceJson (objects with "name", "count", "total", "min", "average", "max").
+    */
+    struct JsonValue
+    {
+        enum Type { Null, Boolean, Number, Text, Array, Object } type;
+        double number;
+        String text;
+        std::vector<JsonValue> items;
+        std::vector<String> keys;
+
+        JsonValue() : type(Null), number(0) {}
+
+        const JsonValue * Find(const String & key) const
+        {
+            for (size_t i = 0; i < keys.size(); ++i)
+                if (keys[i] == key)
+                    return &items[i];
+            return NULL;
+        }
+    };
+
+    class JsonParser
+    {
+    public:
+        JsonParser(const String & text) : _text(text), _pos(0) {}
+
+        bool Parse(JsonValue & value)
+        {
+            return ParseValue(value) && (Skip(), _pos == _text.size());
+        }
+
+    private:
+        const String & _text;
+        size_t _pos;
+
+        void Skip()
+        {
+            while (_pos < _text.size() && ::isspace((unsigned char)_text[_pos]))
+                _pos++;
+        }
+
+        bool Expect(char symbol)
+        {
+            Skip();
+            if (_pos < _text.size() && _text[_pos] == symbol)
+            {
+                _pos++;
+                return true;
+            }
+            return false;
+        }
+
+        bool ParseText(String & text)
+        {
+            if (!Expect('"'))
+                return false;
+            for (; _pos < _text.size() && _text[_pos] != '"'; ++_pos)
+            {
+                if (_text[_pos] == '\\' && ++_pos == _text.size())
+                    return false;
+                text.push_back(_text[_pos]);
+            }
+            return Expect('"');
+        }
+
+        bool ParseValue(JsonValue & value)
+        {
+            Skip();
+            if (_pos == _text.size())
+                return false;
+            char symbol = _text[_pos];
+            if (symbol == '{')
+            {
+                value.type = JsonValue::Object;
+                _pos++;
+                if (Expect('}'))
+                    return true;
+                do
+                {
+                    value.keys.push_back(String());
+                    value.items.push_back(JsonValue());
+                    if (!ParseText(value.keys.back()) || !Expect(':') || !ParseValue(value.items.back()))
+                        return false;
+                } while (Expect(','));
+                return Expect('}');
+            }
+            if (symbol == '[')
+            {
+                value.type = JsonValue::Array;
+                _pos++;
+                if (Expect(']'))
+                    return true;
+                do
+                {
+                    value.items.push_back(JsonValue());
+                    if (!ParseValue(value.items.back()))
+                        return false;
+                } while (Expect(','));
+                return Expect(']');
+            }
+            if (symbol == '"')
+            {
+                value.type = JsonValue::Text;
+                return ParseText(value.text);
+            }
+            static const char * words[3] = { "null", "true", "false" };
+            for (size_t i = 0; i < 3; ++i)
+            {
+                if (_text.compare(_pos, ::strlen(words[i]), words[i]) == 0)
+                {
+                    value.type = i ? JsonValue::Boolean : JsonValue::Null;
+                    value.number = i == 1 ? 1.0 : 0.0;
+                    _pos += ::strlen(words[i]);
+                    return true;
+                }
+            }
+            const char * beg = _text.c_str() + _pos;
+            char * end = NULL;
+            value.type = JsonValue::Number;
+            value.number = ::strtod(beg, &end);
+            _pos += end - beg;
+            return end != beg;
+        }
+    };
+
+    typedef std::map<String, double> AverageMap;
+
+    static bool GetAverages(const JsonValue * counters, AverageMap & averages)
+    {
+        if (counters == NULL || counters->type != JsonValue::Array)
+            return false;
+        for (size_t i = 0; i < counters->items.size(); ++i)
+        {
+            const JsonValue * name = counters->items[i].Find("name");
+            const JsonValue * average = counters->items[i].Find("average");
+            if (name == NULL || name->type != JsonValue::Text || average == NULL || average->type != JsonValue::Number)
+                return false;
+            averages[name->text] = average->number;
+        }
+        return true;
+    }
+
+    static bool LoadBaseline(const String & path, AverageMap & functions, AverageMap & internal)
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+            return false;
+        std::stringstream text;
+        text << file.rdbuf();
+        JsonValue document;
+        if (!JsonParser(text.str()).Parse(document) || document.type != JsonValue::Object)
+            return false;
+        return GetAverages(document.Find("functions"), functions) && GetAverages(document.Find("internal"), internal);
+    }
+
+    static void CompareAverages(const AverageMap & current, const AverageMap & baseline, double threshold,
+        const String & prefix, size_t & compared, size_t & improvements, std::stringstream & regressions, size_t & count)
+    {
+        typedef std::pair<double, String> Difference;
+        std::vector<Difference> differences;
+        for (AverageMap::const_iterator it = current.begin(); it != current.end(); ++it)
+        {
+            AverageMap::const_iterator base = baseline.find(it->first);
+            if (base == baseline.end() || base->second <= 0 || it->second <= 0)
+                continue;
+            double relation = it->second / base->second;
+            if (relation > 1.0 + threshold)
+                differences.push_back(Difference(relation, it->first));
+            if (relation < 1.0 / (1.0 + threshold))
+                improvements++;
+            compared++;
+        }
+        std::sort(differences.rbegin(), differences.rend());
+        for (size_t i = 0; i < differences.size(); ++i)
+        {
+            const String & name = differences[i].second;
+            regressions << prefix << name << ": " << std::setprecision(3) << std::fixed << baseline.at(name) << " -> " << current.at(name);
+            regressions << " ms (+" << std::setprecision(1) << (differences[i].first - 1.0) * 100.0 << "%)" << std::endl;
+        }
+        count += differences.size();
+    }
+
+    int PerformanceMeasurerStorage::CompareReport(const String & path, double threshold, String & report) const
+    {
+        AverageMap baseFunctions, baseInternal;
+        if (!LoadBaseline(path, baseFunctions, baseInternal))
+            return -1;
+
+        AverageMap functions, internal;
+        FunctionMap map = Combined();
+        for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
+            functions[it->first] = it->second->Average() * 1000.0;
+        JsonValue counters;
+        if (!JsonParser(SimdPerformanceJson()).Parse(counters) || !GetAverages(&counters, internal))
+            return -1;
+
+        size_t compared = 0, improvements = 0, count = 0;
+        std::stringstream regressions;
+        CompareAverages(functions, baseFunctions, threshold, "", compared, improvements, regressions, count);
+        CompareAverages(internal, baseInternal, threshold, "internal: ", compared, improvements, regressions, count);
+
+        std::stringstream ss;
+        ss << std::endl << "Comparison with baseline '" << path << "' (threshold " << std::setprecision(1) << std::fixed << threshold * 100.0 << "%):" << std::endl;
+        ss << "compared " << compared << " of " << functions.size() + internal.size() << " functions, ";
+        ss << improvements << " improvements, " << count << " regressions." << std::endl;
+        ss << regressions.str();
+        report = ss.str();
+        return (int)count;
+    }
+
     void PerformanceMeasurerStorage::Clear()
     {
         _map.clear();
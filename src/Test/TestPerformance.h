@@ -55,6 +55,11 @@ namespace Test
         String Statistic() const;
 
         String Description() const { return _description; }
+        int Count() const { return _count; }
+        double Total() const { return _total; }
+        double Min() const { return _min; }
+        double Max() const { return _max; }
+        long long Size() const { return _size; }
 
         void Combine(const PerformanceMeasurer & other);
     };
@@ -107,6 +112,8 @@ namespace Test
 
         Thread & ThisThread();
 
+        FunctionMap Combined() const;
+
         typedef std::shared_ptr<class Table> TablePtr;
         TablePtr GenerateTable(bool align) const;
 
@@ -124,6 +131,10 @@ namespace Test
 
         bool HtmlReport(const String & path, bool align = false) const;
 
+        bool JsonReport(const String & path) const;
+
+        int CompareReport(const String & baseline, double threshold, String & report) const;
+
         void Clear();
     };
 }
@@ -24,6 +24,7 @@
 #include "Test/TestUtils.h"
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
+#include "Test/TestTensor.h"
 
 #include "Simd/SimdResizer.h"
 
@@ -147,6 +148,8 @@ namespace Test
         case SimdResizeMethodBilinear: return "B";
         case SimdResizeMethodCaffeInterp: return "C";
         case SimdResizeMethodArea: return "A";
+        case SimdResizeMethodBicubic: return "Bc";
+        case SimdResizeMethodLanczos3: return "L3";
         default: assert(0); return "";
         }
     }
@@ -157,6 +160,7 @@ namespace Test
         {
         case SimdResizeChannelByte:  return "b";
         case SimdResizeChannelFloat:  return "f";
+        case SimdResizeChannelShort:  return "s";
         default: assert(0); return "";
         }
     }
@@ -183,7 +187,7 @@ namespace Test
             void Call(const View & src, View & dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method) const
             {
                 void * resizer = NULL;
-                if(src.format == View::Float)
+                if(src.format == View::Float || src.format == View::Int16)
                     resizer = func(src.width / channels, src.height, dst.width / channels, dst.height, channels, type, method);
                 else
                     resizer = func(src.width, src.height, dst.width, dst.height, channels, type, method);
@@ -217,6 +221,12 @@ namespace Test
             srcW *= channels;
             dstW *= channels;
         }
+        else if (type == SimdResizeChannelShort)
+        {
+            format = View::Int16;
+            srcW *= channels;
+            dstW *= channels;
+        }
         else if (type == SimdResizeChannelByte)
         {
             switch (channels)
@@ -253,7 +263,9 @@ namespace Test
 
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, type, method));
 
-        if (format == View::Float)
+        if (format == View::Float && (method == SimdResizeMethodBicubic || method == SimdResizeMethodLanczos3))
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else if (format == View::Float)
             result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
         else
             result = result && Compare(dst1, dst2, 0, true, 64);
@@ -291,6 +303,18 @@ namespace Test
         return result;
     }
 
+    bool ResizerScaleAutoTest(SimdResizeMethodType method, SimdResizeChannelType type, int channels, const FuncRS & f1, const FuncRS & f2)
+    {
+        bool result = true;
+
+        result = result && ResizerAutoTest(method, type, channels, f1, f2);
+        if (method != SimdResizeMethodArea)
+            result = result && ResizerAutoTest(method, type, channels, W / 5, H / 5, W / 2 + O, H / 2 - O, f1, f2);
+        result = result && ResizerAutoTest(method, type, channels, W, H, W / 9 + 1, H / 7 - 1, f1, f2);
+
+        return result;
+    }
+
     bool ResizerAutoTest(const FuncRS & f1, const FuncRS & f2)
     {
         bool result = true;
@@ -310,6 +334,20 @@ namespace Test
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 3, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 4, f1, f2);
 #endif
+        for (int channels = 1; channels <= 4; ++channels)
+        {
+            result = result && ResizerScaleAutoTest(SimdResizeMethodBilinear, SimdResizeChannelShort, channels, f1, f2);
+            result = result && ResizerScaleAutoTest(SimdResizeMethodArea, SimdResizeChannelShort, channels, f1, f2);
+        }
+        for (SimdResizeMethodType method = SimdResizeMethodBicubic; method <= SimdResizeMethodLanczos3; method = SimdResizeMethodType(method + 1))
+        {
+            result = result && ResizerScaleAutoTest(method, SimdResizeChannelByte, 1, f1, f2);
+            result = result && ResizerScaleAutoTest(method, SimdResizeChannelByte, 2, f1, f2);
+            result = result && ResizerScaleAutoTest(method, SimdResizeChannelByte, 3, f1, f2);
+            result = result && ResizerScaleAutoTest(method, SimdResizeChannelByte, 4, f1, f2);
+            result = result && ResizerScaleAutoTest(method, SimdResizeChannelFloat, 1, f1, f2);
+            result = result && ResizerScaleAutoTest(method, SimdResizeChannelFloat, 3, f1, f2);
+        }
 
         return result;
     }
@@ -370,6 +408,280 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncRR
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, const ptrdiff_t * rois, size_t roiCount,
+                SimdResizeMethodType method, uint8_t * dst, size_t dstWidth, size_t dstHeight, SimdResizeChannelType dstType, SimdTensorFormatType dstFormat);
+
+            FuncPtr func;
+            String description;
+
+            FuncRR(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdResizeMethodType m, SimdResizeChannelType t, SimdTensorFormatType f, size_t c)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << ToString(m) << "-" << ToString(t) << "-" << ToString(f) << "-" << c << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, size_t channels, const std::vector<Rect> & rois, SimdResizeMethodType method, 
+                View & dst, size_t dstWidth, size_t dstHeight, SimdResizeChannelType type, SimdTensorFormatType format) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, channels, &rois[0].left, rois.size(), method, dst.data, dstWidth, dstHeight, type, format);
+            }
+        };
+    }
+
+#define FUNC_RR(function) \
+    FuncRR(function, std::string(#function))
+
+    void ResizeRoisBase(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, const ptrdiff_t * rois, size_t roiCount,
+        SimdResizeMethodType method, uint8_t * dst, size_t dstWidth, size_t dstHeight, SimdResizeChannelType dstType, SimdTensorFormatType dstFormat)
+    {
+        size_t area = dstWidth * dstHeight, size = area * channels;
+        std::vector<uint8_t> buf(size);
+        for (size_t i = 0; i < roiCount; ++i)
+        {
+            const ptrdiff_t * r = rois + 4 * i;
+            ptrdiff_t left = Simd::RestrictRange<ptrdiff_t>(r[0], 0, srcWidth), top = Simd::RestrictRange<ptrdiff_t>(r[1], 0, srcHeight);
+            ptrdiff_t right = Simd::RestrictRange<ptrdiff_t>(r[2], left, srcWidth), bottom = Simd::RestrictRange<ptrdiff_t>(r[3], top, srcHeight);
+            if (right > left && bottom > top)
+            {
+                size_t width = std::max<size_t>(right - left, 2), height = std::max<size_t>(bottom - top, 2);
+                std::vector<uint8_t> pad(width * height * channels);
+                for (size_t y = 0; y < height; ++y)
+                    for (size_t x = 0; x < width; ++x)
+                        for (size_t c = 0; c < channels; ++c)
+                            pad[(y * width + x) * channels + c] = src[(top + std::min<size_t>(y, bottom - top - 1)) * srcStride + (left + std::min<size_t>(x, right - left - 1)) * channels + c];
+                void * resizer = SimdResizerInit(width, height, dstWidth, dstHeight, channels, SimdResizeChannelByte, method);
+                SimdResizerRun(resizer, pad.data(), width * channels, buf.data(), dstWidth * channels);
+                SimdRelease(resizer);
+            }
+            else
+                memset(buf.data(), 0, size);
+            for (size_t c = 0; c < channels; ++c)
+            {
+                for (size_t j = 0; j < area; ++j)
+                {
+                    size_t offset = i * size + (dstFormat == SimdTensorFormatNchw ? c * area + j : j * channels + c);
+                    if (dstType == SimdResizeChannelFloat)
+                        ((float*)dst)[offset] = buf[j * channels + c];
+                    else
+                        dst[offset] = buf[j * channels + c];
+                }
+            }
+        }
+    }
+
+    bool ResizeRoisAutoTest(SimdResizeMethodType method, SimdResizeChannelType type, SimdTensorFormatType format, size_t channels, size_t dstW, size_t dstH, size_t count, size_t sizes, FuncRR f1, FuncRR f2)
+    {
+        bool result = true;
+
+        f1.Update(method, type, format, channels);
+        f2.Update(method, type, format, channels);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << W << ", " << H << "] -> " << count << " x [" << dstW << ", " << dstH << "]"
+            << (sizes ? " of " + ToString(sizes) + " mixed sizes." : "."));
+
+        View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+        View src(W, H, formats[channels - 1], NULL, TEST_ALIGN(W));
+        FillRandom(src);
+
+        std::vector<Rect> rois(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ptrdiff_t w = Random(int(src.width / 2)) + 1, h = Random(int(src.height / 2)) + 1;
+            ptrdiff_t x = Random(int(src.width + w)) - w / 2, y = Random(int(src.height + h)) - h / 2;
+            rois[i] = i % 4 == 3 ? rois[i - 1] : Rect(x, y, x + w, y + h);
+            if (i % 8 == 1)
+                rois[i] = Rect(x, y, x + 1, y + h);
+            if (i % 8 == 5)
+                rois[i] = Rect(x, y, x + w, y + 1);
+            if (i % 16 == 6)
+                rois[i] = Rect(src.width - 1, src.height - 1, src.width, src.height);
+        }
+        if (sizes)
+        {
+            std::vector<Size> shapes(sizes);
+            for (size_t s = 0; s < sizes; ++s)
+                shapes[s] = Size(Random(int(src.width / 2)) + 1, Random(int(src.height / 2)) + 1);
+            shapes[0].x = 1;
+            if (sizes > 1)
+                shapes[1] = Size(2, shapes[0].y);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Size & shape = shapes[(i * 7 + i / sizes) % sizes];
+                ptrdiff_t x = Random(int(src.width - shape.x + 1)), y = Random(int(src.height - shape.y + 1));
+                rois[i] = Rect(x, y, x + shape.x, y + shape.y);
+            }
+        }
+
+        size_t size = dstW * dstH * channels * (type == SimdResizeChannelFloat ? 4 : 1);
+        View dst1(size, count, View::Gray8, NULL, 1);
+        View dst2(size, count, View::Gray8, NULL, 1);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, rois, method, dst1, dstW, dstH, type, format));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, rois, method, dst2, dstW, dstH, type, format));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ResizeRoisAutoTest(const FuncRR & f1, const FuncRR & f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 1; channels <= 4; ++channels)
+        {
+            result = result && ResizeRoisAutoTest(SimdResizeMethodBilinear, SimdResizeChannelByte, SimdTensorFormatNhwc, channels, 64, 64, 100, 0, f1, f2);
+            result = result && ResizeRoisAutoTest(SimdResizeMethodBilinear, SimdResizeChannelFloat, SimdTensorFormatNchw, channels, 112, 112, 50, 0, f1, f2);
+        }
+        result = result && ResizeRoisAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, SimdTensorFormatNchw, 3, 64, 64, 50, 0, f1, f2);
+        result = result && ResizeRoisAutoTest(SimdResizeMethodBicubic, SimdResizeChannelFloat, SimdTensorFormatNhwc, 3, 64, 64, 50, 0, f1, f2);
+        result = result && ResizeRoisAutoTest(SimdResizeMethodBilinear, SimdResizeChannelByte, SimdTensorFormatNhwc, 3, 48, 48, 60, 5, f1, f2);
+        result = result && ResizeRoisAutoTest(SimdResizeMethodArea, SimdResizeChannelFloat, SimdTensorFormatNchw, 1, 48, 48, 60, 4, f1, f2);
+
+        return result;
+    }
+
+    bool ResizeRoisAutoTest()
+    {
+        bool result = true;
+
+        result = result && ResizeRoisAutoTest(FUNC_RR(ResizeRoisBase), FUNC_RR(SimdResizeRois));
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRP
+        {
+            typedef void(*FuncPtr)(const View & src, Views & dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+            FuncPtr func;
+            String description;
+
+            FuncRP(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdResizeMethodType m, SimdResizeChannelType t, size_t c)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << ToString(m) << "-" << ToString(t) << "-" << c << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, Views & dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src, dst, channels, type, method);
+            }
+        };
+    }
+
+#define FUNC_RP(function) \
+    FuncRP(function, std::string(#function))
+
+    void ResizerPyramidSeparate(const View & src, Views & dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+    {
+        size_t k = type == SimdResizeChannelFloat ? channels : 1;
+        for (size_t i = 0; i < dst.size(); ++i)
+        {
+            void * resizer = SimdResizerInit(src.width / k, src.height, dst[i].width / k, dst[i].height, channels, type, method);
+            SimdResizerRun(resizer, src.data, src.stride, dst[i].data, dst[i].stride);
+            SimdRelease(resizer);
+        }
+    }
+
+    void ResizerPyramidSingle(const View & src, Views & dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+    {
+        size_t k = type == SimdResizeChannelFloat ? channels : 1, count = dst.size();
+        std::vector<size_t> width(count), height(count), stride(count);
+        std::vector<uint8_t*> data(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            width[i] = dst[i].width / k;
+            height[i] = dst[i].height;
+            stride[i] = dst[i].stride;
+            data[i] = dst[i].data;
+        }
+        void * pyramid = SimdResizerPyramidInit(src.width / k, src.height, width.data(), height.data(), count, channels, type, method);
+        SimdResizerPyramidRun(pyramid, src.data, src.stride, data.data(), stride.data());
+        SimdRelease(pyramid);
+    }
+
+    bool ResizerPyramidAutoTest(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, double step, size_t count, FuncRP f1, FuncRP f2)
+    {
+        bool result = true;
+
+        f1.Update(method, type, channels);
+        f2.Update(method, type, channels);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << W << ", " << H << "] -> " << count << " levels with step " << step << ".");
+
+        View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+        View::Format format = type == SimdResizeChannelFloat ? View::Float : formats[channels - 1];
+        size_t k = type == SimdResizeChannelFloat ? channels : 1;
+
+        View src(W * k, H, format, NULL, TEST_ALIGN(W * k));
+        if (format == View::Float)
+            FillRandom32f(src);
+        else
+            FillRandom(src);
+
+        Views dst1(count), dst2(count);
+        double scale = 1.0;
+        for (size_t i = 0; i < count; ++i, scale *= step)
+        {
+            size_t w = Simd::Max<size_t>(size_t(W / scale), 1), h = Simd::Max<size_t>(size_t(H / scale), 1);
+            dst1[i].Recreate(w * k, h, format, NULL, TEST_ALIGN(w * k));
+            dst2[i].Recreate(w * k, h, format, NULL, TEST_ALIGN(w * k));
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, type, method));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, type, method));
+
+        for (size_t i = 0; i < count && result; ++i)
+            result = result && Compare(dst1[i], dst2[i], 0, true, 64);
+
+        return result;
+    }
+
+    bool ResizerPyramidAutoTest(const FuncRP & f1, const FuncRP & f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 1; channels <= 4; ++channels)
+            result = result && ResizerPyramidAutoTest(SimdResizeMethodBilinear, SimdResizeChannelByte, channels, 1.2, 10, f1, f2);
+        result = result && ResizerPyramidAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 1, 1.1, 16, f1, f2);
+        result = result && ResizerPyramidAutoTest(SimdResizeMethodBicubic, SimdResizeChannelByte, 3, 1.2, 10, f1, f2);
+        result = result && ResizerPyramidAutoTest(SimdResizeMethodBilinear, SimdResizeChannelFloat, 1, 1.2, 10, f1, f2);
+
+        return result;
+    }
+
+    bool ResizerPyramidAutoTest()
+    {
+        bool result = true;
+
+        result = result && ResizerPyramidAutoTest(FUNC_RP(ResizerPyramidSeparate), FUNC_RP(ResizerPyramidSingle));
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool ResizeDataTest(bool create, int width, int height, View::Format format, const FuncRB & f)
     {
         bool result = true;
@@ -249,6 +249,309 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncSIP
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType,
+                const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType dstFormat);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSIP(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t c, size_t h, size_t w, SimdYuvType yuv, SimdTensorFormatType dst)
+            {
+                desc = desc + "[" + ToString(c) + "x" + ToString(h) + "x" + ToString(w) + ":" + ToString(yuv) + "->" + ToString(dst) + "]";
+            }
+
+            void Call(const View& y, const View& uv, SimdYuvType yuvType, const float* lower, const float* upper, size_t channels, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, yuvType, lower, upper, dst.Data(), channels, dst.Format());
+            }
+        };
+    }
+
+#define FUNC_SIP(function) FuncSIP(function, #function)
+
+    bool SynetSetInputP010AutoTest(size_t c, size_t h, size_t w, SimdYuvType yuvType, SimdTensorFormatType dstFormat, FuncSIP f1, FuncSIP f2)
+    {
+        bool result = true;
+
+        assert(c == 1 || c == 3);
+
+        f1.Update(c, h, w, yuvType, dstFormat);
+        f2.Update(c, h, w, yuvType, dstFormat);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        View y(w, h, View::Int16);
+        FillRandom(y);
+        View uv(w / 2, h / 2, View::Int32);
+        FillRandom(uv);
+        Tensor32f dst1(ToShape(1, c, h, w, dstFormat), dstFormat);
+        Tensor32f dst2(ToShape(1, c, h, w, dstFormat), dstFormat);
+        TEST_ALIGN(SIMD_ALIGN);
+
+        float lower[3] = { -0.9f, -1.0f, -1.2f };
+        float upper[3] = { 0.91f, 1.01f, 1.21f };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, yuvType, lower, upper, c, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, yuvType, lower, upper, c, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetSetInputP010AutoTest(const FuncSIP& f1, const FuncSIP& f2)
+    {
+        bool result = true;
+
+        size_t channels[2] = { 1, 3 };
+        SimdTensorFormatType dstFormat[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+
+        for (int t = (int)SimdYuvBt601; t <= (int)SimdYuvBt2020Full; ++t)
+        {
+            for (int c = 0; c < 2; ++c)
+            {
+                for (int d = 0; d < 2; ++d)
+                {
+                    result = result && SynetSetInputP010AutoTest(channels[c], H / 6 * 2, (W / 5 + O) / 2 * 2, (SimdYuvType)t, dstFormat[d], f1, f2);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool SynetSetInputP010AutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSetInputP010AutoTest(FUNC_SIP(Simd::Base::SynetSetInputP010), FUNC_SIP(SimdSynetSetInputP010));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSetInputP010AutoTest(FUNC_SIP(Simd::Avx2::SynetSetInputP010), FUNC_SIP(SimdSynetSetInputP010));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetSetInputP010AutoTest(FUNC_SIP(Simd::Neon::SynetSetInputP010), FUNC_SIP(SimdSynetSetInputP010));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSIY
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t srcWidth, size_t srcHeight,
+                SimdYuvType yuvType, SimdResizeMethodType method, const float* lower, const float* upper, float* dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSIY(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t c, const View& src, size_t h, size_t w, SimdResizeMethodType method, SimdTensorFormatType dst)
+            {
+                desc = desc + "[" + ToString(src.width) + "x" + ToString(src.height) + "->" + ToString(c) + "x" + ToString(h) + "x" + ToString(w) + ":" + ToString(method) + "->" + ToString(dst) + "]";
+            }
+
+            void Call(const View& y, const View& u, const View& v, const View& uv, SimdResizeMethodType method, const float* lower, const float* upper, size_t channels, size_t w, size_t h, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, SimdYuvBt601, method, lower, upper,
+                    dst.Data(), w, h, channels, dst.Format());
+            }
+        };
+
+        struct FuncSIN
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+                SimdYuvType yuvType, SimdResizeMethodType method, const float* lower, const float* upper, float* dst, size_t dstWidth, size_t dstHeight, size_t channels, SimdTensorFormatType dstFormat);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSIN(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t c, const View& src, size_t h, size_t w, SimdResizeMethodType method, SimdTensorFormatType dst)
+            {
+                desc = desc + "[" + ToString(src.width) + "x" + ToString(src.height) + "->" + ToString(c) + "x" + ToString(h) + "x" + ToString(w) + ":" + ToString(method) + "->" + ToString(dst) + "]";
+            }
+
+            void Call(const View& y, const View& u, const View& v, const View& uv, SimdResizeMethodType method, const float* lower, const float* upper, size_t channels, size_t w, size_t h, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, SimdYuvBt601, method, lower, upper,
+                    dst.Data(), w, h, channels, dst.Format());
+            }
+        };
+    }
+
+#define FUNC_SIY(function) FuncSIY(function, #function)
+#define FUNC_SIN(function) FuncSIN(function, #function)
+
+    template<class Func> bool SynetSetInputYuvAutoTest(size_t c, size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdResizeMethodType method, SimdTensorFormatType dstFormat, Func f1, Func f2)
+    {
+        bool result = true;
+
+        assert(c == 1 || c == 3);
+
+        View y(srcW, srcH, View::Gray8), u(srcW / 2, srcH / 2, View::Gray8), v(srcW / 2, srcH / 2, View::Gray8), uv(srcW / 2, srcH / 2, View::Uv16);
+        FillRandom(y);
+        FillRandom(u);
+        FillRandom(v);
+        Simd::InterleaveUv(u, v, uv);
+
+        f1.Update(c, y, dstH, dstW, method, dstFormat);
+        f2.Update(c, y, dstH, dstW, method, dstFormat);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        Tensor32f dst1(ToShape(1, c, dstH, dstW, dstFormat), dstFormat);
+        Tensor32f dst2(ToShape(1, c, dstH, dstW, dstFormat), dstFormat);
+        TEST_ALIGN(SIMD_ALIGN);
+
+        float lower[3] = { -0.9f, -1.0f, -1.2f };
+        float upper[3] = { 0.91f, 1.01f, 1.21f };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, uv, method, lower, upper, c, dstW, dstH, dst1));
+
+        f2.Call(y, u, v, uv, method, upper, lower, c, dstW, dstH, dst2);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, uv, method, lower, upper, c, dstW, dstH, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    template<class Func> bool SynetSetInputYuvUnsupportedTest(SimdResizeMethodType method, Func f)
+    {
+        bool result = true;
+
+        size_t c = 3, srcW = W / 6 * 2, srcH = H / 10 * 2, dstW = W / 4, dstH = H / 4;
+        SimdTensorFormatType format = SimdTensorFormatNchw;
+
+        View y(srcW, srcH, View::Gray8), u(srcW / 2, srcH / 2, View::Gray8), v(srcW / 2, srcH / 2, View::Gray8), uv(srcW / 2, srcH / 2, View::Uv16);
+        FillRandom(y);
+        FillRandom(u);
+        FillRandom(v);
+        Simd::InterleaveUv(u, v, uv);
+
+        f.Update(c, y, dstH, dstW, method, format);
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " is ignored.");
+
+        Tensor32f dst1(ToShape(1, c, dstH, dstW, format), format, 7.0f);
+        Tensor32f dst2(ToShape(1, c, dstH, dstW, format), format, 7.0f);
+
+        float lower[3] = { -0.9f, -1.0f, -1.2f };
+        float upper[3] = { 0.91f, 1.01f, 1.21f };
+
+        f.Call(y, u, v, uv, method, lower, upper, c, dstW, dstH, dst2);
+
+        result = result && Compare(dst1, dst2, 0, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    template<class Func> bool SynetSetInputYuvAutoTest(const Func& f1, const Func& f2)
+    {
+        bool result = true;
+
+        size_t channels[2] = { 1, 3 };
+        SimdTensorFormatType dstFormat[4] = { SimdTensorFormatNchw, SimdTensorFormatNhwc, SimdTensorFormatNchw8c, SimdTensorFormatNchw16c };
+        SimdResizeMethodType method[3] = { SimdResizeMethodBilinear, SimdResizeMethodCaffeInterp, SimdResizeMethodInferenceEngineInterp };
+
+        for (int c = 0; c < 2; ++c)
+        {
+            for (int d = 0; d < 4; ++d)
+            {
+                for (int m = 0; m < 3; ++m)
+                {
+                    result = result && SynetSetInputYuvAutoTest(channels[c], W / 2 * 2, H / 2 * 2, 300, 300, method[m], dstFormat[d], f1, f2);
+                    result = result && SynetSetInputYuvAutoTest(channels[c], W / 6 * 2, H / 10 * 2, W / 2 + O, H / 3 + O, method[m], dstFormat[d], f1, f2);
+                }
+            }
+        }
+
+        result = result && SynetSetInputYuvUnsupportedTest(SimdResizeMethodArea, f2);
+        result = result && SynetSetInputYuvUnsupportedTest(SimdResizeMethodBicubic, f2);
+
+        return result;
+    }
+
+    bool SynetSetInputYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSetInputYuvAutoTest(FUNC_SIY(Simd::Base::SynetSetInputYuv420p), FUNC_SIY(SimdSynetSetInputYuv420p));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetSetInputYuvAutoTest(FUNC_SIY(Simd::Sse41::SynetSetInputYuv420p), FUNC_SIY(SimdSynetSetInputYuv420p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSetInputYuvAutoTest(FUNC_SIY(Simd::Avx2::SynetSetInputYuv420p), FUNC_SIY(SimdSynetSetInputYuv420p));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetSetInputYuvAutoTest(FUNC_SIY(Simd::Avx512bw::SynetSetInputYuv420p), FUNC_SIY(SimdSynetSetInputYuv420p));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetSetInputYuvAutoTest(FUNC_SIY(Simd::Neon::SynetSetInputYuv420p), FUNC_SIY(SimdSynetSetInputYuv420p));
+#endif 
+
+        return result;
+    }
+
+    bool SynetSetInputNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSetInputYuvAutoTest(FUNC_SIN(Simd::Base::SynetSetInputNv12), FUNC_SIN(SimdSynetSetInputNv12));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetSetInputYuvAutoTest(FUNC_SIN(Simd::Sse41::SynetSetInputNv12), FUNC_SIN(SimdSynetSetInputNv12));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSetInputYuvAutoTest(FUNC_SIN(Simd::Avx2::SynetSetInputNv12), FUNC_SIN(SimdSynetSetInputNv12));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetSetInputYuvAutoTest(FUNC_SIN(Simd::Avx512bw::SynetSetInputNv12), FUNC_SIN(SimdSynetSetInputNv12));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetSetInputYuvAutoTest(FUNC_SIN(Simd::Neon::SynetSetInputNv12), FUNC_SIN(SimdSynetSetInputNv12));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace
     {
         struct FuncRT
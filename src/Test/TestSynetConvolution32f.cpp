@@ -60,14 +60,14 @@ namespace Test
 #define FUNC_C(function) \
     FuncC(function, std::string(#function))
 
-    bool SynetConvolution32fForwardAutoTest(float eps, const Param & p, FuncC f1, FuncC f2)
+    bool SynetConvolution32fForwardAutoTest(float eps, const Param & p, FuncC f1, FuncC f2, size_t threads = 0)
     {
         bool result = true;
 
         f1.Update(p);
         f2.Update(p);
 
-        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "]" << (threads ? ": 1 thread & " + ToString(threads) + " threads." : "."));
 
         const SimdConvolutionParameters & c = p.conv;
         Tensor32f src({p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
@@ -102,8 +102,14 @@ namespace Test
         ::SimdFill32f(dst1.Data(), dst1.Size(), params.Data() + 0);
         ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data() + 1);
 
+        void * single = threads ? ::SimdContextCreate(1, ::SimdAffinityNone) : NULL;
+        void * multi = threads ? ::SimdContextCreate(threads, ::SimdAffinityNone) : NULL;
+
+        ::SimdContextBind(single);
         void * context1 = f1.func(p.batch, &p.conv, NULL);
+        ::SimdContextBind(multi);
         void * context2 = f2.func(p.batch, &p.conv, NULL);
+        ::SimdContextBind(NULL);
 
         buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
         buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context2) });
@@ -113,12 +119,20 @@ namespace Test
 
         TEST_ALIGN(SIMD_ALIGN);
 
+        ::SimdContextBind(single);
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, buf, dst1));
 
+        ::SimdContextBind(multi);
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf, dst2));
+        ::SimdContextBind(NULL);
 
         ::SimdRelease(context1);
         ::SimdRelease(context2);
+        if (threads)
+        {
+            ::SimdRelease(single);
+            ::SimdRelease(multi);
+        }
 
         result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
 
@@ -517,6 +531,23 @@ namespace Test
         return result;
     }
 
+    bool SynetConvolution32fThreadAutoTest(float eps, ::SimdBool t, size_t threads)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        ::SimdConvolutionActivationType a = ::SimdConvolutionActivationRestrictRange;
+        FuncC f1 = FuncC(SimdSynetConvolution32fInit, "SimdSynetConvolution32fInit<st>");
+        FuncC f2 = FuncC(SimdSynetConvolution32fInit, "SimdSynetConvolution32fInit<mt>");
+
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 64, 56, 56, 64, _3, _1, _1, _1, _1, 1, a, t), f1, f2, threads);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 128, 56, 56, 128, _3, _1, _1, _1, _1, 128, a, t), f1, f2, threads);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 128, 28, 28, 256, _1, _1, _1, _0, _0, 1, a, t), f1, f2, threads);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 32, 111, 97, 64, _3, _1, _2, _1, _1, 1, a, t), f1, f2, threads);
+
+        return result;
+    }
+
     bool SynetConvolution32fForwardAutoTest()
     {
         const float EPS = 0.00001f;
@@ -554,6 +585,206 @@ namespace Test
             result = result && SynetConvolution32fForwardAutoTest(2 * EPS, FUNC_C(Simd::Neon::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
 #endif
 
+        result = result && SynetConvolution32fThreadAutoTest(EPS, ::SimdFalse, 4);
+        result = result && SynetConvolution32fThreadAutoTest(EPS, ::SimdTrue, 4);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    typedef std::vector<String> Strings;
+
+    Strings ReadLines(const String & path)
+    {
+        Strings lines;
+        std::ifstream ifs(path.c_str());
+        String line;
+        while (std::getline(ifs, line))
+            if (line.size())
+                lines.push_back(line);
+        return lines;
+    }
+
+    String Description(void * context)
+    {
+        return ((Simd::SynetConvolution32f*)context)->Desc();
+    }
+
+    bool SynetConvolution32fAutotuneAutoTest(const Param & p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSynetConvolution32fSetAutotune " << p.Decription() << ".");
+
+        const String path = "_autotune.txt";
+        std::remove(path.c_str());
+
+        ::SimdSynetConvolution32fSetAutotune(path.c_str());
+        void * context1 = ::SimdSynetConvolution32fInit(p.batch, &p.conv, NULL);
+        Strings lines = ReadLines(path);
+        String key, name;
+        if (lines.size() == 1)
+        {
+            std::stringstream ss(lines[0]);
+            ss >> key >> name;
+            if (Description(context1).find("::" + name) == String::npos)
+            {
+                TEST_LOG_SS(Error, "Autotune chose " << name << " but created " << Description(context1) << " !");
+                result = false;
+            }
+        }
+        else
+        {
+            TEST_LOG_SS(Error, "Autotune cache file " << path << " has " << lines.size() << " records instead of 1 !");
+            result = false;
+        }
+
+        if (result)
+        {
+            std::ofstream ofs(path.c_str());
+            ofs << key << " GemmNN" << std::endl;
+        }
+        ::SimdSynetConvolution32fSetAutotune(path.c_str());
+        void * context2 = ::SimdSynetConvolution32fInit(p.batch, &p.conv, NULL);
+        lines = ReadLines(path);
+        if (result && lines.size() != 1)
+        {
+            TEST_LOG_SS(Error, "Autotune cache file " << path << " has " << lines.size() << " records: cached choice is not reused !");
+            result = false;
+        }
+        if (result && Description(context2).find("::GemmNN") == String::npos)
+        {
+            TEST_LOG_SS(Error, "Autotune created " << Description(context2) << " instead of cached GemmNN !");
+            result = false;
+        }
+
+        ::SimdSynetConvolution32fSetAutotune(NULL);
+        std::remove(path.c_str());
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fAutotuneAutoTest()
+    {
+        bool result = true;
+
+        Size _1(1, 1), _3(3, 3);
+        ::SimdConvolutionActivationType a = ::SimdConvolutionActivationRelu;
+
+        result = result && SynetConvolution32fAutotuneAutoTest(Param(1, 32, 28, 28, 64, _3, _1, _1, _1, _1, 1, a, ::SimdTrue));
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool SynetConvolution32fExportAutoTest(const Param & p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSynetConvolution32fExport & SimdSynetConvolution32fImport " << p.Decription() << ".");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f dst1({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f dst2(dst1.Shape()), dst3(dst1.Shape());
+
+        void * context1 = ::SimdSynetConvolution32fInit(p.batch, &p.conv, NULL);
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fForward(context1, src.Data(), NULL, dst1.Data());
+
+        size_t size = ::SimdSynetConvolution32fExport(context1, NULL, 0);
+        if (size == 0)
+        {
+            TEST_LOG_SS(Info, "Algorithm " << ((Simd::SynetConvolution32f*)context1)->Desc() << " does not keep weights internally.");
+            ::SimdRelease(context1);
+            return result;
+        }
+        uint8_t * blob = (uint8_t*)::SimdAllocate(size, ::SimdAlignment());
+        if (::SimdSynetConvolution32fExport(context1, blob, size) != size)
+        {
+            TEST_LOG_SS(Error, "Can't export weights of " << ((Simd::SynetConvolution32f*)context1)->Desc() << " !");
+            result = false;
+        }
+
+        void * context2 = ::SimdSynetConvolution32fInit(p.batch, &p.conv, NULL);
+        if (result && ::SimdSynetConvolution32fImport(context2, blob, size, bias.Data(), params.Data(), ::SimdTrue) != ::SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't import weights (with copy) !");
+            result = false;
+        }
+        void * context3 = ::SimdSynetConvolution32fInit(p.batch, &p.conv, NULL);
+        if (result && ::SimdSynetConvolution32fImport(context3, blob, size, bias.Data(), params.Data(), ::SimdFalse) != ::SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't import weights (without copy) !");
+            result = false;
+        }
+
+        if (result)
+        {
+            ::SimdSynetConvolution32fForward(context2, src.Data(), NULL, dst2.Data());
+            ::SimdSynetConvolution32fForward(context3, src.Data(), NULL, dst3.Data());
+            result = result && Compare(dst1, dst2, 0.0f, true, 64, DifferenceAbsolute, "import with copy");
+            result = result && Compare(dst1, dst3, 0.0f, true, 64, DifferenceAbsolute, "import without copy");
+        }
+
+        if (result)
+        {
+            uint64_t * header = (uint64_t*)blob;
+            header[3] += 1;
+            if (::SimdSynetConvolution32fImport(context2, blob, size, bias.Data(), params.Data(), ::SimdTrue) != ::SimdFalse)
+            {
+                TEST_LOG_SS(Error, "Import accepts a blob with wrong size of internal buffer !");
+                result = false;
+            }
+            header[3] -= 1;
+        }
+
+        Param o = p;
+        o.conv.dstC *= 2;
+        void * context4 = ::SimdSynetConvolution32fInit(o.batch, &o.conv, NULL);
+        if (result && ::SimdSynetConvolution32fImport(context4, blob, size, NULL, NULL, ::SimdTrue) != ::SimdFalse)
+        {
+            TEST_LOG_SS(Error, "Import accepts a blob of context with other parameters !");
+            result = false;
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+        ::SimdRelease(context4);
+        ::SimdFree(blob);
+
+        return result;
+    }
+
+    bool SynetConvolution32fExportAutoTest()
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        ::SimdConvolutionActivationType a = ::SimdConvolutionActivationPrelu;
+
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 32, 28, 28, 64, _3, _1, _1, _1, _1, 1, a, ::SimdTrue));
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 64, 14, 14, 48, _1, _1, _1, _0, _0, 1, a, ::SimdTrue));
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 32, 27, 27, 64, _3, _1, _2, _1, _1, 1, a, ::SimdTrue));
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 32, 28, 28, 64, _3, _1, _1, _1, _1, 1, a, ::SimdFalse));
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 48, 20, 20, 48, _3, _1, _1, _1, _1, 48, a, ::SimdTrue));
+
         return result;
     }
 }
@@ -167,14 +167,14 @@ namespace Test
         }
     }
 
-    bool SynetConvolution8iForwardAutoTest(float eps, Param p, int neg, SimdSynetCompatibilityType comp, FuncC f1, FuncC f2)
+    bool SynetConvolution8iForwardAutoTest(float eps, Param p, int neg, SimdSynetCompatibilityType comp, FuncC f1, FuncC f2, size_t threads = 0)
     {
         bool result = true;
 
         f1.Update(p, comp);
         f2.Update(p, comp);
 
-        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "]" << (threads ? ": 1 thread & " + ToString(threads) + " threads." : "."));
 
         const SimdConvolutionParameters & c = p.conv;
 
@@ -217,8 +217,14 @@ namespace Test
         Fill(dst8u1, uint8_t(1));
         Fill(dst8u2, uint8_t(2));
 
+        void * single = threads ? ::SimdContextCreate(1, ::SimdAffinityNone) : NULL;
+        void * multi = threads ? ::SimdContextCreate(threads, ::SimdAffinityNone) : NULL;
+
+        ::SimdContextBind(single);
         void * context1 = f1.func(p.batch, &p.conv, comp);
+        ::SimdContextBind(multi);
         void * context2 = f2.func(p.batch, &p.conv, comp);
+        ::SimdContextBind(NULL);
 
         buf8u.Extend({ ::SimdSynetConvolution8iExternalBufferSize(context1) });
         buf8u.Extend({ ::SimdSynetConvolution8iExternalBufferSize(context2) });
@@ -228,12 +234,20 @@ namespace Test
 
         TEST_ALIGN(SIMD_ALIGN);
 
+        ::SimdContextBind(single);
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, buf8u.Data(), dst1));
 
+        ::SimdContextBind(multi);
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf8u.Data(), dst2));
+        ::SimdContextBind(NULL);
 
         ::SimdRelease(context1);
         ::SimdRelease(context2);
+        if (threads)
+        {
+            ::SimdRelease(single);
+            ::SimdRelease(multi);
+        }
 
         if(p.conv.dstT == SimdTensorData32f)
             result = result && Compare(dst32f1, dst32f2, eps*eps, true, 64, DifferenceBoth);
@@ -296,6 +310,25 @@ namespace Test
         return result;
     }
 
+    bool SynetConvolution8iThreadAutoTest(SimdSynetCompatibilityType c, size_t threads)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+        FuncC f1 = FuncC(SimdSynetConvolution8iInit, "SimdSynetConvolution8iInit<st>");
+        FuncC f2 = FuncC(SimdSynetConvolution8iInit, "SimdSynetConvolution8iInit<mt>");
+
+        result = result && SynetConvolution8iForwardAutoTest(EPS, Param(1, 64, 56, 56, 64, _3, _1, _1, _1, _1, 1, aRe, t1, f32, u8), 0, c, f1, f2, threads);
+        result = result && SynetConvolution8iForwardAutoTest(EPS, Param(1, 128, 28, 28, 256, _1, _1, _1, _0, _0, 1, aRe, t1, u8, f32), 1, c, f1, f2, threads);
+        result = result && SynetConvolution8iForwardAutoTest(EPS, Param(1, 32, 111, 97, 64, _3, _1, _2, _1, _1, 1, aRe, t1, f32, f32), 0, c, f1, f2, threads);
+        result = result && SynetConvolution8iForwardAutoTest(EPS, Param(1, 64, 56, 56, 64, _3, _1, _1, _1, _1, 1, aRe, t0, f32, u8), 0, c, f1, f2, threads);
+
+        return result;
+    }
+
     bool SynetConvolution8iForwardAutoTest()
     {
         bool result = true;
@@ -327,6 +360,124 @@ namespace Test
             result = result && SynetConvolution8iForwardAutoTest(FUNC_C(Simd::Neon::SynetConvolution8iInit), FUNC_C(SimdSynetConvolution8iInit));
 #endif 
 
+        result = result && SynetConvolution8iThreadAutoTest((SimdSynetCompatibilityType)(SimdSynetCompatibility8iPrecise | SimdSynetCompatibilityFmaAvoid), 4);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool SynetConvolution8iExportAutoTest(const Param & p, SimdSynetCompatibilityType comp)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSynetConvolution8iExport & SimdSynetConvolution8iImport " << p.Decription() << ".");
+
+        const SimdConvolutionParameters & c = p.conv;
+
+        Tensor32f weight(p.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        Tensor32f src32f(p.SrcShape()), dst32f1(p.DstShape()), dst32f2(p.DstShape()), dst32f3(p.DstShape()), buf32f;
+        Tensor8u src8u(p.SrcShape()), dst8u1(p.DstShape()), dst8u2(p.DstShape()), dst8u3(p.DstShape());
+
+        FillSrc32f(p, 0, src32f, srcMin.Data(), srcMax.Data());
+        FillSrc8u(p, 0, src32f, srcMin.Data(), srcMax.Data(), src8u);
+        FillDstStat(p, weight, bias, params, src32f, buf32f, dst32f1, dstMin.Data(), dstMax.Data());
+
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        const uint8_t * src = c.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        uint8_t * dst1 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t * dst2 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : dst8u2.Data();
+        uint8_t * dst3 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f3.Data() : dst8u3.Data();
+
+        void * context1 = ::SimdSynetConvolution8iInit(p.batch, &p.conv, comp);
+        ::SimdSynetConvolution8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetConvolution8iForward(context1, src, NULL, dst1);
+
+        size_t size = ::SimdSynetConvolution8iExport(context1, NULL, 0);
+        if (size == 0)
+        {
+            TEST_LOG_SS(Info, "Algorithm " << ((Simd::SynetConvolution8i*)context1)->Desc() << " does not keep weights internally.");
+            ::SimdRelease(context1);
+            return result;
+        }
+        uint8_t * blob = (uint8_t*)::SimdAllocate(size, ::SimdAlignment());
+        if (::SimdSynetConvolution8iExport(context1, blob, size) != size)
+        {
+            TEST_LOG_SS(Error, "Can't export weights of " << ((Simd::SynetConvolution8i*)context1)->Desc() << " !");
+            result = false;
+        }
+
+        void * context2 = ::SimdSynetConvolution8iInit(p.batch, &p.conv, comp);
+        if (result && ::SimdSynetConvolution8iImport(context2, blob, size, ::SimdTrue) != ::SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't import weights (with copy) !");
+            result = false;
+        }
+        void * context3 = ::SimdSynetConvolution8iInit(p.batch, &p.conv, comp);
+        if (result && ::SimdSynetConvolution8iImport(context3, blob, size, ::SimdFalse) != ::SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't import weights (without copy) !");
+            result = false;
+        }
+
+        if (result)
+        {
+            ::SimdSynetConvolution8iForward(context2, src, NULL, dst2);
+            ::SimdSynetConvolution8iForward(context3, src, NULL, dst3);
+            if (c.dstT == SimdTensorData32f)
+            {
+                result = result && Compare(dst32f1, dst32f2, 0.0f, true, 64, DifferenceAbsolute, "import with copy");
+                result = result && Compare(dst32f1, dst32f3, 0.0f, true, 64, DifferenceAbsolute, "import without copy");
+            }
+            else
+            {
+                result = result && Compare(dst8u1, dst8u2, 0, true, 64, "import with copy");
+                result = result && Compare(dst8u1, dst8u3, 0, true, 64, "import without copy");
+            }
+        }
+
+        Param o = p;
+        o.conv.dstC *= 2;
+        void * context4 = ::SimdSynetConvolution8iInit(o.batch, &o.conv, comp);
+        if (result && ::SimdSynetConvolution8iImport(context4, blob, size, ::SimdTrue) != ::SimdFalse)
+        {
+            TEST_LOG_SS(Error, "Import accepts a blob of context with other parameters !");
+            result = false;
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+        ::SimdRelease(context4);
+        ::SimdFree(blob);
+
+        return result;
+    }
+
+    bool SynetConvolution8iExportAutoTest()
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+        SimdSynetCompatibilityType c = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iPrecise | SimdSynetCompatibilityFmaAvoid);
+
+        result = result && SynetConvolution8iExportAutoTest(Param(1, 32, 28, 28, 64, _3, _1, _1, _1, _1, 1, aRe, t1, f32, u8), c);
+        result = result && SynetConvolution8iExportAutoTest(Param(1, 64, 14, 14, 48, _1, _1, _1, _0, _0, 1, aRe, t1, u8, f32), c);
+        result = result && SynetConvolution8iExportAutoTest(Param(1, 32, 27, 27, 64, _3, _1, _2, _1, _1, 1, aRe, t1, u8, u8), c);
+        result = result && SynetConvolution8iExportAutoTest(Param(1, 32, 28, 28, 64, _3, _1, _1, _1, _1, 1, aRe, t0, f32, f32), c);
+
         return result;
     }
 }
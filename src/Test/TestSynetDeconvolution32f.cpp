@@ -181,4 +181,98 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    bool SynetDeconvolution32fExportAutoTest(const Param & p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSynetDeconvolution32fExport & SimdSynetDeconvolution32fImport " << p.Decription() << ".");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        Tensor32f weight({ c.srcC, p.trans ? c.kernelY : c.dstC / c.group, p.trans ? c.kernelX : c.kernelY, p.trans ? c.dstC / c.group : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f dst1({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f dst2(dst1.Shape()), dst3(dst1.Shape());
+
+        void * context1 = ::SimdSynetDeconvolution32fInit(p.batch, &p.conv, NULL);
+        ::SimdSynetDeconvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetDeconvolution32fForward(context1, src.Data(), NULL, dst1.Data());
+
+        size_t size = ::SimdSynetDeconvolution32fExport(context1, NULL, 0);
+        if (size == 0)
+        {
+            TEST_LOG_SS(Info, "Algorithm " << ((Simd::SynetDeconvolution32f*)context1)->Desc() << " does not keep weights internally.");
+            ::SimdRelease(context1);
+            return result;
+        }
+        uint8_t * blob = (uint8_t*)::SimdAllocate(size, ::SimdAlignment());
+        if (::SimdSynetDeconvolution32fExport(context1, blob, size) != size)
+        {
+            TEST_LOG_SS(Error, "Can't export weights of " << ((Simd::SynetDeconvolution32f*)context1)->Desc() << " !");
+            result = false;
+        }
+
+        void * context2 = ::SimdSynetDeconvolution32fInit(p.batch, &p.conv, NULL);
+        if (result && ::SimdSynetDeconvolution32fImport(context2, blob, size, bias.Data(), params.Data(), ::SimdTrue) != ::SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't import weights (with copy) !");
+            result = false;
+        }
+        void * context3 = ::SimdSynetDeconvolution32fInit(p.batch, &p.conv, NULL);
+        if (result && ::SimdSynetDeconvolution32fImport(context3, blob, size, bias.Data(), params.Data(), ::SimdFalse) != ::SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't import weights (without copy) !");
+            result = false;
+        }
+
+        if (result)
+        {
+            ::SimdSynetDeconvolution32fForward(context2, src.Data(), NULL, dst2.Data());
+            ::SimdSynetDeconvolution32fForward(context3, src.Data(), NULL, dst3.Data());
+            result = result && Compare(dst1, dst2, 0.0f, true, 64, DifferenceAbsolute, "import with copy");
+            result = result && Compare(dst1, dst3, 0.0f, true, 64, DifferenceAbsolute, "import without copy");
+        }
+
+        Param o = p;
+        o.conv.dstC *= 2;
+        void * context4 = ::SimdSynetDeconvolution32fInit(o.batch, &o.conv, NULL);
+        if (result && ::SimdSynetDeconvolution32fImport(context4, blob, size, NULL, NULL, ::SimdTrue) != ::SimdFalse)
+        {
+            TEST_LOG_SS(Error, "Import accepts a blob of context with other parameters !");
+            result = false;
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+        ::SimdRelease(context4);
+        ::SimdFree(blob);
+
+        return result;
+    }
+
+    bool SynetDeconvolution32fExportAutoTest()
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        ::SimdConvolutionActivationType a = ::SimdConvolutionActivationPrelu;
+
+        result = result && SynetDeconvolution32fExportAutoTest(Param(1, 24, 22, 40, 24, _2, _1, _2, _0, _0, 1, a, ::SimdTrue));
+        result = result && SynetDeconvolution32fExportAutoTest(Param(1, 24, 22, 40, 24, _2, _1, _2, _0, _0, 1, a, ::SimdFalse));
+        result = result && SynetDeconvolution32fExportAutoTest(Param(1, 32, 14, 14, 16, _3, _1, _2, _1, _1, 1, a, ::SimdTrue));
+
+        return result;
+    }
 }
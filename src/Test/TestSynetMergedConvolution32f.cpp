@@ -283,4 +283,113 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    bool SynetMergedConvolution32fExportAutoTest(const Param & p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdSynetMergedConvolution32fExport & SimdSynetMergedConvolution32fImport [" << p.batch << "x" << p.conv[0].srcC << "x" << p.conv[0].srcH
+            << "x" << p.conv[0].srcW << "-" << p.conv[0].dstC << "x" << p.conv[0].kernelY << "x" << p.conv[0].strideY << "-" << p.conv[1].kernelY << "x" << p.conv[1].strideY
+            << "-" << p.conv[2].dstC << "].");
+
+        Tensor32f src({ p.batch, p.conv[0].srcH, p.conv[0].srcW, p.conv[0].srcC });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight[3], bias[3], params[3];
+        for (size_t i = 0; i < 3; ++i)
+        {
+            weight[i].Reshape({ p.conv[i].kernelY, p.conv[i].kernelX, p.conv[i].srcC / p.conv[i].group, p.conv[i].dstC });
+            FillRandom(weight[i].Data(), weight[i].Size(), -1.0, 1.0f);
+            p.weight[i] = weight[i].Data();
+
+            bias[i].Reshape({ p.conv[i].dstC });
+            FillRandom(bias[i].Data(), bias[i].Size(), -1.0, 1.0f);
+            p.bias[i] = bias[i].Data();
+
+            params[i].Reshape({ Simd::Max<size_t>(2, p.conv[i].dstC) });
+            FillRandom(params[i].Data(), params[i].Size(), -1.0, 1.0f);
+            params[i].Data()[0] = 0.0f + 0.1f * float(i);
+            params[i].Data()[1] = 1.0f + 0.1f * float(i);
+            p.params[i] = params[i].Data();
+        }
+
+        Tensor32f dst1({ p.batch, p.conv[2].dstH, p.conv[2].dstW, p.conv[2].dstC }, SimdTensorFormatNhwc, 0.01f);
+        Tensor32f dst2(dst1.Shape(), SimdTensorFormatNhwc, 0.01f), dst3(dst1.Shape(), SimdTensorFormatNhwc, 0.01f);
+
+        void * context1 = ::SimdSynetMergedConvolution32fInit(p.batch, p.conv, 3, p.add);
+        ::SimdSynetMergedConvolution32fSetParams(context1, p.weight, NULL, p.bias, p.params);
+        ::SimdSynetMergedConvolution32fForward(context1, src.Data(), NULL, dst1.Data());
+
+        size_t size = ::SimdSynetMergedConvolution32fExport(context1, NULL, 0);
+        if (size == 0)
+        {
+            TEST_LOG_SS(Info, "Algorithm " << ((Simd::SynetMergedConvolution32f*)context1)->Desc() << " does not keep weights internally.");
+            ::SimdRelease(context1);
+            return result;
+        }
+        uint8_t * blob = (uint8_t*)::SimdAllocate(size, ::SimdAlignment());
+        if (::SimdSynetMergedConvolution32fExport(context1, blob, size) != size)
+        {
+            TEST_LOG_SS(Error, "Can't export weights of " << ((Simd::SynetMergedConvolution32f*)context1)->Desc() << " !");
+            result = false;
+        }
+
+        void * context2 = ::SimdSynetMergedConvolution32fInit(p.batch, p.conv, 3, p.add);
+        if (result && ::SimdSynetMergedConvolution32fImport(context2, blob, size, p.bias, p.params, ::SimdTrue) != ::SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't import weights (with copy) !");
+            result = false;
+        }
+        void * context3 = ::SimdSynetMergedConvolution32fInit(p.batch, p.conv, 3, p.add);
+        if (result && ::SimdSynetMergedConvolution32fImport(context3, blob, size, p.bias, p.params, ::SimdFalse) != ::SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't import weights (without copy) !");
+            result = false;
+        }
+
+        if (result)
+        {
+            ::SimdSynetMergedConvolution32fForward(context2, src.Data(), NULL, dst2.Data());
+            ::SimdSynetMergedConvolution32fForward(context3, src.Data(), NULL, dst3.Data());
+            result = result && Compare(dst1, dst2, 0.0f, true, 64, DifferenceAbsolute, "import with copy");
+            result = result && Compare(dst1, dst3, 0.0f, true, 64, DifferenceAbsolute, "import without copy");
+        }
+
+        Param o = p;
+        o.conv[0].dstC *= 2;
+        o.conv[1].srcC *= 2;
+        o.conv[1].dstC *= 2;
+        o.conv[1].group *= 2;
+        o.conv[2].srcC *= 2;
+        void * context4 = ::SimdSynetMergedConvolution32fInit(o.batch, o.conv, 3, o.add);
+        if (result && context4 && ::SimdSynetMergedConvolution32fImport(context4, blob, size, p.bias, p.params, ::SimdTrue) != ::SimdFalse)
+        {
+            TEST_LOG_SS(Error, "Import accepts a blob of context with other parameters !");
+            result = false;
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+        ::SimdRelease(context4);
+        ::SimdFree(blob);
+
+        return result;
+    }
+
+    bool SynetMergedConvolution32fExportAutoTest()
+    {
+        bool result = true;
+
+        const SimdBool t = SimdTrue, f = SimdFalse;
+        const ::SimdConvolutionActivationType a0 = ::SimdConvolutionActivationPrelu, a1 = ::SimdConvolutionActivationRelu, a2 = ::SimdConvolutionActivationIdentity;
+
+        result = result && SynetMergedConvolution32fExportAutoTest(Param(1, 3, 64, 64, 3, 2, a0, 16, 3, 1, a1, 8, a2, f));
+        result = result && SynetMergedConvolution32fExportAutoTest(Param(1, 8, 40, 40, 1, 1, a0, 48, 3, 2, a1, 8, a2, f));
+        result = result && SynetMergedConvolution32fExportAutoTest(Param(1, 8, 40, 40, 1, 1, a0, 48, 3, 1, a1, 8, a2, t));
+
+        return result;
+    }
 }
@@ -25,6 +25,9 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffine.h"
+
 namespace Test
 {
     namespace
@@ -130,4 +133,455 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncWA
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+            FuncPtr func;
+            String desc;
+
+            FuncWA(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t channels, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << channels;
+                ss << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat ? "f" : "b");
+                ss << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear ? "-B" : "-N");
+                ss << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderReplicate ? "-R" : "-C");
+                ss << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border) const
+            {
+                void * context = NULL;
+                if (src.format == View::Float)
+                    context = func(src.width / channels, src.height, dst.width / channels, dst.height, channels, mat, flags, border);
+                else
+                    context = func(src.width, src.height, dst.width, dst.height, channels, mat, flags, border);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    SimdWarpAffineRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_WA(function) \
+    FuncWA(function, std::string(#function))
+
+    bool WarpAffineAutoTest(size_t channels, SimdWarpAffineFlags flags, size_t srcW, size_t srcH, size_t dstW, size_t dstH, FuncWA f1, FuncWA f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, flags);
+        f2.Update(channels, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View::Format format = View::Float;
+        if ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat)
+        {
+            srcW *= channels;
+            dstW *= channels;
+        }
+        else
+        {
+            switch (channels)
+            {
+            case 1: format = View::Gray8; break;
+            case 2: format = View::Uv16; break;
+            case 3: format = View::Bgr24; break;
+            case 4: format = View::Bgra32; break;
+            default:
+                assert(0);
+            }
+        }
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        if (format == View::Float)
+            FillRandom32f(src);
+        else
+            FillRandom(src);
+
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+
+        const float angle = 0.3f, scale = 0.9f;
+        const float mat[6] = { scale * ::cos(angle), -scale * ::sin(angle), float(dstW / 8), scale * ::sin(angle), scale * ::cos(angle), -float(dstH / 8) };
+        const uint8_t border[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, mat, flags, border));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, mat, flags, border));
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool WarpAffineAutoTest(const FuncWA & f1, const FuncWA & f2)
+    {
+        bool result = true;
+
+        for (int border = SimdWarpAffineBorderConstant; border <= SimdWarpAffineBorderReplicate; border += SimdWarpAffineBorderReplicate)
+        {
+            for (int interp = SimdWarpAffineInterpNearest; interp <= SimdWarpAffineInterpBilinear; interp += SimdWarpAffineInterpBilinear)
+            {
+                for (size_t channels = 1; channels <= 4; ++channels)
+                {
+                    SimdWarpAffineFlags byte = SimdWarpAffineFlags(SimdWarpAffineChannelByte | interp | border);
+                    result = result && WarpAffineAutoTest(channels, byte, W, H, W + O, H - O, f1, f2);
+                }
+                SimdWarpAffineFlags float1 = SimdWarpAffineFlags(SimdWarpAffineChannelFloat | interp | border);
+                result = result && WarpAffineAutoTest(1, float1, W, H, W + O, H - O, f1, f2);
+                result = result && WarpAffineAutoTest(4, float1, W, H, W + O, H - O, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpAffineAutoTest()
+    {
+        bool result = true;
+
+        result = result && WarpAffineAutoTest(FUNC_WA(Simd::Base::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WA(Simd::Sse41::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WA(Simd::Avx2::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WA(Simd::Avx512bw::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WA(Simd::Neon::WarpAffineInit), FUNC_WA(SimdWarpAffineInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncWP
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+            FuncPtr func;
+            String desc;
+
+            FuncWP(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t channels, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << channels;
+                ss << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat ? "f" : "b");
+                ss << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear ? "-B" : "-N");
+                ss << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderReplicate ? "-R" : "-C");
+                ss << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, const float * mat, SimdWarpAffineFlags flags, const uint8_t * border) const
+            {
+                void * context = NULL;
+                if (src.format == View::Float)
+                    context = func(src.width / channels, src.height, dst.width / channels, dst.height, channels, mat, flags, border);
+                else
+                    context = func(src.width, src.height, dst.width, dst.height, channels, mat, flags, border);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    SimdWarpPerspectiveRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_WP(function) \
+    FuncWP(function, std::string(#function))
+
+    bool WarpPerspectiveAutoTest(size_t channels, SimdWarpAffineFlags flags, size_t srcW, size_t srcH, size_t dstW, size_t dstH, FuncWP f1, FuncWP f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, flags);
+        f2.Update(channels, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View::Format format = View::Float;
+        if ((flags & SimdWarpAffineChannelMask) != SimdWarpAffineChannelFloat)
+        {
+            switch (channels)
+            {
+            case 1: format = View::Gray8; break;
+            case 2: format = View::Uv16; break;
+            case 3: format = View::Bgr24; break;
+            case 4: format = View::Bgra32; break;
+            default:
+                assert(0);
+            }
+        }
+
+        const float mat[9] = { 0.9f, 0.1f, float(dstW / 8), -0.05f, 1.1f, -float(dstH / 8), 0.2f / dstW, -0.1f / dstH, 1.0f };
+        const uint8_t border[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+        if (format == View::Float)
+        {
+            srcW *= channels;
+            dstW *= channels;
+        }
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        if (format == View::Float)
+            FillRandom32f(src);
+        else
+            FillRandom(src);
+
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, mat, flags, border));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, mat, flags, border));
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest(const FuncWP & f1, const FuncWP & f2)
+    {
+        bool result = true;
+
+        for (int border = SimdWarpAffineBorderConstant; border <= SimdWarpAffineBorderReplicate; border += SimdWarpAffineBorderReplicate)
+        {
+            for (int interp = SimdWarpAffineInterpNearest; interp <= SimdWarpAffineInterpBilinear; interp += SimdWarpAffineInterpBilinear)
+            {
+                for (size_t channels = 1; channels <= 4; ++channels)
+                {
+                    SimdWarpAffineFlags byte = SimdWarpAffineFlags(SimdWarpAffineChannelByte | interp | border);
+                    result = result && WarpPerspectiveAutoTest(channels, byte, W, H, W + O, H - O, f1, f2);
+                }
+                SimdWarpAffineFlags float1 = SimdWarpAffineFlags(SimdWarpAffineChannelFloat | interp | border);
+                result = result && WarpPerspectiveAutoTest(1, float1, W, H, W + O, H - O, f1, f2);
+                result = result && WarpPerspectiveAutoTest(4, float1, W, H, W + O, H - O, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest()
+    {
+        bool result = true;
+
+        result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Base::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Sse41::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Avx2::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Avx512bw::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Neon::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRM
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * map, size_t mapStride, SimdWarpAffineFlags flags, const uint8_t * border);
+
+            FuncPtr func;
+            String desc;
+
+            FuncRM(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t channels, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << channels;
+                ss << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat ? "f" : "b");
+                ss << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear ? "-B" : "-N");
+                ss << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderReplicate ? "-R" : "-C");
+                ss << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, const View & map, SimdWarpAffineFlags flags, const uint8_t * border) const
+            {
+                void * context = NULL;
+                if (src.format == View::Float)
+                    context = func(src.width / channels, src.height, dst.width / channels, dst.height, channels, (float*)map.data, map.stride, flags, border);
+                else
+                    context = func(src.width, src.height, dst.width, dst.height, channels, (float*)map.data, map.stride, flags, border);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    SimdRemapRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_RM(function) \
+    FuncRM(function, std::string(#function))
+
+    bool RemapAutoTest(size_t channels, SimdWarpAffineFlags flags, size_t srcW, size_t srcH, size_t dstW, size_t dstH, FuncRM f1, FuncRM f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, flags);
+        f2.Update(channels, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View::Format format = View::Float;
+        if ((flags & SimdWarpAffineChannelMask) != SimdWarpAffineChannelFloat)
+        {
+            switch (channels)
+            {
+            case 1: format = View::Gray8; break;
+            case 2: format = View::Uv16; break;
+            case 3: format = View::Bgr24; break;
+            case 4: format = View::Bgra32; break;
+            default:
+                assert(0);
+            }
+        }
+
+        View map(dstW * 2, dstH, View::Float, NULL, TEST_ALIGN(dstW));
+        for (size_t y = 0; y < dstH; ++y)
+        {
+            float * row = map.Row<float>(y);
+            for (size_t x = 0; x < dstW; ++x)
+            {
+                float nx = float(x) / dstW - 0.5f, ny = float(y) / dstH - 0.5f, k = 1.0f + 0.4f * (nx * nx + ny * ny);
+                row[2 * x + 0] = srcW * (0.5f + 1.1f * k * nx);
+                row[2 * x + 1] = srcH * (0.5f + 1.1f * k * ny);
+            }
+        }
+        const uint8_t border[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+        if (format == View::Float)
+        {
+            srcW *= channels;
+            dstW *= channels;
+        }
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        if (format == View::Float)
+            FillRandom32f(src);
+        else
+            FillRandom(src);
+
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, map, flags, border));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, map, flags, border));
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool RemapAutoTest(const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        for (int border = SimdWarpAffineBorderConstant; border <= SimdWarpAffineBorderReplicate; border += SimdWarpAffineBorderReplicate)
+        {
+            for (int interp = SimdWarpAffineInterpNearest; interp <= SimdWarpAffineInterpBilinear; interp += SimdWarpAffineInterpBilinear)
+            {
+                for (size_t channels = 1; channels <= 4; ++channels)
+                {
+                    SimdWarpAffineFlags byte = SimdWarpAffineFlags(SimdWarpAffineChannelByte | interp | border);
+                    result = result && RemapAutoTest(channels, byte, W, H, W + O, H - O, f1, f2);
+                }
+                SimdWarpAffineFlags float1 = SimdWarpAffineFlags(SimdWarpAffineChannelFloat | interp | border);
+                result = result && RemapAutoTest(1, float1, W, H, W + O, H - O, f1, f2);
+                result = result && RemapAutoTest(4, float1, W, H, W + O, H - O, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool RemapAutoTest()
+    {
+        bool result = true;
+
+        result = result && RemapAutoTest(FUNC_RM(Simd::Base::RemapInit), FUNC_RM(SimdRemapInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && RemapAutoTest(FUNC_RM(Simd::Sse41::RemapInit), FUNC_RM(SimdRemapInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx2::RemapInit), FUNC_RM(SimdRemapInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx512bw::RemapInit), FUNC_RM(SimdRemapInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && RemapAutoTest(FUNC_RM(Simd::Neon::RemapInit), FUNC_RM(SimdRemapInit));
+#endif 
+
+        return result;
+    }
 }
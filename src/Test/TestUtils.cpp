@@ -616,6 +616,8 @@ namespace Test
         case View::BayerGbrg: return "Bayer GBRG";
         case View::BayerRggb: return "Bayer RGGB";
         case View::BayerBggr: return "Bayer BGGR";
+        case View::Yuyv16:    return "16-bit YUYV";
+        case View::Uyvy16:    return "16-bit UYVY";
         default: assert(0); return "";
         }
     }
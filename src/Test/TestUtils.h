@@ -146,6 +146,32 @@ namespace Test
         case View::Hsv24:     return "Hsv24";
         case View::Hsl24:     return "Hsl24";
         case View::Rgb24:     return "Rgb24";
+        case View::Yuyv16:    return "Yuyv16";
+        case View::Uyvy16:    return "Uyvy16";
+        default: assert(0);  return "";
+        }
+    }
+
+    template <> SIMD_INLINE String ToString<SimdYuvType>(const SimdYuvType & value)
+    {
+        switch (value)
+        {
+        case SimdYuvBt601:    return "Bt601";
+        case SimdYuvBt709:    return "Bt709";
+        case SimdYuvBt2020:   return "Bt2020";
+        case SimdYuvTrect871: return "Trect871";
+        case SimdYuvBt709Full: return "Bt709Full";
+        case SimdYuvBt2020Full: return "Bt2020Full";
+        default: assert(0);  return "";
+        }
+    }
+
+    template <> SIMD_INLINE String ToString<SimdBayerDemosaicType>(const SimdBayerDemosaicType & value)
+    {
+        switch (value)
+        {
+        case SimdBayerDemosaicBilinear: return "Bilinear";
+        case SimdBayerDemosaicMalvar:   return "Malvar";
         default: assert(0);  return "";
         }
     }
@@ -0,0 +1,311 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncP010
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncP010(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdYuvType type)
+            {
+                yuvType = type;
+                description = description + "[" + ToString(yuvType) + "]";
+            }
+
+            void Call(const View & y, const View & uv, const View &, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+            }
+        };
+
+        struct FuncP010a
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncP010a(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdYuvType type)
+            {
+                yuvType = type;
+                description = description + "[" + ToString(yuvType) + "]";
+            }
+
+            void Call(const View & y, const View & uv, const View &, View & bgra) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF, yuvType);
+            }
+        };
+
+        struct FuncYuv10
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncYuv10(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdYuvType type)
+            {
+                yuvType = type;
+                description = description + "[" + ToString(yuvType) + "]";
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+            }
+        };
+
+        struct FuncYuv10a
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncYuv10a(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdYuvType type)
+            {
+                yuvType = type;
+                description = description + "[" + ToString(yuvType) + "]";
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & bgra) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF, yuvType);
+            }
+        };
+    }
+
+#define FUNC_P010(function) FuncP010(function, #function)
+#define FUNC_P010A(function) FuncP010a(function, #function)
+#define FUNC_YUV10(function) FuncYuv10(function, #function)
+#define FUNC_YUV10A(function) FuncYuv10a(function, #function)
+
+    static void FillRandom10(View & view, bool p010)
+    {
+        FillRandom(view);
+        for (size_t row = 0; row < view.height; ++row)
+        {
+            uint16_t * data = (uint16_t*)(view.data + row * view.stride);
+            for (size_t col = 0, size = view.width * View::PixelSize(view.format) / 2; col < size; ++col)
+                data[col] = p010 ? data[col] & 0xFFC0 : data[col] & 0x03FF;
+        }
+    }
+
+    template<class Func> bool Yuv10ToAnyAutoTest(int width, int height, bool p010, View::Format dstType, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom10(y, p010);
+        View uv, u, v;
+        if (p010)
+        {
+            uv.Recreate(width / 2, height / 2, View::Int32, NULL, TEST_ALIGN(width));
+            FillRandom10(uv, p010);
+        }
+        else
+        {
+            u.Recreate(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+            FillRandom10(u, p010);
+            v.Recreate(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+            FillRandom10(v, p010);
+        }
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, p010 ? uv : u, v, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, p010 ? uv : u, v, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    template<class Func> bool Yuv10ToAnyAutoTest(bool p010, View::Format dstType, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        for (int type = (int)SimdYuvBt601; type <= (int)SimdYuvBt2020Full && result; ++type)
+        {
+            Func f1t = f1, f2t = f2;
+            f1t.Update((SimdYuvType)type);
+            f2t.Update((SimdYuvType)type);
+
+            result = result && Yuv10ToAnyAutoTest(W, H, p010, dstType, f1t, f2t);
+            result = result && Yuv10ToAnyAutoTest(W + O * 2, H - O * 2, p010, dstType, f1t, f2t);
+            result = result && Yuv10ToAnyAutoTest(W - O * 2, H + O * 2, p010, dstType, f1t, f2t);
+        }
+
+        return result;
+    }
+
+    bool P010ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv10ToAnyAutoTest(true, View::Bgr24, FUNC_P010(Simd::Base::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && Yuv10ToAnyAutoTest(true, View::Bgr24, FUNC_P010(Simd::Ssse3::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuv10ToAnyAutoTest(true, View::Bgr24, FUNC_P010(Simd::Avx2::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv10ToAnyAutoTest(true, View::Bgr24, FUNC_P010(Simd::Avx512bw::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuv10ToAnyAutoTest(true, View::Bgr24, FUNC_P010(Simd::Neon::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool P010ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv10ToAnyAutoTest(true, View::Bgra32, FUNC_P010A(Simd::Base::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Yuv10ToAnyAutoTest(true, View::Bgra32, FUNC_P010A(Simd::Sse2::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuv10ToAnyAutoTest(true, View::Bgra32, FUNC_P010A(Simd::Avx2::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv10ToAnyAutoTest(true, View::Bgra32, FUNC_P010A(Simd::Avx512bw::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuv10ToAnyAutoTest(true, View::Bgra32, FUNC_P010A(Simd::Neon::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420p10ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv10ToAnyAutoTest(false, View::Bgr24, FUNC_YUV10(Simd::Base::Yuv420p10ToBgr), FUNC_YUV10(SimdYuv420p10ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && Yuv10ToAnyAutoTest(false, View::Bgr24, FUNC_YUV10(Simd::Ssse3::Yuv420p10ToBgr), FUNC_YUV10(SimdYuv420p10ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuv10ToAnyAutoTest(false, View::Bgr24, FUNC_YUV10(Simd::Avx2::Yuv420p10ToBgr), FUNC_YUV10(SimdYuv420p10ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv10ToAnyAutoTest(false, View::Bgr24, FUNC_YUV10(Simd::Avx512bw::Yuv420p10ToBgr), FUNC_YUV10(SimdYuv420p10ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuv10ToAnyAutoTest(false, View::Bgr24, FUNC_YUV10(Simd::Neon::Yuv420p10ToBgr), FUNC_YUV10(SimdYuv420p10ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420p10ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv10ToAnyAutoTest(false, View::Bgra32, FUNC_YUV10A(Simd::Base::Yuv420p10ToBgra), FUNC_YUV10A(SimdYuv420p10ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Yuv10ToAnyAutoTest(false, View::Bgra32, FUNC_YUV10A(Simd::Sse2::Yuv420p10ToBgra), FUNC_YUV10A(SimdYuv420p10ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuv10ToAnyAutoTest(false, View::Bgra32, FUNC_YUV10A(Simd::Avx2::Yuv420p10ToBgra), FUNC_YUV10A(SimdYuv420p10ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv10ToAnyAutoTest(false, View::Bgra32, FUNC_YUV10A(Simd::Avx512bw::Yuv420p10ToBgra), FUNC_YUV10A(SimdYuv420p10ToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuv10ToAnyAutoTest(false, View::Bgra32, FUNC_YUV10A(Simd::Neon::Yuv420p10ToBgra), FUNC_YUV10A(SimdYuv420p10ToBgra));
+#endif 
+
+        return result;
+    }
+}
@@ -196,6 +196,26 @@ namespace Test
 
         result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC(Simd::Base::Yuv444pToHsl), FUNC(SimdYuv444pToHsl));
 
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC(Simd::Sse41::Yuv444pToHsl), FUNC(SimdYuv444pToHsl));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC(Simd::Avx2::Yuv444pToHsl), FUNC(SimdYuv444pToHsl));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC(Simd::Avx512bw::Yuv444pToHsl), FUNC(SimdYuv444pToHsl));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsl24, FUNC(Simd::Neon::Yuv444pToHsl), FUNC(SimdYuv444pToHsl));
+#endif
+
         return result;
     }
 
@@ -205,6 +225,26 @@ namespace Test
 
         result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC(Simd::Base::Yuv444pToHsv), FUNC(SimdYuv444pToHsv));
 
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC(Simd::Sse41::Yuv444pToHsv), FUNC(SimdYuv444pToHsv));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC(Simd::Avx2::Yuv444pToHsv), FUNC(SimdYuv444pToHsv));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC(Simd::Avx512bw::Yuv444pToHsv), FUNC(SimdYuv444pToHsv));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && YuvToAnyAutoTest(1, 1, View::Hsv24, FUNC(Simd::Neon::Yuv444pToHsv), FUNC(SimdYuv444pToHsv));
+#endif
+
         return result;
     }
 
@@ -371,6 +411,313 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncV2
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncV2(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdYuvType type)
+            {
+                yuvType = type;
+                description = description + "[" + ToString(yuvType) + "]";
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_V2(function) FuncV2(function, #function)
+
+    bool YuvToAnyV2AutoTest(int width, int height, int dx, int dy, View::Format dstType, const FuncV2 & f1, const FuncV2 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / dx;
+        const int uvHeight = height / dy;
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(u);
+        View v(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(v);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 255);
+
+        return result;
+    }
+
+    bool YuvToAnyV2AutoTest(int dx, int dy, View::Format dstType, const FuncV2 & f1, const FuncV2 & f2)
+    {
+        bool result = true;
+
+        for (int type = (int)SimdYuvBt601; type <= (int)SimdYuvBt2020Full && result; ++type)
+        {
+            FuncV2 f1t = f1, f2t = f2;
+            f1t.Update((SimdYuvType)type);
+            f2t.Update((SimdYuvType)type);
+
+            result = result && YuvToAnyV2AutoTest(W, H, dx, dy, dstType, f1t, f2t);
+            result = result && YuvToAnyV2AutoTest(W + O * dx, H - O * dy, dx, dy, dstType, f1t, f2t);
+            result = result && YuvToAnyV2AutoTest(W - O * dx, H + O * dy, dx, dy, dstType, f1t, f2t);
+        }
+
+        return result;
+    }
+
+    bool Yuv444pToBgrV2ReferenceTest(SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdYuv444pToBgrV2[" << ToString(yuvType) << "] with reference.");
+
+        double kr = 0.299, kb = 0.114;
+        bool full = false;
+        switch (yuvType)
+        {
+        case SimdYuvBt601: break;
+        case SimdYuvBt709: kr = 0.2126, kb = 0.0722; break;
+        case SimdYuvBt2020: kr = 0.2627, kb = 0.0593; break;
+        case SimdYuvTrect871: full = true; break;
+        case SimdYuvBt709Full: kr = 0.2126, kb = 0.0722, full = true; break;
+        case SimdYuvBt2020Full: kr = 0.2627, kb = 0.0593, full = true; break;
+        default: assert(0);
+        }
+        double kg = 1.0 - kr - kb;
+
+        View y(W, H, View::Gray8), u(W, H, View::Gray8), v(W, H, View::Gray8), bgr(W, H, View::Bgr24);
+        FillRandom(y);
+        FillRandom(u);
+        FillRandom(v);
+
+        SimdYuv444pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, W, H, bgr.data, bgr.stride, yuvType);
+
+        int errors = 0;
+        for (size_t row = 0; row < H && errors < 8; ++row)
+        {
+            for (size_t col = 0; col < W && errors < 8; ++col)
+            {
+                double _y = y.At<uint8_t>(col, row), _u = u.At<uint8_t>(col, row) - 128.0, _v = v.At<uint8_t>(col, row) - 128.0;
+                if (!full)
+                    _y = (_y - 16.0) * 255.0 / 219.0, _u *= 255.0 / 224.0, _v *= 255.0 / 224.0;
+                double ref[3] = { _y + 2.0 * (1.0 - kb) * _u, _y - (2.0 * kb * (1.0 - kb) * _u + 2.0 * kr * (1.0 - kr) * _v) / kg, _y + 2.0 * (1.0 - kr) * _v };
+                const uint8_t * dst = bgr.data + row * bgr.stride + col * 3;
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    int expected = Simd::RestrictRange((int)::floor(ref[c] + 0.5), 0, 255);
+                    if (Simd::Abs(expected - (int)dst[c]) > 1)
+                    {
+                        TEST_LOG_SS(Error, "Error at [" << col << ", " << row << "], channel " << c << ": " << (int)dst[c] << " != " << expected << " !");
+                        errors++;
+                    }
+                }
+            }
+        }
+        result = result && errors == 0;
+
+        return result;
+    }
+
+    bool Yuv444pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        for (int type = (int)SimdYuvBt601; type <= (int)SimdYuvBt2020Full && result; ++type)
+            result = result && Yuv444pToBgrV2ReferenceTest((SimdYuvType)type);
+
+        result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Base::Yuv444pToBgrV2), FUNC_V2(SimdYuv444pToBgrV2));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Ssse3::Yuv444pToBgrV2), FUNC_V2(SimdYuv444pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Avx2::Yuv444pToBgrV2), FUNC_V2(SimdYuv444pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Avx512bw::Yuv444pToBgrV2), FUNC_V2(SimdYuv444pToBgrV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Bgr24, FUNC_V2(Simd::Neon::Yuv444pToBgrV2), FUNC_V2(SimdYuv444pToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv422pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Base::Yuv422pToBgrV2), FUNC_V2(SimdYuv422pToBgrV2));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Ssse3::Yuv422pToBgrV2), FUNC_V2(SimdYuv422pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Avx2::Yuv422pToBgrV2), FUNC_V2(SimdYuv422pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Avx512bw::Yuv422pToBgrV2), FUNC_V2(SimdYuv422pToBgrV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Bgr24, FUNC_V2(Simd::Neon::Yuv422pToBgrV2), FUNC_V2(SimdYuv422pToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Base::Yuv420pToBgrV2), FUNC_V2(SimdYuv420pToBgrV2));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Ssse3::Yuv420pToBgrV2), FUNC_V2(SimdYuv420pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Avx2::Yuv420pToBgrV2), FUNC_V2(SimdYuv420pToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Avx512bw::Yuv420pToBgrV2), FUNC_V2(SimdYuv420pToBgrV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Bgr24, FUNC_V2(Simd::Neon::Yuv420pToBgrV2), FUNC_V2(SimdYuv420pToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv444pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_V2(Simd::Base::Yuv444pToRgbV2), FUNC_V2(SimdYuv444pToRgbV2));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_V2(Simd::Ssse3::Yuv444pToRgbV2), FUNC_V2(SimdYuv444pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_V2(Simd::Avx2::Yuv444pToRgbV2), FUNC_V2(SimdYuv444pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_V2(Simd::Avx512bw::Yuv444pToRgbV2), FUNC_V2(SimdYuv444pToRgbV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, View::Rgb24, FUNC_V2(Simd::Neon::Yuv444pToRgbV2), FUNC_V2(SimdYuv444pToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv422pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_V2(Simd::Base::Yuv422pToRgbV2), FUNC_V2(SimdYuv422pToRgbV2));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_V2(Simd::Ssse3::Yuv422pToRgbV2), FUNC_V2(SimdYuv422pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_V2(Simd::Avx2::Yuv422pToRgbV2), FUNC_V2(SimdYuv422pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_V2(Simd::Avx512bw::Yuv422pToRgbV2), FUNC_V2(SimdYuv422pToRgbV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, View::Rgb24, FUNC_V2(Simd::Neon::Yuv422pToRgbV2), FUNC_V2(SimdYuv422pToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_V2(Simd::Base::Yuv420pToRgbV2), FUNC_V2(SimdYuv420pToRgbV2));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_V2(Simd::Ssse3::Yuv420pToRgbV2), FUNC_V2(SimdYuv420pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_V2(Simd::Avx2::Yuv420pToRgbV2), FUNC_V2(SimdYuv420pToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_V2(Simd::Avx512bw::Yuv420pToRgbV2), FUNC_V2(SimdYuv420pToRgbV2));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, View::Rgb24, FUNC_V2(Simd::Neon::Yuv420pToRgbV2), FUNC_V2(SimdYuv420pToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool YuvToAnyDataTest(bool create, int width, int height, int dx, int dy, View::Format dstType, const Func & f, int maxDifference = 0)
     {
         bool result = true;
@@ -283,6 +283,170 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncYuvV2
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncYuvV2(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdYuvType type)
+            {
+                yuvType = type;
+                description = description + "[" + ToString(yuvType) + "]";
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & bgra) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF, yuvType);
+            }
+        };
+    }
+
+#define FUNC_YUV_V2(function) FuncYuvV2(function, #function)
+
+    bool YuvToBgraV2AutoTest(int width, int height, const FuncYuvV2 & f1, const FuncYuvV2 & f2, int dx, int dy)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / dx;
+        const int uvHeight = height / dy;
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(u);
+        View v(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(v);
+
+        View bgra1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View bgra2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, bgra1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, bgra2));
+
+        result = result && Compare(bgra1, bgra2, 0, true, 64);
+
+        return result;
+    }
+
+    bool YuvToBgraV2AutoTest(const FuncYuvV2 & f1, const FuncYuvV2 & f2, int dx, int dy)
+    {
+        bool result = true;
+
+        for (int type = (int)SimdYuvBt601; type <= (int)SimdYuvBt2020Full && result; ++type)
+        {
+            FuncYuvV2 f1t = f1, f2t = f2;
+            f1t.Update((SimdYuvType)type);
+            f2t.Update((SimdYuvType)type);
+
+            result = result && YuvToBgraV2AutoTest(W, H, f1t, f2t, dx, dy);
+            result = result && YuvToBgraV2AutoTest(W + O * dx, H - O * dy, f1t, f2t, dx, dy);
+            result = result && YuvToBgraV2AutoTest(W - O * dx, H + O * dy, f1t, f2t, dx, dy);
+        }
+
+        return result;
+    }
+
+    bool Yuv444pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Base::Yuv444pToBgraV2), FUNC_YUV_V2(SimdYuv444pToBgraV2), 1, 1);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Sse2::Yuv444pToBgraV2), FUNC_YUV_V2(SimdYuv444pToBgraV2), 1, 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Avx2::Yuv444pToBgraV2), FUNC_YUV_V2(SimdYuv444pToBgraV2), 1, 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Avx512bw::Yuv444pToBgraV2), FUNC_YUV_V2(SimdYuv444pToBgraV2), 1, 1);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Neon::Yuv444pToBgraV2), FUNC_YUV_V2(SimdYuv444pToBgraV2), 1, 1);
+#endif 
+
+        return result;
+    }
+
+    bool Yuv422pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Base::Yuv422pToBgraV2), FUNC_YUV_V2(SimdYuv422pToBgraV2), 2, 1);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Sse2::Yuv422pToBgraV2), FUNC_YUV_V2(SimdYuv422pToBgraV2), 2, 1);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Avx2::Yuv422pToBgraV2), FUNC_YUV_V2(SimdYuv422pToBgraV2), 2, 1);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Avx512bw::Yuv422pToBgraV2), FUNC_YUV_V2(SimdYuv422pToBgraV2), 2, 1);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Neon::Yuv422pToBgraV2), FUNC_YUV_V2(SimdYuv422pToBgraV2), 2, 1);
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Base::Yuv420pToBgraV2), FUNC_YUV_V2(SimdYuv420pToBgraV2), 2, 2);
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Sse2::Yuv420pToBgraV2), FUNC_YUV_V2(SimdYuv420pToBgraV2), 2, 2);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Avx2::Yuv420pToBgraV2), FUNC_YUV_V2(SimdYuv420pToBgraV2), 2, 2);
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Avx512bw::Yuv420pToBgraV2), FUNC_YUV_V2(SimdYuv420pToBgraV2), 2, 2);
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToBgraV2AutoTest(FUNC_YUV_V2(Simd::Neon::Yuv420pToBgraV2), FUNC_YUV_V2(SimdYuv420pToBgraV2), 2, 2);
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool YuvToBgraDataTest(bool create, int width, int height, const FuncYuv & f, int dx, int dy)
     {
         bool result = true;
@@ -0,0 +1,329 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncYuyv
+        {
+            typedef void(*FuncPtr)(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncYuyv(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & yuyv, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, dst.data, dst.stride);
+            }
+        };
+
+        struct FuncYuyva
+        {
+            typedef void(*FuncPtr)(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+            FuncPtr func;
+            String description;
+
+            FuncYuyva(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & yuyv, View & bgra) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, bgra.data, bgra.stride, 0xFF);
+            }
+        };
+
+        struct FuncYuyvYuv
+        {
+            typedef void(*FuncPtr)(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height,
+                uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncYuyvYuv(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & yuyv, View & y, View & u, View & v) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+            }
+        };
+    }
+
+#define FUNC_YUYV(function) FuncYuyv(function, #function)
+#define FUNC_YUYVA(function) FuncYuyva(function, #function)
+#define FUNC_YUYVYUV(function) FuncYuyvYuv(function, #function)
+
+    template<class Func> bool Yuyv422ToAnyAutoTest(int width, int height, View::Format srcType, View::Format dstType, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    template<class Func> bool Yuyv422ToAnyAutoTest(View::Format srcType, View::Format dstType, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToAnyAutoTest(W, H, srcType, dstType, f1, f2);
+        result = result && Yuyv422ToAnyAutoTest(W + O * 2, H - O * 2, srcType, dstType, f1, f2);
+        result = result && Yuyv422ToAnyAutoTest(W - O * 2, H + O * 2, srcType, dstType, f1, f2);
+
+        return result;
+    }
+
+    bool Yuyv422ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_YUYV(Simd::Base::Yuyv422ToBgr), FUNC_YUYV(SimdYuyv422ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_YUYV(Simd::Ssse3::Yuyv422ToBgr), FUNC_YUYV(SimdYuyv422ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_YUYV(Simd::Avx2::Yuyv422ToBgr), FUNC_YUYV(SimdYuyv422ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_YUYV(Simd::Avx512bw::Yuyv422ToBgr), FUNC_YUYV(SimdYuyv422ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgr24, FUNC_YUYV(Simd::Neon::Yuyv422ToBgr), FUNC_YUYV(SimdYuyv422ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Uyvy422ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_YUYV(Simd::Base::Uyvy422ToBgr), FUNC_YUYV(SimdUyvy422ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_YUYV(Simd::Ssse3::Uyvy422ToBgr), FUNC_YUYV(SimdUyvy422ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_YUYV(Simd::Avx2::Uyvy422ToBgr), FUNC_YUYV(SimdUyvy422ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_YUYV(Simd::Avx512bw::Uyvy422ToBgr), FUNC_YUYV(SimdUyvy422ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgr24, FUNC_YUYV(Simd::Neon::Uyvy422ToBgr), FUNC_YUYV(SimdUyvy422ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Yuyv422ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_YUYVA(Simd::Base::Yuyv422ToBgra), FUNC_YUYVA(SimdYuyv422ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_YUYVA(Simd::Sse2::Yuyv422ToBgra), FUNC_YUYVA(SimdYuyv422ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_YUYVA(Simd::Avx2::Yuyv422ToBgra), FUNC_YUYVA(SimdYuyv422ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_YUYVA(Simd::Avx512bw::Yuyv422ToBgra), FUNC_YUYVA(SimdYuyv422ToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Bgra32, FUNC_YUYVA(Simd::Neon::Yuyv422ToBgra), FUNC_YUYVA(SimdYuyv422ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Uyvy422ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_YUYVA(Simd::Base::Uyvy422ToBgra), FUNC_YUYVA(SimdUyvy422ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_YUYVA(Simd::Sse2::Uyvy422ToBgra), FUNC_YUYVA(SimdUyvy422ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_YUYVA(Simd::Avx2::Uyvy422ToBgra), FUNC_YUYVA(SimdUyvy422ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_YUYVA(Simd::Avx512bw::Uyvy422ToBgra), FUNC_YUYVA(SimdUyvy422ToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Uyvy16, View::Bgra32, FUNC_YUYVA(Simd::Neon::Uyvy422ToBgra), FUNC_YUYVA(SimdUyvy422ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Yuyv422ToGrayAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Gray8, FUNC_YUYV(Simd::Base::Yuyv422ToGray), FUNC_YUYV(SimdYuyv422ToGray));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Gray8, FUNC_YUYV(Simd::Sse2::Yuyv422ToGray), FUNC_YUYV(SimdYuyv422ToGray));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Gray8, FUNC_YUYV(Simd::Avx2::Yuyv422ToGray), FUNC_YUYV(SimdYuyv422ToGray));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Gray8, FUNC_YUYV(Simd::Avx512bw::Yuyv422ToGray), FUNC_YUYV(SimdYuyv422ToGray));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuyv422ToAnyAutoTest(View::Yuyv16, View::Gray8, FUNC_YUYV(Simd::Neon::Yuyv422ToGray), FUNC_YUYV(SimdYuyv422ToGray));
+#endif 
+
+        return result;
+    }
+
+    bool Yuyv422ToYuv420pAutoTest(int width, int height, const FuncYuyvYuv & f1, const FuncYuyvYuv & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View yuyv(width, height, View::Yuyv16, NULL, TEST_ALIGN(width));
+        FillRandom(yuyv);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View v1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View v2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(yuyv, y1, u1, v1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(yuyv, y2, u2, v2));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(u1, u2, 0, true, 64, 0, "u");
+        result = result && Compare(v1, v2, 0, true, 64, 0, "v");
+
+        return result;
+    }
+
+    bool Yuyv422ToYuv420pAutoTest(const FuncYuyvYuv & f1, const FuncYuyvYuv & f2)
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToYuv420pAutoTest(W, H, f1, f2);
+        result = result && Yuyv422ToYuv420pAutoTest(W + O * 2, H - O * 2, f1, f2);
+        result = result && Yuyv422ToYuv420pAutoTest(W - O * 2, H + O * 2, f1, f2);
+
+        return result;
+    }
+
+    bool Yuyv422ToYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToYuv420pAutoTest(FUNC_YUYVYUV(Simd::Base::Yuyv422ToYuv420p), FUNC_YUYVYUV(SimdYuyv422ToYuv420p));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Yuyv422ToYuv420pAutoTest(FUNC_YUYVYUV(Simd::Sse2::Yuyv422ToYuv420p), FUNC_YUYVYUV(SimdYuyv422ToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuyv422ToYuv420pAutoTest(FUNC_YUYVYUV(Simd::Avx2::Yuyv422ToYuv420p), FUNC_YUYVYUV(SimdYuyv422ToYuv420p));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuyv422ToYuv420pAutoTest(FUNC_YUYVYUV(Simd::Avx512bw::Yuyv422ToYuv420p), FUNC_YUYVYUV(SimdYuyv422ToYuv420p));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Yuyv422ToYuv420pAutoTest(FUNC_YUYVYUV(Simd::Neon::Yuyv422ToYuv420p), FUNC_YUYVYUV(SimdYuyv422ToYuv420p));
+#endif 
+
+        return result;
+    }
+}